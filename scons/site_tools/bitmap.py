@@ -43,7 +43,7 @@ namespace bitmap
 		${width}, ${height},
 		${array}
 	};
-}
+${source_rle}}
 
 """
 
@@ -64,12 +64,64 @@ namespace bitmap
 	 * - Height : ${height}
 	 */
 	EXTERN_FLASH_STORAGE(uint8_t ${name}[]);
-}
+${header_rle}}
 
 #endif // ${include_guard}
 
 """
 
+# Only emitted if the compressed data is smaller than the uncompressed one
+template_source_rle = """	
+	FLASH_STORAGE(uint8_t ${name}_rle[]) =
+	{
+		${width}, ${height},
+		${array_rle}
+	};
+"""
+
+template_header_rle = """	
+	/**
+	 * \\brief	Generated bitmap, PackBits compressed
+	 * 
+	 * Draw with xpcc::GraphicDisplay::drawCompressedImage().
+	 * 
+	 * - Size   : ${size_rle} bytes (uncompressed ${size} bytes)
+	 */
+	EXTERN_FLASH_STORAGE(uint8_t ${name}_rle[]);
+"""
+
+# -----------------------------------------------------------------------------
+def packbits(data):
+	""" PackBits compression
+	
+	A header byte n < 128 is followed by n + 1 literal bytes, a header
+	byte n > 128 by a single byte which is repeated 257 - n times.
+	"""
+	output = []
+	literal = []
+	i = 0
+	while i < len(data):
+		run = 1
+		while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+			run += 1
+		
+		if run >= 3:
+			if literal:
+				output += [len(literal) - 1] + literal
+				literal = []
+			output += [257 - run, data[i]]
+			i += run
+		else:
+			literal.append(data[i])
+			i += 1
+			if len(literal) == 128:
+				output += [len(literal) - 1] + literal
+				literal = []
+	
+	if literal:
+		output += [len(literal) - 1] + literal
+	return output
+
 # -----------------------------------------------------------------------------
 def bitmap_action(target, source, env):
 	filename = str(source[0])
@@ -115,6 +167,12 @@ def bitmap_action(target, source, env):
 			line.append("0x%02x," % data[y][x])
 		array.append(" ".join(line))
 	
+	# compressed data, the page rows are stored one after another
+	compressed = packbits(sum(data, []))
+	array_rle = []
+	for i in range(0, len(compressed), 16):
+		array_rle.append(" ".join(["0x%02x," % c for c in compressed[i:i + 16]]))
+	
 	basename = os.path.splitext(os.path.basename(str(target[0])))[0]
 	substitutions = {
 		'name': basename,
@@ -122,9 +180,21 @@ def bitmap_action(target, source, env):
 		'width': width,
 		'height': height,
 		'array': "\n\t\t".join(array),
+		'array_rle': "\n\t\t".join(array_rle),
+		'size': 2 + width * rows,
+		'size_rle': 2 + len(compressed),
 		'include_guard': "BITMAP__" + basename.upper().replace(" ", "_") + "_HPP"
 	}
 	
+	# PackBits adds a header byte per literal run, images without longer
+	# runs of equal bytes get bigger. No compressed variant for them.
+	if len(compressed) < width * rows:
+		substitutions['source_rle'] = string.Template(template_source_rle).safe_substitute(substitutions)
+		substitutions['header_rle'] = string.Template(template_header_rle).safe_substitute(substitutions)
+	else:
+		substitutions['source_rle'] = ""
+		substitutions['header_rle'] = ""
+	
 	output = string.Template(template_source).safe_substitute(substitutions)
 	open(target[0].path, 'w').write(output)
 		
@@ -41,8 +41,13 @@ class FunctionScanner:
 	# find any function 'void test*();'
 	functionFilter = re.compile(r"void\s+(test[A-Z]\w*)\s*\([\svoid]*\)\s*;")
 	
-	def __init__(self, filename):
+	# find any function 'void benchmark*(unittest::BenchmarkState& state);'
+	benchmarkFilter = re.compile(r"void\s+(benchmark[A-Z]\w*)\s*\(\s*(?:unittest::)?BenchmarkState\s*&\s*\w*\s*\)\s*;")
+	
+	def __init__(self, filename, functionFilter=None):
 		self.text = open(filename).read()
+		if functionFilter is not None:
+			self.functionFilter = functionFilter
 	
 	def getFunctions(self):
 		self._stripCommentsAndStrings()
@@ -163,6 +168,57 @@ def unittest_emitter(target, source, env):
 			header.append(file)
 	return target, header
 
+# -----------------------------------------------------------------------------
+def benchmark_action(target, source, env):
+	if not env.has_key('template'):
+		raise SCons.Errors.UserError, "Use 'BenchmarkRunner(..., template = ...)'"
+	
+	includes = []
+	benchmarks = []
+	for file in source:
+		# crc_benchmark.hpp -> crc_benchmark -> CrcBenchmark
+		basename = os.path.splitext(file.name)[0]
+		class_name = generateClassName(basename)
+		instance_name = class_name[0].lower() + class_name[1:]
+		
+		scanner = FunctionScanner(file.abspath, FunctionScanner.benchmarkFilter)
+		
+		includes.append('#include "%s"' % file.abspath)
+		
+		str = """\
+	controller.nextBenchmark("%s");
+	{
+		%s %s;
+		""" % (basename, class_name, instance_name)
+		
+		for function_name in scanner.getFunctions():
+			str += """
+		controller.run(%(instance)s, &%(class)s::%(function)s, "%(function)s");""" % \
+					{ 'instance': instance_name,
+					  'class': class_name,
+					  'function': function_name }
+		
+		str += "\n\t}"
+		benchmarks.append(str)
+	
+	substitutions = {
+		'includes': '\n'.join(includes),
+		'benchmarks': '\n'.join(benchmarks),
+	}
+	
+	input = open(os.path.abspath(env['template']), 'r').read()
+	output = string.Template(input).safe_substitute(substitutions)
+	open(target[0].abspath, 'w').write(output)
+	
+	return 0
+
+def benchmark_emitter(target, source, env):
+	header = []
+	for file in source:
+		if file.name.endswith('_benchmark.hpp'):
+			header.append(file)
+	return target, header
+
 # -----------------------------------------------------------------------------
 def generate(env, **kw):
 	env.Append(BUILDERS = {
@@ -170,7 +226,12 @@ def generate(env, **kw):
 				action = SCons.Action.Action(unittest_action, "Generate runner file: $TARGET"),
 				suffix = '.cpp',
 				emitter = unittest_emitter,
-				target_factory = env.fs.File)
+				target_factory = env.fs.File),
+		'BenchmarkRunner': Builder(
+				action = SCons.Action.Action(benchmark_action, "Generate benchmark runner file: $TARGET"),
+				suffix = '.cpp',
+				emitter = benchmark_emitter,
+				target_factory = env.fs.File),
 	})
 
 def exists(env):
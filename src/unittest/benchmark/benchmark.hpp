@@ -0,0 +1,128 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	UNITTEST__BENCHMARK_HPP
+#define	UNITTEST__BENCHMARK_HPP
+
+#include "state.hpp"
+
+/**
+ * \ingroup		unittest
+ * \defgroup	benchmark	Benchmarks
+ * \brief		Measure the execution time of small pieces of code
+ * 
+ * Benchmarks are written like unit tests. They are placed in the
+ * \c test folders in files named \c *_benchmark.hpp and \c *_benchmark.cpp
+ * and derive from unittest::Benchmark. Every method with the signature
+ * <tt>void benchmarkXxx(unittest::BenchmarkState& state)</tt> is found
+ * by the scons tool, which then generates a runner for all of them.
+ * 
+ * \code
+ * class CrcBenchmark : public unittest::Benchmark
+ * {
+ * public:
+ *     void
+ *     benchmarkCrc8(unittest::BenchmarkState& state);
+ * };
+ * 
+ * void
+ * CrcBenchmark::benchmarkCrc8(unittest::BenchmarkState& state)
+ * {
+ *     uint8_t crc = 0;
+ *     // setup code before the loop is not measured
+ *     while (state.keepRunning()) {
+ *         crc = xpcc::Crc8Dallas::update(crc, data, sizeof(data));
+ *     }
+ *     unittest::doNotOptimize(crc);
+ * }
+ * \endcode
+ * 
+ * The number of iterations is calibrated automatically until a run
+ * takes longer than the minimum measurement time. The results (time,
+ * processor cycles and heap allocations per iteration) are printed and
+ * can optionally be written to a JSON file, which
+ * \c tools/benchmark_compare.py uses to find regressions between two
+ * builds.
+ * 
+ * Benchmarks are only available for the hosted target:
+ * \code
+ * $ cd src
+ * $ scons target=benchmark [output=results.json]
+ * \endcode
+ */
+
+namespace unittest
+{
+	/**
+	 * \brief	Base class for every benchmark
+	 * 
+	 * setUp() and tearDown() are called around every run of a benchmark
+	 * method, they are not part of the measurement.
+	 * 
+	 * \ingroup	benchmark
+	 */
+	class Benchmark
+	{
+	public:
+		virtual
+		~Benchmark();
+		
+		virtual void
+		setUp();
+		
+		virtual void
+		tearDown();
+	};
+	
+	/**
+	 * \brief	Prevent the compiler from optimizing away a value
+	 * 
+	 * \ingroup	benchmark
+	 */
+	template <typename T>
+	inline void
+	doNotOptimize(const T& value)
+	{
+		asm volatile("" : : "r,m" (value) : "memory");
+	}
+	
+	/**
+	 * \brief	Force the compiler to write all pending values to memory
+	 * 
+	 * \ingroup	benchmark
+	 */
+	inline void
+	clobberMemory()
+	{
+		asm volatile("" : : : "memory");
+	}
+}
+
+#endif	// UNITTEST__BENCHMARK_HPP
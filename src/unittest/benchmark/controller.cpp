@@ -0,0 +1,84 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include "controller.hpp"
+
+namespace
+{
+	const uint32_t maximumIterations = 1000000000UL;
+}
+
+uint32_t unittest::BenchmarkController::allocationCounter = 0;
+
+// ----------------------------------------------------------------------------
+unittest::BenchmarkController::BenchmarkController(
+		BenchmarkReporter& reporter, uint32_t minimumTime,
+		uint8_t repetitions) :
+	reporter(reporter),
+	minimumTime(static_cast<uint64_t>(minimumTime) * 1000000ULL),
+	repetitions(repetitions)
+{
+}
+
+void
+unittest::BenchmarkController::nextBenchmark(const char* name)
+{
+	reporter.nextBenchmark(name);
+}
+
+// ----------------------------------------------------------------------------
+uint32_t
+unittest::BenchmarkController::getNextIterations(
+		const BenchmarkState& state) const
+{
+	const uint64_t time = state.getNanoseconds();
+	const uint32_t iterations = state.getIterations();
+	if (time >= minimumTime || iterations >= maximumIterations) {
+		return 0;
+	}
+	
+	// Aim a bit above the minimum time so that the next run is most
+	// likely the last one. Very short runs are dominated by the timer
+	// resolution and are therefore only extrapolated by a factor of ten.
+	double multiplier = 10.0;
+	if (time * 10 > minimumTime) {
+		multiplier = 1.4 * static_cast<double>(minimumTime) /
+				static_cast<double>(time);
+	}
+	
+	double next = static_cast<double>(iterations) * multiplier;
+	if (next > maximumIterations) {
+		return maximumIterations;
+	}
+	if (next < iterations + 1.0) {
+		return iterations + 1;
+	}
+	return static_cast<uint32_t>(next);
+}
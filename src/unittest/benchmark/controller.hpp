@@ -0,0 +1,111 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	UNITTEST__BENCHMARK_CONTROLLER_HPP
+#define	UNITTEST__BENCHMARK_CONTROLLER_HPP
+
+#include <stdint.h>
+
+#include "state.hpp"
+#include "reporter.hpp"
+
+namespace unittest
+{
+	/**
+	 * \brief	Runs the benchmark methods
+	 * 
+	 * Every method is first called with a single iteration. The number
+	 * of iterations is then increased until a run takes longer than the
+	 * minimum measurement time. This run is repeated and the fastest of
+	 * the repetitions is reported.
+	 * 
+	 * \ingroup	benchmark
+	 */
+	class BenchmarkController
+	{
+	public:
+		/**
+		 * \param	reporter		Receives the results
+		 * \param	minimumTime		Minimum duration of the measured run
+		 * 							in milliseconds
+		 * \param	repetitions		Number of measured runs
+		 */
+		BenchmarkController(BenchmarkReporter& reporter,
+				uint32_t minimumTime = 100, uint8_t repetitions = 3);
+		
+		/// Switch to the next benchmark class
+		void
+		nextBenchmark(const char* name);
+		
+		/// Calibrate, run and report one benchmark method
+		template <typename T>
+		void
+		run(T& benchmark, void (T::*function)(BenchmarkState&),
+				const char* name);
+		
+		/// Called by the \c operator \c new of the generated runner
+		static inline void
+		countAllocation()
+		{
+			allocationCounter++;
+		}
+		
+		/// Number of heap allocations since the start of the program
+		static inline uint32_t
+		getAllocations()
+		{
+			return allocationCounter;
+		}
+		
+	private:
+		template <typename T>
+		BenchmarkState
+		runOnce(T& benchmark, void (T::*function)(BenchmarkState&),
+				uint32_t iterations);
+		
+		/**
+		 * \brief	Number of iterations for the next run
+		 * 
+		 * \return	Zero if the given run was long enough
+		 */
+		uint32_t
+		getNextIterations(const BenchmarkState& state) const;
+		
+		BenchmarkReporter& reporter;
+		const uint64_t minimumTime;		// in nanoseconds
+		const uint8_t repetitions;
+		
+		static uint32_t allocationCounter;
+	};
+}
+
+#include "controller_impl.hpp"
+
+#endif	// UNITTEST__BENCHMARK_CONTROLLER_HPP
@@ -0,0 +1,76 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	UNITTEST__BENCHMARK_CONTROLLER_HPP
+#	error	"Don't include this file directly, use 'controller.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename T>
+void
+unittest::BenchmarkController::run(T& benchmark,
+		void (T::*function)(BenchmarkState&), const char* name)
+{
+	// calibrate the number of iterations
+	uint32_t iterations = 1;
+	uint32_t next = 1;
+	BenchmarkState best(0);
+	do {
+		iterations = next;
+		best = this->runOnce(benchmark, function, iterations);
+		next = this->getNextIterations(best);
+	}
+	while (next != 0);
+	
+	// the fastest run is the one least disturbed by other processes
+	for (uint_fast8_t i = 1; i < repetitions; ++i)
+	{
+		BenchmarkState state = this->runOnce(benchmark, function, iterations);
+		if (state.getNanoseconds() < best.getNanoseconds()) {
+			best = state;
+		}
+	}
+	
+	reporter.report(name, best);
+}
+
+template <typename T>
+unittest::BenchmarkState
+unittest::BenchmarkController::runOnce(T& benchmark,
+		void (T::*function)(BenchmarkState&), uint32_t iterations)
+{
+	BenchmarkState state(iterations);
+	
+	benchmark.setUp();
+	(benchmark.*function)(state);
+	benchmark.tearDown();
+	
+	return state;
+}
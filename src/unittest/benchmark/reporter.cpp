@@ -0,0 +1,95 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include "reporter.hpp"
+
+// ----------------------------------------------------------------------------
+unittest::BenchmarkReporter::BenchmarkReporter(xpcc::IODevice& device,
+		std::FILE* json) :
+	outputStream(device), json(json), benchmarkName("invalid"), count(0)
+{
+	if (json != 0) {
+		std::fprintf(json, "{\n\t\"benchmarks\": [");
+	}
+}
+
+void
+unittest::BenchmarkReporter::nextBenchmark(const char* name)
+{
+	benchmarkName = name;
+}
+
+void
+unittest::BenchmarkReporter::report(const char* function,
+		const BenchmarkState& state)
+{
+	const double iterations = state.getIterations();
+	const double time = state.getNanoseconds() / iterations;
+	const double cycles = state.getCycles() / iterations;
+	const double allocations = state.getAllocations() / iterations;
+	const double operations = (time > 0) ? (1e9 / time) : 0;
+	
+	char name[128];
+	std::snprintf(name, sizeof(name), "%s.%s", benchmarkName, function);
+	
+	char line[256];
+	std::snprintf(line, sizeof(line),
+			"%-56s %10lu %12.2f ns/op %10.1f cycles/op %8.2f allocs/op\n",
+			name, static_cast<unsigned long>(state.getIterations()),
+			time, cycles, allocations);
+	outputStream << line;
+	
+	if (json != 0)
+	{
+		std::fprintf(json, "%s\n\t\t{\n"
+				"\t\t\t\"name\": \"%s\",\n"
+				"\t\t\t\"iterations\": %lu,\n"
+				"\t\t\t\"ns_per_op\": %.3f,\n"
+				"\t\t\t\"ops_per_second\": %.1f,\n"
+				"\t\t\t\"cycles_per_op\": %.3f,\n"
+				"\t\t\t\"allocs_per_op\": %.3f\n"
+				"\t\t}",
+				(count == 0) ? "" : ",",
+				name, static_cast<unsigned long>(state.getIterations()),
+				time, operations, cycles, allocations);
+	}
+	count++;
+}
+
+void
+unittest::BenchmarkReporter::printSummary()
+{
+	outputStream << "\nRan " << count << " benchmarks" << xpcc::endl;
+	
+	if (json != 0) {
+		std::fprintf(json, "\n\t]\n}\n");
+		std::fflush(json);
+	}
+}
@@ -0,0 +1,98 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	UNITTEST__BENCHMARK_REPORTER_HPP
+#define	UNITTEST__BENCHMARK_REPORTER_HPP
+
+#include <cstdio>
+#include <stdint.h>
+
+#include <xpcc/io/iostream.hpp>
+
+#include "state.hpp"
+
+namespace unittest
+{
+	/**
+	 * \brief	Prints the results of the benchmarks
+	 * 
+	 * Writes a table with the time, the cycles and the allocations per
+	 * iteration to the given device. If a file is given the results are
+	 * additionally written to it in JSON format:
+	 * 
+	 * \code
+	 * {
+	 *     "benchmarks": [
+	 *         {
+	 *             "name": "crc_benchmark.benchmarkCrc8",
+	 *             "iterations": 1000000,
+	 *             "ns_per_op": 12.5,
+	 *             "ops_per_second": 80000000.0,
+	 *             "cycles_per_op": 40.1,
+	 *             "allocs_per_op": 0.0
+	 *         }
+	 *     ]
+	 * }
+	 * \endcode
+	 * 
+	 * \ingroup	benchmark
+	 */
+	class BenchmarkReporter
+	{
+	public:
+		/**
+		 * \param	device	IODevice used for the table
+		 * \param	json	File for the machine readable output, may be
+		 * 					zero.
+		 */
+		BenchmarkReporter(xpcc::IODevice& device, std::FILE* json = 0);
+		
+		/// Switch to the next benchmark class
+		void
+		nextBenchmark(const char* name);
+		
+		/// Report the result of a calibrated run
+		void
+		report(const char* function, const BenchmarkState& state);
+		
+		/// Finish the output
+		void
+		printSummary();
+		
+	private:
+		xpcc::IOStream outputStream;
+		std::FILE* json;
+		
+		const char* benchmarkName;
+		uint_fast16_t count;
+	};
+}
+
+#endif	// UNITTEST__BENCHMARK_REPORTER_HPP
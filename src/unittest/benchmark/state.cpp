@@ -0,0 +1,108 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/architecture/detect.hpp>
+
+#include "controller.hpp"
+#include "state.hpp"
+
+#if defined(XPCC__OS_WIN32) || defined(XPCC__OS_WIN64)
+#	include <windows.h>
+#elif defined(XPCC__OS_OSX)
+#	include <sys/time.h>
+#else
+#	include <time.h>
+#endif
+
+namespace
+{
+	uint64_t
+	nanoseconds()
+	{
+#if defined(XPCC__OS_WIN32) || defined(XPCC__OS_WIN64)
+		LARGE_INTEGER frequency;
+		LARGE_INTEGER counter;
+		QueryPerformanceFrequency(&frequency);
+		QueryPerformanceCounter(&counter);
+		return static_cast<uint64_t>(counter.QuadPart) * 1000000000ULL /
+				static_cast<uint64_t>(frequency.QuadPart);
+#elif defined(XPCC__OS_OSX)
+		struct timeval now;
+		gettimeofday(&now, 0);
+		return static_cast<uint64_t>(now.tv_sec) * 1000000000ULL +
+				static_cast<uint64_t>(now.tv_usec) * 1000;
+#else
+		struct timespec now;
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		return static_cast<uint64_t>(now.tv_sec) * 1000000000ULL +
+				static_cast<uint64_t>(now.tv_nsec);
+#endif
+	}
+	
+	uint64_t
+	cycles()
+	{
+#if defined(__i386__) || defined(__x86_64__)
+		uint32_t low;
+		uint32_t high;
+		asm volatile("rdtsc" : "=a" (low), "=d" (high));
+		return (static_cast<uint64_t>(high) << 32) | low;
+#else
+		return 0;
+#endif
+	}
+}
+
+// ----------------------------------------------------------------------------
+unittest::BenchmarkState::BenchmarkState(uint32_t iterations) :
+	iterations(iterations), remaining(iterations), started(false),
+	startTime(0), startCycles(0), startAllocations(0),
+	elapsedTime(0), elapsedCycles(0), allocations(0)
+{
+}
+
+void
+unittest::BenchmarkState::pauseTiming()
+{
+	uint64_t stopCycles = cycles();
+	uint64_t stopTime = nanoseconds();
+	
+	elapsedTime += stopTime - startTime;
+	elapsedCycles += stopCycles - startCycles;
+	allocations += BenchmarkController::getAllocations() - startAllocations;
+}
+
+void
+unittest::BenchmarkState::resumeTiming()
+{
+	startAllocations = BenchmarkController::getAllocations();
+	startTime = nanoseconds();
+	startCycles = cycles();
+}
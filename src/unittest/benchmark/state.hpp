@@ -0,0 +1,138 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	UNITTEST__BENCHMARK_STATE_HPP
+#define	UNITTEST__BENCHMARK_STATE_HPP
+
+#include <stdint.h>
+#include <xpcc/architecture/utils.hpp>
+
+namespace unittest
+{
+	/**
+	 * \brief	State of a single run of a benchmark method
+	 * 
+	 * Controls the loop of the benchmark and measures the time, the
+	 * processor cycles and the number of heap allocations between the
+	 * first and the last call of keepRunning().
+	 * 
+	 * \ingroup	benchmark
+	 */
+	class BenchmarkState
+	{
+	public:
+		explicit
+		BenchmarkState(uint32_t iterations);
+		
+		/**
+		 * \brief	Check if the benchmark loop should continue
+		 * 
+		 * The first call starts the measurement, the call which returns
+		 * \c false stops it. The loop body is executed exactly
+		 * getIterations() times.
+		 */
+		ALWAYS_INLINE bool
+		keepRunning()
+		{
+			if (__builtin_expect(started, true))
+			{
+				if (__builtin_expect(--remaining != 0, true)) {
+					return true;
+				}
+				this->pauseTiming();
+				return false;
+			}
+			
+			started = true;
+			this->resumeTiming();
+			return true;
+		}
+		
+		/**
+		 * \brief	Exclude the following code from the measurement
+		 * 
+		 * Has a considerable overhead itself, use it only if the
+		 * excluded code takes much longer than a few hundred nanoseconds.
+		 */
+		void
+		pauseTiming();
+		
+		/// Continue the measurement after pauseTiming()
+		void
+		resumeTiming();
+		
+		inline uint32_t
+		getIterations() const
+		{
+			return iterations;
+		}
+		
+		/// Measured time in nanoseconds
+		inline uint64_t
+		getNanoseconds() const
+		{
+			return elapsedTime;
+		}
+		
+		/**
+		 * \brief	Measured processor cycles
+		 * 
+		 * Only available on x86 processors (time stamp counter), zero
+		 * otherwise.
+		 */
+		inline uint64_t
+		getCycles() const
+		{
+			return elapsedCycles;
+		}
+		
+		/// Number of heap allocations during the measurement
+		inline uint32_t
+		getAllocations() const
+		{
+			return allocations;
+		}
+		
+	private:
+		uint32_t iterations;
+		uint32_t remaining;
+		bool started;
+		
+		uint64_t startTime;
+		uint64_t startCycles;
+		uint32_t startAllocations;
+		
+		uint64_t elapsedTime;
+		uint64_t elapsedCycles;
+		uint32_t allocations;
+	};
+}
+
+#endif	// UNITTEST__BENCHMARK_STATE_HPP
@@ -32,7 +32,9 @@
 
 std::size_t unittest::CountType::numberOfDefaultConstructorCalls = 0;
 std::size_t unittest::CountType::numberOfCopyConstructorCalls = 0;
+std::size_t unittest::CountType::numberOfMoveConstructorCalls = 0;
 std::size_t unittest::CountType::numberOfAssignments = 0;
+std::size_t unittest::CountType::numberOfMoveAssignments = 0;
 std::size_t unittest::CountType::numberOfDestructorCalls = 0;
 std::size_t unittest::CountType::numberOfReallocs = 0;
 
@@ -50,6 +52,12 @@ unittest::CountType::CountType(const CountType&)
 	++numberOfOperations;
 }
 
+unittest::CountType::CountType(CountType&&)
+{
+	++numberOfMoveConstructorCalls;
+	++numberOfOperations;
+}
+
 unittest::CountType::~CountType()
 {
 	++numberOfDestructorCalls;
@@ -68,12 +76,23 @@ unittest::CountType::operator = (const CountType&)
 	return *this;
 }
 
+unittest::CountType&
+unittest::CountType::operator = (CountType&&)
+{
+	++numberOfMoveAssignments;
+	++numberOfOperations;
+	
+	return *this;
+}
+
 void
 unittest::CountType::reset()
 {
 	numberOfDefaultConstructorCalls = 0;
 	numberOfCopyConstructorCalls = 0;
+	numberOfMoveConstructorCalls = 0;
 	numberOfAssignments = 0;
+	numberOfMoveAssignments = 0;
 	numberOfDestructorCalls = 0;
 	numberOfReallocs = 0;
 	
@@ -48,17 +48,24 @@ namespace unittest
 		
 		CountType(const CountType& other);
 		
+		CountType(CountType&& other);
+		
 		~CountType();
 		
 		CountType&
 		operator = (const CountType& other);
 		
+		CountType&
+		operator = (CountType&& other);
+		
 		static void
 		reset();
 		
 		static std::size_t numberOfDefaultConstructorCalls;
 		static std::size_t numberOfCopyConstructorCalls;
+		static std::size_t numberOfMoveConstructorCalls;
 		static std::size_t numberOfAssignments;
+		static std::size_t numberOfMoveAssignments;
 		static std::size_t numberOfDestructorCalls;
 		static std::size_t numberOfReallocs;
 		
@@ -57,6 +57,17 @@ namespace
 	// delegating
 	static xpcc::i2c::Delegate *delegate(0);
 	static xpcc::atmega::I2cMaster::ErrorState errorState(xpcc::atmega::I2cMaster::NO_ERROR);
+	
+	// The delegate is detached before it is notified, so it may start
+	// the next transaction from its stopped() method.
+	static void
+	stopDelegate(xpcc::i2c::Delegate::DetachCause cause)
+	{
+		xpcc::i2c::Delegate *stopping = delegate;
+		delegate = 0;
+		if (stopping) stopping->stopped(cause);
+	}
+	
 	static bool newSession;
 	
 	// helper functions
@@ -169,8 +180,7 @@ ISR(TWI_vect)
 					default:
 						DEBUG('S');
 						TWCR = (1 << TWINT) | (1 << TWSTO) | (1 << TWEN);
-						delegate->stopped(xpcc::i2c::Delegate::NORMAL_STOP);
-						delegate = 0;
+						stopDelegate(xpcc::i2c::Delegate::NORMAL_STOP);
 						break;
 				}
 			}
@@ -215,8 +225,7 @@ ISR(TWI_vect)
 				case xpcc::i2c::Delegate::STOP_OP:
 					DEBUG('S');
 					TWCR = (1 << TWINT) | (1 << TWSTO) | (1 << TWEN);
-					delegate->stopped(xpcc::i2c::Delegate::NORMAL_STOP);
-					delegate = 0;
+					stopDelegate(xpcc::i2c::Delegate::NORMAL_STOP);
 					break;
 			}
 			break;
@@ -267,10 +276,9 @@ xpcc::atmega::I2cMaster::reset(bool error)
 	DEBUG('T');
 	writeBytesLeft = 0;
 	readBytesLeft = 0;
-	if (delegate) delegate->stopped(
+	stopDelegate(
 			error ?	xpcc::i2c::Delegate::ERROR_CONDITION :
 					xpcc::i2c::Delegate::SOFTWARE_RESET);
-	delegate = 0;
 }
 
 uint8_t
@@ -287,6 +295,9 @@ xpcc::atmega::I2cMaster::start(xpcc::i2c::Delegate *delegate)
 		::delegate = delegate;
 		newSession = true;
 		DEBUG('Y');
+		// a stop condition of the previous transaction may still be pending
+		while (TWCR & (1 << TWSTO))
+			;
 		TWCR = (1 << TWINT) | (1 << TWSTA) | (1 << TWEN) | (1 << TWIE);
 		
 		return true;
@@ -302,6 +313,9 @@ xpcc::atmega::I2cMaster::startSync(xpcc::i2c::Delegate *delegate)
 		::delegate = delegate;
 		newSession = true;
 		DEBUG('Y');
+		// a stop condition of the previous transaction may still be pending
+		while (TWCR & (1 << TWSTO))
+			;
 		TWCR = (1 << TWINT) | (1 << TWSTA) | (1 << TWEN) | (1 << TWIE);
 		
 		// the compiler generates out of order code here
@@ -63,6 +63,16 @@ namespace
 	static xpcc::i2c::Delegate *delegate = 0;
 	static xpcc::atxmega::I2cMasterC::ErrorState errorState(xpcc::atxmega::I2cMasterC::NO_ERROR);
 	
+	// The delegate is detached before it is notified, so it may start
+	// the next transaction from its stopped() method.
+	static void
+	stopDelegate(xpcc::i2c::Delegate::DetachCause cause)
+	{
+		xpcc::i2c::Delegate *stopping = delegate;
+		delegate = 0;
+		if (stopping) stopping->stopped(cause);
+	}
+	
 	// helper functions
 	static void
 	initializeWrite(xpcc::i2c::Delegate::Writing w) {
@@ -197,8 +207,7 @@ ISR(TWIC_TWIM_vect)
 						default:
 							DEBUG('S');
 							TWIC_MASTER_CTRLC = TWI_MASTER_ACKACT_bm | TWI_MASTER_CMD_STOP_gc;
-							delegate->stopped(xpcc::i2c::Delegate::NORMAL_STOP);
-							delegate = 0;
+							stopDelegate(xpcc::i2c::Delegate::NORMAL_STOP);
 							break;
 					}
 				}
@@ -233,8 +242,7 @@ ISR(TWIC_TWIM_vect)
 						case xpcc::i2c::Delegate::STOP_OP:
 							DEBUG('S');
 							TWIC_MASTER_CTRLC = TWI_MASTER_ACKACT_bm | TWI_MASTER_CMD_STOP_gc;
-							delegate->stopped(xpcc::i2c::Delegate::NORMAL_STOP);
-							delegate = 0;
+							stopDelegate(xpcc::i2c::Delegate::NORMAL_STOP);
 							break;
 					}
 				}
@@ -296,8 +304,7 @@ xpcc::atxmega::I2cMasterC::reset(bool error)
 	DEBUG('T');
 	writeBytesLeft = 0;
 	readBytesLeft = 0;
-	if (delegate) delegate->stopped(error ? xpcc::i2c::Delegate::ERROR_CONDITION : xpcc::i2c::Delegate::SOFTWARE_RESET);
-	delegate = 0;
+	stopDelegate(error ? xpcc::i2c::Delegate::ERROR_CONDITION : xpcc::i2c::Delegate::SOFTWARE_RESET);
 }
 
 uint8_t
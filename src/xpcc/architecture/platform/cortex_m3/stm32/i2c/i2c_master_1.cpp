@@ -228,6 +228,16 @@ namespace
 	static xpcc::i2c::Delegate *delegate = 0;
 	static xpcc::stm32::I2cMaster1::ErrorState errorState(xpcc::stm32::I2cMaster1::NO_ERROR);
 	
+	// The delegate is detached before it is notified, so it may start
+	// the next transaction from its stopped() method.
+	static void
+	stopDelegate(xpcc::i2c::Delegate::DetachCause cause)
+	{
+		xpcc::i2c::Delegate *stopping = delegate;
+		delegate = 0;
+		if (stopping) stopping->stopped(cause);
+	}
+	
 	static void
 	initializeWrite(xpcc::i2c::Delegate::Writing w)
 	{
@@ -267,6 +277,11 @@ namespace
 	{
 		DEBUG_STREAM("callStarting");
 		
+		// no access to CR1 while the stop condition of the previous
+		// transaction is pending
+		while (I2C1->CR1 & I2C_CR1_STOP)
+			;
+		
 		I2C1->CR1 &= ~I2C_CR1_POS;
 		I2C1->SR1 = 0;
 		I2C1->SR2 = 0;
@@ -518,8 +533,7 @@ I2C1_EV_IRQHandler(void)
 				
 				DEBUG_STREAM("disable interrupts");
 				I2C1->CR2 &= ~(I2C_CR2_ITEVTEN | I2C_CR2_ITBUFEN | I2C_CR2_ITERREN);
-				if (delegate) delegate->stopped(xpcc::i2c::Delegate::NORMAL_STOP);
-				delegate = 0;
+				stopDelegate(xpcc::i2c::Delegate::NORMAL_STOP);
 				DEBUG_STREAM("write finished");
 				break;
 		}
@@ -558,12 +572,6 @@ I2C1_ER_IRQHandler(void)
 		errorState = xpcc::stm32::I2cMaster1::UNKNOWN_ERROR;
 	}
 	
-	if (delegate)
-	{
-		delegate->stopped(xpcc::i2c::Delegate::ERROR_CONDITION);
-		delegate = 0;
-	}
-	
 	// Overrun error is not handled here separately
 	
 	// Clear flags and interrupts
@@ -576,6 +584,8 @@ I2C1_ER_IRQHandler(void)
 	
 	DEBUG_STREAM("disable interrupts");
 	I2C1->CR2 &= ~(I2C_CR2_ITEVTEN | I2C_CR2_ITBUFEN | I2C_CR2_ITERREN);
+	
+	stopDelegate(xpcc::i2c::Delegate::ERROR_CONDITION);
 }
 	
 // ----------------------------------------------------------------------------
@@ -634,8 +644,7 @@ xpcc::stm32::I2cMaster1::reset(bool error)
 {
 	readBytesLeft = 0;
 	writeBytesLeft = 0;
-	if (delegate) delegate->stopped(error ? xpcc::i2c::Delegate::ERROR_CONDITION : xpcc::i2c::Delegate::SOFTWARE_RESET);
-	delegate = 0;
+	stopDelegate(error ? xpcc::i2c::Delegate::ERROR_CONDITION : xpcc::i2c::Delegate::SOFTWARE_RESET);
 }
 	
 // MARK: - ownership
@@ -230,6 +230,16 @@ namespace
 	static xpcc::i2c::Delegate *delegate = 0;
 	static xpcc::stm32::I2cMaster3::ErrorState errorState(xpcc::stm32::I2cMaster3::NO_ERROR);
 	
+	// The delegate is detached before it is notified, so it may start
+	// the next transaction from its stopped() method.
+	static void
+	stopDelegate(xpcc::i2c::Delegate::DetachCause cause)
+	{
+		xpcc::i2c::Delegate *stopping = delegate;
+		delegate = 0;
+		if (stopping) stopping->stopped(cause);
+	}
+	
 	static void
 	initializeWrite(xpcc::i2c::Delegate::Writing w)
 	{
@@ -269,6 +279,11 @@ namespace
 	{
 		DEBUG_STREAM("callStarting");
 		
+		// no access to CR1 while the stop condition of the previous
+		// transaction is pending
+		while (I2C3->CR1 & I2C_CR1_STOP)
+			;
+		
 		I2C3->CR1 &= ~I2C_CR1_POS;
 		I2C3->SR1 = 0;
 		I2C3->SR2 = 0;
@@ -520,8 +535,7 @@ I2C3_EV_IRQHandler(void)
 				
 				DEBUG_STREAM("disable interrupts");
 				I2C3->CR2 &= ~(I2C_CR2_ITEVTEN | I2C_CR2_ITBUFEN | I2C_CR2_ITERREN);
-				if (delegate) delegate->stopped(xpcc::i2c::Delegate::NORMAL_STOP);
-				delegate = 0;
+				stopDelegate(xpcc::i2c::Delegate::NORMAL_STOP);
 				DEBUG_STREAM("write finished");
 				break;
 		}
@@ -560,12 +574,6 @@ I2C3_ER_IRQHandler(void)
 		errorState = xpcc::stm32::I2cMaster3::UNKNOWN_ERROR;
 	}
 	
-	if (delegate)
-	{
-		delegate->stopped(xpcc::i2c::Delegate::ERROR_CONDITION);
-		delegate = 0;
-	}
-	
 	// Overrun error is not handled here separately
 	
 	// Clear flags and interrupts
@@ -578,6 +586,8 @@ I2C3_ER_IRQHandler(void)
 	
 	DEBUG_STREAM("disable interrupts");
 	I2C3->CR2 &= ~(I2C_CR2_ITEVTEN | I2C_CR2_ITBUFEN | I2C_CR2_ITERREN);
+	
+	stopDelegate(xpcc::i2c::Delegate::ERROR_CONDITION);
 }
 	
 // ----------------------------------------------------------------------------
@@ -628,8 +638,7 @@ xpcc::stm32::I2cMaster3::reset(bool error)
 {
 	readBytesLeft = 0;
 	writeBytesLeft = 0;
-	if (delegate) delegate->stopped(error ? xpcc::i2c::Delegate::ERROR_CONDITION : xpcc::i2c::Delegate::SOFTWARE_RESET);
-	delegate = 0;
+	stopDelegate(error ? xpcc::i2c::Delegate::ERROR_CONDITION : xpcc::i2c::Delegate::SOFTWARE_RESET);
 }
 	
 // MARK: - ownership
@@ -0,0 +1,120 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_PC__HEADLESS_DISPLAY_HPP
+#define XPCC_PC__HEADLESS_DISPLAY_HPP
+
+#include <cstdio>
+
+#include <xpcc/driver/ui/display/buffered_color_graphic_display.hpp>
+
+#include "ppm_image.hpp"
+
+namespace xpcc
+{
+	namespace pc
+	{
+		/**
+		 * \brief	Display which stores its frames as image files
+		 * 
+		 * Replacement for xpcc::SDLDisplay in tests which need no window,
+		 * e.g. on machines without a X server. Every update() is counted
+		 * and, if a filename prefix is given, written as
+		 * "<prefix>0000.ppm", "<prefix>0001.ppm", ...
+		 * 
+		 * Example:
+		 * \code
+		 * xpcc::pc::HeadlessDisplay<128, 64> display;
+		 * 
+		 * display.drawString("Hello");
+		 * display.update();
+		 * 
+		 * if (display.compareImage("golden/hello.ppm") != 0) {
+		 *     display.writeImage("hello.ppm");
+		 * }
+		 * \endcode
+		 * 
+		 * \ingroup	hosted
+		 */
+		template <uint16_t Width, uint16_t Height>
+		class HeadlessDisplay : public BufferedColorGraphicDisplay<Width, Height>
+		{
+		public:
+			/**
+			 * \param	prefix	Path and name for the frame files, no
+			 * 					files are written if zero.
+			 */
+			HeadlessDisplay(const char *prefix = 0) :
+				prefix(prefix), frames(0)
+			{
+			}
+			
+			virtual void
+			update()
+			{
+				if (this->prefix != 0)
+				{
+					char filename[256];
+					std::snprintf(filename, sizeof(filename), "%s%04u.ppm",
+							this->prefix, static_cast<unsigned int>(this->frames));
+					this->writeImage(filename);
+				}
+				this->frames++;
+			}
+			
+			/// Number of calls to update()
+			inline uint32_t
+			getFrameCount() const
+			{
+				return this->frames;
+			}
+			
+			/// Store the current content
+			inline bool
+			writeImage(const char *filename) const
+			{
+				return PpmImage::write(filename, this->getBuffer(), Width, Height);
+			}
+			
+			/// Number of pixels which differ from a reference image
+			inline int32_t
+			compareImage(const char *filename) const
+			{
+				return PpmImage::compare(filename, this->getBuffer(), Width, Height);
+			}
+			
+		private:
+			const char *prefix;
+			uint32_t frames;
+		};
+	}
+}
+
+#endif	// XPCC_PC__HEADLESS_DISPLAY_HPP
@@ -0,0 +1,128 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <cstdio>
+#include <vector>
+
+#include "ppm_image.hpp"
+
+// ----------------------------------------------------------------------------
+bool
+xpcc::pc::PpmImage::write(const char *filename, const uint16_t *pixels,
+		uint16_t width, uint16_t height)
+{
+	std::FILE *file = std::fopen(filename, "wb");
+	if (file == 0) {
+		return false;
+	}
+	
+	std::fprintf(file, "P6\n%u %u\n255\n", width, height);
+	
+	std::vector<uint8_t> row(width * 3);
+	for (uint_fast16_t y = 0; y < height; ++y)
+	{
+		for (uint_fast16_t x = 0; x < width; ++x)
+		{
+			const uint16_t color = pixels[y * width + x];
+			
+			// extend to 8 bit by replicating the most significant bits
+			const uint8_t red   = (color >> 11) & 0x1f;
+			const uint8_t green = (color >> 5) & 0x3f;
+			const uint8_t blue  = color & 0x1f;
+			row[x * 3 + 0] = (red << 3) | (red >> 2);
+			row[x * 3 + 1] = (green << 2) | (green >> 4);
+			row[x * 3 + 2] = (blue << 3) | (blue >> 2);
+		}
+		std::fwrite(&row[0], 1, row.size(), file);
+	}
+	
+	bool success = (std::ferror(file) == 0);
+	if (std::fclose(file) != 0) {
+		success = false;
+	}
+	return success;
+}
+
+bool
+xpcc::pc::PpmImage::read(const char *filename, uint16_t *pixels,
+		uint16_t width, uint16_t height)
+{
+	std::FILE *file = std::fopen(filename, "rb");
+	if (file == 0) {
+		return false;
+	}
+	
+	unsigned int fileWidth;
+	unsigned int fileHeight;
+	unsigned int maximum;
+	
+	// single whitespace after the header, comments are not supported
+	bool success = (std::fscanf(file, "P6 %u %u %u", &fileWidth, &fileHeight, &maximum) == 3) &&
+			(std::fgetc(file) != EOF) &&
+			(fileWidth == width) && (fileHeight == height) && (maximum == 255);
+	
+	std::vector<uint8_t> row(width * 3);
+	for (uint_fast16_t y = 0; success && y < height; ++y)
+	{
+		if (std::fread(&row[0], 1, row.size(), file) != row.size()) {
+			success = false;
+			break;
+		}
+		
+		for (uint_fast16_t x = 0; x < width; ++x)
+		{
+			pixels[y * width + x] =
+					((row[x * 3 + 0] >> 3) << 11) |
+					((row[x * 3 + 1] >> 2) << 5) |
+					(row[x * 3 + 2] >> 3);
+		}
+	}
+	
+	std::fclose(file);
+	return success;
+}
+
+int32_t
+xpcc::pc::PpmImage::compare(const char *filename, const uint16_t *pixels,
+		uint16_t width, uint16_t height)
+{
+	std::vector<uint16_t> reference(width * height);
+	if (!read(filename, &reference[0], width, height)) {
+		return -1;
+	}
+	
+	int32_t differences = 0;
+	for (uint32_t i = 0; i < reference.size(); ++i) {
+		if (reference[i] != pixels[i]) {
+			differences++;
+		}
+	}
+	return differences;
+}
@@ -0,0 +1,90 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_PC__PPM_IMAGE_HPP
+#define XPCC_PC__PPM_IMAGE_HPP
+
+#include <stdint.h>
+
+namespace xpcc
+{
+	namespace pc
+	{
+		/**
+		 * \brief	Read and write RGB565 images as binary PPM files (P6)
+		 * 
+		 * PPM files can be opened with most image viewers and converted
+		 * to PNG with e.g. ImageMagick. Used to store the content of
+		 * xpcc::BufferedColorGraphicDisplay without a real display and
+		 * to compare it with reference images in regression tests.
+		 * 
+		 * The pixels are stored row by row, see
+		 * xpcc::BufferedColorGraphicDisplay::getBuffer().
+		 * 
+		 * \ingroup	hosted
+		 */
+		class PpmImage
+		{
+		public:
+			/**
+			 * \brief	Write an image
+			 * 
+			 * \return	\c false if the file could not be written
+			 */
+			static bool
+			write(const char *filename, const uint16_t *pixels,
+					uint16_t width, uint16_t height);
+			
+			/**
+			 * \brief	Read an image with the given size
+			 * 
+			 * The colors are reduced to RGB565.
+			 * 
+			 * \return	\c false if the file could not be read or the size
+			 * 			of the image does not match
+			 */
+			static bool
+			read(const char *filename, uint16_t *pixels,
+					uint16_t width, uint16_t height);
+			
+			/**
+			 * \brief	Compare pixels with a reference image
+			 * 
+			 * \return	Number of different pixels, -1 if the reference
+			 * 			image could not be read or has another size
+			 */
+			static int32_t
+			compare(const char *filename, const uint16_t *pixels,
+					uint16_t width, uint16_t height);
+		};
+	}
+}
+
+#endif	// XPCC_PC__PPM_IMAGE_HPP
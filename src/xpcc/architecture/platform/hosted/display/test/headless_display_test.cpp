@@ -0,0 +1,93 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <cstdio>
+
+#include "../headless_display.hpp"
+
+#include "headless_display_test.hpp"
+
+// ----------------------------------------------------------------------------
+void
+HeadlessDisplayTest::testWriteAndCompare()
+{
+	xpcc::pc::HeadlessDisplay<32, 16> display;
+	display.setColor(xpcc::glcd::Color::red());
+	display.fillRectangle(2, 3, 10, 5);
+	display.setColor(xpcc::glcd::Color(0x12, 0x34, 0x56));
+	display.drawLine(0, 15, 31, 0);
+	
+	TEST_ASSERT_TRUE(display.writeImage("headless_display_test.ppm"));
+	TEST_ASSERT_EQUALS(display.compareImage("headless_display_test.ppm"), 0);
+	
+	// RGB565 values survive the conversion to 24 bit and back
+	xpcc::pc::HeadlessDisplay<32, 16> copy;
+	TEST_ASSERT_TRUE(xpcc::pc::PpmImage::read("headless_display_test.ppm",
+			const_cast<uint16_t *>(copy.getBuffer()), 32, 16));
+	TEST_ASSERT_TRUE(copy.getPixelColor(2, 3) == xpcc::glcd::Color::red());
+	TEST_ASSERT_EQUALS_ARRAY(copy.getBuffer(), display.getBuffer(), 32 * 16);
+	
+	display.setColor(xpcc::glcd::Color::blue());
+	display.drawPixel(31, 15);
+	display.drawPixel(0, 0);
+	TEST_ASSERT_EQUALS(display.compareImage("headless_display_test.ppm"), 2);
+	
+	// wrong size
+	xpcc::pc::HeadlessDisplay<16, 32> other;
+	TEST_ASSERT_EQUALS(other.compareImage("headless_display_test.ppm"), -1);
+	
+	std::remove("headless_display_test.ppm");
+}
+
+void
+HeadlessDisplayTest::testFrames()
+{
+	xpcc::pc::HeadlessDisplay<8, 8> display("headless_display_test_");
+	
+	display.update();
+	display.setColor(xpcc::glcd::Color::white());
+	display.drawPixel(1, 1);
+	display.update();
+	TEST_ASSERT_EQUALS(display.getFrameCount(), 2U);
+	
+	TEST_ASSERT_EQUALS(display.compareImage("headless_display_test_0000.ppm"), 1);
+	TEST_ASSERT_EQUALS(display.compareImage("headless_display_test_0001.ppm"), 0);
+	
+	std::remove("headless_display_test_0000.ppm");
+	std::remove("headless_display_test_0001.ppm");
+}
+
+void
+HeadlessDisplayTest::testMissingImage()
+{
+	xpcc::pc::HeadlessDisplay<8, 8> display;
+	TEST_ASSERT_EQUALS(display.compareImage("headless_display_test_missing.ppm"), -1);
+	TEST_ASSERT_FALSE(display.writeImage("/nonexistent/directory/image.ppm"));
+}
@@ -37,6 +37,7 @@
 
 #include "linux/tipc.hpp"
 //#include "linux/serial_port.hpp"
-#include "linux/serial_interface.hpp"
+#include "linux/serial_interface.hpp"
+#include "linux/threaded_spi_master.hpp"
 
 #endif // XPCC__LINUX_HPP
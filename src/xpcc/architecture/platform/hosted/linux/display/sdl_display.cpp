@@ -1,7 +1,8 @@
 #include "sdl_display.hpp"
 
 xpcc::SDLDisplay::SDLDisplay(int16_t width, int16_t height):
-	width(width), height(height), memory(0), screen(0)
+	width(width), height(height), memory(0), screen(0),
+	dirtyX0(0), dirtyY0(0), dirtyX1(width), dirtyY1(height)
 {
 	this->memory = new bool[this->width*this->height];
 	for(int i = 0; i< this->width*this->height; i++)
@@ -20,9 +21,14 @@ xpcc::SDLDisplay::~SDLDisplay()
 void
 xpcc::SDLDisplay::update()
 {
-	for(int i = 0; i < this->width; i++)
+	if (this->dirtyX0 >= this->dirtyX1 || this->dirtyY0 >= this->dirtyY1) {
+		// nothing changed since the last update
+		return;
+	}
+
+	for(int i = this->dirtyX0; i < this->dirtyX1; i++)
 	{
-		for(int j = 0; j < this->height; j++)
+		for(int j = this->dirtyY0; j < this->dirtyY1; j++)
 		{
 			if(this->getPixel(i, j))
 			{
@@ -33,19 +39,23 @@ xpcc::SDLDisplay::update()
 			}
 		}
 	}
-	SDL_Flip( this->screen );
+	SDL_UpdateRect( this->screen, this->dirtyX0, this->dirtyY0,
+			this->dirtyX1 - this->dirtyX0, this->dirtyY1 - this->dirtyY0 );
+	this->markClean();
 }
 
 void
 xpcc::SDLDisplay::setPixel(int16_t x, int16_t y)
 {
 	this->memory[y*this->width+x] = true;
+	this->markDirty(x, y);
 }
 
 void
 xpcc::SDLDisplay::clearPixel(int16_t x, int16_t y)
 {
 	this->memory[y*this->width+x] = false;
+	this->markDirty(x, y);
 }
 
 bool
@@ -82,4 +92,36 @@ xpcc::SDLDisplay::clearWholeScreen()
 			this->memory[j*this->width+i] = false;
 		}
 	}
+
+	// the screen surface was changed directly
+	this->dirtyX0 = 0;
+	this->dirtyY0 = 0;
+	this->dirtyX1 = this->width;
+	this->dirtyY1 = this->height;
+}
+
+void
+xpcc::SDLDisplay::markDirty(int16_t x, int16_t y)
+{
+	if (x < this->dirtyX0) {
+		this->dirtyX0 = x;
+	}
+	if (x >= this->dirtyX1) {
+		this->dirtyX1 = x + 1;
+	}
+	if (y < this->dirtyY0) {
+		this->dirtyY0 = y;
+	}
+	if (y >= this->dirtyY1) {
+		this->dirtyY1 = y + 1;
+	}
+}
+
+void
+xpcc::SDLDisplay::markClean()
+{
+	this->dirtyX0 = this->width;
+	this->dirtyY0 = this->height;
+	this->dirtyX1 = 0;
+	this->dirtyY1 = 0;
 }
@@ -43,6 +43,9 @@ namespace xpcc
      *
      * \author Thorsten Lajewski
      *
+     * Only the bounding box of the pixels changed since the last
+     * update() is copied to the screen.
+     *
      * \warning SDL_Init( SDL_INIT_EVERYTHING ); needs to be  called, before
      *          any instance of the SDLDisplay can be used
      */
@@ -90,6 +93,10 @@ namespace xpcc
 
 		void clearWholeScreen();
 
+		void markDirty(int16_t x, int16_t y);
+
+		void markClean();
+
 		const int16_t width;
 		const int16_t height;
 
@@ -97,6 +104,12 @@ namespace xpcc
 		bool* memory;
 		SDL_Surface* screen;
 
+		// bounding box of the changed pixels, end exclusive
+		int16_t dirtyX0;
+		int16_t dirtyY0;
+		int16_t dirtyX1;
+		int16_t dirtyY1;
+
 	};
 }
 #endif /* XPCC__SDL_DISPLAY_HPP */
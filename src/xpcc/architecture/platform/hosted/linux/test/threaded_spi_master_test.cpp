@@ -0,0 +1,178 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/architecture/driver/gpio.hpp>
+#include <xpcc/driver/ui/display/st7565_async.hpp>
+
+#include "../threaded_spi_master.hpp"
+#include "threaded_spi_master_test.hpp"
+
+typedef xpcc::pc::ThreadedSpiMaster Spi;
+
+namespace
+{
+	class TestDisplay : public xpcc::St7565Async< xpcc::St7565<Spi,
+			xpcc::gpio::Unused, xpcc::gpio::Unused, xpcc::gpio::Unused,
+			128, 64, false> >
+	{
+	public:
+		TestDisplay() :
+			finished(0)
+		{
+		}
+		
+		uint8_t finished;
+		
+	protected:
+		virtual void
+		updateFinished()
+		{
+			finished++;
+		}
+	};
+}
+
+// ----------------------------------------------------------------------------
+void
+ThreadedSpiMasterTest::setUp()
+{
+	Spi::clear();
+}
+
+void
+ThreadedSpiMasterTest::tearDown()
+{
+	Spi::setByteDuration(0);
+}
+
+void
+ThreadedSpiMasterTest::testTransfer()
+{
+	uint8_t buffer[40];
+	for (uint8_t i = 0; i < 40; ++i) {
+		buffer[i] = i;
+	}
+	
+	Spi::write(0xaa);
+	
+	// 40 bytes need at least 4 ms
+	Spi::setByteDuration(100);
+	TEST_ASSERT_TRUE(Spi::setBuffer(40, buffer));
+	TEST_ASSERT_TRUE(Spi::transfer(Spi::TRANSFER_SEND_BUFFER_DISCARD_RECEIVE));
+	
+	TEST_ASSERT_FALSE(Spi::isFinished());
+	TEST_ASSERT_FALSE(Spi::transfer(Spi::TRANSFER_SEND_BUFFER_DISCARD_RECEIVE));
+	TEST_ASSERT_FALSE(Spi::setBuffer(40, buffer));
+	
+	// waits for the transfer
+	Spi::write(0x55);
+	TEST_ASSERT_TRUE(Spi::isFinished());
+	
+	std::vector<uint8_t> data = Spi::getTransmittedData();
+	TEST_ASSERT_EQUALS(data.size(), 42U);
+	TEST_ASSERT_EQUALS(data[0], 0xaa);
+	TEST_ASSERT_EQUALS_ARRAY(&data[1], buffer, 40);
+	TEST_ASSERT_EQUALS(data[41], 0x55);
+	TEST_ASSERT_EQUALS(Spi::getTransferCount(), 1U);
+	
+	// dummy bytes
+	Spi::setByteDuration(0);
+	TEST_ASSERT_TRUE(Spi::setBuffer(3));
+	TEST_ASSERT_TRUE(Spi::transferSync(Spi::TRANSFER_SEND_DUMMY_DISCARD_RECEIVE));
+	
+	data = Spi::getTransmittedData();
+	TEST_ASSERT_EQUALS(data.size(), 45U);
+	TEST_ASSERT_EQUALS(data[44], 0xff);
+}
+
+void
+ThreadedSpiMasterTest::testReceive()
+{
+	uint8_t transmit[4] = { 1, 2, 3, 4 };
+	uint8_t receive[4] = { 0, 0, 0, 0 };
+	
+	TEST_ASSERT_TRUE(Spi::setBuffer(4, transmit, receive,
+			Spi::BUFFER_INCR_TRANSMIT_DECR_RECEIVE));
+	TEST_ASSERT_TRUE(Spi::transferSync(Spi::TRANSFER_SEND_BUFFER_SAVE_RECEIVE));
+	
+	const uint8_t expected[4] = { 4, 3, 2, 1 };
+	TEST_ASSERT_EQUALS_ARRAY(receive, expected, 4);
+	
+	// without a receive buffer the transmit buffer is overwritten
+	TEST_ASSERT_TRUE(Spi::setBuffer(4, transmit, 0, Spi::BUFFER_DECR_BOTH));
+	TEST_ASSERT_TRUE(Spi::transferSync(Spi::TRANSFER_SEND_BUFFER_SAVE_RECEIVE));
+	
+	const uint8_t unchanged[4] = { 1, 2, 3, 4 };
+	TEST_ASSERT_EQUALS_ARRAY(transmit, unchanged, 4);
+	
+	TEST_ASSERT_EQUALS(Spi::write(0x42), 0x42);
+}
+
+void
+ThreadedSpiMasterTest::testDisplayUpdate()
+{
+	TestDisplay display;
+	display.clear();
+	display.update();
+	Spi::clear();
+	
+	// 5 us per byte (1.6 MHz), 4 pages with 128 byte each
+	Spi::setByteDuration(5);
+	
+	display.fillRectangle(0, 0, 128, 32);
+	TEST_ASSERT_TRUE(display.startUpdate());
+	TEST_ASSERT_TRUE(display.run());
+	TEST_ASSERT_FALSE(Spi::isFinished());
+	
+	// draw the next frame while the first one is transmitted
+	display.clear();
+	display.fillRectangle(0, 32, 128, 32);
+	
+	while (display.run()) {
+	}
+	TEST_ASSERT_EQUALS(display.finished, 2);
+	TEST_ASSERT_EQUALS(Spi::getTransferCount(), 4U);
+	
+	std::vector<uint8_t> data = Spi::getTransmittedData();
+	TEST_ASSERT_EQUALS(data.size(), 4U * (3 + 128));
+	for (uint16_t i = 0; i < data.size(); ++i)
+	{
+		// command bytes at the beginning of every page
+		if ((i % 131) >= 3) {
+			TEST_ASSERT_EQUALS(data[i], 0xff);
+		}
+	}
+	
+	// second frame
+	Spi::clear();
+	display.update();
+	TEST_ASSERT_EQUALS(display.finished, 3);
+	TEST_ASSERT_EQUALS(Spi::getTransmittedData().size(), 8U * (3 + 128));
+}
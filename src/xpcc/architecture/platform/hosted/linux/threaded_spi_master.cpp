@@ -0,0 +1,232 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+#include "threaded_spi_master.hpp"
+
+namespace
+{
+	typedef boost::mutex::scoped_lock	MutexGuard;
+	
+	// Bytes transferred between two checks for the byte duration
+	const uint16_t chunkSize = 16;
+	
+	// Never destroyed, the thread may still wait for them when the
+	// program exits.
+	boost::mutex& mutex = *new boost::mutex;
+	boost::condition_variable& changed = *new boost::condition_variable;
+	boost::thread *thread = 0;
+	
+	// buffer set by setBuffer()
+	uint8_t *transmitBuffer = 0;
+	uint8_t *receiveBuffer = 0;
+	uint16_t bufferLength = 0;
+	xpcc::SpiMaster::BufferIncrease bufferIncrease = xpcc::SpiMaster::BUFFER_INCR_BOTH;
+	
+	// current transfer
+	xpcc::SpiMaster::TransferOptions transferOptions;
+	bool busy = false;
+	
+	uint32_t byteDuration = 0;
+	std::vector<uint8_t> transmitted;
+	uint32_t transferCount = 0;
+	
+	uint8_t
+	exchange(uint16_t index)
+	{
+		const bool transmitIncrease = (bufferIncrease &
+				xpcc::SpiMaster::BUFFER_INCR_TRANSMIT_DECR_RECEIVE);
+		const bool receiveIncrease = (bufferIncrease &
+				xpcc::SpiMaster::BUFFER_DECR_TRANSMIT_INCR_RECEIVE);
+		
+		uint8_t data = 0xff;
+		if ((transferOptions & xpcc::SpiMaster::TRANSFER_SEND_BUFFER_DISCARD_RECEIVE) &&
+				transmitBuffer != 0)
+		{
+			data = transmitBuffer[transmitIncrease ? index : bufferLength - 1 - index];
+		}
+		
+		// loopback
+		if ((transferOptions & xpcc::SpiMaster::TRANSFER_SEND_DUMMY_SAVE_RECEIVE) &&
+				receiveBuffer != 0)
+		{
+			receiveBuffer[receiveIncrease ? index : bufferLength - 1 - index] = data;
+		}
+		return data;
+	}
+	
+	// Works like a DMA channel: reads the buffer while the CPU
+	// continues with something else
+	void
+	run()
+	{
+		MutexGuard lock(mutex);
+		while (true)
+		{
+			while (!busy) {
+				changed.wait(lock);
+			}
+			
+			for (uint16_t i = 0; i < bufferLength; i += chunkSize)
+			{
+				const uint16_t end = (bufferLength - i > chunkSize) ?
+						(i + chunkSize) : bufferLength;
+				
+				if (byteDuration > 0)
+				{
+					lock.unlock();
+					boost::this_thread::sleep(
+							boost::posix_time::microseconds(byteDuration * (end - i)));
+					lock.lock();
+				}
+				
+				for (uint16_t k = i; k < end; ++k) {
+					transmitted.push_back(exchange(k));
+				}
+			}
+			
+			busy = false;
+			changed.notify_all();
+		}
+	}
+	
+	void
+	waitUntilFinished(MutexGuard& lock)
+	{
+		while (busy) {
+			changed.wait(lock);
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+uint8_t
+xpcc::pc::ThreadedSpiMaster::write(uint8_t data)
+{
+	MutexGuard lock(mutex);
+	waitUntilFinished(lock);
+	
+	if (byteDuration > 0) {
+		boost::this_thread::sleep(boost::posix_time::microseconds(byteDuration));
+	}
+	
+	transmitted.push_back(data);
+	return data;
+}
+
+bool
+xpcc::pc::ThreadedSpiMaster::setBuffer(uint16_t length,
+		uint8_t* transmit, uint8_t* receive, BufferIncrease increase)
+{
+	MutexGuard lock(mutex);
+	if (busy) {
+		return false;
+	}
+	
+	transmitBuffer = transmit;
+	receiveBuffer = receive ? receive : transmit;
+	bufferLength = length;
+	bufferIncrease = increase;
+	return true;
+}
+
+bool
+xpcc::pc::ThreadedSpiMaster::transfer(TransferOptions options)
+{
+	MutexGuard lock(mutex);
+	if (busy) {
+		return false;
+	}
+	
+	if (thread == 0) {
+		// never stopped, the thread waits for the next transfer
+		thread = new boost::thread(&run);
+	}
+	
+	transferOptions = options;
+	transferCount++;
+	busy = true;
+	changed.notify_all();
+	return true;
+}
+
+bool
+xpcc::pc::ThreadedSpiMaster::transferSync(TransferOptions options)
+{
+	if (!transfer(options)) {
+		return false;
+	}
+	
+	MutexGuard lock(mutex);
+	waitUntilFinished(lock);
+	return true;
+}
+
+bool
+xpcc::pc::ThreadedSpiMaster::isFinished()
+{
+	MutexGuard lock(mutex);
+	return !busy;
+}
+
+// ----------------------------------------------------------------------------
+void
+xpcc::pc::ThreadedSpiMaster::setByteDuration(uint32_t microseconds)
+{
+	MutexGuard lock(mutex);
+	byteDuration = microseconds;
+}
+
+std::vector<uint8_t>
+xpcc::pc::ThreadedSpiMaster::getTransmittedData()
+{
+	MutexGuard lock(mutex);
+	return transmitted;
+}
+
+uint32_t
+xpcc::pc::ThreadedSpiMaster::getTransferCount()
+{
+	MutexGuard lock(mutex);
+	return transferCount;
+}
+
+void
+xpcc::pc::ThreadedSpiMaster::clear()
+{
+	MutexGuard lock(mutex);
+	waitUntilFinished(lock);
+	
+	transmitted.clear();
+	transferCount = 0;
+}
@@ -0,0 +1,112 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_PC__THREADED_SPI_MASTER_HPP
+#define XPCC_PC__THREADED_SPI_MASTER_HPP
+
+#include <vector>
+#include <stdint.h>
+
+#include <xpcc/driver/connectivity/spi/spi_master.hpp>
+
+namespace xpcc
+{
+	namespace pc
+	{
+		/**
+		 * \brief	SPI master simulated by a background thread
+		 * 
+		 * Behaves like a SPI master with DMA support: transfer() only
+		 * starts the transfer of the buffer given to setBuffer() and
+		 * returns immediately. A background thread then reads the buffer
+		 * at the speed given by setByteDuration(), like a DMA channel
+		 * would do, until isFinished() returns \c true again.
+		 * 
+		 * MOSI is connected to MISO, the received bytes are the
+		 * transmitted ones. Every transmitted byte is recorded and can be
+		 * checked with getTransmittedData().
+		 * 
+		 * Used to test drivers with asynchronous transfers on the PC,
+		 * e.g. xpcc::St7565Async.
+		 * 
+		 * \ingroup	linux
+		 */
+		class ThreadedSpiMaster : public SpiMaster
+		{
+		public:
+			/// Synchronous transfer, waits for a running transfer to finish
+			static uint8_t
+			write(uint8_t data);
+			
+			/// \return \c false if a transfer is running
+			static bool
+			setBuffer(uint16_t length,
+					  uint8_t* transmit=0, uint8_t* receive=0,
+					  BufferIncrease bufferIncrease=BUFFER_INCR_BOTH);
+			
+			/**
+			 * Start an asynchronous transfer
+			 * 
+			 * The buffers must not be changed until isFinished()
+			 * returns \c true.
+			 * 
+			 * \return	\c false if another transfer is still running
+			 */
+			static bool
+			transfer(TransferOptions options=TRANSFER_SEND_BUFFER_SAVE_RECEIVE);
+			
+			/// Start a transfer and wait until it is finished
+			static bool
+			transferSync(TransferOptions options=TRANSFER_SEND_BUFFER_SAVE_RECEIVE);
+			
+			static bool
+			isFinished();
+			
+		public:
+			/// Time needed to transfer one byte, default is zero
+			static void
+			setByteDuration(uint32_t microseconds);
+			
+			/// All bytes transmitted since the last call of clear()
+			static std::vector<uint8_t>
+			getTransmittedData();
+			
+			/// Number of calls of transfer() since the last call of clear()
+			static uint32_t
+			getTransferCount();
+			
+			/// Wait for a running transfer and reset the recorded data
+			static void
+			clear();
+		};
+	}
+}
+
+#endif // XPCC_PC__THREADED_SPI_MASTER_HPP
@@ -0,0 +1,522 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <cstring>
+
+#include "at45db_simulator.hpp"
+
+namespace
+{
+	enum Opcode
+	{
+		CONTINOUS_ARRAY_READ_HIGH_FREQ = 0x0b,
+		CONTINOUS_ARRAY_READ = 0x03,
+		MAIN_MEMORY_PAGE_READ = 0xd2,
+		BUFFER_1_READ = 0xd4,
+		BUFFER_2_READ = 0xd6,
+		BUFFER_1_WRITE = 0x84,
+		BUFFER_2_WRITE = 0x87,
+		MAIN_MEMORY_PAGE_TO_BUFFER_1_TRANSFER = 0x53,
+		MAIN_MEMORY_PAGE_TO_BUFFER_2_TRANSFER = 0x55,
+		MAIN_MEMORY_PAGE_TO_BUFFER_1_COMPARE = 0x60,
+		MAIN_MEMORY_PAGE_TO_BUFFER_2_COMPARE = 0x61,
+		BUFFER_1_TO_MAIN_MEMORY_PAGE_PROGRAM_WITH_ERASE = 0x83,
+		BUFFER_2_TO_MAIN_MEMORY_PAGE_PROGRAM_WITH_ERASE = 0x86,
+		BUFFER_1_TO_MAIN_MEMORY_PAGE_PROGRAM_WITHOUT_ERASE = 0x88,
+		BUFFER_2_TO_MAIN_MEMORY_PAGE_PROGRAM_WITHOUT_ERASE = 0x89,
+		BUFFER_1_PAGE_REWRITE = 0x58,
+		BUFFER_2_PAGE_REWRITE = 0x59,
+		MAIN_MEMORY_PAGE_PROGRAM_THROUGH_BUFFER_1 = 0x82,
+		MAIN_MEMORY_PAGE_PROGRAM_THROUGH_BUFFER_2 = 0x85,
+		PAGE_ERASE = 0x81,
+		BLOCK_ERASE = 0x50,
+		READ_STATUS_REGISTER = 0xd7,
+		
+		// first byte of the four byte sequences
+		CHIP_ERASE = 0xc7,
+		CONFIGURE_PAGE_SIZE = 0x3d,
+	};
+	
+	/// Page to buffer transfers take ~200us instead of 14-35ms
+	const uint16_t TRANSFER_RATIO = 64;
+	
+	/// Number of opcode, address and don't care bytes, 0 for unknown commands
+	uint8_t
+	getHeaderLength(uint8_t opcode)
+	{
+		switch (opcode)
+		{
+			case READ_STATUS_REGISTER:
+				return 1;
+			
+			case CONTINOUS_ARRAY_READ_HIGH_FREQ:
+			case BUFFER_1_READ:
+			case BUFFER_2_READ:
+				return 5;
+			
+			case MAIN_MEMORY_PAGE_READ:
+				return 8;
+			
+			case CONTINOUS_ARRAY_READ:
+			case BUFFER_1_WRITE:
+			case BUFFER_2_WRITE:
+			case MAIN_MEMORY_PAGE_TO_BUFFER_1_TRANSFER:
+			case MAIN_MEMORY_PAGE_TO_BUFFER_2_TRANSFER:
+			case MAIN_MEMORY_PAGE_TO_BUFFER_1_COMPARE:
+			case MAIN_MEMORY_PAGE_TO_BUFFER_2_COMPARE:
+			case BUFFER_1_TO_MAIN_MEMORY_PAGE_PROGRAM_WITH_ERASE:
+			case BUFFER_2_TO_MAIN_MEMORY_PAGE_PROGRAM_WITH_ERASE:
+			case BUFFER_1_TO_MAIN_MEMORY_PAGE_PROGRAM_WITHOUT_ERASE:
+			case BUFFER_2_TO_MAIN_MEMORY_PAGE_PROGRAM_WITHOUT_ERASE:
+			case BUFFER_1_PAGE_REWRITE:
+			case BUFFER_2_PAGE_REWRITE:
+			case MAIN_MEMORY_PAGE_PROGRAM_THROUGH_BUFFER_1:
+			case MAIN_MEMORY_PAGE_PROGRAM_THROUGH_BUFFER_2:
+			case PAGE_ERASE:
+			case BLOCK_ERASE:
+			case CHIP_ERASE:
+			case CONFIGURE_PAGE_SIZE:
+				return 4;
+			
+			default:
+				return 0;
+		}
+	}
+	
+	/// Buffer used by a command, -1 if none
+	int8_t
+	getBuffer(uint8_t opcode)
+	{
+		switch (opcode)
+		{
+			case BUFFER_1_READ:
+			case BUFFER_1_WRITE:
+			case MAIN_MEMORY_PAGE_TO_BUFFER_1_TRANSFER:
+			case MAIN_MEMORY_PAGE_TO_BUFFER_1_COMPARE:
+			case BUFFER_1_TO_MAIN_MEMORY_PAGE_PROGRAM_WITH_ERASE:
+			case BUFFER_1_TO_MAIN_MEMORY_PAGE_PROGRAM_WITHOUT_ERASE:
+			case BUFFER_1_PAGE_REWRITE:
+			case MAIN_MEMORY_PAGE_PROGRAM_THROUGH_BUFFER_1:
+				return 0;
+			
+			case BUFFER_2_READ:
+			case BUFFER_2_WRITE:
+			case MAIN_MEMORY_PAGE_TO_BUFFER_2_TRANSFER:
+			case MAIN_MEMORY_PAGE_TO_BUFFER_2_COMPARE:
+			case BUFFER_2_TO_MAIN_MEMORY_PAGE_PROGRAM_WITH_ERASE:
+			case BUFFER_2_TO_MAIN_MEMORY_PAGE_PROGRAM_WITHOUT_ERASE:
+			case BUFFER_2_PAGE_REWRITE:
+			case MAIN_MEMORY_PAGE_PROGRAM_THROUGH_BUFFER_2:
+				return 1;
+			
+			default:
+				return -1;
+		}
+	}
+	
+	/// Commands which may be used while a program or erase operation runs
+	bool
+	isAllowedWhileBusy(uint8_t opcode)
+	{
+		switch (opcode)
+		{
+			case READ_STATUS_REGISTER:
+			case BUFFER_1_READ:
+			case BUFFER_2_READ:
+			case BUFFER_1_WRITE:
+			case BUFFER_2_WRITE:
+				return true;
+			
+			default:
+				return false;
+		}
+	}
+}
+
+xpcc::pc::FileMemory xpcc::pc::At45dbSimulator::memory;
+uint16_t xpcc::pc::At45dbSimulator::pages = 0;
+
+uint8_t xpcc::pc::At45dbSimulator::buffer[2][PAGE_SIZE];
+
+bool xpcc::pc::At45dbSimulator::selected = false;
+uint8_t xpcc::pc::At45dbSimulator::command[8];
+uint8_t xpcc::pc::At45dbSimulator::length = 0;
+uint32_t xpcc::pc::At45dbSimulator::position = 0;
+
+bool xpcc::pc::At45dbSimulator::binaryPageSize = false;
+bool xpcc::pc::At45dbSimulator::compareDifferent = false;
+uint16_t xpcc::pc::At45dbSimulator::busyPolls = 0;
+uint16_t xpcc::pc::At45dbSimulator::busy = 0;
+int8_t xpcc::pc::At45dbSimulator::busyBuffer = -1;
+
+bool xpcc::pc::At45dbSimulator::powered = true;
+int32_t xpcc::pc::At45dbSimulator::powerFailure = -1;
+
+xpcc::pc::At45dbSimulator::Statistics xpcc::pc::At45dbSimulator::statistics;
+
+// ----------------------------------------------------------------------------
+void
+xpcc::pc::At45dbSimulator::Spi::initialize()
+{
+}
+
+uint8_t
+xpcc::pc::At45dbSimulator::Spi::write(uint8_t data)
+{
+	return At45dbSimulator::transfer(data);
+}
+
+void
+xpcc::pc::At45dbSimulator::Cs::setOutput()
+{
+}
+
+void
+xpcc::pc::At45dbSimulator::Cs::set()
+{
+	if (selected) {
+		At45dbSimulator::execute();
+	}
+	selected = false;
+}
+
+void
+xpcc::pc::At45dbSimulator::Cs::reset()
+{
+	selected = true;
+	length = 0;
+	position = 0;
+}
+
+// ----------------------------------------------------------------------------
+void
+xpcc::pc::At45dbSimulator::initialize(uint16_t pages)
+{
+	At45dbSimulator::pages = pages;
+	memory.create(pages * PAGE_SIZE, 0xff);
+	
+	std::memset(buffer, 0xff, sizeof(buffer));
+	selected = false;
+	binaryPageSize = false;
+	compareDifferent = false;
+	busy = 0;
+	powered = true;
+	powerFailure = -1;
+	resetStatistics();
+}
+
+bool
+xpcc::pc::At45dbSimulator::open(const char *filename, uint16_t pages)
+{
+	initialize(pages);
+	return memory.open(filename, pages * PAGE_SIZE, 0xff);
+}
+
+void
+xpcc::pc::At45dbSimulator::close()
+{
+	memory.close();
+}
+
+void
+xpcc::pc::At45dbSimulator::setBusyPolls(uint16_t polls)
+{
+	busyPolls = polls;
+}
+
+void
+xpcc::pc::At45dbSimulator::resetStatistics()
+{
+	std::memset(&statistics, 0, sizeof(statistics));
+}
+
+void
+xpcc::pc::At45dbSimulator::setPowerFailure(uint32_t programs)
+{
+	powerFailure = programs;
+}
+
+void
+xpcc::pc::At45dbSimulator::powerOn()
+{
+	std::memset(buffer, 0xff, sizeof(buffer));
+	selected = false;
+	compareDifferent = false;
+	busy = 0;
+	powered = true;
+	powerFailure = -1;
+}
+
+// ----------------------------------------------------------------------------
+uint8_t
+xpcc::pc::At45dbSimulator::transfer(uint8_t data)
+{
+	if (!selected || !powered) {
+		return 0xff;
+	}
+	statistics.bytes++;
+	
+	if (length == 0)
+	{
+		command[length++] = data;
+		if (getHeaderLength(data) == 0) {
+			statistics.violations++;
+		}
+		else if (busy > 0 && (!isAllowedWhileBusy(data) ||
+				(getBuffer(data) >= 0 && getBuffer(data) == busyBuffer))) {
+			statistics.violations++;
+		}
+		return 0xff;
+	}
+	
+	uint8_t opcode = command[0];
+	uint8_t header = getHeaderLength(opcode);
+	if (length < header)
+	{
+		command[length++] = data;
+		if (length == header)
+		{
+			uint32_t address = (command[1] << 16) | (command[2] << 8) | command[3];
+			switch (opcode)
+			{
+				case CONTINOUS_ARRAY_READ:
+				case CONTINOUS_ARRAY_READ_HIGH_FREQ:
+					position = address;
+					break;
+				
+				default:
+					position = address & 0xff;
+					break;
+			}
+		}
+		return 0xff;
+	}
+	if (header == 0) {
+		return 0xff;
+	}
+	
+	uint8_t result = 0xff;
+	switch (opcode)
+	{
+		case READ_STATUS_REGISTER:
+			result = getStatus();
+			break;
+		
+		case BUFFER_1_READ:
+		case BUFFER_2_READ:
+			result = buffer[getBuffer(opcode)][position++ % PAGE_SIZE];
+			break;
+		
+		case BUFFER_1_WRITE:
+		case BUFFER_2_WRITE:
+		case MAIN_MEMORY_PAGE_PROGRAM_THROUGH_BUFFER_1:
+		case MAIN_MEMORY_PAGE_PROGRAM_THROUGH_BUFFER_2:
+			buffer[getBuffer(opcode)][position++ % PAGE_SIZE] = data;
+			break;
+		
+		case CONTINOUS_ARRAY_READ:
+		case CONTINOUS_ARRAY_READ_HIGH_FREQ:
+			if (position % PAGE_SIZE == 0) {
+				statistics.pageReads++;
+			}
+			result = memory.getData()[position++ % memory.getSize()];
+			break;
+		
+		case MAIN_MEMORY_PAGE_READ:
+			if (position % PAGE_SIZE == 0) {
+				statistics.pageReads++;
+			}
+			result = memory.getData()[getPage() * PAGE_SIZE + position++ % PAGE_SIZE];
+			break;
+		
+		default:
+			break;
+	}
+	return result;
+}
+
+void
+xpcc::pc::At45dbSimulator::execute()
+{
+	if (length == 0) {
+		return;
+	}
+	statistics.commands++;
+	
+	uint8_t opcode = command[0];
+	if (length < getHeaderLength(opcode) || pages == 0 || !powered) {
+		return;
+	}
+	
+	uint16_t pageAddress = getPage();
+	uint8_t *page = memory.getData() + pageAddress * PAGE_SIZE;
+	int8_t index = getBuffer(opcode);
+	switch (opcode)
+	{
+		case MAIN_MEMORY_PAGE_TO_BUFFER_1_TRANSFER:
+		case MAIN_MEMORY_PAGE_TO_BUFFER_2_TRANSFER:
+			std::memcpy(buffer[index], page, PAGE_SIZE);
+			statistics.pageReads++;
+			startOperation(index, busyPolls / TRANSFER_RATIO);
+			break;
+		
+		case MAIN_MEMORY_PAGE_TO_BUFFER_1_COMPARE:
+		case MAIN_MEMORY_PAGE_TO_BUFFER_2_COMPARE:
+			compareDifferent = (std::memcmp(buffer[index], page, PAGE_SIZE) != 0);
+			statistics.pageReads++;
+			startOperation(index, busyPolls / TRANSFER_RATIO);
+			break;
+		
+		case BUFFER_1_PAGE_REWRITE:
+		case BUFFER_2_PAGE_REWRITE:
+			std::memcpy(buffer[index], page, PAGE_SIZE);
+			statistics.pageReads++;
+			// fall through
+		
+		case BUFFER_1_TO_MAIN_MEMORY_PAGE_PROGRAM_WITH_ERASE:
+		case BUFFER_2_TO_MAIN_MEMORY_PAGE_PROGRAM_WITH_ERASE:
+		case MAIN_MEMORY_PAGE_PROGRAM_THROUGH_BUFFER_1:
+		case MAIN_MEMORY_PAGE_PROGRAM_THROUGH_BUFFER_2:
+			if (program(page, buffer[index], true)) {
+				statistics.erases++;
+				statistics.pagePrograms++;
+				startOperation(index, busyPolls);
+			}
+			memory.store(pageAddress * PAGE_SIZE, PAGE_SIZE);
+			break;
+		
+		case BUFFER_1_TO_MAIN_MEMORY_PAGE_PROGRAM_WITHOUT_ERASE:
+		case BUFFER_2_TO_MAIN_MEMORY_PAGE_PROGRAM_WITHOUT_ERASE:
+			if (program(page, buffer[index], false)) {
+				statistics.pagePrograms++;
+				startOperation(index, busyPolls);
+			}
+			memory.store(pageAddress * PAGE_SIZE, PAGE_SIZE);
+			break;
+		
+		case PAGE_ERASE:
+			std::memset(page, 0xff, PAGE_SIZE);
+			memory.store(pageAddress * PAGE_SIZE, PAGE_SIZE);
+			statistics.erases++;
+			startOperation(-1, busyPolls);
+			break;
+		
+		case BLOCK_ERASE:
+		{
+			uint16_t first = pageAddress & ~0x07;
+			std::memset(memory.getData() + first * PAGE_SIZE, 0xff, 8 * PAGE_SIZE);
+			memory.store(first * PAGE_SIZE, 8 * PAGE_SIZE);
+			statistics.erases++;
+			startOperation(-1, busyPolls);
+			break;
+		}
+		
+		case CHIP_ERASE:
+			if (command[1] == 0x94 && command[2] == 0x80 && command[3] == 0x9a) {
+				std::memset(memory.getData(), 0xff, memory.getSize());
+				memory.store(0, memory.getSize());
+				statistics.erases++;
+				startOperation(-1, busyPolls);
+			}
+			break;
+		
+		case CONFIGURE_PAGE_SIZE:
+			if (command[1] == 0x2a && command[2] == 0x80 && command[3] == 0xa6) {
+				binaryPageSize = true;
+			}
+			break;
+		
+		default:
+			break;
+	}
+}
+
+uint8_t
+xpcc::pc::At45dbSimulator::getStatus()
+{
+	// density code: 0011 for 512 pages, 0101 for 1024, ...
+	uint8_t density = 3;
+	for (uint16_t i = 512; i < pages; i *= 2) {
+		density += 2;
+	}
+	
+	uint8_t status = (density & 0x0f) << 2;
+	if (busy > 0) {
+		busy--;
+		statistics.busyPolls++;
+	}
+	else {
+		status |= 0x80;
+	}
+	if (compareDifferent) {
+		status |= 0x40;
+	}
+	if (binaryPageSize) {
+		status |= 0x01;
+	}
+	return status;
+}
+
+void
+xpcc::pc::At45dbSimulator::startOperation(int8_t buffer, uint16_t polls)
+{
+	busy = polls;
+	busyBuffer = buffer;
+}
+
+uint16_t
+xpcc::pc::At45dbSimulator::getPage()
+{
+	uint32_t address = (command[1] << 16) | (command[2] << 8) | command[3];
+	return (address / PAGE_SIZE) % pages;
+}
+
+bool
+xpcc::pc::At45dbSimulator::program(uint8_t *page, const uint8_t *data, bool erase)
+{
+	uint16_t size = PAGE_SIZE;
+	if (powerFailure == 0) {
+		size = PAGE_SIZE / 2;
+		powered = false;
+		powerFailure = -1;
+	}
+	else if (powerFailure > 0) {
+		powerFailure--;
+	}
+	
+	if (erase) {
+		std::memset(page, 0xff, PAGE_SIZE);
+	}
+	// programming can only clear bits
+	for (uint_fast16_t i = 0; i < size; ++i) {
+		page[i] &= data[i];
+	}
+	return powered;
+}
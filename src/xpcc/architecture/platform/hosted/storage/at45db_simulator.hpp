@@ -0,0 +1,201 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_PC__AT45DB_SIMULATOR_HPP
+#define XPCC_PC__AT45DB_SIMULATOR_HPP
+
+#include <stdint.h>
+
+#include "file_memory.hpp"
+
+namespace xpcc
+{
+	namespace pc
+	{
+		/**
+		 * \brief	Simulated Atmel DataFlash
+		 * 
+		 * Decodes the SPI commands of the AT45DB0x1D family, so the
+		 * unchanged xpcc::At45db0x1d driver can be used on the PC:
+		 * \code
+		 * typedef xpcc::pc::At45dbSimulator Simulator;
+		 * typedef xpcc::At45db0x1d<Simulator::Spi, Simulator::Cs> Flash;
+		 * 
+		 * Simulator::open("flash.bin", 2048);
+		 * Flash::initialize();
+		 * \endcode
+		 * 
+		 * Only the binary page size (256 bytes) is supported. Program and
+		 * erase operations keep the device busy for a configurable number
+		 * of status reads. Commands which are not allowed while the device
+		 * is busy are executed anyway but counted as violations.
+		 * 
+		 * \see		xpcc::At45db0x1d
+		 * \ingroup	hosted
+		 */
+		class At45dbSimulator
+		{
+		public:
+			static const uint16_t PAGE_SIZE = 256;
+			
+			struct Statistics
+			{
+				uint32_t bytes;			///< Transferred SPI bytes
+				uint32_t commands;
+				uint32_t pageReads;		///< Main memory pages read or transferred to a buffer
+				uint32_t pagePrograms;
+				uint32_t erases;		///< Erased pages and blocks
+				uint32_t busyPolls;		///< Status reads while the device was busy
+				uint32_t violations;	///< Unknown commands or commands while busy
+			};
+			
+			/// SPI master connected to the simulated device
+			struct Spi
+			{
+				static void
+				initialize();
+				
+				static uint8_t
+				write(uint8_t data);
+			};
+			
+			/// Chip select
+			struct Cs
+			{
+				static void
+				setOutput();
+				
+				/// Deselect, finishes the command
+				static void
+				set();
+				
+				/// Select, starts a new command
+				static void
+				reset();
+			};
+			
+		public:
+			/// Erased device without a file
+			static void
+			initialize(uint16_t pages);
+			
+			/// Device stored in a file
+			static bool
+			open(const char *filename, uint16_t pages);
+			
+			/// Close the file
+			static void
+			close();
+			
+			/**
+			 * \brief	Number of status reads a program or erase operation takes
+			 * 
+			 * A page to buffer transfer or compare takes 1/64 of it.
+			 * Default is zero, the device is never busy.
+			 */
+			static void
+			setBusyPolls(uint16_t polls);
+			
+			static inline uint8_t *
+			getMemory()
+			{
+				return memory.getData();
+			}
+			
+			static inline const Statistics&
+			getStatistics()
+			{
+				return statistics;
+			}
+			
+			static void
+			resetStatistics();
+			
+			/**
+			 * \brief	Cut the power during a program operation
+			 * 
+			 * After \p programs complete page programs, the next one only
+			 * writes the first half of the page and the rest stays erased.
+			 * The device then ignores all commands until powerOn().
+			 */
+			static void
+			setPowerFailure(uint32_t programs);
+			
+			/// Restore the power, the buffers are lost but the memory is kept
+			static void
+			powerOn();
+			
+		private:
+			static void
+			execute();
+			
+			static uint8_t
+			transfer(uint8_t data);
+			
+			static uint8_t
+			getStatus();
+			
+			/// Make the device busy, \p buffer is used by the operation
+			static void
+			startOperation(int8_t buffer, uint16_t polls);
+			
+			/// Page addressed by the current command
+			static uint16_t
+			getPage();
+			
+			/// Program a page, \c false if the power failed
+			static bool
+			program(uint8_t *page, const uint8_t *data, bool erase);
+			
+			static FileMemory memory;
+			static uint16_t pages;
+			
+			static uint8_t buffer[2][PAGE_SIZE];
+			
+			static bool selected;
+			static uint8_t command[8];
+			static uint8_t length;
+			static uint32_t position;
+			
+			static bool binaryPageSize;
+			static bool compareDifferent;
+			static uint16_t busyPolls;
+			static uint16_t busy;
+			static int8_t busyBuffer;
+			
+			static bool powered;
+			static int32_t powerFailure;
+			
+			static Statistics statistics;
+		};
+	}
+}
+
+#endif	// XPCC_PC__AT45DB_SIMULATOR_HPP
@@ -0,0 +1,91 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include "file_memory.hpp"
+
+// ----------------------------------------------------------------------------
+xpcc::pc::FileMemory::FileMemory() :
+	file(0)
+{
+}
+
+xpcc::pc::FileMemory::~FileMemory()
+{
+	close();
+}
+
+void
+xpcc::pc::FileMemory::create(std::size_t size, uint8_t fill)
+{
+	close();
+	memory.assign(size, fill);
+}
+
+bool
+xpcc::pc::FileMemory::open(const char *filename, std::size_t size, uint8_t fill)
+{
+	create(size, fill);
+	
+	file = std::fopen(filename, "r+b");
+	if (file == 0) {
+		file = std::fopen(filename, "w+b");
+		if (file == 0) {
+			return false;
+		}
+	}
+	
+	std::size_t length = std::fread(&memory[0], 1, size, file);
+	if (length < size) {
+		// extend the file to the full size
+		store(length, size - length);
+	}
+	return true;
+}
+
+void
+xpcc::pc::FileMemory::close()
+{
+	if (file != 0) {
+		std::fclose(file);
+		file = 0;
+	}
+}
+
+void
+xpcc::pc::FileMemory::store(std::size_t offset, std::size_t length)
+{
+	if (file == 0 || length == 0) {
+		return;
+	}
+	
+	std::fseek(file, offset, SEEK_SET);
+	std::fwrite(&memory[offset], 1, length, file);
+	std::fflush(file);
+}
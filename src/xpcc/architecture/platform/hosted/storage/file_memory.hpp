@@ -0,0 +1,107 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_PC__FILE_MEMORY_HPP
+#define XPCC_PC__FILE_MEMORY_HPP
+
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+#include <stdint.h>
+
+namespace xpcc
+{
+	namespace pc
+	{
+		/**
+		 * \brief	Memory of a simulated storage device
+		 * 
+		 * The content is kept in RAM. If a file is opened, it is loaded
+		 * from the file and every change is written back, so the content
+		 * survives the end of the program like on the real device.
+		 * 
+		 * \ingroup	hosted
+		 */
+		class FileMemory
+		{
+		public:
+			FileMemory();
+			
+			~FileMemory();
+			
+			/// Create a memory without a file, every byte is set to \p fill
+			void
+			create(std::size_t size, uint8_t fill);
+			
+			/**
+			 * \brief	Load the memory from a file
+			 * 
+			 * The file is created if it does not exist. Bytes which are
+			 * not contained in the file are set to \p fill.
+			 * 
+			 * \return	\c false if the file could not be opened or created
+			 */
+			bool
+			open(const char *filename, std::size_t size, uint8_t fill);
+			
+			/// Close the file, the content stays available
+			void
+			close();
+			
+			inline uint8_t *
+			getData()
+			{
+				return &memory[0];
+			}
+			
+			inline std::size_t
+			getSize() const
+			{
+				return memory.size();
+			}
+			
+			/// Write a changed range to the file
+			void
+			store(std::size_t offset, std::size_t length);
+			
+		private:
+			// disable copy constructor and assignment operator
+			FileMemory(const FileMemory&);
+			
+			FileMemory&
+			operator = (const FileMemory&);
+			
+			std::vector<uint8_t> memory;
+			std::FILE *file;
+		};
+	}
+}
+
+#endif	// XPCC_PC__FILE_MEMORY_HPP
@@ -0,0 +1,130 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <cstring>
+
+#include "i2c_eeprom_simulator.hpp"
+
+// ----------------------------------------------------------------------------
+xpcc::pc::I2cEepromSimulator::I2cEepromSimulator(uint8_t address,
+		uint32_t size, uint16_t pageSize) :
+	address(address), pageSize(pageSize), pointer(0), addressBytes(0),
+	wrapped(false), written(false), busyPolls(0), busy(0)
+{
+	memory.create(size, 0xff);
+	resetStatistics();
+}
+
+bool
+xpcc::pc::I2cEepromSimulator::open(const char *filename)
+{
+	return memory.open(filename, memory.getSize(), 0xff);
+}
+
+void
+xpcc::pc::I2cEepromSimulator::close()
+{
+	memory.close();
+}
+
+void
+xpcc::pc::I2cEepromSimulator::resetStatistics()
+{
+	std::memset(&statistics, 0, sizeof(statistics));
+}
+
+// ----------------------------------------------------------------------------
+bool
+xpcc::pc::I2cEepromSimulator::selected(uint8_t address)
+{
+	if (address != this->address) {
+		return false;
+	}
+	
+	// The mock master does not report the stop condition, so the write
+	// cycle of the last transaction starts here.
+	if (written) {
+		written = false;
+		busy = busyPolls;
+		statistics.pageWrites++;
+	}
+	
+	if (busy > 0) {
+		busy--;
+		statistics.busyPolls++;
+		return false;
+	}
+	
+	statistics.transactions++;
+	addressBytes = 0;
+	wrapped = false;
+	return true;
+}
+
+void
+xpcc::pc::I2cEepromSimulator::write(const uint8_t *data, std::size_t size)
+{
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		if (addressBytes < 2) {
+			pointer = (pointer << 8) | data[i];
+			if (++addressBytes == 2) {
+				pointer %= memory.getSize();
+			}
+			continue;
+		}
+		
+		if (wrapped) {
+			wrapped = false;
+			statistics.pageWraps++;
+		}
+		
+		memory.getData()[pointer] = data[i];
+		memory.store(pointer, 1);
+		statistics.bytesWritten++;
+		written = true;
+		
+		// only the lower bits are incremented
+		uint16_t page = pointer - (pointer % pageSize);
+		pointer = page + ((pointer + 1) % pageSize);
+		wrapped = (pointer == page);
+	}
+}
+
+void
+xpcc::pc::I2cEepromSimulator::read(uint8_t *data, std::size_t size)
+{
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		data[i] = memory.getData()[pointer];
+		pointer = (pointer + 1) % memory.getSize();
+		statistics.bytesRead++;
+	}
+}
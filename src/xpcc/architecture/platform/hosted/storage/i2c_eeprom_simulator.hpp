@@ -0,0 +1,142 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_PC__I2C_EEPROM_SIMULATOR_HPP
+#define XPCC_PC__I2C_EEPROM_SIMULATOR_HPP
+
+#include <stdint.h>
+
+#include <xpcc/driver/connectivity/i2c/mock_master.hpp>
+
+#include "file_memory.hpp"
+
+namespace xpcc
+{
+	namespace pc
+	{
+		/**
+		 * \brief	Simulated I2C EEPROM with a 16-bit address pointer
+		 * 
+		 * Behaves like a 24C256 connected to xpcc::i2c::MockMaster:
+		 * \code
+		 * xpcc::pc::I2cEepromSimulator eeprom(0x50, 32768, 64);
+		 * xpcc::i2c::MockMaster::attachSlave(&eeprom);
+		 * 
+		 * xpcc::I2cEeprom<xpcc::i2c::MockMaster> driver(0x50);
+		 * \endcode
+		 * 
+		 * Writes wrap around at the end of a page like on the real
+		 * device. After a write the device does not acknowledge its
+		 * address for a configurable number of attempts.
+		 * 
+		 * \see		xpcc::I2cEeprom
+		 * \ingroup	hosted
+		 */
+		class I2cEepromSimulator : public xpcc::i2c::MockMaster::Slave
+		{
+		public:
+			struct Statistics
+			{
+				uint32_t transactions;	///< Acknowledged addresses
+				uint32_t bytesRead;
+				uint32_t bytesWritten;
+				uint32_t pageWrites;	///< Write cycles
+				uint32_t pageWraps;		///< Writes continued at the beginning of the page
+				uint32_t busyPolls;		///< Not acknowledged addresses during a write cycle
+			};
+			
+		public:
+			/**
+			 * \param	address		7-bit address
+			 * \param	size		Size of the memory in bytes
+			 * \param	pageSize	Size of a page in bytes
+			 */
+			I2cEepromSimulator(uint8_t address = 0x50,
+					uint32_t size = 32768, uint16_t pageSize = 64);
+			
+			/// Store the content in a file
+			bool
+			open(const char *filename);
+			
+			void
+			close();
+			
+			/// Number of addresses not acknowledged after a write
+			inline void
+			setBusyPolls(uint16_t polls)
+			{
+				busyPolls = polls;
+			}
+			
+			inline uint8_t *
+			getMemory()
+			{
+				return memory.getData();
+			}
+			
+			inline const Statistics&
+			getStatistics() const
+			{
+				return statistics;
+			}
+			
+			void
+			resetStatistics();
+			
+		public:
+			virtual bool
+			selected(uint8_t address);
+			
+			virtual void
+			write(const uint8_t *data, std::size_t size);
+			
+			virtual void
+			read(uint8_t *data, std::size_t size);
+			
+		private:
+			uint8_t address;
+			uint16_t pageSize;
+			FileMemory memory;
+			
+			uint16_t pointer;
+			uint8_t addressBytes;
+			bool wrapped;
+			
+			/// Data has been written, the write cycle starts with the stop
+			bool written;
+			uint16_t busyPolls;
+			uint16_t busy;
+			
+			Statistics statistics;
+		};
+	}
+}
+
+#endif	// XPCC_PC__I2C_EEPROM_SIMULATOR_HPP
@@ -0,0 +1,186 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <cstring>
+#include <vector>
+
+#include "image_file_volume.hpp"
+
+// ----------------------------------------------------------------------------
+xpcc::pc::ImageFileVolume::ImageFileVolume(const char *filename, uint32_t sectors) :
+	filename(filename), file(0), sectors(sectors), status(STA_NOINIT)
+{
+	resetStatistics();
+}
+
+xpcc::pc::ImageFileVolume::~ImageFileVolume()
+{
+	close();
+}
+
+xpcc::fat::Status
+xpcc::pc::ImageFileVolume::initialize()
+{
+	close();
+	
+	file = std::fopen(filename, "r+b");
+	if (file == 0) {
+		file = std::fopen(filename, "w+b");
+		if (file == 0) {
+			return status;
+		}
+	}
+	
+	std::fseek(file, 0, SEEK_END);
+	uint32_t size = std::ftell(file) / SECTOR_SIZE;
+	if (sectors == 0) {
+		sectors = size;
+	}
+	else if (size < sectors)
+	{
+		// extend the file to the full size
+		std::vector<uint8_t> zero(SECTOR_SIZE, 0);
+		std::fseek(file, static_cast<long>(size) * SECTOR_SIZE, SEEK_SET);
+		for (uint32_t i = size; i < sectors; ++i) {
+			std::fwrite(&zero[0], 1, SECTOR_SIZE, file);
+		}
+		std::fflush(file);
+	}
+	
+	if (sectors > 0) {
+		status = 0;
+	}
+	return status;
+}
+
+xpcc::fat::Status
+xpcc::pc::ImageFileVolume::getStatus()
+{
+	return status;
+}
+
+xpcc::fat::Result
+xpcc::pc::ImageFileVolume::read(uint8_t *buffer,
+		int32_t sectorNumber, uint8_t sectorCount)
+{
+	if (status & STA_NOINIT) {
+		return RES_NOTRDY;
+	}
+	if (!seek(sectorNumber, sectorCount)) {
+		return RES_PARERR;
+	}
+	
+	statistics.reads++;
+	statistics.sectorsRead += sectorCount;
+	
+	std::size_t length = sectorCount * SECTOR_SIZE;
+	if (std::fread(buffer, 1, length, file) != length) {
+		return RES_ERROR;
+	}
+	return RES_OK;
+}
+
+xpcc::fat::Result
+xpcc::pc::ImageFileVolume::write(const uint8_t *buffer,
+		int32_t sectorNumber, uint8_t sectorCount)
+{
+	if (status & STA_NOINIT) {
+		return RES_NOTRDY;
+	}
+	if (!seek(sectorNumber, sectorCount)) {
+		return RES_PARERR;
+	}
+	
+	statistics.writes++;
+	statistics.sectorsWritten += sectorCount;
+	
+	std::size_t length = sectorCount * SECTOR_SIZE;
+	if (std::fwrite(buffer, 1, length, file) != length) {
+		return RES_ERROR;
+	}
+	return RES_OK;
+}
+
+xpcc::fat::Result
+xpcc::pc::ImageFileVolume::ioctl(uint8_t command, uint32_t *buffer)
+{
+	if (status & STA_NOINIT) {
+		return RES_NOTRDY;
+	}
+	
+	switch (command)
+	{
+		case CTRL_SYNC:
+			return (std::fflush(file) == 0) ? RES_OK : RES_ERROR;
+		
+		case GET_SECTOR_COUNT:
+			*buffer = sectors;
+			return RES_OK;
+		
+		case GET_SECTOR_SIZE:
+			// FatFs expects a WORD here
+			*reinterpret_cast<uint16_t *>(buffer) = SECTOR_SIZE;
+			return RES_OK;
+		
+		case GET_BLOCK_SIZE:
+			*buffer = 1;
+			return RES_OK;
+		
+		default:
+			return RES_PARERR;
+	}
+}
+
+void
+xpcc::pc::ImageFileVolume::close()
+{
+	if (file != 0) {
+		std::fclose(file);
+		file = 0;
+	}
+	status = STA_NOINIT;
+}
+
+void
+xpcc::pc::ImageFileVolume::resetStatistics()
+{
+	std::memset(&statistics, 0, sizeof(statistics));
+}
+
+// ----------------------------------------------------------------------------
+bool
+xpcc::pc::ImageFileVolume::seek(int32_t sectorNumber, uint8_t sectorCount)
+{
+	if (sectorNumber < 0 || sectorCount == 0 ||
+			static_cast<uint32_t>(sectorNumber) + sectorCount > sectors) {
+		return false;
+	}
+	return (std::fseek(file, static_cast<long>(sectorNumber) * SECTOR_SIZE, SEEK_SET) == 0);
+}
@@ -0,0 +1,141 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_PC__IMAGE_FILE_VOLUME_HPP
+#define XPCC_PC__IMAGE_FILE_VOLUME_HPP
+
+#include <cstdio>
+#include <stdint.h>
+
+#include <xpcc/driver/storage/fat.hpp>
+
+namespace xpcc
+{
+	namespace pc
+	{
+		/**
+		 * \brief	FAT volume stored in a disk image file
+		 * 
+		 * Every read and write is passed directly to the file, so
+		 * images of any size can be used. The image can be created with
+		 * f_mkfs() or e.g. with
+		 * \code
+		 * dd if=/dev/zero of=card.img bs=1M count=64
+		 * mkfs.vfat card.img
+		 * \endcode
+		 * and then be used like a card:
+		 * \code
+		 * xpcc::pc::ImageFileVolume volume("card.img");
+		 * xpcc::fat::FileSystem fileSystem(&volume);
+		 * \endcode
+		 * 
+		 * \ingroup	hosted
+		 */
+		class ImageFileVolume : public fat::PhysicalVolume
+		{
+		public:
+			static const uint16_t SECTOR_SIZE = 512;
+			
+			struct Statistics
+			{
+				uint32_t reads;				///< Calls of read()
+				uint32_t writes;			///< Calls of write()
+				uint32_t sectorsRead;
+				uint32_t sectorsWritten;
+			};
+			
+		public:
+			/**
+			 * \param	filename	Must stay valid until the volume is destroyed
+			 * \param	sectors		Size of the image, the file is created or
+			 * 						extended if necessary. Zero uses the size
+			 * 						of the existing file.
+			 */
+			ImageFileVolume(const char *filename, uint32_t sectors = 0);
+			
+			virtual
+			~ImageFileVolume();
+			
+			/// Open the image file
+			virtual fat::Status
+			initialize();
+			
+			virtual fat::Status
+			getStatus();
+			
+			virtual fat::Result
+			read(uint8_t *buffer, int32_t sectorNumber, uint8_t sectorCount);
+			
+			virtual fat::Result
+			write(const uint8_t *buffer, int32_t sectorNumber, uint8_t sectorCount);
+			
+			/**
+			 * \brief	Execute a command
+			 * 
+			 * Supports CTRL_SYNC, which flushes the file, and
+			 * GET_SECTOR_COUNT, GET_SECTOR_SIZE and GET_BLOCK_SIZE.
+			 */
+			virtual fat::Result
+			ioctl(uint8_t command, uint32_t *buffer);
+			
+			/// Close the image file
+			void
+			close();
+			
+			inline const Statistics&
+			getStatistics() const
+			{
+				return statistics;
+			}
+			
+			void
+			resetStatistics();
+			
+		private:
+			// disable copy constructor and assignment operator
+			ImageFileVolume(const ImageFileVolume&);
+			
+			ImageFileVolume&
+			operator = (const ImageFileVolume&);
+			
+			bool
+			seek(int32_t sectorNumber, uint8_t sectorCount);
+			
+			const char *filename;
+			std::FILE *file;
+			uint32_t sectors;
+			fat::Status status;
+			
+			Statistics statistics;
+		};
+	}
+}
+
+#endif	// XPCC_PC__IMAGE_FILE_VOLUME_HPP
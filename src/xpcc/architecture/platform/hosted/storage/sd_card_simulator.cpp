@@ -0,0 +1,493 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <cstring>
+
+#include "sd_card_simulator.hpp"
+
+namespace
+{
+	/// Number of ACMD41 commands until the card leaves the idle state
+	const uint8_t INITIALIZATION_POLLS = 2;
+	
+	/// A block of a multiple block write keeps the card busy shorter
+	const uint16_t MULTIPLE_BLOCK_RATIO = 8;
+	
+	// R1 response
+	const uint8_t IDLE = 0x01;
+	const uint8_t ILLEGAL_COMMAND = 0x04;
+	const uint8_t CRC_ERROR = 0x08;
+	const uint8_t PARAMETER_ERROR = 0x40;
+	
+	const uint8_t DATA_ACCEPTED = 0x05;
+}
+
+xpcc::pc::FileMemory xpcc::pc::SdCardSimulator::memory;
+uint32_t xpcc::pc::SdCardSimulator::sectors = 0;
+
+bool xpcc::pc::SdCardSimulator::selected = false;
+xpcc::pc::SdCardSimulator::State xpcc::pc::SdCardSimulator::state = COMMAND;
+uint8_t xpcc::pc::SdCardSimulator::command[6];
+uint8_t xpcc::pc::SdCardSimulator::commandLength = 0;
+
+uint8_t xpcc::pc::SdCardSimulator::response[24];
+uint8_t xpcc::pc::SdCardSimulator::responseLength = 0;
+uint8_t xpcc::pc::SdCardSimulator::responsePosition = 0;
+
+bool xpcc::pc::SdCardSimulator::idle = true;
+bool xpcc::pc::SdCardSimulator::applicationCommand = false;
+uint8_t xpcc::pc::SdCardSimulator::initializationPolls = 0;
+
+bool xpcc::pc::SdCardSimulator::multipleBlock = false;
+uint32_t xpcc::pc::SdCardSimulator::sector = 0;
+uint16_t xpcc::pc::SdCardSimulator::position = 0;
+uint8_t xpcc::pc::SdCardSimulator::block[SECTOR_SIZE];
+
+uint16_t xpcc::pc::SdCardSimulator::accessPolls = 0;
+uint16_t xpcc::pc::SdCardSimulator::programPolls = 0;
+uint16_t xpcc::pc::SdCardSimulator::latency = 0;
+uint16_t xpcc::pc::SdCardSimulator::busy = 0;
+
+uint8_t *xpcc::pc::SdCardSimulator::transmitBuffer = 0;
+uint8_t *xpcc::pc::SdCardSimulator::receiveBuffer = 0;
+uint16_t xpcc::pc::SdCardSimulator::bufferLength = 0;
+
+xpcc::pc::SdCardSimulator::Statistics xpcc::pc::SdCardSimulator::statistics;
+
+// ----------------------------------------------------------------------------
+void
+xpcc::pc::SdCardSimulator::Spi::initialize()
+{
+}
+
+uint8_t
+xpcc::pc::SdCardSimulator::Spi::write(uint8_t data)
+{
+	return SdCardSimulator::transfer(data);
+}
+
+bool
+xpcc::pc::SdCardSimulator::Spi::setBuffer(uint16_t length,
+		uint8_t* transmit, uint8_t* receive, BufferIncrease /*bufferIncrease*/)
+{
+	// only incrementing buffers are supported
+	transmitBuffer = transmit;
+	receiveBuffer = receive ? receive : transmit;
+	bufferLength = length;
+	return true;
+}
+
+bool
+xpcc::pc::SdCardSimulator::Spi::transfer(TransferOptions options)
+{
+	bool transmit = (options & TRANSFER_SEND_BUFFER_DISCARD_RECEIVE) && transmitBuffer;
+	bool receive = (options & TRANSFER_SEND_DUMMY_SAVE_RECEIVE) && receiveBuffer;
+	
+	statistics.bufferTransfers++;
+	for (uint_fast16_t i = 0; i < bufferLength; ++i)
+	{
+		uint8_t data = SdCardSimulator::transfer(transmit ? transmitBuffer[i] : 0xff);
+		if (receive) {
+			receiveBuffer[i] = data;
+		}
+	}
+	return true;
+}
+
+bool
+xpcc::pc::SdCardSimulator::Spi::transferSync(TransferOptions options)
+{
+	return transfer(options);
+}
+
+bool
+xpcc::pc::SdCardSimulator::Spi::isFinished()
+{
+	return true;
+}
+
+void
+xpcc::pc::SdCardSimulator::Cs::setOutput()
+{
+}
+
+void
+xpcc::pc::SdCardSimulator::Cs::set()
+{
+	selected = false;
+	commandLength = 0;
+}
+
+void
+xpcc::pc::SdCardSimulator::Cs::reset()
+{
+	selected = true;
+}
+
+// ----------------------------------------------------------------------------
+void
+xpcc::pc::SdCardSimulator::initialize(uint32_t sectors)
+{
+	SdCardSimulator::sectors = sectors;
+	memory.create(sectors * SECTOR_SIZE, 0xff);
+	
+	selected = false;
+	state = COMMAND;
+	commandLength = 0;
+	responseLength = 0;
+	responsePosition = 0;
+	idle = true;
+	applicationCommand = false;
+	initializationPolls = INITIALIZATION_POLLS;
+	latency = 0;
+	busy = 0;
+	resetStatistics();
+}
+
+bool
+xpcc::pc::SdCardSimulator::open(const char *filename, uint32_t sectors)
+{
+	initialize(sectors);
+	return memory.open(filename, sectors * SECTOR_SIZE, 0xff);
+}
+
+void
+xpcc::pc::SdCardSimulator::close()
+{
+	memory.close();
+}
+
+void
+xpcc::pc::SdCardSimulator::setLatency(uint16_t accessPolls, uint16_t programPolls)
+{
+	SdCardSimulator::accessPolls = accessPolls;
+	SdCardSimulator::programPolls = programPolls;
+}
+
+void
+xpcc::pc::SdCardSimulator::resetStatistics()
+{
+	std::memset(&statistics, 0, sizeof(statistics));
+}
+
+// ----------------------------------------------------------------------------
+uint8_t
+xpcc::pc::SdCardSimulator::transfer(uint8_t data)
+{
+	if (!selected) {
+		return 0xff;
+	}
+	statistics.bytes++;
+	
+	if (responsePosition < responseLength) {
+		return response[responsePosition++];
+	}
+	
+	if (busy > 0)
+	{
+		// DO is held low while the card programs its flash
+		busy--;
+		statistics.busyPolls++;
+		if (data != 0xff) {
+			statistics.violations++;
+		}
+		return 0x00;
+	}
+	
+	if (state == READ)
+	{
+		if ((data & 0xc0) != 0x40) {
+			return read();
+		}
+		// new command (CMD12) while the data is sent
+		state = COMMAND;
+	}
+	else if (state == WRITE)
+	{
+		if (position > 0) {
+			write(data);
+			return 0xff;
+		}
+		
+		if ((data == 0xfe && !multipleBlock) || (data == 0xfc && multipleBlock)) {
+			// start token
+			position = 1;
+			return 0xff;
+		}
+		if (data == 0xfd && multipleBlock) {
+			// stop token
+			state = COMMAND;
+			busy = programPolls;
+			return 0xff;
+		}
+		if (data == 0xff) {
+			return 0xff;
+		}
+		state = COMMAND;
+	}
+	
+	if (commandLength == 0 && (data & 0xc0) != 0x40) {
+		return 0xff;
+	}
+	command[commandLength++] = data;
+	if (commandLength == sizeof(command)) {
+		commandLength = 0;
+		execute();
+	}
+	return 0xff;
+}
+
+void
+xpcc::pc::SdCardSimulator::execute()
+{
+	statistics.commands++;
+	
+	const uint8_t index = command[0] & 0x3f;
+	const uint32_t argument = (static_cast<uint32_t>(command[1]) << 24) |
+			(static_cast<uint32_t>(command[2]) << 16) |
+			(static_cast<uint32_t>(command[3]) << 8) | command[4];
+	const bool application = applicationCommand;
+	applicationCommand = false;
+	
+	// Ncr of one byte, R1 and additional data
+	uint8_t data[22];
+	uint8_t length = 2;
+	data[0] = 0xff;
+	
+	uint8_t r1 = idle ? IDLE : 0;
+	switch (index)
+	{
+		case 0:		// GO_IDLE_STATE
+			if (command[5] != 0x95) {
+				r1 |= CRC_ERROR;
+				statistics.violations++;
+				break;
+			}
+			idle = true;
+			initializationPolls = INITIALIZATION_POLLS;
+			state = COMMAND;
+			r1 = IDLE;
+			break;
+		
+		case 8:		// SEND_IF_COND
+			if (command[5] != 0x87) {
+				r1 |= CRC_ERROR;
+				statistics.violations++;
+				break;
+			}
+			// echo voltage and check pattern
+			data[2] = 0;
+			data[3] = 0;
+			data[4] = command[3] & 0x0f;
+			data[5] = command[4];
+			length = 6;
+			break;
+		
+		case 55:	// APP_CMD
+			applicationCommand = true;
+			break;
+		
+		case 41:	// SD_SEND_OP_COND
+			if (!application) {
+				r1 |= ILLEGAL_COMMAND;
+				statistics.violations++;
+				break;
+			}
+			if (initializationPolls > 0) {
+				initializationPolls--;
+			}
+			else {
+				idle = false;
+			}
+			r1 = idle ? IDLE : 0;
+			break;
+		
+		case 58:	// READ_OCR
+			// power up status, card capacity status (SDHC), 2.7-3.6V
+			data[2] = idle ? 0x40 : 0xc0;
+			data[3] = 0xff;
+			data[4] = 0x80;
+			data[5] = 0x00;
+			length = 6;
+			break;
+		
+		case 9:		// SEND_CSD
+		{
+			// CSD version 2.0
+			uint8_t *csd = data + 4;
+			std::memset(csd, 0, 16);
+			uint32_t size = sectors / 1024 - 1;
+			csd[0] = 0x40;
+			csd[7] = (size >> 16) & 0x3f;
+			csd[8] = size >> 8;
+			csd[9] = size;
+			
+			data[2] = 0xff;
+			data[3] = 0xfe;
+			data[20] = 0xff;
+			data[21] = 0xff;
+			length = 22;
+			break;
+		}
+		
+		case 12:	// STOP_TRANSMISSION
+			state = COMMAND;
+			break;
+		
+		case 16:	// SET_BLOCKLEN, fixed to 512 for SDHC
+			break;
+		
+		case 23:	// SET_WR_BLK_ERASE_COUNT
+			if (!application) {
+				r1 |= ILLEGAL_COMMAND;
+				statistics.violations++;
+			}
+			break;
+		
+		case 17:	// READ_SINGLE_BLOCK
+		case 18:	// READ_MULTIPLE_BLOCK
+		case 24:	// WRITE_BLOCK
+		case 25:	// WRITE_MULTIPLE_BLOCK
+			if (idle) {
+				r1 |= ILLEGAL_COMMAND;
+				statistics.violations++;
+				break;
+			}
+			if (argument >= sectors) {
+				r1 |= PARAMETER_ERROR;
+				break;
+			}
+			
+			sector = argument;
+			position = 0;
+			multipleBlock = (index == 18 || index == 25);
+			if (index == 17 || index == 18)
+			{
+				state = READ;
+				latency = accessPolls;
+				if (multipleBlock) {
+					statistics.multipleBlockReads++;
+				}
+				else {
+					statistics.singleBlockReads++;
+				}
+			}
+			else
+			{
+				state = WRITE;
+				if (multipleBlock) {
+					statistics.multipleBlockWrites++;
+				}
+				else {
+					statistics.singleBlockWrites++;
+				}
+			}
+			break;
+		
+		default:
+			r1 |= ILLEGAL_COMMAND;
+			statistics.violations++;
+			break;
+	}
+	
+	data[1] = r1;
+	respond(data, length);
+}
+
+uint8_t
+xpcc::pc::SdCardSimulator::read()
+{
+	if (latency > 0) {
+		latency--;
+		return 0xff;
+	}
+	
+	uint8_t result;
+	if (position == 0) {
+		// start token
+		result = 0xfe;
+	}
+	else if (position <= SECTOR_SIZE) {
+		result = memory.getData()[sector * SECTOR_SIZE + position - 1];
+	}
+	else {
+		// CRC
+		result = 0xff;
+	}
+	
+	position++;
+	if (position == SECTOR_SIZE + 3)
+	{
+		statistics.blocksRead++;
+		position = 0;
+		if (multipleBlock && sector + 1 < sectors) {
+			sector++;
+		}
+		else {
+			state = COMMAND;
+		}
+	}
+	return result;
+}
+
+void
+xpcc::pc::SdCardSimulator::write(uint8_t data)
+{
+	if (position <= SECTOR_SIZE) {
+		block[position - 1] = data;
+	}
+	
+	position++;
+	if (position == SECTOR_SIZE + 3)
+	{
+		std::memcpy(memory.getData() + sector * SECTOR_SIZE, block, SECTOR_SIZE);
+		memory.store(sector * SECTOR_SIZE, SECTOR_SIZE);
+		statistics.blocksWritten++;
+		respond(&DATA_ACCEPTED, 1);
+		
+		position = 0;
+		if (multipleBlock && sector + 1 < sectors) {
+			sector++;
+			busy = programPolls / MULTIPLE_BLOCK_RATIO;
+		}
+		else {
+			state = COMMAND;
+			busy = programPolls;
+		}
+	}
+}
+
+void
+xpcc::pc::SdCardSimulator::respond(const uint8_t *data, uint8_t length)
+{
+	std::memcpy(response, data, length);
+	responseLength = length;
+	responsePosition = 0;
+}
@@ -0,0 +1,226 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_PC__SD_CARD_SIMULATOR_HPP
+#define XPCC_PC__SD_CARD_SIMULATOR_HPP
+
+#include <stdint.h>
+
+#include <xpcc/driver/connectivity/spi/spi_master.hpp>
+
+#include "file_memory.hpp"
+
+namespace xpcc
+{
+	namespace pc
+	{
+		/**
+		 * \brief	Simulated SDHC card in SPI mode
+		 * 
+		 * Decodes the SPI commands, so xpcc::fat::SdCardVolume can be
+		 * used unchanged on the PC:
+		 * \code
+		 * typedef xpcc::pc::SdCardSimulator Simulator;
+		 * xpcc::fat::SdCardVolume<Simulator::Spi, Simulator::Cs> volume;
+		 * 
+		 * Simulator::open("card.img", 65536);
+		 * volume.initialize();
+		 * \endcode
+		 * 
+		 * The card has to be initialized with CMD0, CMD8 and ACMD41
+		 * before it accepts other commands. It supports single and
+		 * multiple block reads and writes (CMD17, CMD18, CMD24, CMD25),
+		 * reading the CSD and OCR registers and the pre-erase count
+		 * (ACMD23). Wrong CRCs of CMD0 and CMD8, unknown commands and
+		 * commands sent while the card is busy are counted as violations.
+		 * 
+		 * The time a real card needs is simulated by a number of
+		 * \c 0xff bytes before the data token of a read command and
+		 * by busy bytes after a written block:
+		 * - The first block of a read command waits \c accessPolls
+		 *   bytes, the following blocks of CMD18 are sent immediately.
+		 * - A block written with CMD24 and the stop token of CMD25 keep
+		 *   the card busy for \c programPolls bytes, every block of CMD25
+		 *   for 1/8 of it.
+		 * 
+		 * \ingroup	hosted
+		 */
+		class SdCardSimulator
+		{
+		public:
+			static const uint16_t SECTOR_SIZE = 512;
+			
+			struct Statistics
+			{
+				uint32_t bytes;					///< Transferred SPI bytes
+				uint32_t bufferTransfers;		///< Calls of Spi::transferSync()
+				uint32_t commands;
+				uint32_t singleBlockReads;
+				uint32_t multipleBlockReads;
+				uint32_t singleBlockWrites;
+				uint32_t multipleBlockWrites;
+				uint32_t blocksRead;
+				uint32_t blocksWritten;
+				uint32_t busyPolls;				///< Bytes while the card was busy
+				uint32_t violations;
+			};
+			
+			/// SPI master connected to the simulated card
+			struct Spi : public xpcc::SpiMaster
+			{
+				static void
+				initialize();
+				
+				static uint8_t
+				write(uint8_t data);
+				
+				static bool
+				setBuffer(uint16_t length,
+						uint8_t* transmit=0, uint8_t* receive=0,
+						BufferIncrease bufferIncrease=BUFFER_INCR_BOTH);
+				
+				static bool
+				transfer(TransferOptions options=TRANSFER_SEND_BUFFER_SAVE_RECEIVE);
+				
+				static bool
+				transferSync(TransferOptions options=TRANSFER_SEND_BUFFER_SAVE_RECEIVE);
+				
+				static bool
+				isFinished();
+			};
+			
+			/// Chip select
+			struct Cs
+			{
+				static void
+				setOutput();
+				
+				static void
+				set();
+				
+				static void
+				reset();
+			};
+			
+		public:
+			/**
+			 * \brief	Erased card without a file
+			 * 
+			 * \param	sectors		Multiple of 1024 (512kB)
+			 */
+			static void
+			initialize(uint32_t sectors);
+			
+			/// Card image stored in a file
+			static bool
+			open(const char *filename, uint32_t sectors);
+			
+			static void
+			close();
+			
+			/// Simulated access and programming time, default is zero
+			static void
+			setLatency(uint16_t accessPolls, uint16_t programPolls);
+			
+			static inline uint8_t *
+			getMemory()
+			{
+				return memory.getData();
+			}
+			
+			static inline const Statistics&
+			getStatistics()
+			{
+				return statistics;
+			}
+			
+			static void
+			resetStatistics();
+			
+		private:
+			enum State
+			{
+				COMMAND,
+				READ,
+				WRITE,
+			};
+			
+			static uint8_t
+			transfer(uint8_t data);
+			
+			/// Execute a complete command
+			static void
+			execute();
+			
+			static uint8_t
+			read();
+			
+			static void
+			write(uint8_t data);
+			
+			static void
+			respond(const uint8_t *data, uint8_t length);
+			
+			static FileMemory memory;
+			static uint32_t sectors;
+			
+			static bool selected;
+			static State state;
+			static uint8_t command[6];
+			static uint8_t commandLength;
+			
+			static uint8_t response[24];
+			static uint8_t responseLength;
+			static uint8_t responsePosition;
+			
+			static bool idle;
+			static bool applicationCommand;
+			static uint8_t initializationPolls;
+			
+			static bool multipleBlock;
+			static uint32_t sector;
+			static uint16_t position;
+			static uint8_t block[SECTOR_SIZE];
+			
+			static uint16_t accessPolls;
+			static uint16_t programPolls;
+			static uint16_t latency;
+			static uint16_t busy;
+			
+			static uint8_t *transmitBuffer;
+			static uint8_t *receiveBuffer;
+			static uint16_t bufferLength;
+			
+			static Statistics statistics;
+		};
+	}
+}
+
+#endif	// XPCC_PC__SD_CARD_SIMULATOR_HPP
@@ -0,0 +1,238 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <cstring>
+
+#include "spi_ram_simulator.hpp"
+
+namespace
+{
+	enum Instruction
+	{
+		READ = 0x03,
+		WRITE = 0x02,
+		READ_STATUS_REGISTER = 0x05,
+		WRITE_STATUS_REGISTER = 0x01
+	};
+	
+	enum Mode
+	{
+		BYTE_MODE = 0x00,
+		PAGE_MODE = 0x80,
+		SEQUENTIAL_MODE = 0x40,
+		MODE_MASK = 0xc0
+	};
+}
+
+xpcc::pc::FileMemory xpcc::pc::SpiRamSimulator::memory;
+
+bool xpcc::pc::SpiRamSimulator::selected = false;
+bool xpcc::pc::SpiRamSimulator::held = false;
+uint8_t xpcc::pc::SpiRamSimulator::status = BYTE_MODE;
+
+uint8_t xpcc::pc::SpiRamSimulator::command;
+uint8_t xpcc::pc::SpiRamSimulator::length = 0;
+uint16_t xpcc::pc::SpiRamSimulator::address;
+
+uint16_t xpcc::pc::SpiRamSimulator::writeStart;
+uint32_t xpcc::pc::SpiRamSimulator::written;
+
+xpcc::pc::SpiRamSimulator::Statistics xpcc::pc::SpiRamSimulator::statistics;
+
+// ----------------------------------------------------------------------------
+void
+xpcc::pc::SpiRamSimulator::Spi::initialize()
+{
+}
+
+uint8_t
+xpcc::pc::SpiRamSimulator::Spi::write(uint8_t data)
+{
+	return SpiRamSimulator::transfer(data);
+}
+
+void
+xpcc::pc::SpiRamSimulator::Cs::setOutput()
+{
+}
+
+void
+xpcc::pc::SpiRamSimulator::Cs::set()
+{
+	if (selected && written > 0)
+	{
+		// the written bytes can wrap around
+		if ((status & MODE_MASK) == PAGE_MODE) {
+			memory.store(writeStart & ~(PAGE_SIZE - 1), PAGE_SIZE);
+		}
+		else if (writeStart + written > memory.getSize()) {
+			memory.store(0, memory.getSize());
+		}
+		else {
+			memory.store(writeStart, written);
+		}
+	}
+	selected = false;
+}
+
+void
+xpcc::pc::SpiRamSimulator::Cs::reset()
+{
+	selected = true;
+	length = 0;
+	written = 0;
+}
+
+void
+xpcc::pc::SpiRamSimulator::Hold::setOutput()
+{
+}
+
+void
+xpcc::pc::SpiRamSimulator::Hold::set()
+{
+	held = false;
+}
+
+void
+xpcc::pc::SpiRamSimulator::Hold::reset()
+{
+	held = true;
+}
+
+// ----------------------------------------------------------------------------
+void
+xpcc::pc::SpiRamSimulator::initialize(uint32_t size)
+{
+	memory.create(size, 0);
+	selected = false;
+	held = false;
+	status = BYTE_MODE;
+	resetStatistics();
+}
+
+bool
+xpcc::pc::SpiRamSimulator::open(const char *filename, uint32_t size)
+{
+	initialize(size);
+	return memory.open(filename, size, 0);
+}
+
+void
+xpcc::pc::SpiRamSimulator::close()
+{
+	memory.close();
+}
+
+void
+xpcc::pc::SpiRamSimulator::resetStatistics()
+{
+	std::memset(&statistics, 0, sizeof(statistics));
+}
+
+// ----------------------------------------------------------------------------
+uint8_t
+xpcc::pc::SpiRamSimulator::transfer(uint8_t data)
+{
+	if (!selected) {
+		return 0xff;
+	}
+	if (held) {
+		statistics.violations++;
+		return 0xff;
+	}
+	statistics.bytes++;
+	
+	if (length == 0)
+	{
+		command = data;
+		length++;
+		statistics.commands++;
+		if (command != READ && command != WRITE &&
+				command != READ_STATUS_REGISTER && command != WRITE_STATUS_REGISTER) {
+			statistics.violations++;
+		}
+		return 0xff;
+	}
+	
+	switch (command)
+	{
+		case READ_STATUS_REGISTER:
+			return status;
+		
+		case WRITE_STATUS_REGISTER:
+			if (length++ == 1) {
+				status = data;
+			}
+			return 0xff;
+		
+		case READ:
+		case WRITE:
+			break;
+		
+		default:
+			return 0xff;
+	}
+	
+	if (length < 3)
+	{
+		// 16-bit address, the upper bits are ignored
+		address = (address << 8) | data;
+		length++;
+		if (length == 3) {
+			address %= memory.getSize();
+			writeStart = address;
+		}
+		return 0xff;
+	}
+	
+	if ((status & MODE_MASK) == BYTE_MODE && length > 3) {
+		// only a single byte per command
+		return 0xff;
+	}
+	length = 4;
+	
+	uint8_t result = 0xff;
+	if (command == READ) {
+		result = memory.getData()[address];
+	}
+	else {
+		memory.getData()[address] = data;
+		written++;
+	}
+	
+	if ((status & MODE_MASK) == PAGE_MODE) {
+		address = (address & ~(PAGE_SIZE - 1)) | ((address + 1) & (PAGE_SIZE - 1));
+	}
+	else {
+		address = (address + 1) % memory.getSize();
+	}
+	return result;
+}
@@ -0,0 +1,154 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_PC__SPI_RAM_SIMULATOR_HPP
+#define XPCC_PC__SPI_RAM_SIMULATOR_HPP
+
+#include <stdint.h>
+
+#include "file_memory.hpp"
+
+namespace xpcc
+{
+	namespace pc
+	{
+		/**
+		 * \brief	Simulated serial SRAM (23K256)
+		 * 
+		 * Decodes the SPI commands, so the unchanged xpcc::SpiRam driver
+		 * can be used on the PC:
+		 * \code
+		 * typedef xpcc::pc::SpiRamSimulator Simulator;
+		 * typedef xpcc::SpiRam<Simulator::Spi, Simulator::Cs, Simulator::Hold> Ram;
+		 * \endcode
+		 * 
+		 * The byte, page (32 bytes) and sequential mode are supported.
+		 * The content can be stored in a file, although the real device
+		 * loses it without power.
+		 * 
+		 * \see		xpcc::SpiRam
+		 * \ingroup	hosted
+		 */
+		class SpiRamSimulator
+		{
+		public:
+			static const uint16_t PAGE_SIZE = 32;
+			
+			struct Statistics
+			{
+				uint32_t bytes;			///< Transferred SPI bytes
+				uint32_t commands;
+				uint32_t violations;	///< Unknown commands or transfers while on hold
+			};
+			
+			struct Spi
+			{
+				static void
+				initialize();
+				
+				static uint8_t
+				write(uint8_t data);
+			};
+			
+			struct Cs
+			{
+				static void
+				setOutput();
+				
+				static void
+				set();
+				
+				static void
+				reset();
+			};
+			
+			struct Hold
+			{
+				static void
+				setOutput();
+				
+				static void
+				set();
+				
+				static void
+				reset();
+			};
+			
+		public:
+			/// Device without a file, the memory is cleared
+			static void
+			initialize(uint32_t size = 32768);
+			
+			/// Device stored in a file
+			static bool
+			open(const char *filename, uint32_t size = 32768);
+			
+			static void
+			close();
+			
+			static inline uint8_t *
+			getMemory()
+			{
+				return memory.getData();
+			}
+			
+			static inline const Statistics&
+			getStatistics()
+			{
+				return statistics;
+			}
+			
+			static void
+			resetStatistics();
+			
+		private:
+			static uint8_t
+			transfer(uint8_t data);
+			
+			static FileMemory memory;
+			
+			static bool selected;
+			static bool held;
+			static uint8_t status;
+			
+			static uint8_t command;
+			static uint8_t length;
+			static uint16_t address;
+			
+			/// First byte written by the current command
+			static uint16_t writeStart;
+			static uint32_t written;
+			
+			static Statistics statistics;
+		};
+	}
+}
+
+#endif	// XPCC_PC__SPI_RAM_SIMULATOR_HPP
@@ -112,12 +112,20 @@
 	
 	// see http://dbp-consulting.com/tutorials/StrictAliasing.html
 	#	define ATTRIBUTE_MAY_ALIAS	__attribute__((__may_alias__))	
+	
+	// marks an intended fall through to the next case label
+	#	if __GNUC__ >= 7
+	#		define ATTRIBUTE_FALLTHROUGH	__attribute__((fallthrough))
+	#	else
+	#		define ATTRIBUTE_FALLTHROUGH
+	#	endif
 	#else
 	#	define ALWAYS_INLINE  		inline
 	#	define ATTRIBUTE_UNUSED
 	#	define ATTRIBUTE_WEAK
 	#	define ATTRIBUTE_ALIGNED(n)
 	#	define ATTRIBUTE_MAY_ALIAS
+	#	define ATTRIBUTE_FALLTHROUGH
 	#endif
 	
 	#ifdef XPCC__CPU_AVR
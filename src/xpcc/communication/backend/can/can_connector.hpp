@@ -31,7 +31,9 @@
 #ifndef	XPCC__CAN_CONNECTOR_HPP
 #define	XPCC__CAN_CONNECTOR_HPP
 
-#include <xpcc/container/linked_list.hpp>
+#include <xpcc/container/intrusive_linked_list.hpp>
+#include <xpcc/container/intrusive_doubly_linked_list.hpp>
+#include <xpcc/debug/profile.hpp>
 #include "../backend_interface.hpp"
 
 // Filter
@@ -130,6 +132,14 @@ namespace xpcc
 	 *
 	 * Every event is send with the destination identifier \c 0x00.
 	 * 
+	 * \section can_connector_memory Memory usage
+	 * 
+	 * The connector still allocates memory for every message: one list
+	 * item for every message which could not be sent directly and for
+	 * every received packet, in addition to the SmartPointer holding the
+	 * payload. The items are linked intrusively, so no extra list nodes
+	 * are allocated and finished packets are not copied.
+	 * 
 	 * \todo timeout
 	 *
 	 * \ingroup	backend
@@ -188,6 +198,9 @@ namespace xpcc
 		checkAndReceiveMessages();
 		
 	protected:
+		// The list items are linked intrusively, so a message is never
+		// copied once it is allocated and finished packets are moved from
+		// the list of pending messages to the received ones in O(1).
 		class SendListItem
 		{
 		public:
@@ -199,19 +212,16 @@ namespace xpcc
 			{
 			}
 			
-			SendListItem(const SendListItem& other) :
-				identifier(other.identifier),
-				payload(other.payload),
-				fragmentIndex(other.fragmentIndex)
-			{
-			}
-			
 			uint32_t identifier;
 			SmartPointer payload;
 			
 			uint8_t fragmentIndex;
 			
+			xpcc::IntrusiveLinkedListHook<SendListItem> hook;
+			
 		private:
+			SendListItem(const SendListItem& other);
+			
 			SendListItem&
 			operator = (const SendListItem& other);
 		};
@@ -227,26 +237,31 @@ namespace xpcc
 			{
 			}
 			
-			ReceiveListItem(const ReceiveListItem& other) :
-				header(other.header), payload(other.payload),
-				receivedFragments(other.receivedFragments),
-				counter(other.counter)
-			{
-			}
-			
 			Header header;
 			SmartPointer payload;
 			
 			uint8_t receivedFragments;
 			const uint8_t counter;
 			
+			xpcc::IntrusiveDoublyLinkedListHook<ReceiveListItem> hook;
+			
 		private:
+			ReceiveListItem(const ReceiveListItem& other);
+			
 			ReceiveListItem&
 			operator = (const ReceiveListItem& other);
 		};
 		
-		typedef xpcc::LinkedList< SendListItem > SendList;
-		typedef xpcc::LinkedList< ReceiveListItem > ReceiveList;
+		typedef xpcc::IntrusiveLinkedList< SendListItem, &SendListItem::hook > SendList;
+		typedef xpcc::IntrusiveDoublyLinkedList< ReceiveListItem, &ReceiveListItem::hook > ReceiveList;
+		
+		/// Remove the first entry of the list and delete it
+		static void
+		dropFront(ReceiveList& list);
+		
+		/// Remove the first message waiting to be send and delete it
+		void
+		dropFrontSendItem();
 		
 	protected:
 		SendList sendList;
@@ -45,6 +45,17 @@ xpcc::CanConnector<Driver>::CanConnector(Driver *driver) :
 template<typename Driver>
 xpcc::CanConnector<Driver>::~CanConnector()
 {
+	while (!this->sendList.isEmpty()) {
+		this->dropFrontSendItem();
+	}
+	
+	while (!this->pendingMessages.isEmpty()) {
+		this->dropFront(this->pendingMessages);
+	}
+	
+	while (!this->receivedMessages.isEmpty()) {
+		this->dropFront(this->receivedMessages);
+	}
 }
 
 // ----------------------------------------------------------------------------
@@ -88,7 +99,7 @@ xpcc::CanConnector<Driver>::sendPacket(const Header &header, SmartPointer payloa
 	if (!successful)
 	{
 		// append the message to the list of waiting messages
-		this->sendList.append(SendListItem(identifier, payload));
+		this->sendList.append(*new SendListItem(identifier, payload));
 	}
 }
 
@@ -97,7 +108,7 @@ template<typename Driver>
 void
 xpcc::CanConnector<Driver>::dropPacket()
 {
-	this->receivedMessages.removeFront();
+	this->dropFront(this->receivedMessages);
 }
 
 // ----------------------------------------------------------------------------
@@ -105,6 +116,8 @@ template<typename Driver>
 void
 xpcc::CanConnector<Driver>::update()
 {
+	XPCC_PROFILE("CanConnector::update");
+	
 	this->checkAndReceiveMessages();
 	this->sendWaitingMessages();
 }
@@ -113,6 +126,24 @@ xpcc::CanConnector<Driver>::update()
 // protected
 // ----------------------------------------------------------------------------
 
+template<typename Driver>
+void
+xpcc::CanConnector<Driver>::dropFront(ReceiveList& list)
+{
+	ReceiveListItem *item = &list.getFront();
+	list.removeFront();
+	delete item;
+}
+
+template<typename Driver>
+void
+xpcc::CanConnector<Driver>::dropFrontSendItem()
+{
+	SendListItem *item = &this->sendList.getFront();
+	this->sendList.removeFront();
+	delete item;
+}
+
 template<typename Driver>
 bool
 xpcc::CanConnector<Driver>::sendMessage(const uint32_t & identifier,
@@ -166,7 +197,7 @@ xpcc::CanConnector<Driver>::sendWaitingMessages()
 			{
 				// message was the last fragment
 				// => remove it from the list
-				this->sendList.removeFront();
+				this->dropFrontSendItem();
 				this->messageCounter += 0x10;
 			}
 		}
@@ -176,7 +207,7 @@ xpcc::CanConnector<Driver>::sendWaitingMessages()
 		if (this->sendMessage(message.identifier, message.payload.getPointer(),
 				messageSize))
 		{
-			this->sendList.removeFront();
+			this->dropFrontSendItem();
 		}
 	}
 }
@@ -193,7 +224,7 @@ xpcc::CanConnector<Driver>::retrieveMessage()
 		
 		if (!isFragment)
 		{
-			this->receivedMessages.append(ReceiveListItem(message.length, header));
+			this->receivedMessages.append(*new ReceiveListItem(message.length, header));
 			std::memcpy(this->receivedMessages.getBack().payload.getPointer(),
 					message.data,
 					message.length);
@@ -252,7 +283,7 @@ xpcc::CanConnector<Driver>::retrieveMessage()
 			if (packet == this->pendingMessages.end()) {
 				// message not found => first part of this message,
 				// prepend it to the list
-				this->pendingMessages.prepend(ReceiveListItem(messageSize, header, counter));
+				this->pendingMessages.prepend(*new ReceiveListItem(messageSize, header, counter));
 				packet = this->pendingMessages.begin();
 			}
 			
@@ -275,8 +306,10 @@ xpcc::CanConnector<Driver>::retrieveMessage()
 			// for more messages
 			if (xpcc::bitCount(packet->receivedFragments) == numberOfFragments)
 			{
-				this->receivedMessages.append(*packet);
-				this->pendingMessages.remove(packet);
+				// move the complete packet to the received messages
+				ReceiveListItem& item = *packet;
+				this->pendingMessages.remove(item);
+				this->receivedMessages.append(item);
 			}
 		}
 		
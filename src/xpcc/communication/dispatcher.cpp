@@ -28,8 +28,10 @@
  */
 // ----------------------------------------------------------------------------
 
+#include "xpcc_config.hpp"
 #include "dispatcher.hpp"
 
+#include <xpcc/debug/profile.hpp>
 #include <xpcc/debug/logger/logger.hpp>
 // set the Loglevel
 #undef  XPCC_LOG_LEVEL
@@ -40,9 +42,7 @@ xpcc::Dispatcher::Dispatcher(
 		Postman* postman_) :
 	backend(backend_),
 	postman(postman_),
-	dummyFirst(Header()),
-	first(&dummyFirst),
-	last(&dummyFirst)
+	entries()
 {
 }
 
@@ -50,6 +50,8 @@ xpcc::Dispatcher::Dispatcher(
 void
 xpcc::Dispatcher::update()
 {
+	XPCC_PROFILE("Dispatcher::update");
+	
 	this->backend->update();
 	
 	//Check if a new packet was received by the backend
@@ -118,72 +120,19 @@ xpcc::Dispatcher::Entry::headerFits(const Header& inHeader) const
 }
 
 // ----------------------------------------------------------------------------
-void
-xpcc::Dispatcher::append(Entry *next)
-{
-	this->last->next = next;
-	
-	// find tail of next
-	while (next->next != 0) {
-		next = next->next;
-	}
-	
-	this->last = next;
-}
-
-void
-xpcc::Dispatcher::insertAfter(Entry *fix, Entry *next)
-{
-	Entry *tmp = fix->next;
-	fix->next = next;
-	
-	while (next->next)// find tail of next
-		next = next->next;
-	
-	if (tmp) {
-		next->next = tmp;
-	}
-	else
-	{// fix was the last element, so last has to be updated
-		last = next;
-	}
-}
-
-xpcc::Dispatcher::Entry *
-xpcc::Dispatcher::removeNextEntryFromList(Entry *entry)
-{
-	Entry *next = entry->next;
-	if (next)
-	{
-		entry->next = next->next;
-		
-		if (next == last) {
-			last = entry;
-		}
-		// next->next = 0; // is null already
-		else {
-			next->next = 0;
-		}
-	}
-	
-	return next;
-}
-
 void
 xpcc::Dispatcher::handlePacket(const Header& header,
 		const SmartPointer& payload)
 {
-	Entry *prev = first;// first is always a dummy entry
-	while (Entry *entry = prev->next)
+	for (Entry *entry = entries.getNext(0); entry != 0;
+			entry = entries.getNext(entry))
 	{
 		if (entry->type == Entry::DEFAULT)
 		{
 			// waiting for ack, no response can be handled
 			if (entry->headerFits(header))
 			{
-				// entry e->next has to be removed
-				this->removeNextEntryFromList(prev);
-				delete entry;
+				this->deleteEntry(entry);
 				
 				return;
 			}
@@ -216,33 +165,30 @@ xpcc::Dispatcher::handlePacket(const Header& header,
 					// else cannot happen, since responses with callbacks are
 					// not possible
 					
-					this->removeNextEntryFromList(prev);
-					delete callbackEntry;
+					this->deleteEntry(callbackEntry);
 				}
 				return;
 			}
 		}
-		
-		prev = entry;
 	}
 }
 
 xpcc::Dispatcher::Entry *
-xpcc::Dispatcher::deleteEntry(Entry *entry, Entry *prev)
+xpcc::Dispatcher::deleteEntry(Entry *entry)
 {
-	while (prev->next != entry) {
-		prev = prev->next;
-	}
+	Entry *prev = EntryList::getPrevious(*entry);
 	
-	this->removeNextEntryFromList(prev);
+	entries.remove(*entry);
 	delete entry;
 	
 	return prev;
 }
 
 xpcc::Dispatcher::Entry *
-xpcc::Dispatcher::sendMessageToInnerComponent(Entry *entry, Entry *prev)
+xpcc::Dispatcher::sendMessageToInnerComponent(Entry *entry)
 {
+	Entry *prev;
+	
 	// to one component on board inner component
 	// send message also out, so it is possible to log
 	// communication externally
@@ -261,29 +207,29 @@ xpcc::Dispatcher::sendMessageToInnerComponent(Entry *entry, Entry *prev)
 			prev = entry;
 		}
 		else {
-			prev = deleteEntry(entry, prev);
+			prev = deleteEntry(entry);
 		}
 	}
 	else
 	{
 		// (neg)response
-		// remove actual = e->next
+		// remove entry
 		// find one waiting request with callback and handle response
 		// responses are insertet at front, requests at end, 
-		// so search only after e (e->next is the first candidate)
+		// so search only after entry
 		//		handle found request and delete it
-		// delete actual
+		// delete entry
 		
-		this->removeNextEntryFromList(prev);
+		prev = EntryList::getPrevious(*entry);
+		entries.remove(*entry);
 		
-		Entry *tmp = prev;
-		while (Entry *s = tmp->next)
+		for (Entry *s = entries.getNext(prev); s != 0; s = entries.getNext(s))
 		{
 			if (s->header.type == Header::REQUEST
 					&& s->state != Entry::TRANSMISSION_PENDING // must be WAIT_FOR_RESPONSE
 					&& s->headerFits(entry->header))
 			{
-				this->removeNextEntryFromList(tmp);
+				entries.remove(*s);
 				
 				if (s->type == Entry::CALLBACK)
 				{
@@ -295,8 +241,6 @@ xpcc::Dispatcher::sendMessageToInnerComponent(Entry *entry, Entry *prev)
 				delete s;
 				break;
 			}
-			
-			tmp = s;
 		}
 		
 		delete entry;
@@ -308,9 +252,9 @@ xpcc::Dispatcher::sendMessageToInnerComponent(Entry *entry, Entry *prev)
 void
 xpcc::Dispatcher::handleWaitingMessages()
 {
-	// first is always a dummy entry
-	Entry *prev = first;
-	while (Entry *entry = prev->next)
+	// prev is zero while processing the first entry of the list
+	Entry *prev = 0;
+	while (Entry *entry = entries.getNext(prev))
 	{
 		if (entry->state == Entry::TRANSMISSION_PENDING)
 		{
@@ -320,7 +264,7 @@ xpcc::Dispatcher::handleWaitingMessages()
 				postman->deliverPacket(entry->header, entry->payload);
 				backend->sendPacket(entry->header, entry->payload);
 				
-				prev = deleteEntry(entry, prev);
+				prev = deleteEntry(entry);
 				continue;
 			}
 			else
@@ -328,7 +272,7 @@ xpcc::Dispatcher::handleWaitingMessages()
 				// action or response
 				if (postman->isComponentAvaliable(entry->header.destination))
 				{
-					prev = sendMessageToInnerComponent(entry, prev);
+					prev = sendMessageToInnerComponent(entry);
 				}
 				else
 				{
@@ -350,7 +294,7 @@ xpcc::Dispatcher::handleWaitingMessages()
 				if (entry->tries >= 2)
 				{
 					// TODO do sth to notify the user
-					prev = deleteEntry(entry, prev);
+					prev = deleteEntry(entry);
 					continue;
 				}
 				else
@@ -382,7 +326,7 @@ xpcc::Dispatcher::addMessage(const Header& header,
 	Entry *e = new Entry(header, smartPayload);
 	e->state = Entry::TRANSMISSION_PENDING;
 	
-	this->append(e);
+	this->entries.append(*e);
 }
 
 void
@@ -392,7 +336,7 @@ xpcc::Dispatcher::addMessage(const Header& header,
 	Entry *e = new CallbackEntry(header, smartPayload, responseCallback);
 	e->state = Entry::TRANSMISSION_PENDING;
 	
-	this->append(e);
+	this->entries.append(*e);
 }
 
 void
@@ -402,7 +346,7 @@ xpcc::Dispatcher::addResponse(const Header& header,
 	Entry *e = new Entry(header, smartPayload);
 	e->state = Entry::TRANSMISSION_PENDING;
 	
-	this->insertAfter(first, e);
+	this->entries.prepend(*e);
 	// it makes response more important, than requests
 	// it prevents intern loops. Since it is possible to give a response while 
 	// an action is handled and call an action while response is handled
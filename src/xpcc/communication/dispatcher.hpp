@@ -32,6 +32,7 @@
 #define	XPCC__DISPATCHER_HPP
 
 #include <xpcc/workflow/timeout.hpp>
+#include <xpcc/container/intrusive_doubly_linked_list.hpp>
 
 #include "backend/backend_interface.hpp"
 #include "postman/postman.hpp"
@@ -96,29 +97,27 @@ namespace xpcc
 		public:
 			/**
 			 * \brief 	Creates one Entry with given header.
-			 * 			this->next is initially set Null
 			 *
-			 * Creates one Entry with given header. this->next is initially
-			 * set Null. The const member this->typeInfo is set to typeInfo
-			 * and never else changed. this->typeInfo replaces runtime
-			 * information needed by handling of messages.
+			 * The const member this->type is set to type and never else
+			 * changed. this->type replaces runtime information needed by
+			 * handling of messages.
 			 */
 			Entry(Type type, const Header& inHeader, SmartPointer& inPayload) :
-				type(type), next(0),
+				type(type), hook(),
 				header(inHeader), payload(inPayload),
 				time(), tries(0)
 			{
 			}
 			
 			Entry(const Header& inHeader, SmartPointer& inPayload) :
-				type(DEFAULT), next(0),
+				type(DEFAULT), hook(),
 				header(inHeader), payload(inPayload),
 				time(), tries(0)
 			{
 			}
 			
 			Entry(const Header& inHeader) :
-				type(DEFAULT), next(0),
+				type(DEFAULT), hook(),
 				header(inHeader), payload(),
 				time(), tries(0)
 			{
@@ -131,17 +130,8 @@ namespace xpcc
 			bool
 			headerFits(const Header& header) const;
 			
-			/**
-			 * \brief 	List-handling, return pointer to the next entry.
-			 */
-			inline const Entry *
-			getNext() const
-			{
-				return next;
-			}
-			
 			const Type type;
-			Entry *next;			///< List-handling, holds pointer to the next entry.
+			xpcc::IntrusiveDoublyLinkedListHook<Entry> hook;	///< List-handling
 			const Header header;
 			const SmartPointer payload;
 			State state;
@@ -172,39 +162,17 @@ namespace xpcc
 		void
 		addResponse(const Header& header, SmartPointer& smartPayload);
 		
+
+		typedef xpcc::IntrusiveDoublyLinkedList<Entry, &Entry::hook> EntryList;
 		
 		/**
-		 * \brief 		Appends one ore more entries to this->last. this->last is updated to the tail of next.
-		 *
-		 */
-		void
-		append(Entry *next);
-		
-		/**
-		 * \brief 		fix->next will be set to next. the old entry of fix->next will be set
-		 *				to the tail of next. this->last will be updated to tail of next if 
-		 *				fix->next==Null, which is equivalent to fix==last.
-		 *
-		 * \param fix has to be one element already appended to the list.
-		 * \param next must not be contained by any list. Any element of the next->next chain must not be contained by any list.
-		 */
-		inline void
-		insertAfter(Entry *fix, Entry *next);
-		
-		/**
-		 * \brief 		if (entry->next) then entry->next will be set to entry->next->next. this->last
-		 *				will be set to entry if entry->next was the last element.
-		 *				The removed element is returned
-		 *				if entry was the last element nothing is done and Null is returned.
-		 *				For safety the member next of the returned element is set to Null.
-		 *
-		 * \param entry has to be one element already appended to the list.
+		 * \brief	Remove \p entry from the list and delete it
+		 * 
+		 * \return	Entry in front of the removed one or zero if it was
+		 * 			the first one in the list
 		 */
 		Entry *
-		removeNextEntryFromList(Entry *entry);
-		
-		Entry *
-		deleteEntry(Entry *entry, Entry *prev);
+		deleteEntry(Entry *entry);
 		
 		inline void
 		handleActionCall(const Header& header, const SmartPointer& payload);
@@ -212,15 +180,15 @@ namespace xpcc
 		void
 		sendAcknowledge(const Header& header);
 		
+		/// \return	Entry after which the list has to be processed further
 		inline Entry *
-		sendMessageToInnerComponent(Entry *entry, Entry *prev);
+		sendMessageToInnerComponent(Entry *entry);
 		
 		BackendInterface * const backend;
 		Postman * const postman;
 		
-		Entry dummyFirst;
-		Entry *first;
-		Entry *last;
+		/// Responses at the front, requests and events at the back
+		EntryList entries;
 		
 	private:
 		friend class Communicator;
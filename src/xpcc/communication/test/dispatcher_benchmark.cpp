@@ -0,0 +1,87 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include "dispatcher_benchmark.hpp"
+
+void
+DispatcherBenchmark::setUp()
+{
+	backend = new FakeBackend();
+	postman = new FakePostman();
+	dispatcher = new xpcc::Dispatcher(backend, postman);
+	timeline = new Timeline();
+	
+	component1 = new TestingComponent1(dispatcher, timeline);
+	component2 = new TestingComponent2(dispatcher, timeline);
+	
+	postman->component1 = component1;
+	postman->component2 = component2;
+}
+
+void
+DispatcherBenchmark::tearDown()
+{
+	delete component2;
+	delete component1;
+	delete timeline;
+	delete dispatcher;
+	delete postman;
+	delete backend;
+}
+
+void
+DispatcherBenchmark::receive(const xpcc::Header& header)
+{
+	backend->messagesToReceive.append(Message(header, xpcc::SmartPointer()));
+	dispatcher->update();
+	
+	backend->messagesSend.removeAll();
+	postman->messagesToDeliver.removeAll();
+	timeline->events.removeAll();
+}
+
+// ----------------------------------------------------------------------------
+void
+DispatcherBenchmark::benchmarkReceiveEvent(unittest::BenchmarkState& state)
+{
+	const xpcc::Header header(xpcc::Header::REQUEST, false, 0, 10, 0x20);
+	while (state.keepRunning()) {
+		this->receive(header);
+	}
+}
+
+void
+DispatcherBenchmark::benchmarkReceiveRequest(unittest::BenchmarkState& state)
+{
+	const xpcc::Header header(xpcc::Header::REQUEST, false, 1, 10, 0x10);
+	while (state.keepRunning()) {
+		this->receive(header);
+	}
+}
@@ -0,0 +1,76 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/benchmark/benchmark.hpp>
+
+#include <xpcc/communication/dispatcher.hpp>
+
+#include "fake_backend.hpp"
+#include "fake_postman.hpp"
+#include "testing_component_1.hpp"
+#include "testing_component_2.hpp"
+#include "timeline.hpp"
+
+/**
+ * \brief	Delivery of received messages by the dispatcher
+ * 
+ * Uses the same setup as DispatcherTest. The lists of the fake
+ * objects are cleared after every message, so the numbers include a
+ * constant overhead for the fake backend and postman.
+ */
+class DispatcherBenchmark : public unittest::Benchmark
+{
+public:
+	virtual void
+	setUp();
+	
+	virtual void
+	tearDown();
+	
+	/// Event delivered to both local components
+	void
+	benchmarkReceiveEvent(unittest::BenchmarkState& state);
+	
+	/// Action call for a local component, including the ACK
+	void
+	benchmarkReceiveRequest(unittest::BenchmarkState& state);
+	
+private:
+	void
+	receive(const xpcc::Header& header);
+	
+	FakeBackend *backend;
+	FakePostman *postman;
+	xpcc::Dispatcher *dispatcher;
+	Timeline *timeline;
+	
+	TestingComponent1 *component1;
+	TestingComponent2 *component2;
+};
@@ -56,6 +56,10 @@ Sequence containers:
  - xpcc::DoublyLinkedList
  - xpcc::BoundedDeque
 
+Intrusive containers (the entries carry the link, no allocation is done):
+ - xpcc::IntrusiveLinkedList
+ - xpcc::IntrusiveDoublyLinkedList
+
 Container adaptors:
  - xpcc::Queue
  - xpcc::Stack
@@ -117,6 +121,9 @@ every one of it, only a subset which is sufficient for the container.
 #include "container/linked_list.hpp"
 #include "container/doubly_linked_list.hpp"
 
+#include "container/intrusive_linked_list.hpp"
+#include "container/intrusive_doubly_linked_list.hpp"
+
 #include "container/dynamic_array.hpp"
 
 #include "container/pair.hpp"
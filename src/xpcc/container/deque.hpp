@@ -34,6 +34,7 @@
 #include <cstddef>
 
 #include <stdint.h>
+#include <utility>		// for std::move and std::forward
 #include <xpcc/utils/template_metaprogramming.hpp>
 
 namespace xpcc
@@ -119,9 +120,32 @@ namespace xpcc
 		bool
 		append(const T& value);
 		
+		/// Append \p value by move assignment
+		bool
+		append(T&& value);
+		
 		bool
 		prepend(const T& value);
 		
+		/// Prepend \p value by move assignment
+		bool
+		prepend(T&& value);
+		
+		/**
+		 * \brief	Append a value constructed from \p args
+		 * 
+		 * The slots of the deque are always constructed, therefore the
+		 * new value is move assigned to the slot.
+		 */
+		template <typename... Args>
+		bool
+		emplaceBack(Args&&... args);
+		
+		/// Prepend a value constructed from \p args
+		template <typename... Args>
+		bool
+		emplaceFront(Args&&... args);
+		
 		void
 		removeBack();
 		
@@ -168,6 +192,14 @@ namespace xpcc
 	private:
 		friend class const_iterator;
 		
+		/// Reserve a slot at the end, returns false if the deque is full
+		bool
+		advanceHead();
+		
+		/// Reserve a slot in front, returns false if the deque is full
+		bool
+		advanceTail();
+		
 		Index head;
 		Index tail;
 		Size size;
@@ -119,7 +119,7 @@ xpcc::BoundedDeque<T, N>::getBack() const
 
 template<typename T, std::size_t N>
 bool
-xpcc::BoundedDeque<T, N>::append(const T& value)
+xpcc::BoundedDeque<T, N>::advanceHead()
 {
 	if (this->isFull()) {
 		return false;
@@ -132,11 +132,47 @@ xpcc::BoundedDeque<T, N>::append(const T& value)
 		this->head++;
 	}
 	
-	this->buffer[this->head] = value;
 	this->size++;
 	return true;
 }
 
+template<typename T, std::size_t N>
+bool
+xpcc::BoundedDeque<T, N>::append(const T& value)
+{
+	if (!this->advanceHead()) {
+		return false;
+	}
+	
+	this->buffer[this->head] = value;
+	return true;
+}
+
+template<typename T, std::size_t N>
+bool
+xpcc::BoundedDeque<T, N>::append(T&& value)
+{
+	if (!this->advanceHead()) {
+		return false;
+	}
+	
+	this->buffer[this->head] = std::move(value);
+	return true;
+}
+
+template<typename T, std::size_t N>
+template <typename... Args>
+bool
+xpcc::BoundedDeque<T, N>::emplaceBack(Args&&... args)
+{
+	if (!this->advanceHead()) {
+		return false;
+	}
+	
+	this->buffer[this->head] = T(std::forward<Args>(args)...);
+	return true;
+}
+
 template<typename T, std::size_t N>
 void
 xpcc::BoundedDeque<T, N>::removeBack()
@@ -154,7 +190,7 @@ xpcc::BoundedDeque<T, N>::removeBack()
 
 template<typename T, std::size_t N>
 bool
-xpcc::BoundedDeque<T, N>::prepend(const T& value)
+xpcc::BoundedDeque<T, N>::advanceTail()
 {
 	if (this->isFull()) {
 		return false;
@@ -167,11 +203,47 @@ xpcc::BoundedDeque<T, N>::prepend(const T& value)
 		this->tail--;
 	}
 	
-	this->buffer[this->tail] = value;
 	this->size++;
 	return true;
 }
 
+template<typename T, std::size_t N>
+bool
+xpcc::BoundedDeque<T, N>::prepend(const T& value)
+{
+	if (!this->advanceTail()) {
+		return false;
+	}
+	
+	this->buffer[this->tail] = value;
+	return true;
+}
+
+template<typename T, std::size_t N>
+bool
+xpcc::BoundedDeque<T, N>::prepend(T&& value)
+{
+	if (!this->advanceTail()) {
+		return false;
+	}
+	
+	this->buffer[this->tail] = std::move(value);
+	return true;
+}
+
+template<typename T, std::size_t N>
+template <typename... Args>
+bool
+xpcc::BoundedDeque<T, N>::emplaceFront(Args&&... args)
+{
+	if (!this->advanceTail()) {
+		return false;
+	}
+	
+	this->buffer[this->tail] = T(std::forward<Args>(args)...);
+	return true;
+}
+
 template<typename T, std::size_t N>
 void
 xpcc::BoundedDeque<T, N>::removeFront()
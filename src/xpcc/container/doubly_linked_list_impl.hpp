@@ -75,9 +75,38 @@ template <typename T, typename Allocator>
 bool
 xpcc::DoublyLinkedList<T, Allocator>::prepend(const T& value)
 {
-	// allocate memory for the new node and copy the value into it
+	return this->emplaceFront(value);
+}
+
+template <typename T, typename Allocator>
+bool
+xpcc::DoublyLinkedList<T, Allocator>::prepend(T&& value)
+{
+	return this->emplaceFront(std::move(value));
+}
+
+template <typename T, typename Allocator>
+void
+xpcc::DoublyLinkedList<T, Allocator>::append(const T& value)
+{
+	this->emplaceBack(value);
+}
+
+template <typename T, typename Allocator>
+void
+xpcc::DoublyLinkedList<T, Allocator>::append(T&& value)
+{
+	this->emplaceBack(std::move(value));
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+bool
+xpcc::DoublyLinkedList<T, Allocator>::emplaceFront(Args&&... args)
+{
+	// allocate memory for the new node and construct the value in place
 	Node *node = this->nodeAllocator.allocate(1);
-	Allocator::construct(&node->value, value);
+	Allocator::emplace(&node->value, std::forward<Args>(args)...);
 	
 	// hook the node into the list
 	node->next = this->front;
@@ -97,12 +126,13 @@ xpcc::DoublyLinkedList<T, Allocator>::prepend(const T& value)
 }
 
 template <typename T, typename Allocator>
+template <typename... Args>
 void
-xpcc::DoublyLinkedList<T, Allocator>::append(const T& value)
+xpcc::DoublyLinkedList<T, Allocator>::emplaceBack(Args&&... args)
 {
-	// allocate memory for the new node and copy the value into it
+	// allocate memory for the new node and construct the value in place
 	Node *node = this->nodeAllocator.allocate(1);
-	Allocator::construct(&node->value, value);
+	Allocator::emplace(&node->value, std::forward<Args>(args)...);
 	
 	// hook the node into the list
 	node->next = 0;
@@ -32,7 +32,10 @@
 #define XPCC__DYNAMIC_ARRAY_HPP
 
 #include <cstddef>
+#include <cstring>		// for std::memcpy
+#include <utility>		// for std::move and std::forward
 #include <xpcc/utils/allocator.hpp>
+#include <xpcc/utils/template_metaprogramming.hpp>
 
 namespace xpcc
 {
@@ -54,6 +57,10 @@ namespace xpcc
 	 * explicitly indicate a capacity for the dynamic array using member
 	 * function DynamicArray::reserve().
 	 * 
+	 * On reallocation the elements are moved instead of copied. If
+	 * xpcc::tmp::TriviallyRelocatable is true for \p T the whole buffer
+	 * is transferred with a single memcpy().
+	 * 
 	 * \author	Fabian Greif <fabian.greif@rwth-aachen.de>
 	 * \ingroup	container
 	 */
@@ -91,10 +98,21 @@ namespace xpcc
 		
 		DynamicArray(const DynamicArray& other);
 		
+		/**
+		 * \brief	Move constructor
+		 *
+		 * Takes over the storage of \p other without copying any element.
+		 * \p other is left empty with a capacity of zero.
+		 */
+		DynamicArray(DynamicArray&& other);
+		
 		~DynamicArray();
 		
 		DynamicArray&
 		operator = (const DynamicArray& other);
+		
+		DynamicArray&
+		operator = (DynamicArray&& other);
 
 		/**
 		 * \brief	Test whether dynamic array is empty
@@ -219,6 +237,28 @@ namespace xpcc
 		void
 		append(const T& value);
 
+		/**
+		 * \brief	Add element at the end
+		 *
+		 * Same as append(const T&) but the new element is move constructed
+		 * from \p value.
+		 */
+		void
+		append(T&& value);
+
+		/**
+		 * \brief	Construct element at the end
+		 *
+		 * Constructs a new element in place at the end of the dynamic
+		 * array, passing \p args to the constructor of T. No temporary
+		 * object is created.
+		 *
+		 * \see	append()
+		 */
+		template <typename... Args>
+		void
+		emplaceBack(Args&&... args);
+
 		/**
 		 * \brief	Delete last element
 		 *
@@ -364,18 +404,36 @@ namespace xpcc
 		
 	private:
 		/*
-		 * Allocate a new buffer of size n and copy the elements from the
+		 * Allocate a new buffer of size n and move the elements from the
 		 * old buffer to the new buffer.
 		 */
 		void
 		relocate(SizeType n);
 		
+		/*
+		 * Move all elements to newBuffer and release the old buffer.
+		 */
+		void
+		moveElementsTo(T* newBuffer);
+		
 		Allocator allocator;
 		
 		SizeType size;
 		SizeType capacity;
 		T* values;
 	};
+	
+	namespace tmp
+	{
+		/// DynamicArray holds no pointers to itself, moving it is a memcpy()
+		template <typename T>
+		struct TriviallyRelocatable< DynamicArray<T, allocator::Dynamic<T> > >
+		{
+			enum {
+				value = true
+			};
+		};
+	}
 }
 
 #include "dynamic_array_impl.hpp"
@@ -68,6 +68,16 @@ xpcc::DynamicArray<T, Allocator>::DynamicArray(const DynamicArray& other) :
 	}
 }
 
+template <typename T, typename Allocator>
+xpcc::DynamicArray<T, Allocator>::DynamicArray(DynamicArray&& other) :
+	allocator(other.allocator),
+	size(other.size), capacity(other.capacity), values(other.values)
+{
+	other.size = 0;
+	other.capacity = 0;
+	other.values = 0;
+}
+
 template <typename T, typename Allocator>
 xpcc::DynamicArray<T, Allocator>::~DynamicArray()
 {
@@ -97,6 +107,31 @@ xpcc::DynamicArray<T, Allocator>::operator = (const DynamicArray& other)
 	return *this;
 }
 
+template <typename T, typename Allocator>
+xpcc::DynamicArray<T, Allocator>&
+xpcc::DynamicArray<T, Allocator>::operator = (DynamicArray&& other)
+{
+	if (this == &other) {
+		return *this;
+	}
+	
+	for (SizeType i = 0; i < this->size; ++i) {
+		this->allocator.destroy(&this->values[i]);
+	}
+	this->allocator.deallocate(this->values);
+	
+	this->allocator = other.allocator;
+	this->size = other.size;
+	this->capacity = other.capacity;
+	this->values = other.values;
+	
+	other.size = 0;
+	other.capacity = 0;
+	other.values = 0;
+	
+	return *this;
+}
+
 // ----------------------------------------------------------------------------
 template <typename T, typename Allocator>
 void
@@ -141,6 +176,21 @@ xpcc::DynamicArray<T, Allocator>::removeAll()
 template <typename T, typename Allocator>
 void
 xpcc::DynamicArray<T, Allocator>::append(const T& value)
+{
+	this->emplaceBack(value);
+}
+
+template <typename T, typename Allocator>
+void
+xpcc::DynamicArray<T, Allocator>::append(T&& value)
+{
+	this->emplaceBack(std::move(value));
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+void
+xpcc::DynamicArray<T, Allocator>::emplaceBack(Args&&... args)
 {
 	if (this->capacity == this->size)
 	{
@@ -149,10 +199,18 @@ xpcc::DynamicArray<T, Allocator>::append(const T& value)
 		if (n == 0) {
 			n = 1;
 		}
-		this->relocate(n);
+		
+		// The new element is constructed before the old elements are
+		// moved, because the arguments might refer to one of them.
+		T* newBuffer = this->allocator.allocate(n);
+		this->allocator.emplace(&newBuffer[this->size], std::forward<Args>(args)...);
+		
+		this->moveElementsTo(newBuffer);
+		this->capacity = n;
+	}
+	else {
+		this->allocator.emplace(&this->values[this->size], std::forward<Args>(args)...);
 	}
-	
-	this->allocator.construct(&this->values[this->size], value);
 	++this->size;
 }
 
@@ -172,12 +230,29 @@ template <typename T, typename Allocator>
 void
 xpcc::DynamicArray<T, Allocator>::relocate(SizeType n)
 {
+	T* newBuffer = this->allocator.allocate(n);
+	this->moveElementsTo(newBuffer);
 	this->capacity = n;
-	
-	T* newBuffer = allocator.allocate(n);
-	for (SizeType i = 0; i < this->size; ++i) {
-		this->allocator.construct(&newBuffer[i], this->values[i]);
-		this->allocator.destroy(&this->values[i]);
+}
+
+template <typename T, typename Allocator>
+void
+xpcc::DynamicArray<T, Allocator>::moveElementsTo(T* newBuffer)
+{
+	if (xpcc::tmp::TriviallyRelocatable<T>::value)
+	{
+		if (this->size > 0) {
+			std::memcpy(static_cast<void *>(newBuffer),
+					static_cast<const void *>(this->values),
+					this->size * sizeof(T));
+		}
+	}
+	else
+	{
+		for (SizeType i = 0; i < this->size; ++i) {
+			this->allocator.construct(&newBuffer[i], std::move(this->values[i]));
+			this->allocator.destroy(&this->values[i]);
+		}
 	}
 	this->allocator.deallocate(this->values);
 	
@@ -0,0 +1,228 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC__INTRUSIVE_DOUBLY_LINKED_LIST_HPP
+#define	XPCC__INTRUSIVE_DOUBLY_LINKED_LIST_HPP
+
+#include <cstddef>
+#include <stdint.h>
+
+namespace xpcc
+{
+	/**
+	 * \brief	Hook for xpcc::IntrusiveDoublyLinkedList
+	 * 
+	 * \see		xpcc::IntrusiveLinkedListHook
+	 * \ingroup	container
+	 */
+	template <typename T>
+	struct IntrusiveDoublyLinkedListHook
+	{
+		IntrusiveDoublyLinkedListHook() :
+			next(0), previous(0)
+		{
+		}
+		
+		T *next;
+		T *previous;
+	};
+	
+	/**
+	 * \brief	Intrusive doubly-linked list
+	 * 
+	 * Same as xpcc::IntrusiveLinkedList but every entry knows its
+	 * predecessor, so entries can be removed from anywhere in the list
+	 * in O(1).
+	 * 
+	 * The list does not own its entries. They are neither copied nor
+	 * destroyed by the list and must stay valid as long as they are
+	 * part of the list.
+	 * 
+	 * \tparam	T		Type of list entries
+	 * \tparam	Hook	Member of T used to link the entries
+	 * 
+	 * \ingroup	container
+	 */
+	template <typename T, IntrusiveDoublyLinkedListHook<T> T::*Hook>
+	class IntrusiveDoublyLinkedList
+	{
+	public:
+		typedef std::size_t Size;
+		
+	public:
+		IntrusiveDoublyLinkedList();
+		
+		/// check if there are any entries in the list
+		inline bool
+		isEmpty() const;
+		
+		/**
+		 * \brief	Get number of entries
+		 * 
+		 * \warning	This function is O(n)!
+		 */
+		Size
+		getSize() const;
+		
+		/// Insert in front
+		void
+		prepend(T& item);
+		
+		/// Insert at the end of the list
+		void
+		append(T& item);
+		
+		/// Insert \p item behind \p position, which must be part of the list
+		void
+		insertAfter(T& position, T& item);
+		
+		/// Remove the first entry
+		void
+		removeFront();
+		
+		/// Remove the last entry
+		void
+		removeBack();
+		
+		/// Remove \p item from the list, \p item must be part of the list
+		void
+		remove(T& item);
+		
+		/// Remove all entries, the entries themselves are not touched
+		void
+		removeAll();
+		
+		inline T&
+		getFront();
+		
+		inline const T&
+		getFront() const;
+		
+		inline T&
+		getBack();
+		
+		inline const T&
+		getBack() const;
+		
+		/**
+		 * \brief	Get the entry following \p item
+		 * 
+		 * If \p item is zero the first entry is returned.
+		 * 
+		 * \return	Next entry or zero at the end of the list
+		 */
+		inline T *
+		getNext(const T *item) const;
+		
+		/**
+		 * \brief	Get the entry preceding \p item
+		 * 
+		 * \return	Previous entry or zero if \p item is the first one
+		 */
+		static inline T *
+		getPrevious(const T& item);
+		
+	public:
+		/// Bidirectional iterator
+		class iterator
+		{
+			friend class IntrusiveDoublyLinkedList;
+			friend class const_iterator;
+			
+		public:
+			/// Default constructor
+			iterator();
+			iterator(const iterator& other);
+			
+			iterator& operator = (const iterator& other);
+			iterator& operator ++ ();
+			iterator& operator -- ();
+			bool operator == (const iterator& other) const;
+			bool operator != (const iterator& other) const;
+			T& operator * ();
+			T* operator -> ();
+		
+		private:
+			iterator(T* item);
+			
+			T* item;
+		};
+		
+		/// Bidirectional const iterator
+		class const_iterator
+		{
+			friend class IntrusiveDoublyLinkedList;
+			
+		public:
+			/// Default constructor
+			const_iterator();
+			const_iterator(const iterator& other);
+			const_iterator(const const_iterator& other);
+			
+			const_iterator& operator = (const const_iterator& other);
+			const_iterator& operator ++ ();
+			const_iterator& operator -- ();
+			bool operator == (const const_iterator& other) const;
+			bool operator != (const const_iterator& other) const;
+			const T& operator * () const;
+			const T* operator -> () const;
+		
+		private:
+			const_iterator(const T* item);
+			
+			const T* item;
+		};
+		
+		iterator
+		begin();
+		
+		const_iterator
+		begin() const;
+		
+		iterator
+		end();
+		
+		const_iterator
+		end() const;
+		
+	private:
+		IntrusiveDoublyLinkedList(const IntrusiveDoublyLinkedList& other);
+		
+		IntrusiveDoublyLinkedList&
+		operator = (const IntrusiveDoublyLinkedList& other);
+		
+		T *front;
+		T *back;
+	};
+}
+
+#include "intrusive_doubly_linked_list_impl.hpp"
+
+#endif	// XPCC__INTRUSIVE_DOUBLY_LINKED_LIST_HPP
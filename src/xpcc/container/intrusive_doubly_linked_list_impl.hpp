@@ -0,0 +1,387 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC__INTRUSIVE_DOUBLY_LINKED_LIST_HPP
+	#error	"Don't include this file directly, use 'intrusive_doubly_linked_list.hpp' instead"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::IntrusiveDoublyLinkedList() :
+	front(0), back(0)
+{
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+bool
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::isEmpty() const
+{
+	return (this->front == 0);
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+typename xpcc::IntrusiveDoublyLinkedList<T, Hook>::Size
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::getSize() const
+{
+	Size count = 0;
+	for (const T *item = this->front; item != 0; item = (item->*Hook).next) {
+		count++;
+	}
+	return count;
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+void
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::prepend(T& item)
+{
+	(item.*Hook).next = this->front;
+	(item.*Hook).previous = 0;
+	
+	if (this->front == 0)
+	{
+		// first entry in the list
+		this->back = &item;
+	}
+	else {
+		(this->front->*Hook).previous = &item;
+	}
+	this->front = &item;
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+void
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::append(T& item)
+{
+	(item.*Hook).next = 0;
+	(item.*Hook).previous = this->back;
+	
+	if (this->back == 0)
+	{
+		// first entry in the list
+		this->front = &item;
+	}
+	else {
+		(this->back->*Hook).next = &item;
+	}
+	this->back = &item;
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+void
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::insertAfter(T& position, T& item)
+{
+	T *next = (position.*Hook).next;
+	
+	(item.*Hook).next = next;
+	(item.*Hook).previous = &position;
+	(position.*Hook).next = &item;
+	
+	if (next == 0) {
+		this->back = &item;
+	}
+	else {
+		(next->*Hook).previous = &item;
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+void
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::removeFront()
+{
+	this->remove(*this->front);
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+void
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::removeBack()
+{
+	this->remove(*this->back);
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+void
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::remove(T& item)
+{
+	T *next = (item.*Hook).next;
+	T *previous = (item.*Hook).previous;
+	
+	if (previous == 0) {
+		this->front = next;
+	}
+	else {
+		(previous->*Hook).next = next;
+	}
+	
+	if (next == 0) {
+		this->back = previous;
+	}
+	else {
+		(next->*Hook).previous = previous;
+	}
+	
+	(item.*Hook).next = 0;
+	(item.*Hook).previous = 0;
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+void
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::removeAll()
+{
+	while (!this->isEmpty()) {
+		this->removeFront();
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+T&
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::getFront()
+{
+	return *this->front;
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+const T&
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::getFront() const
+{
+	return *this->front;
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+T&
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::getBack()
+{
+	return *this->back;
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+const T&
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::getBack() const
+{
+	return *this->back;
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+T *
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::getNext(const T *item) const
+{
+	if (item == 0) {
+		return this->front;
+	}
+	return (item->*Hook).next;
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+T *
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::getPrevious(const T& item)
+{
+	return (item.*Hook).previous;
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+typename xpcc::IntrusiveDoublyLinkedList<T, Hook>::iterator
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::begin()
+{
+	return iterator(this->front);
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+typename xpcc::IntrusiveDoublyLinkedList<T, Hook>::iterator
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::end()
+{
+	return iterator(0);
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+typename xpcc::IntrusiveDoublyLinkedList<T, Hook>::const_iterator
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::begin() const
+{
+	return const_iterator(this->front);
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+typename xpcc::IntrusiveDoublyLinkedList<T, Hook>::const_iterator
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::end() const
+{
+	return const_iterator(0);
+}
+
+// ----------------------------------------------------------------------------
+// Iterators
+// ----------------------------------------------------------------------------
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::iterator::iterator() :
+	item(0)
+{
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::iterator::iterator(T* item) :
+	item(item)
+{
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::iterator::iterator(const iterator& other) :
+	item(other.item)
+{
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+typename xpcc::IntrusiveDoublyLinkedList<T, Hook>::iterator&
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::iterator::operator = (const iterator& other)
+{
+	this->item = other.item;
+	return *this;
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+typename xpcc::IntrusiveDoublyLinkedList<T, Hook>::iterator&
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::iterator::operator ++ ()
+{
+	this->item = (this->item->*Hook).next;
+	return *this;
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+typename xpcc::IntrusiveDoublyLinkedList<T, Hook>::iterator&
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::iterator::operator -- ()
+{
+	this->item = (this->item->*Hook).previous;
+	return *this;
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+bool
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::iterator::operator == (const iterator& other) const
+{
+	return (this->item == other.item);
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+bool
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::iterator::operator != (const iterator& other) const
+{
+	return (this->item != other.item);
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+T&
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::iterator::operator * ()
+{
+	return *this->item;
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+T*
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::iterator::operator -> ()
+{
+	return this->item;
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::const_iterator::const_iterator() :
+	item(0)
+{
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::const_iterator::const_iterator(const T* item) :
+	item(item)
+{
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::const_iterator::const_iterator(const iterator& other) :
+	item(other.item)
+{
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::const_iterator::const_iterator(const const_iterator& other) :
+	item(other.item)
+{
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+typename xpcc::IntrusiveDoublyLinkedList<T, Hook>::const_iterator&
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::const_iterator::operator = (const const_iterator& other)
+{
+	this->item = other.item;
+	return *this;
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+typename xpcc::IntrusiveDoublyLinkedList<T, Hook>::const_iterator&
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::const_iterator::operator ++ ()
+{
+	this->item = (this->item->*Hook).next;
+	return *this;
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+typename xpcc::IntrusiveDoublyLinkedList<T, Hook>::const_iterator&
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::const_iterator::operator -- ()
+{
+	this->item = (this->item->*Hook).previous;
+	return *this;
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+bool
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::const_iterator::operator == (const const_iterator& other) const
+{
+	return (this->item == other.item);
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+bool
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::const_iterator::operator != (const const_iterator& other) const
+{
+	return (this->item != other.item);
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+const T&
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::const_iterator::operator * () const
+{
+	return *this->item;
+}
+
+template <typename T, xpcc::IntrusiveDoublyLinkedListHook<T> T::*Hook>
+const T*
+xpcc::IntrusiveDoublyLinkedList<T, Hook>::const_iterator::operator -> () const
+{
+	return this->item;
+}
@@ -0,0 +1,243 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC__INTRUSIVE_LINKED_LIST_HPP
+#define	XPCC__INTRUSIVE_LINKED_LIST_HPP
+
+#include <cstddef>
+#include <stdint.h>
+
+namespace xpcc
+{
+	/**
+	 * \brief	Hook for xpcc::IntrusiveLinkedList
+	 * 
+	 * Add a member of this type to every class which should be stored
+	 * in a xpcc::IntrusiveLinkedList. An object can be part of as many
+	 * lists at the same time as it has hooks.
+	 * 
+	 * \ingroup	container
+	 */
+	template <typename T>
+	struct IntrusiveLinkedListHook
+	{
+		IntrusiveLinkedListHook() :
+			next(0)
+		{
+		}
+		
+		T *next;
+	};
+	
+	/**
+	 * \brief	Intrusive singly-linked list
+	 * 
+	 * In contrast to xpcc::LinkedList the list does not allocate a node
+	 * for every entry. The link to the next entry is stored in a hook
+	 * inside the entry itself, which makes appending and removing entries
+	 * free of any memory allocation.
+	 * 
+	 * The list does not own its entries. They are neither copied nor
+	 * destroyed by the list and must stay valid as long as they are
+	 * part of the list. An entry must not be added to a second list
+	 * using the same hook.
+	 * 
+	 * Example:
+	 * \code
+	 * struct Item
+	 * {
+	 *     int value;
+	 *     xpcc::IntrusiveLinkedListHook<Item> hook;
+	 * };
+	 * 
+	 * xpcc::IntrusiveLinkedList<Item, &Item::hook> list;
+	 * 
+	 * Item item;
+	 * list.append(item);
+	 * \endcode
+	 * 
+	 * \tparam	T		Type of list entries
+	 * \tparam	Hook	Member of T used to link the entries
+	 * 
+	 * \see		xpcc::IntrusiveDoublyLinkedList
+	 * \ingroup	container
+	 */
+	template <typename T, IntrusiveLinkedListHook<T> T::*Hook>
+	class IntrusiveLinkedList
+	{
+	public:
+		typedef std::size_t Size;
+		
+	public:
+		IntrusiveLinkedList();
+		
+		/// check if there are any entries in the list
+		inline bool
+		isEmpty() const;
+		
+		/**
+		 * \brief	Get number of entries
+		 * 
+		 * \warning	This function is O(n)!
+		 */
+		Size
+		getSize() const;
+		
+		/// Insert in front
+		void
+		prepend(T& item);
+		
+		/// Insert at the end of the list
+		void
+		append(T& item);
+		
+		/// Insert \p item behind \p position, which must be part of the list
+		void
+		insertAfter(T& position, T& item);
+		
+		/// Remove the first entry
+		void
+		removeFront();
+		
+		/**
+		 * \brief	Remove an entry
+		 * 
+		 * The list is searched for the predecessor of \p item, so this
+		 * is O(n). Use xpcc::IntrusiveDoublyLinkedList if entries
+		 * are often removed from the middle of the list.
+		 * 
+		 * \return	\c false if \p item was not part of the list
+		 */
+		bool
+		remove(T& item);
+		
+		/// Remove all entries, the entries themselves are not touched
+		void
+		removeAll();
+		
+		inline T&
+		getFront();
+		
+		inline const T&
+		getFront() const;
+		
+		inline T&
+		getBack();
+		
+		inline const T&
+		getBack() const;
+		
+		/**
+		 * \brief	Get the entry following \p item
+		 * 
+		 * If \p item is zero the first entry is returned. This allows to
+		 * walk the list while remembering the predecessor of the current
+		 * entry.
+		 * 
+		 * \return	Next entry or zero at the end of the list
+		 */
+		inline T *
+		getNext(const T *item) const;
+		
+	public:
+		/// Forward iterator
+		class iterator
+		{
+			friend class IntrusiveLinkedList;
+			friend class const_iterator;
+			
+		public:
+			/// Default constructor
+			iterator();
+			iterator(const iterator& other);
+			
+			iterator& operator = (const iterator& other);
+			iterator& operator ++ ();
+			bool operator == (const iterator& other) const;
+			bool operator != (const iterator& other) const;
+			T& operator * ();
+			T* operator -> ();
+		
+		private:
+			iterator(T* item);
+			
+			T* item;
+		};
+		
+		/// Forward const iterator
+		class const_iterator
+		{
+			friend class IntrusiveLinkedList;
+			
+		public:
+			/// Default constructor
+			const_iterator();
+			const_iterator(const iterator& other);
+			const_iterator(const const_iterator& other);
+			
+			const_iterator& operator = (const const_iterator& other);
+			const_iterator& operator ++ ();
+			bool operator == (const const_iterator& other) const;
+			bool operator != (const const_iterator& other) const;
+			const T& operator * () const;
+			const T* operator -> () const;
+		
+		private:
+			const_iterator(const T* item);
+			
+			const T* item;
+		};
+		
+		iterator
+		begin();
+		
+		const_iterator
+		begin() const;
+		
+		iterator
+		end();
+		
+		const_iterator
+		end() const;
+		
+	private:
+		IntrusiveLinkedList(const IntrusiveLinkedList& other);
+		
+		IntrusiveLinkedList&
+		operator = (const IntrusiveLinkedList& other);
+		
+		T *front;
+		T *back;
+	};
+}
+
+#include "intrusive_linked_list_impl.hpp"
+
+#endif	// XPCC__INTRUSIVE_LINKED_LIST_HPP
@@ -0,0 +1,355 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC__INTRUSIVE_LINKED_LIST_HPP
+	#error	"Don't include this file directly, use 'intrusive_linked_list.hpp' instead"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+xpcc::IntrusiveLinkedList<T, Hook>::IntrusiveLinkedList() :
+	front(0), back(0)
+{
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+bool
+xpcc::IntrusiveLinkedList<T, Hook>::isEmpty() const
+{
+	return (this->front == 0);
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+typename xpcc::IntrusiveLinkedList<T, Hook>::Size
+xpcc::IntrusiveLinkedList<T, Hook>::getSize() const
+{
+	Size count = 0;
+	for (const T *item = this->front; item != 0; item = (item->*Hook).next) {
+		count++;
+	}
+	return count;
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+void
+xpcc::IntrusiveLinkedList<T, Hook>::prepend(T& item)
+{
+	(item.*Hook).next = this->front;
+	this->front = &item;
+	
+	if (this->back == 0) {
+		// first entry in the list
+		this->back = &item;
+	}
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+void
+xpcc::IntrusiveLinkedList<T, Hook>::append(T& item)
+{
+	(item.*Hook).next = 0;
+	if (this->front == 0)
+	{
+		// first entry in the list
+		this->front = &item;
+	}
+	else {
+		(this->back->*Hook).next = &item;
+	}
+	this->back = &item;
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+void
+xpcc::IntrusiveLinkedList<T, Hook>::insertAfter(T& position, T& item)
+{
+	(item.*Hook).next = (position.*Hook).next;
+	(position.*Hook).next = &item;
+	
+	if (this->back == &position) {
+		this->back = &item;
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+void
+xpcc::IntrusiveLinkedList<T, Hook>::removeFront()
+{
+	T *item = this->front;
+	this->front = (item->*Hook).next;
+	if (this->front == 0) {
+		// last entry in the list
+		this->back = 0;
+	}
+	(item->*Hook).next = 0;
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+bool
+xpcc::IntrusiveLinkedList<T, Hook>::remove(T& item)
+{
+	if (this->front == 0) {
+		return false;
+	}
+	else if (this->front == &item) {
+		this->removeFront();
+		return true;
+	}
+	
+	T *previous = this->front;
+	while (T *current = (previous->*Hook).next)
+	{
+		if (current == &item)
+		{
+			(previous->*Hook).next = (item.*Hook).next;
+			if (this->back == &item) {
+				this->back = previous;
+			}
+			(item.*Hook).next = 0;
+			return true;
+		}
+		previous = current;
+	}
+	
+	return false;
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+void
+xpcc::IntrusiveLinkedList<T, Hook>::removeAll()
+{
+	while (!this->isEmpty()) {
+		this->removeFront();
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+T&
+xpcc::IntrusiveLinkedList<T, Hook>::getFront()
+{
+	return *this->front;
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+const T&
+xpcc::IntrusiveLinkedList<T, Hook>::getFront() const
+{
+	return *this->front;
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+T&
+xpcc::IntrusiveLinkedList<T, Hook>::getBack()
+{
+	return *this->back;
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+const T&
+xpcc::IntrusiveLinkedList<T, Hook>::getBack() const
+{
+	return *this->back;
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+T *
+xpcc::IntrusiveLinkedList<T, Hook>::getNext(const T *item) const
+{
+	if (item == 0) {
+		return this->front;
+	}
+	return (item->*Hook).next;
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+typename xpcc::IntrusiveLinkedList<T, Hook>::iterator
+xpcc::IntrusiveLinkedList<T, Hook>::begin()
+{
+	return iterator(this->front);
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+typename xpcc::IntrusiveLinkedList<T, Hook>::iterator
+xpcc::IntrusiveLinkedList<T, Hook>::end()
+{
+	return iterator(0);
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+typename xpcc::IntrusiveLinkedList<T, Hook>::const_iterator
+xpcc::IntrusiveLinkedList<T, Hook>::begin() const
+{
+	return const_iterator(this->front);
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+typename xpcc::IntrusiveLinkedList<T, Hook>::const_iterator
+xpcc::IntrusiveLinkedList<T, Hook>::end() const
+{
+	return const_iterator(0);
+}
+
+// ----------------------------------------------------------------------------
+// Iterators
+// ----------------------------------------------------------------------------
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+xpcc::IntrusiveLinkedList<T, Hook>::iterator::iterator() :
+	item(0)
+{
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+xpcc::IntrusiveLinkedList<T, Hook>::iterator::iterator(T* item) :
+	item(item)
+{
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+xpcc::IntrusiveLinkedList<T, Hook>::iterator::iterator(const iterator& other) :
+	item(other.item)
+{
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+typename xpcc::IntrusiveLinkedList<T, Hook>::iterator&
+xpcc::IntrusiveLinkedList<T, Hook>::iterator::operator = (const iterator& other)
+{
+	this->item = other.item;
+	return *this;
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+typename xpcc::IntrusiveLinkedList<T, Hook>::iterator&
+xpcc::IntrusiveLinkedList<T, Hook>::iterator::operator ++ ()
+{
+	this->item = (this->item->*Hook).next;
+	return *this;
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+bool
+xpcc::IntrusiveLinkedList<T, Hook>::iterator::operator == (const iterator& other) const
+{
+	return (this->item == other.item);
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+bool
+xpcc::IntrusiveLinkedList<T, Hook>::iterator::operator != (const iterator& other) const
+{
+	return (this->item != other.item);
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+T&
+xpcc::IntrusiveLinkedList<T, Hook>::iterator::operator * ()
+{
+	return *this->item;
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+T*
+xpcc::IntrusiveLinkedList<T, Hook>::iterator::operator -> ()
+{
+	return this->item;
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+xpcc::IntrusiveLinkedList<T, Hook>::const_iterator::const_iterator() :
+	item(0)
+{
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+xpcc::IntrusiveLinkedList<T, Hook>::const_iterator::const_iterator(const T* item) :
+	item(item)
+{
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+xpcc::IntrusiveLinkedList<T, Hook>::const_iterator::const_iterator(const iterator& other) :
+	item(other.item)
+{
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+xpcc::IntrusiveLinkedList<T, Hook>::const_iterator::const_iterator(const const_iterator& other) :
+	item(other.item)
+{
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+typename xpcc::IntrusiveLinkedList<T, Hook>::const_iterator&
+xpcc::IntrusiveLinkedList<T, Hook>::const_iterator::operator = (const const_iterator& other)
+{
+	this->item = other.item;
+	return *this;
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+typename xpcc::IntrusiveLinkedList<T, Hook>::const_iterator&
+xpcc::IntrusiveLinkedList<T, Hook>::const_iterator::operator ++ ()
+{
+	this->item = (this->item->*Hook).next;
+	return *this;
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+bool
+xpcc::IntrusiveLinkedList<T, Hook>::const_iterator::operator == (const const_iterator& other) const
+{
+	return (this->item == other.item);
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+bool
+xpcc::IntrusiveLinkedList<T, Hook>::const_iterator::operator != (const const_iterator& other) const
+{
+	return (this->item != other.item);
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+const T&
+xpcc::IntrusiveLinkedList<T, Hook>::const_iterator::operator * () const
+{
+	return *this->item;
+}
+
+template <typename T, xpcc::IntrusiveLinkedListHook<T> T::*Hook>
+const T*
+xpcc::IntrusiveLinkedList<T, Hook>::const_iterator::operator -> () const
+{
+	return this->item;
+}
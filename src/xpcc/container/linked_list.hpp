@@ -32,6 +32,7 @@
 #define	XPCC__LINKED_LIST_HPP
 
 #include <stdint.h>
+#include <utility>		// for std::move and std::forward
 #include <xpcc/utils/allocator.hpp>
 
 namespace xpcc
@@ -77,9 +78,27 @@ namespace xpcc
 		bool
 		prepend(const T& value);
 
+		/// Insert in front, move constructing the new entry from \p value
+		bool
+		prepend(T&& value);
+
 		/// Insert at the end of the list
 		void
 		append(const T& value);
+
+		/// Insert at the end, move constructing the new entry from \p value
+		void
+		append(T&& value);
+		
+		/// Construct a new entry in front of the list from \p args
+		template <typename... Args>
+		bool
+		emplaceFront(Args&&... args);
+		
+		/// Construct a new entry at the end of the list from \p args
+		template <typename... Args>
+		void
+		emplaceBack(Args&&... args);
 		
 		/// Remove the first entry
 		void
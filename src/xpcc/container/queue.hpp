@@ -32,6 +32,7 @@
 #define	XPCC__QUEUE_HPP
 
 #include <cstddef>
+#include <utility>
 
 #include "deque.hpp"
 
@@ -102,6 +103,12 @@ namespace xpcc
 			return c.append(value);
 		}
 		
+		inline bool
+		push(T&& value)
+		{
+			return c.append(std::move(value));
+		}
+		
 		inline void
 		pop()
 		{
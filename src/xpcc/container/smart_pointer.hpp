@@ -35,6 +35,7 @@
 #include <stdint.h>
 
 #include <xpcc/io/iostream.hpp>
+#include <xpcc/utils/template_metaprogramming.hpp>
 
 namespace xpcc
 {
@@ -150,6 +151,21 @@ namespace xpcc
 	 */
 	xpcc::IOStream&
 	operator <<( xpcc::IOStream& s, const xpcc::SmartPointer& sPtr);
+	
+	namespace tmp
+	{
+		/**
+		 * A SmartPointer only holds a pointer to the shared buffer, so it
+		 * can be relocated without touching the reference counter.
+		 */
+		template <>
+		struct TriviallyRelocatable<SmartPointer>
+		{
+			enum {
+				value = true
+			};
+		};
+	}
 };
 
 #endif	// XPCC_SMART_POINTER_H
@@ -33,6 +33,7 @@
 
 #include <cstddef>
 #include <stdint.h>
+#include <utility>
 
 #include "deque.hpp"
 
@@ -101,6 +102,12 @@ namespace xpcc
 			return c.prepend(value);
 		}
 		
+		bool
+		push(T&& value)
+		{
+			return c.prepend(std::move(value));
+		}
+		
 		void
 		pop()
 		{
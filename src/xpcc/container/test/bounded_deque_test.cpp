@@ -28,6 +28,7 @@
  */
 // ----------------------------------------------------------------------------
 
+#include <unittest/type/count_type.hpp>
 #include <xpcc/container/deque.hpp>
 
 #include "bounded_deque_test.hpp"
@@ -228,3 +229,33 @@ BoundedDequeTest::testConstIterator()
 	
 	TEST_ASSERT_FALSE(it != deque.end());
 }
+
+void
+BoundedDequeTest::testMove()
+{
+	xpcc::BoundedDeque<unittest::CountType, 3> deque;
+	
+	unittest::CountType::reset();
+	
+	deque.append(unittest::CountType());
+	deque.prepend(unittest::CountType());
+	
+	TEST_ASSERT_EQUALS(deque.getSize(), 2U);
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfAssignments, 0U);
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfMoveAssignments, 2U);
+}
+
+void
+BoundedDequeTest::testEmplace()
+{
+	xpcc::BoundedDeque<int16_t, 3> deque;
+	
+	TEST_ASSERT_TRUE(deque.emplaceBack(2));
+	TEST_ASSERT_TRUE(deque.emplaceFront(1));
+	TEST_ASSERT_TRUE(deque.emplaceBack(3));
+	TEST_ASSERT_FALSE(deque.emplaceBack(4));
+	
+	TEST_ASSERT_EQUALS(deque.getSize(), 3U);
+	TEST_ASSERT_EQUALS(deque.getFront(), 1);
+	TEST_ASSERT_EQUALS(deque.getBack(), 3);
+}
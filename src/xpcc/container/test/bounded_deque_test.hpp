@@ -47,4 +47,10 @@ public:
 	
 	void
 	testConstIterator();
+	
+	void
+	testMove();
+	
+	void
+	testEmplace();
 };
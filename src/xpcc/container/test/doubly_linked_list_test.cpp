@@ -376,3 +376,36 @@ DoublyLinkedListTest::testIteratorAccess()
 	(*it).b = 22312;
 	TEST_ASSERT_EQUALS(it->b, 22312);
 }
+
+void
+DoublyLinkedListTest::testAppendMove()
+{
+	xpcc::DoublyLinkedList< unittest::CountType > list;
+	
+	list.append(unittest::CountType());
+	list.prepend(unittest::CountType());
+	
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfDefaultConstructorCalls, 2U);
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfCopyConstructorCalls, 0U);
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfMoveConstructorCalls, 2U);
+}
+
+void
+DoublyLinkedListTest::testEmplace()
+{
+	xpcc::DoublyLinkedList< unittest::CountType > list;
+	
+	list.emplaceBack();
+	list.emplaceFront();
+	
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfDefaultConstructorCalls, 2U);
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfOperations, 2U);
+	
+	xpcc::DoublyLinkedList<int16_t> values;
+	values.emplaceBack(2);
+	values.emplaceFront(1);
+	values.emplaceBack(3);
+	
+	TEST_ASSERT_EQUALS(values.getFront(), 1);
+	TEST_ASSERT_EQUALS(values.getBack(), 3);
+}
@@ -78,5 +78,11 @@ public:
 	void
 	testIteratorAccess();
 	
+	void
+	testAppendMove();
+	
+	void
+	testEmplace();
+	
 	// TODO test decrement operator for iterators 
 };
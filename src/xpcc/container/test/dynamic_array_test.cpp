@@ -204,6 +204,159 @@ DynamicArrayTest::testRemoveAll()
 
 // ----------------------------------------------------------------------------
 
+namespace
+{
+	// Counts the number of allocations done by all instances
+	template <typename T>
+	class CountingAllocator : public xpcc::allocator::Dynamic<T>
+	{
+	public:
+		template <typename U>
+		struct rebind
+		{
+			typedef CountingAllocator<U> other;
+		};
+		
+		T*
+		allocate(size_t n)
+		{
+			++numberOfAllocations;
+			return xpcc::allocator::Dynamic<T>::allocate(n);
+		}
+		
+		static std::size_t numberOfAllocations;
+	};
+	
+	template <typename T>
+	std::size_t CountingAllocator<T>::numberOfAllocations = 0;
+	
+	class EmplaceTestClass
+	{
+	public:
+		EmplaceTestClass(uint8_t a, int16_t b) :
+			a(a), b(b)
+		{
+		}
+		
+		uint8_t a;
+		int16_t b;
+		unittest::CountType count;
+	};
+}
+
+void
+DynamicArrayTest::testAppendMove()
+{
+	xpcc::DynamicArray<unittest::CountType> array(5);
+	
+	array.append(unittest::CountType());
+	
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfDefaultConstructorCalls, 1U);
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfCopyConstructorCalls, 0U);
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfMoveConstructorCalls, 1U);
+	TEST_ASSERT_EQUALS(array.getSize(), 1U);
+}
+
+void
+DynamicArrayTest::testEmplaceBack()
+{
+	xpcc::DynamicArray<EmplaceTestClass> array(2);
+	
+	array.emplaceBack(12, -1532);
+	array.emplaceBack(13, 42);
+	
+	TEST_ASSERT_EQUALS(array.getSize(), 2U);
+	TEST_ASSERT_EQUALS(array[0].a, 12);
+	TEST_ASSERT_EQUALS(array[0].b, -1532);
+	TEST_ASSERT_EQUALS(array[1].a, 13);
+	TEST_ASSERT_EQUALS(array[1].b, 42);
+	
+	// constructed in place, no temporaries
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfDefaultConstructorCalls, 2U);
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfOperations, 2U);
+}
+
+void
+DynamicArrayTest::testReallocationMoves()
+{
+	xpcc::DynamicArray<unittest::CountType> array;
+	
+	unittest::CountType data;
+	for (uint_fast8_t i = 0; i < 20; ++i) {
+		array.append(data);
+	}
+	
+	TEST_ASSERT_EQUALS(array.getSize(), 20U);
+	
+	// only the appends themselves copy, reallocation moves the elements
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfCopyConstructorCalls, 20U);
+	TEST_ASSERT_TRUE(unittest::CountType::numberOfMoveConstructorCalls > 0);
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfDestructorCalls,
+			unittest::CountType::numberOfMoveConstructorCalls);
+}
+
+void
+DynamicArrayTest::testMoveConstructor()
+{
+	xpcc::DynamicArray<unittest::CountType> array(5);
+	
+	unittest::CountType data;
+	array.append(data);
+	array.append(data);
+	
+	unittest::CountType::reset();
+	
+	xpcc::DynamicArray<unittest::CountType> array2(std::move(array));
+	
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfOperations, 0U);
+	TEST_ASSERT_EQUALS(array2.getSize(), 2U);
+	TEST_ASSERT_EQUALS(array2.getCapacity(), 5U);
+	TEST_ASSERT_TRUE(array.isEmpty());
+	TEST_ASSERT_EQUALS(array.getCapacity(), 0U);
+	
+	array = std::move(array2);
+	
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfOperations, 0U);
+	TEST_ASSERT_EQUALS(array.getSize(), 2U);
+	TEST_ASSERT_TRUE(array2.isEmpty());
+}
+
+void
+DynamicArrayTest::testReallocationAllocations()
+{
+	typedef xpcc::DynamicArray<int16_t, CountingAllocator<int16_t> > Inner;
+	
+	CountingAllocator<int16_t>::numberOfAllocations = 0;
+	
+	xpcc::DynamicArray<Inner> array;
+	for (uint_fast8_t i = 0; i < 20; ++i)
+	{
+		Inner inner(4);
+		inner.append(i);
+		array.append(std::move(inner));
+	}
+	
+	// one allocation per inner array, neither the appends nor the
+	// reallocations of the outer array allocate memory for the inner ones
+	TEST_ASSERT_EQUALS(CountingAllocator<int16_t>::numberOfAllocations, 20U);
+	
+	for (uint_fast8_t i = 0; i < 20; ++i) {
+		TEST_ASSERT_EQUALS(array[i][0], i);
+	}
+	
+	// The nested dynamic array is trivially relocatable
+	xpcc::DynamicArray< xpcc::DynamicArray<int16_t> > nested;
+	for (uint_fast8_t i = 0; i < 20; ++i) {
+		nested.emplaceBack(1, i);
+	}
+	for (uint_fast8_t i = 0; i < 20; ++i) {
+		TEST_ASSERT_EQUALS(nested[i].getSize(), 1U);
+		TEST_ASSERT_EQUALS(nested[i][0], i);
+	}
+}
+
+// ----------------------------------------------------------------------------
+
 namespace
 {
 	class IteratorTestClass
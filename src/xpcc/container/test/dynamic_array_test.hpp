@@ -63,6 +63,22 @@ public:
 	void
 	testRemoveAll();
 	
+	// move semantics
+	void
+	testAppendMove();
+	
+	void
+	testEmplaceBack();
+	
+	void
+	testReallocationMoves();
+	
+	void
+	testMoveConstructor();
+	
+	void
+	testReallocationAllocations();
+	
 	// iterators
 	void
 	testConstIterator();
@@ -0,0 +1,231 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/container/intrusive_linked_list.hpp>
+
+#include "intrusive_linked_list_test.hpp"
+
+namespace
+{
+	struct Item
+	{
+		Item(int value) :
+			value(value)
+		{
+		}
+		
+		int value;
+		xpcc::IntrusiveLinkedListHook<Item> hook;
+		xpcc::IntrusiveLinkedListHook<Item> otherHook;
+	};
+	
+	typedef xpcc::IntrusiveLinkedList<Item, &Item::hook> List;
+	typedef xpcc::IntrusiveLinkedList<Item, &Item::otherHook> OtherList;
+}
+
+void
+IntrusiveLinkedListTest::testConstructor()
+{
+	List list;
+	
+	TEST_ASSERT_TRUE(list.isEmpty());
+	TEST_ASSERT_EQUALS(list.getSize(), 0U);
+	TEST_ASSERT_TRUE(list.begin() == list.end());
+}
+
+void
+IntrusiveLinkedListTest::testAppend()
+{
+	Item a(1), b(2), c(3);
+	List list;
+	
+	list.append(a);
+	
+	TEST_ASSERT_FALSE(list.isEmpty());
+	TEST_ASSERT_EQUALS(&list.getFront(), &a);
+	TEST_ASSERT_EQUALS(&list.getBack(), &a);
+	
+	list.append(b);
+	list.append(c);
+	
+	TEST_ASSERT_EQUALS(list.getSize(), 3U);
+	TEST_ASSERT_EQUALS(&list.getFront(), &a);
+	TEST_ASSERT_EQUALS(&list.getBack(), &c);
+}
+
+void
+IntrusiveLinkedListTest::testPrepend()
+{
+	Item a(1), b(2), c(3);
+	List list;
+	
+	list.prepend(a);
+	
+	TEST_ASSERT_EQUALS(&list.getFront(), &a);
+	TEST_ASSERT_EQUALS(&list.getBack(), &a);
+	
+	list.prepend(b);
+	list.prepend(c);
+	
+	TEST_ASSERT_EQUALS(list.getSize(), 3U);
+	TEST_ASSERT_EQUALS(&list.getFront(), &c);
+	TEST_ASSERT_EQUALS(&list.getBack(), &a);
+}
+
+void
+IntrusiveLinkedListTest::testInsertAfter()
+{
+	Item a(1), b(2), c(3), d(4);
+	List list;
+	
+	list.append(a);
+	list.append(c);
+	
+	list.insertAfter(a, b);
+	list.insertAfter(c, d);
+	
+	TEST_ASSERT_EQUALS(list.getSize(), 4U);
+	TEST_ASSERT_EQUALS(&list.getBack(), &d);
+	
+	List::iterator it = list.begin();
+	TEST_ASSERT_EQUALS(it->value, 1);
+	++it;
+	TEST_ASSERT_EQUALS(it->value, 2);
+	++it;
+	TEST_ASSERT_EQUALS(it->value, 3);
+	++it;
+	TEST_ASSERT_EQUALS(it->value, 4);
+	++it;
+	TEST_ASSERT_TRUE(it == list.end());
+}
+
+void
+IntrusiveLinkedListTest::testRemoveFront()
+{
+	Item a(1), b(2);
+	List list;
+	
+	list.append(a);
+	list.append(b);
+	
+	list.removeFront();
+	TEST_ASSERT_EQUALS(&list.getFront(), &b);
+	TEST_ASSERT_EQUALS(&list.getBack(), &b);
+	
+	list.removeFront();
+	TEST_ASSERT_TRUE(list.isEmpty());
+	
+	// a removed entry can be added again
+	list.append(a);
+	TEST_ASSERT_EQUALS(&list.getFront(), &a);
+	TEST_ASSERT_EQUALS(&list.getBack(), &a);
+}
+
+void
+IntrusiveLinkedListTest::testRemove()
+{
+	Item a(1), b(2), c(3), d(4);
+	List list;
+	
+	TEST_ASSERT_FALSE(list.remove(a));
+	
+	list.append(a);
+	list.append(b);
+	list.append(c);
+	
+	TEST_ASSERT_FALSE(list.remove(d));
+	
+	// last entry
+	TEST_ASSERT_TRUE(list.remove(c));
+	TEST_ASSERT_EQUALS(&list.getBack(), &b);
+	
+	list.append(c);
+	
+	// middle
+	TEST_ASSERT_TRUE(list.remove(b));
+	TEST_ASSERT_EQUALS(list.getSize(), 2U);
+	TEST_ASSERT_EQUALS(&list.getFront(), &a);
+	TEST_ASSERT_EQUALS(&list.getBack(), &c);
+	
+	// front
+	TEST_ASSERT_TRUE(list.remove(a));
+	TEST_ASSERT_EQUALS(&list.getFront(), &c);
+	TEST_ASSERT_EQUALS(&list.getBack(), &c);
+	
+	TEST_ASSERT_TRUE(list.remove(c));
+	TEST_ASSERT_TRUE(list.isEmpty());
+}
+
+void
+IntrusiveLinkedListTest::testIterator()
+{
+	Item a(1), b(2), c(3);
+	List list;
+	OtherList otherList;
+	
+	list.append(a);
+	list.append(b);
+	list.append(c);
+	
+	// the same entries are part of a second list in reverse order
+	otherList.prepend(a);
+	otherList.prepend(b);
+	otherList.prepend(c);
+	
+	int i = 1;
+	for (List::iterator it = list.begin(); it != list.end(); ++it) {
+		TEST_ASSERT_EQUALS(it->value, i);
+		++i;
+	}
+	TEST_ASSERT_EQUALS(i, 4);
+	
+	const OtherList& constList = otherList;
+	for (OtherList::const_iterator it = constList.begin(); it != constList.end(); ++it) {
+		--i;
+		TEST_ASSERT_EQUALS((*it).value, i);
+	}
+	TEST_ASSERT_EQUALS(i, 1);
+}
+
+void
+IntrusiveLinkedListTest::testGetNext()
+{
+	Item a(1), b(2);
+	List list;
+	
+	TEST_ASSERT_TRUE(list.getNext(0) == 0);
+	
+	list.append(a);
+	list.append(b);
+	
+	TEST_ASSERT_EQUALS(list.getNext(0), &a);
+	TEST_ASSERT_EQUALS(list.getNext(&a), &b);
+	TEST_ASSERT_TRUE(list.getNext(&b) == 0);
+}
@@ -402,3 +402,36 @@ LinkedListTest::testRemove()
 	TEST_ASSERT_EQUALS(list.getFront(), 2);
 	TEST_ASSERT_EQUALS(list.getBack(), 2);
 }
+
+void
+LinkedListTest::testAppendMove()
+{
+	xpcc::LinkedList< unittest::CountType > list;
+	
+	list.append(unittest::CountType());
+	list.prepend(unittest::CountType());
+	
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfDefaultConstructorCalls, 2U);
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfCopyConstructorCalls, 0U);
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfMoveConstructorCalls, 2U);
+}
+
+void
+LinkedListTest::testEmplace()
+{
+	xpcc::LinkedList< unittest::CountType > list;
+	
+	list.emplaceBack();
+	list.emplaceFront();
+	
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfDefaultConstructorCalls, 2U);
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfOperations, 2U);
+	
+	xpcc::LinkedList<int16_t> values;
+	values.emplaceBack(2);
+	values.emplaceFront(1);
+	values.emplaceBack(3);
+	
+	TEST_ASSERT_EQUALS(values.getFront(), 1);
+	TEST_ASSERT_EQUALS(values.getBack(), 3);
+}
@@ -77,4 +77,10 @@ public:
 	
 	void
 	testRemove();
+	
+	void
+	testAppendMove();
+	
+	void
+	testEmplace();
 };
@@ -36,5 +36,6 @@
 
 #include "debug/logger.hpp"
 #include "debug/error_report.hpp"
+#include "debug/profile.hpp"
 
 #endif	// XPCC__DEBUG_HPP
@@ -0,0 +1,89 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__PROFILE_HPP
+#define XPCC__PROFILE_HPP
+
+#include "profile/profiler.hpp"
+
+/**
+\ingroup	debug
+\defgroup	profile	Profiler
+\brief		Measure the execution time of code sections on the target
+
+A zone is measured from the XPCC_PROFILE() statement to the end of the
+enclosing scope:
+
+\code
+void
+Controller::update()
+{
+	XPCC_PROFILE("Controller::update");
+	...
+}
+\endcode
+
+Every finished zone is stored as a record (name and duration) in a ring
+buffer of \c XPCC_PROFILE_BUFFER_SIZE entries. Call
+xpcc::profile::Profiler::dump() from time to time to write and clear
+the records:
+
+\code
+xpcc::profile::Profiler::initialize();
+while (1)
+{
+	...
+	if (dumpTimer.isExpired()) {
+		xpcc::profile::Profiler::dump(stream);
+	}
+}
+\endcode
+
+\c tools/profile.py reads these dumps (from a file, stdin or a serial
+port) and prints min/avg/max and percentiles for every zone.
+
+The time base is
+- the DWT cycle counter on Cortex-M3/M4,
+- Timer/Counter 1 (ATmega) or TCC1 (ATxmega) running at F_CPU on AVRs,
+  zones longer than 65535 cycles wrap around,
+- a monotonic clock with nanosecond resolution on the PC,
+- xpcc::Clock with millisecond resolution on all other targets.
+
+The profiler is disabled by default and XPCC_PROFILE() then compiles to
+nothing. Enable it with
+\code
+[defines]
+XPCC_PROFILE_ENABLED = 1
+\endcode
+in the \c project.cfg. The library uses zones in xpcc::Dispatcher::update(),
+xpcc::CanConnector::update() and xpcc::Scheduler::scheduleInterupt().
+*/
+
+#endif	// XPCC__PROFILE_HPP
@@ -0,0 +1,202 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/architecture/driver/atomic/lock.hpp>
+#include <xpcc/architecture/driver/clock.hpp>
+
+#include "xpcc_config.hpp"
+#include "profiler.hpp"
+
+#if defined(XPCC__OS_WIN32) || defined(XPCC__OS_WIN64)
+#	include <windows.h>
+#elif defined(XPCC__OS_UNIX)
+#	include <time.h>
+#elif defined(XPCC__OS_OSX)
+#	include <sys/time.h>
+#endif
+
+namespace
+{
+	struct Record
+	{
+		const char *zone;
+		xpcc::profile::Profiler::Ticks duration;
+	};
+	
+	Record buffer[XPCC_PROFILE_BUFFER_SIZE];
+	uint16_t head = 0;
+	uint16_t count = 0;
+	uint16_t lost = 0;
+	
+	FLASH_STORAGE_STRING(profileHeader) = "profile\t";
+	FLASH_STORAGE_STRING(profileEnd) = "end\n";
+	
+	// The global stream operator for flash strings is hidden by the
+	// operators declared in the namespace xpcc.
+	inline void
+	print(xpcc::IOStream& stream, xpcc::accessor::Flash<char> string)
+	{
+		stream << string;
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+xpcc::profile::Profiler::initialize()
+{
+#if defined(XPCC__CPU_CORTEX_M3) || defined(XPCC__CPU_CORTEX_M4)
+	// enable the trace unit (CoreDebug->DEMCR |= TRCENA) and start
+	// the cycle counter (DWT->CTRL |= CYCCNTENA)
+	*reinterpret_cast<volatile uint32_t *>(0xE000EDFC) |= (1UL << 24);
+	*reinterpret_cast<volatile uint32_t *>(0xE0001004) = 0;
+	*reinterpret_cast<volatile uint32_t *>(0xE0001000) |= 1;
+#elif defined(XPCC__CPU_ATXMEGA)
+	TCC1.CTRLA = TC_CLKSEL_DIV1_gc;
+#elif defined(XPCC__CPU_ATMEGA)
+	TCCR1A = 0;
+	TCCR1B = (1 << CS10);
+#endif
+	clear();
+}
+
+uint32_t
+xpcc::profile::Profiler::getFrequency()
+{
+#if defined(XPCC__CPU_CORTEX_M3) || defined(XPCC__CPU_CORTEX_M4) || \
+	defined(XPCC__CPU_AVR)
+	return F_CPU;
+#elif defined(XPCC__CPU_HOSTED)
+	return 1000000000UL;
+#else
+	return 1000;
+#endif
+}
+
+xpcc::profile::Profiler::Ticks
+xpcc::profile::Profiler::readCounter()
+{
+#if defined(XPCC__OS_WIN32) || defined(XPCC__OS_WIN64)
+	LARGE_INTEGER frequency;
+	LARGE_INTEGER counter;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	return static_cast<Ticks>(static_cast<uint64_t>(counter.QuadPart) *
+			1000000000ULL / static_cast<uint64_t>(frequency.QuadPart));
+#elif defined(XPCC__OS_UNIX)
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return static_cast<Ticks>(now.tv_sec * 1000000000UL + now.tv_nsec);
+#elif defined(XPCC__OS_OSX)
+	struct timeval now;
+	gettimeofday(&now, 0);
+	return static_cast<Ticks>(now.tv_sec * 1000000000UL + now.tv_usec * 1000);
+#else
+	return xpcc::Clock::now().getTime();
+#endif
+}
+
+// ----------------------------------------------------------------------------
+void
+xpcc::profile::Profiler::record(xpcc::accessor::Flash<char> zone,
+		Ticks duration)
+{
+	xpcc::atomic::Lock lock;
+	
+	Record& record = buffer[head];
+	record.zone = zone.getPointer();
+	record.duration = duration;
+	
+	head++;
+	if (head >= XPCC_PROFILE_BUFFER_SIZE) {
+		head = 0;
+	}
+	
+	if (count < XPCC_PROFILE_BUFFER_SIZE) {
+		count++;
+	}
+	else if (lost < 0xffff) {
+		// the oldest record was overwritten
+		lost++;
+	}
+}
+
+void
+xpcc::profile::Profiler::dump(xpcc::IOStream& stream)
+{
+	uint16_t index;
+	uint16_t number;
+	uint16_t lostRecords;
+	{
+		xpcc::atomic::Lock lock;
+		number = count;
+		lostRecords = lost;
+		index = (head + XPCC_PROFILE_BUFFER_SIZE - count) % XPCC_PROFILE_BUFFER_SIZE;
+	}
+	
+	print(stream, xpcc::accessor::asFlash(profileHeader));
+	stream << getFrequency() << '\t' << lostRecords << '\n';
+	
+	for (uint16_t i = 0; i < number; ++i)
+	{
+		Record record;
+		{
+			xpcc::atomic::Lock lock;
+			record = buffer[index];
+		}
+		
+		print(stream, xpcc::accessor::asFlash(record.zone));
+		stream << '\t' << record.duration << '\n';
+		
+		index++;
+		if (index >= XPCC_PROFILE_BUFFER_SIZE) {
+			index = 0;
+		}
+	}
+	print(stream, xpcc::accessor::asFlash(profileEnd));
+	stream << xpcc::flush;
+	
+	clear();
+}
+
+void
+xpcc::profile::Profiler::clear()
+{
+	xpcc::atomic::Lock lock;
+	head = 0;
+	count = 0;
+	lost = 0;
+}
+
+uint16_t
+xpcc::profile::Profiler::getCount()
+{
+	xpcc::atomic::Lock lock;
+	return count;
+}
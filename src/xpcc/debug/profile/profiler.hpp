@@ -0,0 +1,188 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_PROFILE__PROFILER_HPP
+#define XPCC_PROFILE__PROFILER_HPP
+
+#include <stdint.h>
+
+#include <xpcc/architecture/detect.hpp>
+#include <xpcc/architecture/utils.hpp>
+#include <xpcc/io/iostream.hpp>
+#include <xpcc/architecture/driver/accessor/flash.hpp>
+
+#if defined(XPCC__CPU_AVR)
+#	include <avr/io.h>
+#	include <avr/pgmspace.h>
+#endif
+
+// The profiler is enabled in the ``project.cfg``. The configuration is
+// included here, so the library and the project code always agree on it.
+#include <xpcc_config.hpp>
+
+#ifndef XPCC_PROFILE_ENABLED
+#	define XPCC_PROFILE_ENABLED 0
+#endif
+
+#ifdef __DOXYGEN__
+	/**
+	 * \brief	Measure the time until the end of the current scope
+	 * 
+	 * \param	zone	Name of the zone, a string literal
+	 * \ingroup	profile
+	 */
+	#define	XPCC_PROFILE(zone)
+#else
+#	if XPCC_PROFILE_ENABLED
+#		if defined(XPCC__CPU_AVR)
+#			define	XPCC_PROFILE_ZONE__(zone)	PSTR(zone)
+#		else
+#			define	XPCC_PROFILE_ZONE__(zone)	(zone)
+#		endif
+#		define	XPCC_PROFILE(zone) \
+			::xpcc::profile::Scope CONCAT(xpccProfileScope, __LINE__)( \
+					::xpcc::accessor::asFlash(XPCC_PROFILE_ZONE__(zone)))
+#	else
+#		define	XPCC_PROFILE(zone)	((void) 0)
+#	endif
+#endif
+
+namespace xpcc
+{
+	namespace profile
+	{
+		/**
+		 * \brief	Records the duration of the profiling zones
+		 * 
+		 * \see		profile
+		 * \ingroup	profile
+		 */
+		class Profiler
+		{
+		public:
+#if defined(XPCC__CPU_AVR)
+			typedef uint16_t Ticks;
+#else
+			typedef uint32_t Ticks;
+#endif
+			
+			/// Start the counter used as time base
+			static void
+			initialize();
+			
+			/// Current value of the time base
+			static ALWAYS_INLINE Ticks
+			now()
+			{
+#if defined(XPCC__CPU_CORTEX_M3) || defined(XPCC__CPU_CORTEX_M4)
+				// DWT->CYCCNT
+				return *reinterpret_cast<volatile uint32_t *>(0xE0001004);
+#elif defined(XPCC__CPU_ATXMEGA)
+				return TCC1.CNT;
+#elif defined(XPCC__CPU_ATMEGA)
+				return TCNT1;
+#else
+				return readCounter();
+#endif
+			}
+			
+			/// Number of ticks per second
+			static uint32_t
+			getFrequency();
+			
+			/// Store a finished zone in the ring buffer
+			static void
+			record(xpcc::accessor::Flash<char> zone, Ticks duration);
+			
+			/**
+			 * \brief	Write all records to the stream and clear them
+			 * 
+			 * Format (one record per line, tab separated):
+			 * \code
+			 * profile	<ticks per second>	<number of lost records>
+			 * <zone>	<ticks>
+			 * ...
+			 * end
+			 * \endcode
+			 * 
+			 * Zones finished while dump() is running are discarded.
+			 */
+			static void
+			dump(xpcc::IOStream& stream);
+			
+			/// Remove all records
+			static void
+			clear();
+			
+			/// Number of records currently stored
+			static uint16_t
+			getCount();
+			
+		private:
+			static Ticks
+			readCounter();
+		};
+		
+		/**
+		 * \brief	Measures the lifetime of the object
+		 * 
+		 * Use XPCC_PROFILE() instead of creating it directly.
+		 * 
+		 * \ingroup	profile
+		 */
+		class Scope
+		{
+		public:
+			ALWAYS_INLINE
+			Scope(xpcc::accessor::Flash<char> zone) :
+				zone(zone), start(Profiler::now())
+			{
+			}
+			
+			ALWAYS_INLINE
+			~Scope()
+			{
+				Profiler::record(zone,
+						static_cast<Profiler::Ticks>(Profiler::now() - start));
+			}
+			
+		private:
+			Scope(const Scope&);
+			
+			Scope&
+			operator = (const Scope&);
+			
+			const xpcc::accessor::Flash<char> zone;
+			const Profiler::Ticks start;
+		};
+	}
+}
+
+#endif	// XPCC_PROFILE__PROFILER_HPP
@@ -0,0 +1,165 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <cstring>
+#include <cstdio>
+
+// Enable the zones in this file only, independent of the configuration
+// used for the library
+#include <xpcc_config.hpp>
+#undef	XPCC_PROFILE_ENABLED
+#define	XPCC_PROFILE_ENABLED	1
+#include <xpcc/debug/profile.hpp>
+
+#include "profiler_test.hpp"
+
+using xpcc::profile::Profiler;
+
+namespace
+{
+	// stores all data in a memory buffer
+	class MemoryWriter : public xpcc::IODevice
+	{
+	public:
+		MemoryWriter() :
+			bytesWritten(0)
+		{
+			buffer[0] = '\0';
+		}
+		
+		virtual void
+		write(char c)
+		{
+			if (bytesWritten < sizeof(buffer) - 1) {
+				buffer[bytesWritten++] = c;
+				buffer[bytesWritten] = '\0';
+			}
+		}
+		
+		using xpcc::IODevice::write;
+		
+		virtual void
+		flush()
+		{
+		}
+		
+		virtual bool
+		read(char& /*c*/)
+		{
+			return false;
+		}
+		
+		char buffer[4096];
+		std::size_t bytesWritten;
+	};
+	
+	FLASH_STORAGE_STRING(zoneA) = "a";
+	FLASH_STORAGE_STRING(zoneB) = "b";
+}
+
+// ----------------------------------------------------------------------------
+void
+ProfilerTest::setUp()
+{
+	Profiler::clear();
+}
+
+void
+ProfilerTest::testDump()
+{
+	Profiler::record(xpcc::accessor::asFlash(zoneA), 10);
+	Profiler::record(xpcc::accessor::asFlash(zoneB), 2000);
+	Profiler::record(xpcc::accessor::asFlash(zoneA), 12);
+	TEST_ASSERT_EQUALS(Profiler::getCount(), 3U);
+	
+	MemoryWriter device;
+	xpcc::IOStream stream(device);
+	Profiler::dump(stream);
+	
+	TEST_ASSERT_TRUE(std::strcmp(device.buffer,
+			"profile\t1000000000\t0\n"
+			"a\t10\n"
+			"b\t2000\n"
+			"a\t12\n"
+			"end\n") == 0);
+	
+	// dump() removes the records
+	TEST_ASSERT_EQUALS(Profiler::getCount(), 0U);
+}
+
+void
+ProfilerTest::testOverflow()
+{
+	for (uint16_t i = 0; i < 1000; ++i) {
+		Profiler::record(xpcc::accessor::asFlash(zoneA), i);
+	}
+	
+	uint16_t count = Profiler::getCount();
+	TEST_ASSERT_TRUE(count > 0);
+	TEST_ASSERT_TRUE(count < 1000);
+	
+	MemoryWriter device;
+	xpcc::IOStream stream(device);
+	Profiler::dump(stream);
+	
+	// header with the number of lost records, then the newest records
+	char expected[64];
+	std::sprintf(expected, "profile\t1000000000\t%u\na\t%u\n",
+			1000 - count, 1000 - count);
+	TEST_ASSERT_TRUE(std::strncmp(device.buffer, expected,
+			std::strlen(expected)) == 0);
+	
+	const char *last = "a\t999\nend\n";
+	TEST_ASSERT_TRUE(std::strcmp(device.buffer + device.bytesWritten -
+			std::strlen(last), last) == 0);
+}
+
+void
+ProfilerTest::testScope()
+{
+	volatile uint32_t sum = 0;
+	{
+		XPCC_PROFILE("loop");
+		for (uint32_t i = 0; i < 10000; ++i) {
+			sum += i;
+		}
+		TEST_ASSERT_EQUALS(Profiler::getCount(), 0U);
+	}
+	TEST_ASSERT_EQUALS(Profiler::getCount(), 1U);
+	
+	MemoryWriter device;
+	xpcc::IOStream stream(device);
+	Profiler::dump(stream);
+	
+	unsigned long duration = 0;
+	TEST_ASSERT_EQUALS(std::sscanf(device.buffer,
+			"profile\t1000000000\t0\nloop\t%lu\nend\n", &duration), 1);
+	TEST_ASSERT_TRUE(duration > 0);
+}
@@ -39,6 +39,7 @@
 #include <stdlib.h>
 #include <xpcc/architecture/driver/clock.hpp>
 #include <xpcc/workflow/timestamp.hpp>
+#include <xpcc/math/utils/crc.hpp>
 
 #include "constants.hpp"
 
@@ -34,6 +34,7 @@
 #include <cstddef>
 #include <xpcc/architecture/driver/accessor/flash.hpp>
 #include <xpcc/workflow/timeout.hpp>
+#include <xpcc/utils/algorithm.hpp>
 
 #include "interface.hpp"
 
@@ -241,6 +242,14 @@ namespace xpcc
 		 * }
 		 * \endcode
 		 * 
+		 * If the entries of a list are sorted in ascending order (actions by
+		 * command, listeners and error handlers by address and then by
+		 * command) the node finds the matching entry by a binary search
+		 * instead of scanning the whole list. Use AMNB__ACTION_TABLE(),
+		 * AMNB__LISTEN_TABLE() and AMNB__ERROR_TABLE() to have the order
+		 * checked by the compiler. Unsorted lists still work but are
+		 * searched linearly.
+		 * 
 		 * A complete example is available in the \c example/amnb folder.
 		 * 
 		 * \author	Fabian Greif, Niklas Hauser
@@ -391,6 +400,32 @@ namespace xpcc
 			bool
 			checkErrorHandlers(uint8_t address, uint8_t command, Flags type, uint8_t errorCode);
 			
+			/**
+			 * \brief	Find the entry with the given key
+			 * 
+			 * Uses a binary search if \a sorted is \c true, otherwise
+			 * the list is scanned from the beginning. Only the keys are read
+			 * from flash until the entry is found.
+			 */
+			template <typename T>
+			static bool
+			find(xpcc::accessor::Flash<T> list, uint8_t count, bool sorted,
+				 uint16_t key, T& entry);
+			
+			/// Check if the keys of a list are strictly ascending
+			template <typename T>
+			static bool
+			isSorted(xpcc::accessor::Flash<T> list, uint8_t count);
+			
+			static inline uint16_t
+			getKey(xpcc::accessor::Flash<Action> list, uint8_t index);
+			
+			static inline uint16_t
+			getKey(xpcc::accessor::Flash<Listener> list, uint8_t index);
+			
+			static inline uint16_t
+			getKey(xpcc::accessor::Flash<ErrorHandler> list, uint8_t index);
+			
 			
 			uint8_t ownAddress;
 			xpcc::accessor::Flash<Action> actionList;
@@ -400,6 +435,10 @@ namespace xpcc
 			xpcc::accessor::Flash<ErrorHandler> errorHandlerList;
 			uint8_t errorHandlerCount;
 			
+			bool actionListSorted;
+			bool listenListSorted;
+			bool errorHandlerListSorted;
+			
 			uint8_t currentCommand;
 			Response response;
 			
@@ -479,6 +518,40 @@ namespace xpcc
 			reinterpret_cast<xpcc::amnb::Action::Callback>(&function) }
 #endif	// __DOXYGEN__
 
+#ifdef __DOXYGEN__
+	/**
+	 * \brief	Define a sorted list of amnb::Action
+	 * 
+	 * The entries are given through a macro which takes the name of the
+	 * entry macro as parameter. The table is stored in flash and the
+	 * compiler checks that the commands are unique and sorted in
+	 * ascending order, which allows the node to use a binary search.
+	 * 
+	 * Example:
+	 * \code
+	 * #define ACTIONS(ACTION) \
+	 *     ACTION(0x03, sensor, Sensor::doSomething, sizeof(uint32_t)), \
+	 *     ACTION(0x57, sensor, Sensor::sendValue,   0)
+	 * 
+	 * AMNB__ACTION_TABLE(actionList, ACTIONS);
+	 * \endcode
+	 * 
+	 * \param	name	Name of the array
+	 * \param	list	Macro defining the entries
+	 * 
+	 * \see		AMNB__ACTION()
+	 * \ingroup	amnb
+	 */
+	#define	AMNB__ACTION_TABLE(name, list)
+#else
+	#define	AMNB__ACTION_KEY(command, object, function, length)	(command)
+	
+	#define	AMNB__ACTION_TABLE(name, list)	\
+		FLASH_STORAGE(xpcc::amnb::Action name[]) = { list(AMNB__ACTION) }; \
+		static_assert(xpcc::isStrictlyAscending(list(AMNB__ACTION_KEY)), \
+				"Commands of " #name " must be unique and sorted in ascending order")
+#endif	// __DOXYGEN__
+
 
 
 #ifdef __DOXYGEN__
@@ -534,6 +607,27 @@ namespace xpcc
 			reinterpret_cast<xpcc::amnb::Listener::Callback>(&function) }
 #endif	// __DOXYGEN__
 
+#ifdef __DOXYGEN__
+	/**
+	 * \brief	Define a sorted list of amnb::Listener
+	 * 
+	 * Same as AMNB__ACTION_TABLE(). The entries must be sorted by address
+	 * and then by command.
+	 * 
+	 * \see		AMNB__LISTEN()
+	 * \ingroup	amnb
+	 */
+	#define	AMNB__LISTEN_TABLE(name, list)
+#else
+	#define	AMNB__LISTEN_KEY(address, command, object, function)	\
+		(((address) << 8) | (command))
+	
+	#define	AMNB__LISTEN_TABLE(name, list)	\
+		FLASH_STORAGE(xpcc::amnb::Listener name[]) = { list(AMNB__LISTEN) }; \
+		static_assert(xpcc::isStrictlyAscending(list(AMNB__LISTEN_KEY)), \
+				"Entries of " #name " must be unique and sorted by address and command")
+#endif	// __DOXYGEN__
+
 
 #ifdef __DOXYGEN__
 	/**
@@ -581,6 +675,24 @@ namespace xpcc
 			reinterpret_cast<xpcc::amnb::ErrorHandler::Callback>(&function) }
 #endif	// __DOXYGEN__
 
+#ifdef __DOXYGEN__
+	/**
+	 * \brief	Define a sorted list of amnb::ErrorHandler
+	 * 
+	 * Same as AMNB__ACTION_TABLE(). The entries must be sorted by address
+	 * and then by command.
+	 * 
+	 * \see		AMNB__ERROR()
+	 * \ingroup	amnb
+	 */
+	#define	AMNB__ERROR_TABLE(name, list)
+#else
+	#define	AMNB__ERROR_TABLE(name, list)	\
+		FLASH_STORAGE(xpcc::amnb::ErrorHandler name[]) = { list(AMNB__ERROR) }; \
+		static_assert(xpcc::isStrictlyAscending(list(AMNB__LISTEN_KEY)), \
+				"Entries of " #name " must be unique and sorted by address and command")
+#endif	// __DOXYGEN__
+
 #include "node_impl.hpp"
 
 #endif	// XPCC_AMNB__NODE_HPP
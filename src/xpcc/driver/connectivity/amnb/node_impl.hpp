@@ -113,6 +113,9 @@ ownAddress(address),
 actionList(actionList), actionCount(actionCount),
 listenList(listenList), listenCount(listenCount),
 errorHandlerList(errorHandlerList), errorHandlerCount(errorHandlerCount),
+actionListSorted(isSorted(actionList, actionCount)),
+listenListSorted(isSorted(listenList, listenCount)),
+errorHandlerListSorted(isSorted(errorHandlerList, errorHandlerCount)),
 response(this)
 {
 	Interface::initialize(address);
@@ -129,6 +132,9 @@ ownAddress(address),
 actionList(actionList), actionCount(actionCount),
 listenList(listenList), listenCount(listenCount),
 errorHandlerCount(0),
+actionListSorted(isSorted(actionList, actionCount)),
+listenListSorted(isSorted(listenList, listenCount)),
+errorHandlerListSorted(false),
 response(this)
 {
 	Interface::initialize(address);
@@ -143,6 +149,9 @@ ownAddress(address),
 actionList(actionList), actionCount(actionCount),
 listenCount(0),
 errorHandlerCount(0),
+actionListSorted(isSorted(actionList, actionCount)),
+listenListSorted(false),
+errorHandlerListSorted(false),
 response(this)
 {
 	Interface::initialize(address);
@@ -397,27 +406,23 @@ xpcc::amnb::Node<Interface>::update()
 					this->response.triggered = false;
 					this->currentCommand = messageCommand;
 					
-					xpcc::accessor::Flash<Action> list = actionList;
-					for (uint8_t i = 0; i < actionCount; ++i, ++list)
+					Action action;
+					if (find(actionList, actionCount, actionListSorted,
+							 messageCommand, action))
 					{
-						Action action(*list);
-						if (this->currentCommand == action.command)
+						if (Interface::getPayloadLength() == action.payloadLength)
 						{
-							if (Interface::getPayloadLength() == action.payloadLength)
-							{
-								// execute callback function
-								action.call(this->response, Interface::getPayload());
-								
-								if (!this->response.triggered) {
-									this->response.error(ERROR__ACTION_NO_RESPONSE);
-									checkErrorHandlers(messageAddress, messageCommand, NACK, ERROR__ACTION_NO_RESPONSE);
-								}
+							// execute callback function
+							action.call(this->response, Interface::getPayload());
+							
+							if (!this->response.triggered) {
+								this->response.error(ERROR__ACTION_NO_RESPONSE);
+								checkErrorHandlers(messageAddress, messageCommand, NACK, ERROR__ACTION_NO_RESPONSE);
 							}
-							else {
-								this->response.error(ERROR__ACTION_WRONG_PAYLOAD_LENGTH);
-								checkErrorHandlers(messageAddress, messageCommand, NACK, ERROR__ACTION_WRONG_PAYLOAD_LENGTH);
-							}
-							break;
+						}
+						else {
+							this->response.error(ERROR__ACTION_WRONG_PAYLOAD_LENGTH);
+							checkErrorHandlers(messageAddress, messageCommand, NACK, ERROR__ACTION_WRONG_PAYLOAD_LENGTH);
 						}
 					}
 				}
@@ -436,16 +441,12 @@ xpcc::amnb::Node<Interface>::update()
 		
 		if (checkListeners && (listenCount > 0))
 		{	// check if we want to listen to it
-			xpcc::accessor::Flash<Listener> list = listenList;
-			for (uint8_t i = 0; i < listenCount; ++i, ++list)
+			Listener listen;
+			if (find(listenList, listenCount, listenListSorted,
+					 (messageAddress << 8) | messageCommand, listen))
 			{
-				Listener listen(*list);
-				if ((messageAddress == listen.address) && (messageCommand == listen.command))
-				{
-					// execute callback function
-					listen.call(Interface::getPayload(), Interface::getPayloadLength(), messageAddress);
-					break;
-				}
+				// execute callback function
+				listen.call(Interface::getPayload(), Interface::getPayloadLength(), messageAddress);
 			}
 		}
 		// finished with the message, drop it.
@@ -466,20 +467,95 @@ xpcc::amnb::Node<Interface>::checkErrorHandlers(uint8_t address, uint8_t command
 {
 	if (errorHandlerCount == 0) return false;
 	
-	xpcc::accessor::Flash<ErrorHandler> list = errorHandlerList;
-	for (uint8_t i = 0; i < errorHandlerCount; ++i, ++list)
+	ErrorHandler errorHandler;
+	if (find(errorHandlerList, errorHandlerCount, errorHandlerListSorted,
+			 (address << 8) | command, errorHandler))
+	{
+		// execute callback function
+		errorHandler.call(type, errorCode);
+		return true;
+	}
+	return false;
+}
+
+// ----------------------------------------------------------------------------
+template <typename Interface> template <typename T>
+bool
+xpcc::amnb::Node<Interface>::find(xpcc::accessor::Flash<T> list, uint8_t count,
+								  bool sorted, uint16_t key, T& entry)
+{
+	if (sorted)
+	{
+		uint_fast8_t low = 0;
+		uint_fast8_t high = count;
+		while (low < high)
+		{
+			uint_fast8_t middle = (low + high) / 2;
+			uint16_t current = getKey(list, middle);
+			if (current < key) {
+				low = middle + 1;
+			}
+			else if (current > key) {
+				high = middle;
+			}
+			else {
+				entry = list[middle];
+				return true;
+			}
+		}
+	}
+	else
 	{
-		ErrorHandler errorHandler(*list);
-		if ((address == errorHandler.address) && (command == errorHandler.command))
+		for (uint_fast8_t i = 0; i < count; ++i)
 		{
-			// execute callback function
-			errorHandler.call(type, errorCode);
-			return true;
+			if (getKey(list, i) == key) {
+				entry = list[i];
+				return true;
+			}
 		}
 	}
 	return false;
 }
 
+template <typename Interface> template <typename T>
+bool
+xpcc::amnb::Node<Interface>::isSorted(xpcc::accessor::Flash<T> list, uint8_t count)
+{
+	for (uint_fast8_t i = 1; i < count; ++i)
+	{
+		if (getKey(list, i - 1) >= getKey(list, i)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+template <typename Interface>
+uint16_t
+xpcc::amnb::Node<Interface>::getKey(xpcc::accessor::Flash<Action> list, uint8_t index)
+{
+	// read only the key from flash, not the whole entry
+	return xpcc::accessor::asFlash(&list.getPointer()[index].command)[0];
+}
+
+template <typename Interface>
+uint16_t
+xpcc::amnb::Node<Interface>::getKey(xpcc::accessor::Flash<Listener> list, uint8_t index)
+{
+	const Listener *entry = &list.getPointer()[index];
+	return (xpcc::accessor::asFlash(&entry->address)[0] << 8) |
+			xpcc::accessor::asFlash(&entry->command)[0];
+}
+
+template <typename Interface>
+uint16_t
+xpcc::amnb::Node<Interface>::getKey(xpcc::accessor::Flash<ErrorHandler> list, uint8_t index)
+{
+	const ErrorHandler *entry = &list.getPointer()[index];
+	return (xpcc::accessor::asFlash(&entry->address)[0] << 8) |
+			xpcc::accessor::asFlash(&entry->command)[0];
+}
+
 // ----------------------------------------------------------------------------
 template <typename Interface>
 void
@@ -0,0 +1,158 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <cstring>
+
+#include "fake_interface.hpp"
+
+uint8_t FakeInterface::messagesSent;
+uint8_t FakeInterface::sentAddress;
+xpcc::amnb::Flags FakeInterface::sentFlags;
+uint8_t FakeInterface::sentCommand;
+uint8_t FakeInterface::sentPayload[xpcc::amnb::maxPayloadLength];
+uint8_t FakeInterface::sentPayloadLength;
+
+bool FakeInterface::messageAvailable;
+uint8_t FakeInterface::receivedAddress;
+xpcc::amnb::Flags FakeInterface::receivedFlags;
+uint8_t FakeInterface::receivedCommand;
+uint8_t FakeInterface::receivedPayload[xpcc::amnb::maxPayloadLength];
+uint8_t FakeInterface::receivedPayloadLength;
+
+// ----------------------------------------------------------------------------
+bool
+FakeInterface::sendMessage(uint8_t address, xpcc::amnb::Flags flags,
+		uint8_t command, const void *payload, uint8_t payloadLength)
+{
+	messagesSent++;
+	sentAddress = address;
+	sentFlags = flags;
+	sentCommand = command;
+	sentPayloadLength = payloadLength;
+	if (payloadLength > 0) {
+		std::memcpy(sentPayload, payload, payloadLength);
+	}
+	return true;
+}
+
+bool
+FakeInterface::isMessageAvailable()
+{
+	return messageAvailable;
+}
+
+uint8_t
+FakeInterface::getTransmittedAddress()
+{
+	return sentAddress;
+}
+
+uint8_t
+FakeInterface::getTransmittedCommand()
+{
+	return sentCommand;
+}
+
+xpcc::amnb::Flags
+FakeInterface::getTransmittedFlags()
+{
+	return sentFlags;
+}
+
+uint8_t
+FakeInterface::getAddress()
+{
+	return receivedAddress;
+}
+
+uint8_t
+FakeInterface::getCommand()
+{
+	return receivedCommand;
+}
+
+bool
+FakeInterface::isResponse()
+{
+	return (receivedFlags & 0x80);
+}
+
+bool
+FakeInterface::isAcknowledge()
+{
+	return (receivedFlags & 0x40);
+}
+
+bool
+FakeInterface::messageTransmitted()
+{
+	return true;
+}
+
+const uint8_t *
+FakeInterface::getPayload()
+{
+	return receivedPayload;
+}
+
+uint8_t
+FakeInterface::getPayloadLength()
+{
+	return receivedPayloadLength;
+}
+
+void
+FakeInterface::dropMessage()
+{
+	messageAvailable = false;
+}
+
+// ----------------------------------------------------------------------------
+void
+FakeInterface::reset()
+{
+	messagesSent = 0;
+	sentPayloadLength = 0;
+	messageAvailable = false;
+}
+
+void
+FakeInterface::receive(uint8_t address, xpcc::amnb::Flags flags,
+		uint8_t command, const void *payload, uint8_t payloadLength)
+{
+	messageAvailable = true;
+	receivedAddress = address;
+	receivedFlags = flags;
+	receivedCommand = command;
+	receivedPayloadLength = payloadLength;
+	if (payloadLength > 0) {
+		std::memcpy(receivedPayload, payload, payloadLength);
+	}
+}
@@ -0,0 +1,126 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef FAKE_INTERFACE_HPP
+#define FAKE_INTERFACE_HPP
+
+#include <stdint.h>
+#include "../constants.hpp"
+
+/**
+ * Replaces xpcc::amnb::Interface. Received messages are set with
+ * receive(), the last message sent by the node is stored.
+ */
+class FakeInterface
+{
+public:
+	static void
+	initialize(int)
+	{
+	}
+	
+	static void
+	update()
+	{
+	}
+	
+	static bool
+	sendMessage(uint8_t address, xpcc::amnb::Flags flags, uint8_t command,
+			const void *payload, uint8_t payloadLength);
+	
+	template <typename T>
+	static bool
+	sendMessage(uint8_t address, xpcc::amnb::Flags flags, uint8_t command,
+			const T& payload)
+	{
+		return sendMessage(address, flags, command, &payload, sizeof(T));
+	}
+	
+	static bool
+	isMessageAvailable();
+	
+	static uint8_t
+	getTransmittedAddress();
+	
+	static uint8_t
+	getTransmittedCommand();
+	
+	static xpcc::amnb::Flags
+	getTransmittedFlags();
+	
+	static uint8_t
+	getAddress();
+	
+	static uint8_t
+	getCommand();
+	
+	static bool
+	isResponse();
+	
+	static bool
+	isAcknowledge();
+	
+	static bool
+	messageTransmitted();
+	
+	static const uint8_t *
+	getPayload();
+	
+	static uint8_t
+	getPayloadLength();
+	
+	static void
+	dropMessage();
+	
+	
+	static void
+	reset();
+	
+	static void
+	receive(uint8_t address, xpcc::amnb::Flags flags, uint8_t command,
+			const void *payload = 0, uint8_t payloadLength = 0);
+	
+	static uint8_t messagesSent;
+	static uint8_t sentAddress;
+	static xpcc::amnb::Flags sentFlags;
+	static uint8_t sentCommand;
+	static uint8_t sentPayload[xpcc::amnb::maxPayloadLength];
+	static uint8_t sentPayloadLength;
+	
+private:
+	static bool messageAvailable;
+	static uint8_t receivedAddress;
+	static xpcc::amnb::Flags receivedFlags;
+	static uint8_t receivedCommand;
+	static uint8_t receivedPayload[xpcc::amnb::maxPayloadLength];
+	static uint8_t receivedPayloadLength;
+};
+
+#endif	// FAKE_INTERFACE_HPP
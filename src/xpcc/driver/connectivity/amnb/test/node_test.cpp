@@ -0,0 +1,446 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include "../node.hpp"
+#include "fake_interface.hpp"
+
+#include "node_test.hpp"
+
+namespace
+{
+	typedef xpcc::amnb::Node< FakeInterface > TestingNode;
+	
+	// gives access to the lookup functions of the node
+	class Lookup : public TestingNode
+	{
+	public:
+		using TestingNode::find;
+		using TestingNode::isSorted;
+	};
+	
+	class TestingObject : public xpcc::amnb::Callable
+	{
+	public:
+		TestingObject() :
+			calledFunction(NONE), receivedParameter(0), sender(0),
+			errorType(xpcc::amnb::BROADCAST), errorCode(0)
+		{
+		}
+		
+		void
+		reset()
+		{
+			calledFunction = NONE;
+			receivedParameter = 0;
+			sender = 0;
+			errorCode = 0;
+		}
+		
+		
+		void
+		firstAction(xpcc::amnb::Response& response)
+		{
+			calledFunction = FIRST;
+			response.send();
+		}
+		
+		void
+		secondAction(xpcc::amnb::Response& response)
+		{
+			calledFunction = SECOND;
+			response.send();
+		}
+		
+		void
+		parameterAction(xpcc::amnb::Response& response, const uint16_t* parameter)
+		{
+			calledFunction = PARAMETER;
+			receivedParameter = *parameter;
+			response.send();
+		}
+		
+		void
+		firstListener(const void *, const uint8_t, const uint8_t sender)
+		{
+			calledFunction = FIRST;
+			this->sender = sender;
+		}
+		
+		void
+		secondListener(const void *, const uint8_t, const uint8_t sender)
+		{
+			calledFunction = SECOND;
+			this->sender = sender;
+		}
+		
+		void
+		errorHandler(xpcc::amnb::Flags type, const uint8_t errorCode)
+		{
+			calledFunction = ERROR;
+			this->errorType = type;
+			this->errorCode = errorCode;
+		}
+		
+		enum FunctionCode
+		{
+			NONE,
+			FIRST,
+			SECOND,
+			PARAMETER,
+			ERROR,
+		};
+		
+		FunctionCode calledFunction;
+		uint16_t receivedParameter;
+		uint8_t sender;
+		xpcc::amnb::Flags errorType;
+		uint8_t errorCode;
+	};
+	
+	TestingObject testingObject;
+	
+	const uint8_t ownAddress = 0x12;
+	
+	// ------------------------------------------------------------------------
+	#define	SORTED_ACTIONS(ACTION) \
+		ACTION(0x01, testingObject, TestingObject::firstAction, 0), \
+		ACTION(0x20, testingObject, TestingObject::parameterAction, 2), \
+		ACTION(0x21, testingObject, TestingObject::secondAction, 0), \
+		ACTION(0x80, testingObject, TestingObject::firstAction, 0), \
+		ACTION(0xfe, testingObject, TestingObject::secondAction, 0)
+	
+	AMNB__ACTION_TABLE(sortedActionList, SORTED_ACTIONS);
+	
+	FLASH_STORAGE(xpcc::amnb::Action unsortedActionList[]) =
+	{
+		AMNB__ACTION(0xfe, testingObject, TestingObject::secondAction, 0),
+		AMNB__ACTION(0x20, testingObject, TestingObject::parameterAction, 2),
+		AMNB__ACTION(0x80, testingObject, TestingObject::firstAction, 0),
+		AMNB__ACTION(0x01, testingObject, TestingObject::firstAction, 0),
+		AMNB__ACTION(0x21, testingObject, TestingObject::secondAction, 0),
+	};
+	
+	// same command twice, must not be taken as sorted
+	FLASH_STORAGE(xpcc::amnb::Action duplicateActionList[]) =
+	{
+		AMNB__ACTION(0x01, testingObject, TestingObject::firstAction, 0),
+		AMNB__ACTION(0x20, testingObject, TestingObject::firstAction, 0),
+		AMNB__ACTION(0x20, testingObject, TestingObject::secondAction, 0),
+	};
+	
+	// ------------------------------------------------------------------------
+	// listeners are sorted by address first, then by command
+	#define	SORTED_LISTENERS(LISTEN) \
+		LISTEN(0x03, 0x40, testingObject, TestingObject::firstListener), \
+		LISTEN(0x03, 0x41, testingObject, TestingObject::secondListener), \
+		LISTEN(0x10, 0x05, testingObject, TestingObject::secondListener), \
+		LISTEN(0x7f, 0x40, testingObject, TestingObject::firstListener)
+	
+	AMNB__LISTEN_TABLE(sortedListenList, SORTED_LISTENERS);
+	
+	FLASH_STORAGE(xpcc::amnb::Listener unsortedListenList[]) =
+	{
+		AMNB__LISTEN(0x10, 0x05, testingObject, TestingObject::secondListener),
+		AMNB__LISTEN(0x03, 0x41, testingObject, TestingObject::secondListener),
+		AMNB__LISTEN(0x7f, 0x40, testingObject, TestingObject::firstListener),
+		AMNB__LISTEN(0x03, 0x40, testingObject, TestingObject::firstListener),
+	};
+	
+	// ------------------------------------------------------------------------
+	#define	SORTED_ERROR_HANDLERS(ERROR) \
+		ERROR(ownAddress, 0x20, testingObject, TestingObject::errorHandler), \
+		ERROR(0x30, 0x01, testingObject, TestingObject::errorHandler)
+	
+	AMNB__ERROR_TABLE(sortedErrorHandlerList, SORTED_ERROR_HANDLERS);
+	
+	template <typename T, std::size_t N>
+	inline uint8_t
+	count(const T (&)[N])
+	{
+		return N;
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+NodeTest::setUp()
+{
+	FakeInterface::reset();
+	testingObject.reset();
+}
+
+// ----------------------------------------------------------------------------
+void
+NodeTest::testIsSorted()
+{
+	TEST_ASSERT_TRUE(Lookup::isSorted(
+			xpcc::accessor::asFlash(sortedActionList), count(sortedActionList)));
+	TEST_ASSERT_FALSE(Lookup::isSorted(
+			xpcc::accessor::asFlash(unsortedActionList), count(unsortedActionList)));
+	TEST_ASSERT_FALSE(Lookup::isSorted(
+			xpcc::accessor::asFlash(duplicateActionList), count(duplicateActionList)));
+	
+	TEST_ASSERT_TRUE(Lookup::isSorted(
+			xpcc::accessor::asFlash(sortedListenList), count(sortedListenList)));
+	TEST_ASSERT_FALSE(Lookup::isSorted(
+			xpcc::accessor::asFlash(unsortedListenList), count(unsortedListenList)));
+	
+	TEST_ASSERT_TRUE(Lookup::isSorted(
+			xpcc::accessor::asFlash(sortedErrorHandlerList), count(sortedErrorHandlerList)));
+	
+	// empty lists and lists with one entry are always sorted
+	TEST_ASSERT_TRUE(Lookup::isSorted(xpcc::accessor::asFlash(sortedActionList), 0));
+	TEST_ASSERT_TRUE(Lookup::isSorted(xpcc::accessor::asFlash(unsortedActionList), 1));
+}
+
+void
+NodeTest::testFind()
+{
+	for (uint_fast16_t command = 0; command < 256; ++command)
+	{
+		xpcc::amnb::Action sorted;
+		xpcc::amnb::Action unsorted;
+		
+		bool foundSorted = Lookup::find(xpcc::accessor::asFlash(sortedActionList),
+				count(sortedActionList), true, command, sorted);
+		bool foundUnsorted = Lookup::find(xpcc::accessor::asFlash(unsortedActionList),
+				count(unsortedActionList), false, command, unsorted);
+		
+		TEST_ASSERT_EQUALS(foundSorted, foundUnsorted);
+		if (foundSorted && foundUnsorted) {
+			TEST_ASSERT_EQUALS(sorted.command, command);
+			TEST_ASSERT_EQUALS(unsorted.command, command);
+			TEST_ASSERT_EQUALS(sorted.payloadLength, unsorted.payloadLength);
+			TEST_ASSERT_TRUE(sorted.function == unsorted.function);
+		}
+	}
+	
+	// listener keys consist of the address and the command
+	const uint16_t keys[] = { 0x0340, 0x0341, 0x1005, 0x7f40 };
+	const uint16_t missing[] = { 0x0000, 0x0342, 0x4003, 0x0510, 0x7f41, 0xffff };
+	
+	xpcc::amnb::Listener listener;
+	for (uint_fast8_t i = 0; i < sizeof(keys) / sizeof(keys[0]); ++i)
+	{
+		TEST_ASSERT_TRUE(Lookup::find(xpcc::accessor::asFlash(sortedListenList),
+				count(sortedListenList), true, keys[i], listener));
+		TEST_ASSERT_EQUALS(listener.address, keys[i] >> 8);
+		TEST_ASSERT_EQUALS(listener.command, keys[i] & 0xff);
+		
+		TEST_ASSERT_TRUE(Lookup::find(xpcc::accessor::asFlash(unsortedListenList),
+				count(unsortedListenList), false, keys[i], listener));
+		TEST_ASSERT_EQUALS(listener.address, keys[i] >> 8);
+		TEST_ASSERT_EQUALS(listener.command, keys[i] & 0xff);
+	}
+	
+	for (uint_fast8_t i = 0; i < sizeof(missing) / sizeof(missing[0]); ++i)
+	{
+		TEST_ASSERT_FALSE(Lookup::find(xpcc::accessor::asFlash(sortedListenList),
+				count(sortedListenList), true, missing[i], listener));
+		TEST_ASSERT_FALSE(Lookup::find(xpcc::accessor::asFlash(unsortedListenList),
+				count(unsortedListenList), false, missing[i], listener));
+	}
+}
+
+// ----------------------------------------------------------------------------
+static void
+checkActions(TestingNode& node)
+{
+	const uint8_t commands[] = { 0x01, 0x21, 0x80, 0xfe };
+	const TestingObject::FunctionCode functions[] = {
+		TestingObject::FIRST, TestingObject::SECOND,
+		TestingObject::FIRST, TestingObject::SECOND };
+	
+	for (uint_fast8_t i = 0; i < sizeof(commands) / sizeof(commands[0]); ++i)
+	{
+		testingObject.reset();
+		FakeInterface::reset();
+		
+		FakeInterface::receive(ownAddress, xpcc::amnb::REQUEST, commands[i]);
+		node.update();
+		
+		TEST_ASSERT_EQUALS(testingObject.calledFunction, functions[i]);
+		TEST_ASSERT_EQUALS(FakeInterface::messagesSent, 1U);
+		TEST_ASSERT_EQUALS(FakeInterface::sentFlags, xpcc::amnb::ACK);
+		TEST_ASSERT_EQUALS(FakeInterface::sentCommand, commands[i]);
+		TEST_ASSERT_FALSE(FakeInterface::isMessageAvailable());
+	}
+	
+	testingObject.reset();
+	FakeInterface::reset();
+	
+	uint16_t parameter = 0xabcd;
+	FakeInterface::receive(ownAddress, xpcc::amnb::REQUEST, 0x20, &parameter, 2);
+	node.update();
+	
+	TEST_ASSERT_EQUALS(testingObject.calledFunction, TestingObject::PARAMETER);
+	TEST_ASSERT_EQUALS(testingObject.receivedParameter, 0xabcd);
+	TEST_ASSERT_EQUALS(FakeInterface::sentFlags, xpcc::amnb::ACK);
+	
+	// commands before, between and after the entries of the list
+	const uint8_t missing[] = { 0x00, 0x02, 0x1f, 0x22, 0x7f, 0x81, 0xfd, 0xff };
+	for (uint_fast8_t i = 0; i < sizeof(missing) / sizeof(missing[0]); ++i)
+	{
+		testingObject.reset();
+		FakeInterface::reset();
+		
+		FakeInterface::receive(ownAddress, xpcc::amnb::REQUEST, missing[i]);
+		node.update();
+		
+		TEST_ASSERT_EQUALS(testingObject.calledFunction, TestingObject::NONE);
+		TEST_ASSERT_EQUALS(FakeInterface::messagesSent, 1U);
+		TEST_ASSERT_EQUALS(FakeInterface::sentFlags, xpcc::amnb::NACK);
+		TEST_ASSERT_EQUALS(FakeInterface::sentCommand, missing[i]);
+		TEST_ASSERT_EQUALS(FakeInterface::sentPayloadLength, 1U);
+		TEST_ASSERT_EQUALS(FakeInterface::sentPayload[0], xpcc::amnb::ERROR__ACTION_NO_ACTION);
+	}
+}
+
+void
+NodeTest::testSortedActions()
+{
+	TestingNode node(ownAddress,
+			xpcc::accessor::asFlash(sortedActionList), count(sortedActionList));
+	
+	checkActions(node);
+}
+
+void
+NodeTest::testUnsortedActions()
+{
+	TestingNode node(ownAddress,
+			xpcc::accessor::asFlash(unsortedActionList), count(unsortedActionList));
+	
+	checkActions(node);
+}
+
+void
+NodeTest::testWrongPayloadLength()
+{
+	TestingNode node(ownAddress,
+			xpcc::accessor::asFlash(sortedActionList), count(sortedActionList));
+	
+	uint32_t parameter = 0x12345678;
+	FakeInterface::receive(ownAddress, xpcc::amnb::REQUEST, 0x20, &parameter, 4);
+	node.update();
+	
+	TEST_ASSERT_EQUALS(testingObject.calledFunction, TestingObject::NONE);
+	TEST_ASSERT_EQUALS(FakeInterface::sentFlags, xpcc::amnb::NACK);
+	TEST_ASSERT_EQUALS(FakeInterface::sentPayload[0], xpcc::amnb::ERROR__ACTION_WRONG_PAYLOAD_LENGTH);
+}
+
+// ----------------------------------------------------------------------------
+static void
+checkListeners(TestingNode& node)
+{
+	const uint8_t addresses[] = { 0x03, 0x03, 0x10, 0x7f };
+	const uint8_t commands[] = { 0x40, 0x41, 0x05, 0x40 };
+	const TestingObject::FunctionCode functions[] = {
+		TestingObject::FIRST, TestingObject::SECOND,
+		TestingObject::SECOND, TestingObject::FIRST };
+	
+	for (uint_fast8_t i = 0; i < sizeof(commands) / sizeof(commands[0]); ++i)
+	{
+		testingObject.reset();
+		
+		FakeInterface::receive(addresses[i], xpcc::amnb::BROADCAST, commands[i]);
+		node.update();
+		
+		TEST_ASSERT_EQUALS(testingObject.calledFunction, functions[i]);
+		TEST_ASSERT_EQUALS(testingObject.sender, addresses[i]);
+	}
+	
+	// known commands from other addresses and unknown commands
+	const uint8_t otherAddresses[] = { 0x02, 0x04, 0x03, 0x10, 0x40 };
+	const uint8_t otherCommands[] = { 0x40, 0x41, 0x05, 0x40, 0x03 };
+	for (uint_fast8_t i = 0; i < sizeof(otherCommands) / sizeof(otherCommands[0]); ++i)
+	{
+		testingObject.reset();
+		
+		FakeInterface::receive(otherAddresses[i], xpcc::amnb::BROADCAST, otherCommands[i]);
+		node.update();
+		
+		TEST_ASSERT_EQUALS(testingObject.calledFunction, TestingObject::NONE);
+	}
+	
+	// responses to queries of other nodes are passed to the listeners too
+	testingObject.reset();
+	FakeInterface::receive(0x10, xpcc::amnb::ACK, 0x05);
+	node.update();
+	
+	TEST_ASSERT_EQUALS(testingObject.calledFunction, TestingObject::SECOND);
+	TEST_ASSERT_EQUALS(testingObject.sender, 0x10);
+}
+
+void
+NodeTest::testSortedListeners()
+{
+	TestingNode node(ownAddress,
+			xpcc::accessor::asFlash(sortedActionList), count(sortedActionList),
+			xpcc::accessor::asFlash(sortedListenList), count(sortedListenList));
+	
+	checkListeners(node);
+}
+
+void
+NodeTest::testUnsortedListeners()
+{
+	TestingNode node(ownAddress,
+			xpcc::accessor::asFlash(sortedActionList), count(sortedActionList),
+			xpcc::accessor::asFlash(unsortedListenList), count(unsortedListenList));
+	
+	checkListeners(node);
+}
+
+// ----------------------------------------------------------------------------
+void
+NodeTest::testErrorHandlers()
+{
+	TestingNode node(ownAddress,
+			xpcc::accessor::asFlash(sortedActionList), count(sortedActionList),
+			xpcc::accessor::asFlash(sortedListenList), count(sortedListenList),
+			xpcc::accessor::asFlash(sortedErrorHandlerList), count(sortedErrorHandlerList));
+	
+	// wrong payload length for the action 0x20 of this node
+	uint8_t parameter = 0;
+	FakeInterface::receive(ownAddress, xpcc::amnb::REQUEST, 0x20, &parameter, 1);
+	node.update();
+	
+	TEST_ASSERT_EQUALS(testingObject.calledFunction, TestingObject::ERROR);
+	TEST_ASSERT_EQUALS(testingObject.errorType, xpcc::amnb::NACK);
+	TEST_ASSERT_EQUALS(testingObject.errorCode, xpcc::amnb::ERROR__ACTION_WRONG_PAYLOAD_LENGTH);
+	
+	// no handler for this command
+	testingObject.reset();
+	FakeInterface::receive(ownAddress, xpcc::amnb::REQUEST, 0x21, &parameter, 1);
+	node.update();
+	
+	TEST_ASSERT_EQUALS(testingObject.calledFunction, TestingObject::NONE);
+}
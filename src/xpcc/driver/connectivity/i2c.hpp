@@ -52,3 +52,5 @@
  */
 
 #include "i2c/software_i2c.hpp"
+#include "i2c/transaction_queue.hpp"
+#include "i2c/sampler.hpp"
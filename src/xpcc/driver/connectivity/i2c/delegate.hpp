@@ -150,7 +150,11 @@ namespace xpcc
 			writing() = 0;
 
 			/**
-			 * Is called just before (or just after) this delegate is detached from i2c.
+			 * Is called right after this delegate was detached from i2c.
+			 * 
+			 * After a \c NORMAL_STOP the stop condition was already
+			 * requested, so the next transaction may be started from
+			 * within this method.
 			 */
 			virtual void
 			stopped(DetachCause cause) = 0;
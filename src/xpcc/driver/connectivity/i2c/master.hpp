@@ -83,8 +83,8 @@ namespace xpcc
 			/**
 			 * \brief	Perform a software reset of the driver.
 			 *	
-			 * This method calls the stopped Delegate method and then detaches 
-			 * the delegate.
+			 * This method detaches the delegate and then calls its stopped
+			 * method.
 			 * \param error DetachCause \c ERROR_CONDITION if \c true, else \c SOFTWARE_RESET
 			 */
 			void
@@ -37,6 +37,7 @@ xpcc::i2c::MockMaster::SlaveDevice xpcc::i2c::MockMaster::slaveDevice = xpcc::i2
 xpcc::i2c::Delegate *xpcc::i2c::MockMaster::delegate;
 xpcc::i2c::MockMaster::ErrorState xpcc::i2c::MockMaster::error;
 xpcc::i2c::Delegate::NextOperation xpcc::i2c::MockMaster::nextOperation;
+xpcc::i2c::MockMaster::Slave *xpcc::i2c::MockMaster::slave = 0;
 
 void
 xpcc::i2c::MockMaster::initialize(SlaveDevice slaveDevice, Behavior behavior)
@@ -45,6 +46,20 @@ xpcc::i2c::MockMaster::initialize(SlaveDevice slaveDevice, Behavior behavior)
 	MockMaster::behavior = behavior;
 }
 
+void
+xpcc::i2c::MockMaster::attachSlave(Slave *slave)
+{
+	MockMaster::slave = slave;
+}
+
+void
+xpcc::i2c::MockMaster::reset(bool error)
+{
+	if (delegate) detach(
+			error ?	xpcc::i2c::Delegate::ERROR_CONDITION :
+					xpcc::i2c::Delegate::SOFTWARE_RESET);
+}
+
 uint8_t
 xpcc::i2c::MockMaster::getErrorState()
 {
@@ -75,32 +90,38 @@ void xpcc::i2c::MockMaster::update(){
 		switch (nextOperation)
 		{
 			case Delegate::STOP_OP:
-				delegate->stopped(Delegate::NORMAL_STOP);
-				delegate = 0;
+				if (slave) {
+					slave->stopped();
+				}
+				detach(Delegate::NORMAL_STOP);
 				break;
 				
 			case Delegate::RESTART_OP:
-				if (slaveDevice != DEVICE_MISSING){
-					nextOperation = delegate->started().next;
+			{
+				Delegate::Starting s = delegate->started();
+				if (slaveDevice != DEVICE_MISSING &&
+						(!slave || slave->selected(s.address >> 1))){
+					nextOperation = s.next;
 				}
 				else{
-					delegate->started();
 					error = ADDRESS_NACK;
-					delegate->stopped(Delegate::ERROR_CONDITION);
-					delegate = 0;
+					detach(Delegate::ERROR_CONDITION);
 				}
-				break;
+			}
+			break;
 				
 			case Delegate::READ_OP:
 				{
 					Delegate::Reading r = delegate->reading();
 					if (r.buffer && r.size){
+						if (slave) {
+							slave->read(r.buffer, r.size);
+						}
 						nextOperation = (Delegate::NextOperation)r.next;
 					}
 					else{
 						error = UNKNOWN_ERROR;
-						delegate->stopped(Delegate::ERROR_CONDITION);
-						delegate = 0;
+						detach(Delegate::ERROR_CONDITION);
 					}
 				}
 				break;
@@ -109,15 +130,25 @@ void xpcc::i2c::MockMaster::update(){
 			{
 				Delegate::Writing w = delegate->writing();
 				if (w.buffer && w.size){
+					if (slave) {
+						slave->write(w.buffer, w.size);
+					}
 					nextOperation = (Delegate::NextOperation)w.next;
 				}
 				else {
 					error = UNKNOWN_ERROR;
-					delegate->stopped(Delegate::ERROR_CONDITION);
-					delegate = 0;
+					detach(Delegate::ERROR_CONDITION);
 				}
 			}
 			break;
 		}
 	}
 }
+
+void
+xpcc::i2c::MockMaster::detach(Delegate::DetachCause cause)
+{
+	Delegate *stopping = delegate;
+	delegate = 0;
+	stopping->stopped(cause);
+}
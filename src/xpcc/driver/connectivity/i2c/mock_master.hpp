@@ -47,6 +47,35 @@ namespace xpcc
 		class MockMaster : public Master
 		{
 		public:
+			/**
+			 * \brief	Simulated slave device
+			 * 
+			 * If a slave is attached, the data of all transfers is passed
+			 * to it. Otherwise only the buffers of the delegate are checked.
+			 */
+			class Slave
+			{
+			public:
+				/**
+				 * \param	address		7-bit address
+				 * \return	\c false to not acknowledge the address
+				 */
+				virtual bool
+				selected(uint8_t address) = 0;
+				
+				virtual void
+				write(const uint8_t *data, std::size_t size) = 0;
+				
+				virtual void
+				read(uint8_t *data, std::size_t size) = 0;
+				
+				/// Stop condition on the bus
+				virtual void
+				stopped()
+				{
+				}
+			};
+			
 			enum ErrorState
 			{
 				NO_ERROR,			//!< No Error occurred
@@ -70,6 +99,10 @@ namespace xpcc
 
 			static void
 			initialize(SlaveDevice slaveDevice, Behavior behavior);
+			
+			/// Pass all transfers to \p slave, \c 0 to detach it
+			static void
+			attachSlave(Slave *slave);
 
 			static bool
 			start(Delegate *delegate);
@@ -80,6 +113,9 @@ namespace xpcc
 				return start(delegate);
 			}
 
+			static void
+			reset(bool error=false);
+			
 			static uint8_t
 			getErrorState();
 
@@ -87,11 +123,17 @@ namespace xpcc
 			update();
 			
 		private:
+			/// Detach the delegate first, so that it may start the next
+			/// transaction from its stopped() method
+			static void
+			detach(Delegate::DetachCause cause);
+			
 			static Behavior behavior;
 			static SlaveDevice slaveDevice;
 			static ErrorState error;
 			static Delegate *delegate;
 			static Delegate::NextOperation nextOperation;
+			static Slave *slave;
 		};
 	}
 }
@@ -0,0 +1,234 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_I2C__SAMPLER_HPP
+#define XPCC_I2C__SAMPLER_HPP
+
+#include <stdint.h>
+
+#include <xpcc/architecture/driver/clock.hpp>
+#include <xpcc/architecture/driver/atomic/queue.hpp>
+#include <xpcc/utils/template_metaprogramming.hpp>
+#include "delegate.hpp"
+
+namespace xpcc
+{
+	namespace i2c
+	{
+		/**
+		 * \brief	Periodic burst reads of the data registers of several
+		 * 			sensors on one bus
+		 * 
+		 * Every channel reads a contiguous range of registers of one
+		 * device with a single burst read (register address write,
+		 * repeated start, read) at a fixed period. All channels which are
+		 * due are read in one bus transaction, chained by repeated
+		 * starts.
+		 * 
+		 * The results are stored with the channel index and a timestamp
+		 * in an interrupt safe queue. The consumer (e.g. the sensor
+		 * fusion) takes all samples collected since its last run instead
+		 * of polling every driver.
+		 * 
+		 * The sensors have to be configured by their drivers first, the
+		 * sampler only reads the data registers. Ranges for common
+		 * sensors:
+		 * 
+		 * - ADXL345: REGISTER_DATA_X0 (0x32), 6 bytes: x, y, z (LSB first)
+		 * - ITG3200: REGISTER_DATA_T0 (0x1b), 8 bytes: temperature, x, y, z
+		 *   (MSB first)
+		 * - HMC5843: REGISTER_DATA_X0 (0x03), 6 bytes: x, y, z (MSB first)
+		 * - HMC5883L: REGISTER_DATA_X0 (0x03), 6 bytes: x, z, y (MSB first)
+		 * - BMA180: REGISTER_DATA_X0 (0x02), 7 bytes: x, y, z (LSB first),
+		 *   temperature
+		 * - TMP102: REGISTER_TEMPERATURE (0x00), 2 bytes (MSB first)
+		 * 
+		 * Sensors which need a conversion command before every
+		 * measurement (e.g. the BMP085) cannot be read this way.
+		 * 
+		 * \code
+		 * xpcc::i2c::Sampler<I2c, 3> sampler;
+		 * 
+		 * sampler.addChannel(0x53, 0x32, 6, 10);	// ADXL345 at 100 Hz
+		 * sampler.addChannel(0x68, 0x1b, 8, 10);	// ITG3200 at 100 Hz
+		 * sampler.addChannel(0x1e, 0x03, 6, 20);	// HMC5883L at 50 Hz
+		 * 
+		 * while (1)
+		 * {
+		 *     sampler.update();
+		 *     
+		 *     while (!sampler.getSamples().isEmpty())
+		 *     {
+		 *         const Sample& sample = sampler.getSamples().get();
+		 *         ...
+		 *         sampler.getSamples().pop();
+		 *     }
+		 * }
+		 * \endcode
+		 * 
+		 * \tparam	I2cMaster	I2C master or xpcc::i2c::TransactionQueue
+		 * \tparam	Channels	Maximum number of channels (up to 32)
+		 * \tparam	SampleSize	Maximum number of bytes per channel
+		 * \tparam	QueueSize	Number of samples the queue can hold
+		 * 
+		 * \ingroup	i2c
+		 */
+		template <typename I2cMaster, uint8_t Channels,
+				uint8_t SampleSize = 8, std::size_t QueueSize = 16>
+		class Sampler : public Delegate
+		{
+		public:
+			struct Sample
+			{
+				/// Time when the read of this sample was started
+				xpcc::Timestamp timestamp;
+				
+				/// Index returned by addChannel()
+				uint8_t channel;
+				
+				/// Register content starting with the first register
+				uint8_t data[SampleSize];
+			};
+			
+			typedef xpcc::atomic::Queue<Sample, QueueSize> SampleQueue;
+			
+		public:
+			Sampler();
+			
+			/**
+			 * \brief	Read a range of registers periodically
+			 * 
+			 * \param	address		7-bit device address
+			 * \param	reg			first register
+			 * \param	size		number of registers (at most SampleSize)
+			 * \param	period		in milliseconds
+			 * 
+			 * \return	index of the channel or -1 if the size is too big
+			 * 			or all channels are used
+			 */
+			int8_t
+			addChannel(uint8_t address, uint8_t reg, uint8_t size,
+					uint16_t period);
+			
+			/// Start the reads of all channels which are due
+			void
+			update();
+			
+			/// Samples in the order they were read
+			ALWAYS_INLINE SampleQueue&
+			getSamples()
+			{
+				return samples;
+			}
+			
+			/// Samples lost because the queue was full
+			ALWAYS_INLINE uint16_t
+			getDroppedSamples() const
+			{
+				return dropped;
+			}
+			
+			/// Reads stopped by a bus error, the channel is read again
+			/// with the next update()
+			ALWAYS_INLINE uint16_t
+			getErrors() const
+			{
+				return errors;
+			}
+			
+		public:
+			// Delegate interface
+			virtual bool
+			attaching();
+			
+			virtual Starting
+			started();
+			
+			virtual Reading
+			reading();
+			
+			virtual Writing
+			writing();
+			
+			virtual void
+			stopped(DetachCause cause);
+			
+		private:
+			struct Channel
+			{
+				uint8_t address;
+				uint8_t reg;
+				uint8_t size;
+				uint16_t period;
+				xpcc::Timestamp next;
+			};
+			
+			typedef typename xpcc::tmp::Select< (Channels > 16), uint32_t,
+					typename xpcc::tmp::Select< (Channels > 8), uint16_t,
+							uint8_t >::Result >::Result Mask;
+			
+			/// Next pending channel starting at index, Channels if none
+			uint8_t
+			findPending(uint8_t index) const;
+			
+			void
+			storeSample();
+			
+			Channel channels[Channels];
+			uint8_t channelCount;
+			
+			/// Channels which are due but not yet read
+			volatile Mask pending;
+			
+			/// Channel of the running transaction
+			uint8_t index;
+			
+			enum Phase
+			{
+				WRITE_REGISTER,
+				READ_DATA,
+				READ_DONE,
+			};
+			
+			Phase phase;
+			volatile bool running;
+			
+			Sample sample;
+			SampleQueue samples;
+			
+			uint16_t dropped;
+			uint16_t errors;
+		};
+	}
+}
+
+#include "sampler_impl.hpp"
+
+#endif // XPCC_I2C__SAMPLER_HPP
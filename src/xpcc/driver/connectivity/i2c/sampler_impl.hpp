@@ -0,0 +1,202 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_I2C__SAMPLER_HPP
+#	error	"Don't include this file directly, use 'sampler.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename I2cMaster, uint8_t Channels, uint8_t SampleSize, std::size_t QueueSize>
+xpcc::i2c::Sampler<I2cMaster, Channels, SampleSize, QueueSize>::Sampler() :
+	channelCount(0), pending(0), index(0), phase(WRITE_REGISTER),
+	running(false), dropped(0), errors(0)
+{
+	XPCC__STATIC_ASSERT(Channels <= 32, "A maximum of 32 channels is allowed!");
+}
+
+template <typename I2cMaster, uint8_t Channels, uint8_t SampleSize, std::size_t QueueSize>
+int8_t
+xpcc::i2c::Sampler<I2cMaster, Channels, SampleSize, QueueSize>::addChannel(
+		uint8_t address, uint8_t reg, uint8_t size, uint16_t period)
+{
+	if (channelCount >= Channels || size == 0 || size > SampleSize) {
+		return -1;
+	}
+	
+	Channel& channel = channels[channelCount];
+	channel.address = address;
+	channel.reg = reg;
+	channel.size = size;
+	channel.period = period;
+	channel.next = xpcc::Clock::now();
+	
+	return channelCount++;
+}
+
+template <typename I2cMaster, uint8_t Channels, uint8_t SampleSize, std::size_t QueueSize>
+void
+xpcc::i2c::Sampler<I2cMaster, Channels, SampleSize, QueueSize>::update()
+{
+	if (running) {
+		return;
+	}
+	
+	xpcc::Timestamp now = xpcc::Clock::now();
+	Mask due = pending;
+	for (uint8_t i = 0; i < channelCount; ++i)
+	{
+		Channel& channel = channels[i];
+		if (now >= channel.next)
+		{
+			due |= static_cast<Mask>(1) << i;
+			channel.next = channel.next + channel.period;
+			if (channel.next <= now) {
+				// too late, skip the missed samples
+				channel.next = now + channel.period;
+			}
+		}
+	}
+	pending = due;
+	
+	if (due)
+	{
+		index = findPending(0);
+		phase = WRITE_REGISTER;
+		
+		// if the bus is busy the channels stay pending and the next
+		// update() tries again
+		I2cMaster::start(this);
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <typename I2cMaster, uint8_t Channels, uint8_t SampleSize, std::size_t QueueSize>
+bool
+xpcc::i2c::Sampler<I2cMaster, Channels, SampleSize, QueueSize>::attaching()
+{
+	if (running) {
+		return false;
+	}
+	running = true;
+	return true;
+}
+
+template <typename I2cMaster, uint8_t Channels, uint8_t SampleSize, std::size_t QueueSize>
+xpcc::i2c::Delegate::Starting
+xpcc::i2c::Sampler<I2cMaster, Channels, SampleSize, QueueSize>::started()
+{
+	if (phase == READ_DONE)
+	{
+		// repeated start after the last read, continue with the next channel
+		storeSample();
+		index = findPending(index + 1);
+		phase = WRITE_REGISTER;
+	}
+	
+	Starting s;
+	s.address = channels[index].address << 1;
+	if (phase == WRITE_REGISTER)
+	{
+		sample.timestamp = xpcc::Clock::now();
+		sample.channel = index;
+		s.next = WRITE_OP;
+	}
+	else {
+		s.next = READ_OP;
+	}
+	return s;
+}
+
+template <typename I2cMaster, uint8_t Channels, uint8_t SampleSize, std::size_t QueueSize>
+xpcc::i2c::Delegate::Writing
+xpcc::i2c::Sampler<I2cMaster, Channels, SampleSize, QueueSize>::writing()
+{
+	phase = READ_DATA;
+	
+	Writing w;
+	w.buffer = &channels[index].reg;
+	w.size = 1;
+	w.next = WRITE_RESTART;
+	return w;
+}
+
+template <typename I2cMaster, uint8_t Channels, uint8_t SampleSize, std::size_t QueueSize>
+xpcc::i2c::Delegate::Reading
+xpcc::i2c::Sampler<I2cMaster, Channels, SampleSize, QueueSize>::reading()
+{
+	phase = READ_DONE;
+	
+	Reading r;
+	r.buffer = sample.data;
+	r.size = channels[index].size;
+	r.next = (findPending(index + 1) < Channels) ? READ_RESTART : READ_STOP;
+	return r;
+}
+
+template <typename I2cMaster, uint8_t Channels, uint8_t SampleSize, std::size_t QueueSize>
+void
+xpcc::i2c::Sampler<I2cMaster, Channels, SampleSize, QueueSize>::stopped(DetachCause cause)
+{
+	if (cause == NORMAL_STOP)
+	{
+		if (phase == READ_DONE) {
+			storeSample();
+		}
+	}
+	else {
+		errors++;
+	}
+	phase = WRITE_REGISTER;
+	running = false;
+}
+
+// ----------------------------------------------------------------------------
+template <typename I2cMaster, uint8_t Channels, uint8_t SampleSize, std::size_t QueueSize>
+uint8_t
+xpcc::i2c::Sampler<I2cMaster, Channels, SampleSize, QueueSize>::findPending(uint8_t index) const
+{
+	for (; index < channelCount; ++index)
+	{
+		if (pending & (static_cast<Mask>(1) << index)) {
+			return index;
+		}
+	}
+	return Channels;
+}
+
+template <typename I2cMaster, uint8_t Channels, uint8_t SampleSize, std::size_t QueueSize>
+void
+xpcc::i2c::Sampler<I2cMaster, Channels, SampleSize, QueueSize>::storeSample()
+{
+	pending &= ~(static_cast<Mask>(1) << index);
+	if (!samples.push(sample)) {
+		dropped++;
+	}
+}
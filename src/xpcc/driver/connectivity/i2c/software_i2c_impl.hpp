@@ -85,8 +85,9 @@ template <typename Scl, typename Sda, int32_t Frequency>
 void
 xpcc::SoftwareI2C<Scl, Sda, Frequency>::reset(bool error)
 {
-	if (myDelegate) myDelegate->stopped(error ? xpcc::i2c::Delegate::ERROR_CONDITION : xpcc::i2c::Delegate::SOFTWARE_RESET);
+	xpcc::i2c::Delegate *stopping = myDelegate;
 	myDelegate = 0;
+	if (stopping) stopping->stopped(error ? xpcc::i2c::Delegate::ERROR_CONDITION : xpcc::i2c::Delegate::SOFTWARE_RESET);
 }
 
 template <typename Scl, typename Sda, int32_t Frequency>
@@ -146,11 +147,17 @@ xpcc::SoftwareI2C<Scl, Sda, Frequency>::start(xpcc::i2c::Delegate *delegate)
 						break;
 					
 					case xpcc::i2c::Delegate::STOP_OP:
+					{
 						DEBUG_SW_I2C('S');
-						myDelegate->stopped(xpcc::i2c::Delegate::NORMAL_STOP);
-						myDelegate = 0;
 						stopCondition();
+						
+						// detach first, the delegate may start the next
+						// transaction from stopped()
+						xpcc::i2c::Delegate *stopping = myDelegate;
+						myDelegate = 0;
+						stopping->stopped(xpcc::i2c::Delegate::NORMAL_STOP);
 						return true;
+					}
 						
 					default:
 						break;
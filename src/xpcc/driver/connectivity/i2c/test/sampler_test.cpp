@@ -0,0 +1,293 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include "../sampler.hpp"
+
+#include <xpcc/architecture/driver/test/testing_clock.hpp>
+
+#include "sampler_test.hpp"
+
+namespace
+{
+	/**
+	 * Master which runs the whole transaction in start() on a simulated
+	 * bus with two devices. The register pointer is set by the first byte
+	 * of every write and incremented by every read byte.
+	 */
+	class FakeBus
+	{
+	public:
+		struct Device
+		{
+			uint8_t address;
+			uint8_t pointer;
+			uint8_t registers[64];
+		};
+		
+		static bool
+		start(xpcc::i2c::Delegate *delegate)
+		{
+			if (busy || !delegate->attaching()) {
+				return false;
+			}
+			sessions++;
+			
+			Device *device = 0;
+			xpcc::i2c::Delegate::NextOperation next = xpcc::i2c::Delegate::RESTART_OP;
+			while (true)
+			{
+				switch (next)
+				{
+					case xpcc::i2c::Delegate::RESTART_OP:
+						{
+							xpcc::i2c::Delegate::Starting s = delegate->started();
+							device = find(s.address >> 1);
+							if (device == 0) {
+								delegate->stopped(xpcc::i2c::Delegate::ERROR_CONDITION);
+								return true;
+							}
+							next = s.next;
+						}
+						break;
+					
+					case xpcc::i2c::Delegate::WRITE_OP:
+						{
+							xpcc::i2c::Delegate::Writing w = delegate->writing();
+							device->pointer = w.buffer[0];
+							registerWrites++;
+							next = static_cast<xpcc::i2c::Delegate::NextOperation>(w.next);
+						}
+						break;
+					
+					case xpcc::i2c::Delegate::READ_OP:
+						{
+							xpcc::i2c::Delegate::Reading r = delegate->reading();
+							for (std::size_t i = 0; i < r.size; ++i) {
+								r.buffer[i] = device->registers[device->pointer++];
+							}
+							next = static_cast<xpcc::i2c::Delegate::NextOperation>(r.next);
+						}
+						break;
+					
+					case xpcc::i2c::Delegate::STOP_OP:
+						delegate->stopped(xpcc::i2c::Delegate::NORMAL_STOP);
+						return true;
+				}
+			}
+		}
+		
+		static Device *
+		find(uint8_t address)
+		{
+			for (uint_fast8_t i = 0; i < 2; ++i)
+			{
+				if (devices[i].address == address) {
+					return &devices[i];
+				}
+			}
+			return 0;
+		}
+		
+		static Device devices[2];
+		static bool busy;
+		
+		static uint8_t sessions;
+		static uint8_t registerWrites;
+	};
+	
+	FakeBus::Device FakeBus::devices[2];
+	bool FakeBus::busy;
+	uint8_t FakeBus::sessions;
+	uint8_t FakeBus::registerWrites;
+	
+	typedef xpcc::i2c::Sampler<FakeBus, 3, 8, 8> Sampler;
+}
+
+void
+SamplerTest::setUp()
+{
+	TestingClock::time = 0;
+	
+	FakeBus::busy = false;
+	FakeBus::sessions = 0;
+	FakeBus::registerWrites = 0;
+	
+	FakeBus::devices[0].address = 0x53;
+	FakeBus::devices[1].address = 0x68;
+	for (uint_fast8_t i = 0; i < 64; ++i)
+	{
+		FakeBus::devices[0].registers[i] = i;
+		FakeBus::devices[1].registers[i] = 0x80 | i;
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+SamplerTest::testAddChannel()
+{
+	Sampler sampler;
+	
+	TEST_ASSERT_EQUALS(sampler.addChannel(0x53, 0x32, 9, 10), -1);
+	TEST_ASSERT_EQUALS(sampler.addChannel(0x53, 0x32, 0, 10), -1);
+	
+	TEST_ASSERT_EQUALS(sampler.addChannel(0x53, 0x32, 6, 10), 0);
+	TEST_ASSERT_EQUALS(sampler.addChannel(0x68, 0x1b, 8, 10), 1);
+	TEST_ASSERT_EQUALS(sampler.addChannel(0x68, 0x00, 1, 100), 2);
+	TEST_ASSERT_EQUALS(sampler.addChannel(0x68, 0x00, 1, 100), -1);
+}
+
+void
+SamplerTest::testBurstRead()
+{
+	Sampler sampler;
+	sampler.addChannel(0x53, 0x32, 6, 10);
+	sampler.addChannel(0x68, 0x1b, 8, 10);
+	
+	TestingClock::time = 5;
+	sampler.update();
+	
+	// both channels in one transaction, one register address per channel
+	TEST_ASSERT_EQUALS(FakeBus::sessions, 1U);
+	TEST_ASSERT_EQUALS(FakeBus::registerWrites, 2U);
+	
+	Sampler::SampleQueue& samples = sampler.getSamples();
+	TEST_ASSERT_FALSE(samples.isEmpty());
+	
+	const uint8_t expected0[6] = { 0x32, 0x33, 0x34, 0x35, 0x36, 0x37 };
+	TEST_ASSERT_EQUALS(samples.get().channel, 0U);
+	TEST_ASSERT_EQUALS(samples.get().timestamp, xpcc::Timestamp(5));
+	TEST_ASSERT_EQUALS_ARRAY(samples.get().data, expected0, 6);
+	samples.pop();
+	
+	const uint8_t expected1[8] = { 0x9b, 0x9c, 0x9d, 0x9e, 0x9f, 0xa0, 0xa1, 0xa2 };
+	TEST_ASSERT_EQUALS(samples.get().channel, 1U);
+	TEST_ASSERT_EQUALS_ARRAY(samples.get().data, expected1, 8);
+	samples.pop();
+	
+	TEST_ASSERT_TRUE(samples.isEmpty());
+	
+	// nothing is due
+	sampler.update();
+	TEST_ASSERT_EQUALS(FakeBus::sessions, 1U);
+}
+
+void
+SamplerTest::testRates()
+{
+	Sampler sampler;
+	sampler.addChannel(0x53, 0x32, 6, 10);
+	sampler.addChannel(0x68, 0x1b, 8, 20);
+	
+	uint8_t count[2] = { 0, 0 };
+	uint16_t last[2] = { 0, 0 };
+	for (uint_fast8_t t = 0; t < 40; ++t)
+	{
+		TestingClock::time = t;
+		sampler.update();
+		
+		Sampler::SampleQueue& samples = sampler.getSamples();
+		while (!samples.isEmpty())
+		{
+			uint8_t channel = samples.get().channel;
+			count[channel]++;
+			last[channel] = samples.get().timestamp.getTime();
+			samples.pop();
+		}
+	}
+	
+	TEST_ASSERT_EQUALS(count[0], 4U);
+	TEST_ASSERT_EQUALS(count[1], 2U);
+	TEST_ASSERT_EQUALS(last[0], 30U);
+	TEST_ASSERT_EQUALS(last[1], 20U);
+	
+	// the 20 ms channel is read together with the 10 ms channel
+	TEST_ASSERT_EQUALS(FakeBus::sessions, 4U);
+	TEST_ASSERT_EQUALS(sampler.getDroppedSamples(), 0U);
+}
+
+void
+SamplerTest::testBusBusy()
+{
+	Sampler sampler;
+	sampler.addChannel(0x53, 0x32, 6, 10);
+	
+	FakeBus::busy = true;
+	sampler.update();
+	TEST_ASSERT_TRUE(sampler.getSamples().isEmpty());
+	
+	// the channel stays pending
+	FakeBus::busy = false;
+	TestingClock::time = 3;
+	sampler.update();
+	TEST_ASSERT_FALSE(sampler.getSamples().isEmpty());
+	TEST_ASSERT_EQUALS(sampler.getSamples().get().timestamp, xpcc::Timestamp(3));
+}
+
+void
+SamplerTest::testError()
+{
+	Sampler sampler;
+	sampler.addChannel(0x1e, 0x03, 6, 10);
+	sampler.addChannel(0x53, 0x32, 6, 10);
+	
+	// the first device is missing, the transaction is stopped
+	sampler.update();
+	TEST_ASSERT_EQUALS(sampler.getErrors(), 1U);
+	TEST_ASSERT_TRUE(sampler.getSamples().isEmpty());
+	
+	// both channels stay pending and are tried again
+	sampler.update();
+	TEST_ASSERT_EQUALS(sampler.getErrors(), 2U);
+	
+	FakeBus::devices[1].address = 0x1e;
+	sampler.update();
+	TEST_ASSERT_EQUALS(sampler.getErrors(), 2U);
+	TEST_ASSERT_EQUALS(sampler.getSamples().get().channel, 0U);
+	sampler.getSamples().pop();
+	TEST_ASSERT_EQUALS(sampler.getSamples().get().channel, 1U);
+}
+
+void
+SamplerTest::testQueueFull()
+{
+	Sampler sampler;
+	sampler.addChannel(0x53, 0x32, 6, 1);
+	
+	for (uint_fast8_t t = 0; t < 10; ++t)
+	{
+		TestingClock::time = t;
+		sampler.update();
+	}
+	
+	TEST_ASSERT_EQUALS(sampler.getDroppedSamples(), 2U);
+	
+	// the oldest samples are kept
+	TEST_ASSERT_EQUALS(sampler.getSamples().get().timestamp, xpcc::Timestamp(0));
+}
@@ -0,0 +1,366 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include "../mock_master.hpp"
+#include "../transaction_queue.hpp"
+
+#include <xpcc/architecture/driver/test/testing_clock.hpp>
+
+#include "transaction_queue_test.hpp"
+
+typedef xpcc::i2c::MockMaster Master;
+typedef xpcc::i2c::TransactionQueue<Master, 4> Queue;
+
+namespace
+{
+	/// Writes two bytes and records when it was started and stopped
+	class TestingDelegate : public xpcc::i2c::Delegate
+	{
+	public:
+		TestingDelegate() :
+			busy(false), startedAt(0), stoppedAt(0), cause(SOFTWARE_RESET),
+			order(0)
+		{
+		}
+		
+		virtual bool
+		attaching()
+		{
+			if (busy) {
+				return false;
+			}
+			busy = true;
+			return true;
+		}
+		
+		virtual Starting
+		started()
+		{
+			startedAt = TestingClock::time;
+			
+			Starting s;
+			s.address = 0x10;
+			s.next = WRITE_OP;
+			return s;
+		}
+		
+		virtual Reading
+		reading()
+		{
+			Reading r;
+			r.buffer = 0;
+			r.size = 0;
+			r.next = READ_STOP;
+			return r;
+		}
+		
+		virtual Writing
+		writing()
+		{
+			Writing w;
+			w.buffer = data;
+			w.size = sizeof(data);
+			w.next = WRITE_STOP;
+			return w;
+		}
+		
+		virtual void
+		stopped(DetachCause cause)
+		{
+			busy = false;
+			stoppedAt = TestingClock::time;
+			this->cause = cause;
+			order = ++counter;
+		}
+		
+		bool busy;
+		uint16_t startedAt;
+		uint16_t stoppedAt;
+		DetachCause cause;
+		
+		/// n-th delegate which was stopped
+		uint8_t order;
+		
+		static uint8_t counter;
+		
+	private:
+		uint8_t data[2];
+	};
+	
+	uint8_t TestingDelegate::counter;
+	
+	/// Counts the start and stop conditions on the bus
+	class BusMonitor : public Master::Slave
+	{
+	public:
+		BusMonitor() :
+			starts(0), stops(0)
+		{
+		}
+		
+		virtual bool
+		selected(uint8_t /* address */)
+		{
+			starts++;
+			return true;
+		}
+		
+		virtual void
+		write(const uint8_t * /* data */, std::size_t /* size */)
+		{
+		}
+		
+		virtual void
+		read(uint8_t * /* data */, std::size_t /* size */)
+		{
+		}
+		
+		virtual void
+		stopped()
+		{
+			stops++;
+		}
+		
+		uint8_t starts;
+		uint8_t stops;
+	};
+	
+	/// One millisecond per bus operation
+	void
+	step()
+	{
+		TestingClock::time++;
+		Master::update();
+	}
+	
+	void
+	run()
+	{
+		for (uint_fast8_t i = 0; i < 100 && (Queue::isBusy() || Queue::getQueueSize()); ++i) {
+			step();
+			Queue::update();
+		}
+	}
+}
+
+void
+TransactionQueueTest::setUp()
+{
+	TestingClock::time = 0;
+	TestingDelegate::counter = 0;
+	Master::initialize(Master::DEVICE_PRESENT, Master::STEP_MODE);
+	Queue::resetStatistics();
+}
+
+void
+TransactionQueueTest::tearDown()
+{
+	Queue::reset();
+	Master::attachSlave(0);
+}
+
+// ----------------------------------------------------------------------------
+void
+TransactionQueueTest::testImmediateStart()
+{
+	Master::initialize(Master::DEVICE_PRESENT, Master::AUTO_MODE);
+	
+	TestingDelegate delegate;
+	TEST_ASSERT_TRUE(Queue::start(&delegate));
+	
+	// the mock master finishes the transaction in start()
+	TEST_ASSERT_FALSE(delegate.busy);
+	TEST_ASSERT_EQUALS(delegate.cause, xpcc::i2c::Delegate::NORMAL_STOP);
+	TEST_ASSERT_FALSE(Queue::isBusy());
+	
+	TEST_ASSERT_EQUALS(Queue::getStatistics().transactions, 1U);
+	TEST_ASSERT_EQUALS(Queue::getStatistics().chained, 0U);
+	TEST_ASSERT_EQUALS(Queue::getStatistics().errors, 0U);
+}
+
+void
+TransactionQueueTest::testChaining()
+{
+	BusMonitor bus;
+	Master::attachSlave(&bus);
+	
+	TestingDelegate a, b, c;
+	
+	TEST_ASSERT_TRUE(Queue::start(&a));
+	TEST_ASSERT_TRUE(Queue::isBusy());
+	TEST_ASSERT_EQUALS(Queue::getQueueSize(), 0U);
+	
+	// the bus is busy, the others have to wait
+	TEST_ASSERT_TRUE(Queue::start(&b));
+	TEST_ASSERT_TRUE(Queue::start(&c));
+	TEST_ASSERT_EQUALS(Queue::getQueueSize(), 2U);
+	TEST_ASSERT_TRUE(b.busy);
+	
+	run();
+	
+	TEST_ASSERT_EQUALS(a.order, 1U);
+	TEST_ASSERT_EQUALS(b.order, 2U);
+	TEST_ASSERT_EQUALS(c.order, 3U);
+	TEST_ASSERT_EQUALS(c.cause, xpcc::i2c::Delegate::NORMAL_STOP);
+	
+	// every transaction ends with its own stop condition
+	TEST_ASSERT_EQUALS(bus.starts, 3U);
+	TEST_ASSERT_EQUALS(bus.stops, 3U);
+	
+	// the next transaction is attached from stopped() and starts with
+	// the bus operation directly after the stop condition
+	TEST_ASSERT_EQUALS(b.startedAt, a.stoppedAt + 1);
+	TEST_ASSERT_EQUALS(c.startedAt, b.stoppedAt + 1);
+	
+	TEST_ASSERT_EQUALS(Queue::getStatistics().transactions, 3U);
+	TEST_ASSERT_EQUALS(Queue::getStatistics().chained, 2U);
+	TEST_ASSERT_EQUALS(Queue::getStatistics().maxQueueSize, 2U);
+}
+
+void
+TransactionQueueTest::testPriority()
+{
+	TestingDelegate a, b, c, d;
+	
+	TEST_ASSERT_TRUE(Queue::start(&a));
+	TEST_ASSERT_TRUE(Queue::start(&b, 0));
+	TEST_ASSERT_TRUE(Queue::start(&c, 2));
+	TEST_ASSERT_TRUE(Queue::WithPriority<2>::start(&d));
+	
+	run();
+	
+	TEST_ASSERT_EQUALS(a.order, 1U);
+	TEST_ASSERT_EQUALS(c.order, 2U);
+	TEST_ASSERT_EQUALS(d.order, 3U);
+	TEST_ASSERT_EQUALS(b.order, 4U);
+}
+
+void
+TransactionQueueTest::testQueueFull()
+{
+	TestingDelegate running;
+	TestingDelegate waiting[4];
+	TestingDelegate rejected;
+	
+	TEST_ASSERT_TRUE(Queue::start(&running));
+	for (uint_fast8_t i = 0; i < 4; ++i) {
+		TEST_ASSERT_TRUE(Queue::start(&waiting[i]));
+	}
+	
+	TEST_ASSERT_FALSE(Queue::start(&rejected));
+	TEST_ASSERT_FALSE(rejected.busy);
+	TEST_ASSERT_EQUALS(Queue::getStatistics().rejected, 1U);
+	
+	// a busy delegate is not queued twice
+	TEST_ASSERT_FALSE(Queue::start(&running));
+	
+	run();
+	
+	TEST_ASSERT_EQUALS(waiting[3].order, 5U);
+	TEST_ASSERT_EQUALS(rejected.order, 0U);
+}
+
+void
+TransactionQueueTest::testError()
+{
+	Master::initialize(Master::DEVICE_MISSING, Master::STEP_MODE);
+	
+	TestingDelegate a, b;
+	TEST_ASSERT_TRUE(Queue::start(&a));
+	TEST_ASSERT_TRUE(Queue::start(&b));
+	
+	step();
+	TEST_ASSERT_EQUALS(a.cause, xpcc::i2c::Delegate::ERROR_CONDITION);
+	TEST_ASSERT_FALSE(Queue::isBusy());
+	TEST_ASSERT_EQUALS(Queue::getQueueSize(), 1U);
+	TEST_ASSERT_EQUALS(Queue::getStatistics().errors, 1U);
+	
+	// the next transaction is attached by update()
+	Master::initialize(Master::DEVICE_PRESENT, Master::STEP_MODE);
+	Queue::update();
+	TEST_ASSERT_TRUE(Queue::isBusy());
+	
+	run();
+	TEST_ASSERT_EQUALS(b.cause, xpcc::i2c::Delegate::NORMAL_STOP);
+	TEST_ASSERT_EQUALS(Queue::getStatistics().transactions, 2U);
+	TEST_ASSERT_EQUALS(Queue::getStatistics().chained, 0U);
+}
+
+void
+TransactionQueueTest::testReset()
+{
+	TestingDelegate a, b;
+	TEST_ASSERT_TRUE(Queue::start(&a));
+	TEST_ASSERT_TRUE(Queue::start(&b));
+	
+	Queue::reset();
+	
+	TEST_ASSERT_FALSE(Queue::isBusy());
+	TEST_ASSERT_EQUALS(Queue::getQueueSize(), 0U);
+	TEST_ASSERT_EQUALS(a.cause, xpcc::i2c::Delegate::SOFTWARE_RESET);
+	TEST_ASSERT_EQUALS(b.cause, xpcc::i2c::Delegate::SOFTWARE_RESET);
+	TEST_ASSERT_FALSE(a.busy);
+	TEST_ASSERT_FALSE(b.busy);
+	TEST_ASSERT_EQUALS(Queue::getStatistics().errors, 2U);
+}
+
+void
+TransactionQueueTest::testStartSync()
+{
+	Master::initialize(Master::DEVICE_PRESENT, Master::AUTO_MODE);
+	
+	TestingDelegate a;
+	TEST_ASSERT_TRUE(Queue::startSync(&a));
+	TEST_ASSERT_EQUALS(a.cause, xpcc::i2c::Delegate::NORMAL_STOP);
+	TEST_ASSERT_FALSE(a.busy);
+}
+
+void
+TransactionQueueTest::testUtilization()
+{
+	TestingDelegate a, b;
+	
+	// two chained transactions with three bus operations each (start,
+	// write, stop)
+	TEST_ASSERT_TRUE(Queue::start(&a));
+	TEST_ASSERT_TRUE(Queue::start(&b));
+	run();
+	TEST_ASSERT_EQUALS(TestingClock::time, 6U);
+	
+	// idle for the same time
+	TestingClock::time += 6;
+	
+	TEST_ASSERT_EQUALS(Queue::getStatistics().busyTime, 6U);
+	TEST_ASSERT_EQUALS(Queue::getUtilization(), 50U);
+	
+	Queue::resetStatistics();
+	TestingClock::time += 10;
+	TEST_ASSERT_EQUALS(Queue::getUtilization(), 0U);
+}
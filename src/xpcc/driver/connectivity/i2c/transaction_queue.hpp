@@ -0,0 +1,277 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_I2C__TRANSACTION_QUEUE_HPP
+#define XPCC_I2C__TRANSACTION_QUEUE_HPP
+
+#include <stdint.h>
+
+#include <xpcc/architecture/driver/clock.hpp>
+#include "master.hpp"
+
+namespace xpcc
+{
+	namespace i2c
+	{
+		/**
+		 * \brief	Queue for the transactions of several drivers on one bus
+		 * 
+		 * Has the same static interface as the I2C masters and can be
+		 * used instead of them as template argument of the drivers.
+		 * start() does not fail if the bus is busy, the delegate is
+		 * stored in a bounded queue instead and attached as soon as the
+		 * bus is free.
+		 * 
+		 * The queue is attached to the master as a single delegate which
+		 * forwards all calls to the current transaction. Every transaction
+		 * ends with its own stop condition, which some devices need (e.g.
+		 * an EEPROM starts its write cycle only on a stop). The masters
+		 * detach the delegate before calling its stopped() method, so the
+		 * next waiting transaction is attached from there, directly after
+		 * the stop condition.
+		 * 
+		 * The waiting delegate with the highest priority is attached next,
+		 * delegates with equal priority are attached in the order of
+		 * their start() calls.
+		 * 
+		 * \code
+		 * typedef xpcc::i2c::TransactionQueue<xpcc::stm32::I2cMaster2> I2c;
+		 * 
+		 * xpcc::Tmp102< I2c > temperature(temperatureData);
+		 * xpcc::Itg3200< I2c::WithPriority<1> > gyroscope(gyroscopeData);
+		 * 
+		 * while (1)
+		 * {
+		 *     I2c::update();
+		 *     ...
+		 * }
+		 * \endcode
+		 * 
+		 * update() has to be called regularly. It restarts the bus after an
+		 * error and when the master was busy with another delegate.
+		 * 
+		 * \tparam	Master	I2C master (e.g. xpcc::i2c::MockMaster)
+		 * \tparam	Size	Maximum number of waiting transactions
+		 * 
+		 * \ingroup	i2c
+		 */
+		template <typename Master, uint8_t Size = 8>
+		class TransactionQueue
+		{
+		public:
+			struct Statistics
+			{
+				/// Transactions attached to the bus
+				uint32_t transactions;
+				
+				/// Transactions attached directly after the stop
+				/// condition of the previous one
+				uint32_t chained;
+				
+				/// Time the bus was in use by the queue in milliseconds
+				uint32_t busyTime;
+				
+				/// Transactions stopped with an error or by a reset
+				uint16_t errors;
+				
+				/// Calls to start() rejected because the queue was full
+				uint16_t rejected;
+				
+				/// Maximum number of waiting transactions
+				uint8_t maxQueueSize;
+			};
+			
+			/**
+			 * \brief	Queue the transaction of a delegate
+			 * 
+			 * The delegate's attaching() method is called immediately.
+			 * 
+			 * \param	priority	transactions with a higher value are
+			 * 						attached first
+			 * \return	\c false if the queue is full or the delegate
+			 * 			refused to be attached
+			 */
+			static bool
+			start(Delegate *delegate, uint8_t priority = 0);
+			
+			/**
+			 * \brief	Queue the transaction and wait until it is finished
+			 * 
+			 * Calls update() while waiting, must not be used from an
+			 * interrupt.
+			 */
+			static bool
+			startSync(Delegate *delegate, uint8_t priority = 0);
+			
+			/**
+			 * \brief	Reset the master and drop all waiting transactions
+			 * 
+			 * The waiting delegates are stopped with
+			 * Delegate::SOFTWARE_RESET.
+			 */
+			static void
+			reset(bool error = false);
+			
+			static uint8_t
+			getErrorState()
+			{
+				return Master::getErrorState();
+			}
+			
+			/// Attach the next transaction if the bus is free
+			static void
+			update();
+			
+			/// Number of waiting transactions (without the current one)
+			static uint8_t
+			getQueueSize()
+			{
+				return count;
+			}
+			
+			static bool
+			isBusy()
+			{
+				return running;
+			}
+			
+			static const Statistics&
+			getStatistics()
+			{
+				return statistics;
+			}
+			
+			/**
+			 * \brief	Percentage of time the bus was in use since the
+			 * 			last call of resetStatistics()
+			 * 
+			 * The time is measured with xpcc::Clock. Transactions are
+			 * usually shorter than one millisecond, so the value is only
+			 * meaningful over many transactions. xpcc::Timestamp is 16 bit
+			 * wide, therefore the statistics have to be reset at least
+			 * once a minute.
+			 */
+			static uint8_t
+			getUtilization();
+			
+			static void
+			resetStatistics();
+			
+			/**
+			 * \brief	Fixed priority for drivers which call start()
+			 * 			without one
+			 * 
+			 * Can be used as template argument of the drivers.
+			 */
+			template <uint8_t Priority>
+			struct WithPriority
+			{
+				static bool
+				start(Delegate *delegate)
+				{
+					return TransactionQueue::start(delegate, Priority);
+				}
+				
+				static bool
+				startSync(Delegate *delegate)
+				{
+					return TransactionQueue::startSync(delegate, Priority);
+				}
+				
+				static void
+				reset(bool error = false)
+				{
+					TransactionQueue::reset(error);
+				}
+				
+				static uint8_t
+				getErrorState()
+				{
+					return TransactionQueue::getErrorState();
+				}
+			};
+			
+		private:
+			/// Delegate attached to the master, forwards to the current transaction
+			class Forwarder : public Delegate
+			{
+			public:
+				virtual bool
+				attaching();
+				
+				virtual Starting
+				started();
+				
+				virtual Reading
+				reading();
+				
+				virtual Writing
+				writing();
+				
+				virtual void
+				stopped(DetachCause cause);
+			};
+			
+			struct Entry
+			{
+				Delegate *delegate;
+				uint8_t priority;
+			};
+			
+			/// Remove the waiting delegate with the highest priority
+			static Delegate *
+			pop();
+			
+			/// Attach the current or next waiting transaction to the
+			/// master, \c false if nothing was started
+			static bool
+			attachNext();
+			
+			static bool
+			isWaiting(Delegate *delegate);
+			
+			static Forwarder forwarder;
+			
+			static Entry queue[Size];
+			static volatile uint8_t count;
+			
+			static Delegate * volatile current;
+			static volatile bool running;
+			
+			static xpcc::Timestamp busyStart;
+			static xpcc::Timestamp statisticsStart;
+			static Statistics statistics;
+		};
+	}
+}
+
+#include "transaction_queue_impl.hpp"
+
+#endif // XPCC_I2C__TRANSACTION_QUEUE_HPP
@@ -0,0 +1,294 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_I2C__TRANSACTION_QUEUE_HPP
+#	error	"Don't include this file directly, use 'transaction_queue.hpp' instead!"
+#endif
+
+#include <xpcc/architecture/driver/atomic/lock.hpp>
+
+template <typename Master, uint8_t Size>
+typename xpcc::i2c::TransactionQueue<Master, Size>::Forwarder xpcc::i2c::TransactionQueue<Master, Size>::forwarder;
+
+template <typename Master, uint8_t Size>
+typename xpcc::i2c::TransactionQueue<Master, Size>::Entry xpcc::i2c::TransactionQueue<Master, Size>::queue[Size];
+template <typename Master, uint8_t Size>
+volatile uint8_t xpcc::i2c::TransactionQueue<Master, Size>::count(0);
+
+template <typename Master, uint8_t Size>
+xpcc::i2c::Delegate * volatile xpcc::i2c::TransactionQueue<Master, Size>::current(0);
+template <typename Master, uint8_t Size>
+volatile bool xpcc::i2c::TransactionQueue<Master, Size>::running(false);
+
+template <typename Master, uint8_t Size>
+xpcc::Timestamp xpcc::i2c::TransactionQueue<Master, Size>::busyStart;
+template <typename Master, uint8_t Size>
+xpcc::Timestamp xpcc::i2c::TransactionQueue<Master, Size>::statisticsStart;
+template <typename Master, uint8_t Size>
+typename xpcc::i2c::TransactionQueue<Master, Size>::Statistics xpcc::i2c::TransactionQueue<Master, Size>::statistics;
+
+// ----------------------------------------------------------------------------
+template <typename Master, uint8_t Size>
+bool
+xpcc::i2c::TransactionQueue<Master, Size>::start(Delegate *delegate, uint8_t priority)
+{
+	if (delegate == 0) {
+		return false;
+	}
+	
+	{
+		atomic::Lock lock;
+		if (count >= Size) {
+			statistics.rejected++;
+			return false;
+		}
+	}
+	
+	if (!delegate->attaching()) {
+		return false;
+	}
+	
+	{
+		atomic::Lock lock;
+		
+		// the queue may only be emptied by the interrupt in the meantime
+		queue[count].delegate = delegate;
+		queue[count].priority = priority;
+		count++;
+		
+		if (count > statistics.maxQueueSize) {
+			statistics.maxQueueSize = count;
+		}
+	}
+	
+	update();
+	return true;
+}
+
+template <typename Master, uint8_t Size>
+bool
+xpcc::i2c::TransactionQueue<Master, Size>::startSync(Delegate *delegate, uint8_t priority)
+{
+	if (!start(delegate, priority)) {
+		return false;
+	}
+	
+	while (current == delegate || isWaiting(delegate)) {
+		update();
+	}
+	return true;
+}
+
+template <typename Master, uint8_t Size>
+void
+xpcc::i2c::TransactionQueue<Master, Size>::reset(bool error)
+{
+	Master::reset(error);
+	
+	Delegate *delegate;
+	while ((delegate = pop()) != 0)
+	{
+		statistics.errors++;
+		delegate->stopped(Delegate::SOFTWARE_RESET);
+	}
+}
+
+template <typename Master, uint8_t Size>
+void
+xpcc::i2c::TransactionQueue<Master, Size>::update()
+{
+	attachNext();
+}
+
+// ----------------------------------------------------------------------------
+template <typename Master, uint8_t Size>
+uint8_t
+xpcc::i2c::TransactionQueue<Master, Size>::getUtilization()
+{
+	uint32_t busy = statistics.busyTime;
+	xpcc::Timestamp now = xpcc::Clock::now();
+	if (running) {
+		busy += (now - busyStart).getTime();
+	}
+	
+	uint32_t elapsed = (now - statisticsStart).getTime();
+	if (elapsed == 0) {
+		return running ? 100 : 0;
+	}
+	if (busy >= elapsed) {
+		return 100;
+	}
+	return (busy * 100) / elapsed;
+}
+
+template <typename Master, uint8_t Size>
+void
+xpcc::i2c::TransactionQueue<Master, Size>::resetStatistics()
+{
+	atomic::Lock lock;
+	
+	statistics = Statistics();
+	statistics.maxQueueSize = count;
+	statisticsStart = xpcc::Clock::now();
+	busyStart = statisticsStart;
+}
+
+// ----------------------------------------------------------------------------
+template <typename Master, uint8_t Size>
+xpcc::i2c::Delegate *
+xpcc::i2c::TransactionQueue<Master, Size>::pop()
+{
+	atomic::Lock lock;
+	
+	if (count == 0) {
+		return 0;
+	}
+	
+	uint8_t index = 0;
+	for (uint8_t i = 1; i < count; ++i)
+	{
+		if (queue[i].priority > queue[index].priority) {
+			index = i;
+		}
+	}
+	
+	Delegate *delegate = queue[index].delegate;
+	
+	// keep the order of the remaining entries
+	count--;
+	for (uint8_t i = index; i < count; ++i) {
+		queue[i] = queue[i + 1];
+	}
+	return delegate;
+}
+
+template <typename Master, uint8_t Size>
+bool
+xpcc::i2c::TransactionQueue<Master, Size>::attachNext()
+{
+	{
+		atomic::Lock lock;
+		if (running) {
+			return false;
+		}
+		
+		if (current == 0)
+		{
+			current = pop();
+			if (current == 0) {
+				return false;
+			}
+			statistics.transactions++;
+		}
+		
+		running = true;
+		busyStart = xpcc::Clock::now();
+	}
+	
+	// might run the whole transaction (or even the whole queue) before
+	// returning, depending on the master
+	if (!Master::start(&forwarder))
+	{
+		// the master is used by someone else, try again later
+		running = false;
+		return false;
+	}
+	return true;
+}
+
+template <typename Master, uint8_t Size>
+bool
+xpcc::i2c::TransactionQueue<Master, Size>::isWaiting(Delegate *delegate)
+{
+	atomic::Lock lock;
+	
+	for (uint8_t i = 0; i < count; ++i)
+	{
+		if (queue[i].delegate == delegate) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// ----------------------------------------------------------------------------
+template <typename Master, uint8_t Size>
+bool
+xpcc::i2c::TransactionQueue<Master, Size>::Forwarder::attaching()
+{
+	// the current delegate was already asked by start()
+	return true;
+}
+
+template <typename Master, uint8_t Size>
+xpcc::i2c::Delegate::Starting
+xpcc::i2c::TransactionQueue<Master, Size>::Forwarder::started()
+{
+	return current->started();
+}
+
+template <typename Master, uint8_t Size>
+xpcc::i2c::Delegate::Reading
+xpcc::i2c::TransactionQueue<Master, Size>::Forwarder::reading()
+{
+	return current->reading();
+}
+
+template <typename Master, uint8_t Size>
+xpcc::i2c::Delegate::Writing
+xpcc::i2c::TransactionQueue<Master, Size>::Forwarder::writing()
+{
+	return current->writing();
+}
+
+template <typename Master, uint8_t Size>
+void
+xpcc::i2c::TransactionQueue<Master, Size>::Forwarder::stopped(DetachCause cause)
+{
+	if (cause != NORMAL_STOP) {
+		statistics.errors++;
+	}
+	
+	Delegate *delegate = current;
+	current = 0;
+	statistics.busyTime += (xpcc::Clock::now() - busyStart).getTime();
+	running = false;
+	
+	if (delegate) {
+		delegate->stopped(cause);
+	}
+	
+	// The master has already sent the stop condition and detached the
+	// forwarder, so the next transaction starts right away. After an
+	// error the bus is restarted by update().
+	if (cause == NORMAL_STOP && attachNext()) {
+		statistics.chained++;
+	}
+}
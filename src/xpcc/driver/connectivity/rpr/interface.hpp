@@ -36,6 +36,7 @@
 
 #include <xpcc/architecture/utils.hpp>
 #include <xpcc/utils/template_metaprogramming.hpp>
+#include <xpcc/math/utils/crc.hpp>
 #include <xpcc/container/queue.hpp>
 #include <xpcc/workflow/timeout.hpp>
 #include <xpcc/utils/allocator/dynamic.hpp>
@@ -53,6 +54,13 @@ namespace xpcc
 		uint16_t
 		crcUpdate(uint16_t crc, uint8_t data);
 		
+		/**
+		 * \internal
+		 * \brief	CRC of the frames
+		 * \ingroup	token
+		 */
+		typedef xpcc::Crc16Ibm Crc;
+		
 		/**
 		 * \brief	Token Ring interface
 		 *
@@ -205,6 +205,9 @@ xpcc::rpr::Interface<Device, N>::update()
 				
 				if (status & STATUS_DESTINATION_RECOGNISED)
 				{
+					// the addresses are already included, now check
+					// command, payload and FCS at once
+					crc = Crc::update(crc, receiveBuffer.payload, receiveBuffer.length);
 					if (crc == 0)
 					{
 						XPCC_RPR_LOG("crc check success");
@@ -299,8 +302,8 @@ xpcc::rpr::Interface<Device, N>::update()
 					
 					if (status & STATUS_DESTINATION_RECOGNISED)
 					{
-						crc = crcUpdate(crc, addressBuffer);
-						crc = crcUpdate(crc, data);
+						crc = Crc::update(crc, addressBuffer);
+						crc = Crc::update(crc, data);
 					}
 				}
 					break;
@@ -326,8 +329,8 @@ xpcc::rpr::Interface<Device, N>::update()
 					
 					if (status & STATUS_DESTINATION_RECOGNISED)
 					{
-						crc = crcUpdate(crc, addressBuffer);
-						crc = crcUpdate(crc, data);
+						crc = Crc::update(crc, addressBuffer);
+						crc = Crc::update(crc, data);
 					}
 					
 					if (!(status & STATUS_SOURCE_RECOGNISED) && (receiveBuffer.type != MESSAGE_TYPE_UNICAST))
@@ -356,7 +359,6 @@ xpcc::rpr::Interface<Device, N>::update()
 							XPCC_RPR_LOG("rx: buffering payload");
 							receiveBuffer.payload[length-5] = data;
 							receiveBuffer.length++;
-							crc = crcUpdate(crc, data);
 						}
 						else {
 							// really, really bad programmer !
@@ -400,8 +402,6 @@ template <typename Device, std::size_t N>
 void
 xpcc::rpr::Interface<Device, N>::writeMessage(Message *message)
 {
-	uint16_t crc = crcInitialValue;
-	
 	// Start Delimiter
 	Device::write(startDelimiterByte);
 	
@@ -418,29 +418,25 @@ xpcc::rpr::Interface<Device, N>::writeMessage(Message *message)
 			destination |= ADDRESS_INDIVIDUAL_GROUP;
 	}
 	
-	writeByteEscaped(destination);
-	crc = crcUpdate(crc, destination);
-	writeByteEscaped(destination >> 8);
-	crc = crcUpdate(crc, destination >> 8);
+	// Destination and source address, LSB first, and the command
+	const uint8_t header[5] = {
+		uint8_t(destination), uint8_t(destination >> 8),
+		uint8_t(message->source), uint8_t(message->source >> 8),
+		message->command
+	};
 	
-	// Source Address
-	// LSB first
-	writeByteEscaped(message->source);
-	crc = crcUpdate(crc, message->source);
-	writeByteEscaped(message->source >> 8);
-	crc = crcUpdate(crc, message->source >> 8);
+	uint16_t crc = Crc::update(crcInitialValue, header, sizeof(header));
+	crc = Crc::update(crc, message->payload, message->length);
 	
-	// PAYLOAD
-	// Command
-	writeByteEscaped(message->command);
-	crc = crcUpdate(crc, message->command);
+	for (uint_fast8_t i = 0; i < sizeof(header); ++i) {
+		writeByteEscaped(header[i]);
+	}
 	
 	// Optional Payload
 	std::size_t i = 0;
 	while (i < message->length)
 	{
 		writeByteEscaped(message->payload[i]);
-		crc = crcUpdate(crc, message->payload[i]);
 		i++;
 	}
 	
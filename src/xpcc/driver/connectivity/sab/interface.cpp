@@ -33,20 +33,6 @@
 uint8_t
 xpcc::sab::crcUpdate(uint8_t crc, uint8_t data)
 {
-#ifdef __AVR__
-	return _crc_ibutton_update(crc, data);
-#else
-	crc = crc ^ data;
-	for (uint_fast8_t i = 0; i < 8; ++i)
-	{
-		if (crc & 0x01) {
-			crc = (crc >> 1) ^ 0x8C;
-		}
-		else {
-			crc >>= 1;
-		}
-	}
-	return crc;
-#endif
+	return Crc::update(crc, data);
 }
 
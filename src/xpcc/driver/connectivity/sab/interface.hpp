@@ -34,6 +34,7 @@
 #include <cstddef>
 #include <stdint.h>
 #include <xpcc/architecture/utils.hpp>
+#include <xpcc/math/utils/crc.hpp>
 
 #include "constants.hpp"
 
@@ -52,6 +53,13 @@ namespace xpcc
 		uint8_t
 		crcUpdate(uint8_t crc, uint8_t data);
 		
+		/**
+		 * \internal
+		 * \brief	CRC of the frames
+		 * \ingroup	sab
+		 */
+		typedef xpcc::Crc8Dallas Crc;
+		
 		/**
 		 * \brief	SAB interface
 		 * 
@@ -32,10 +32,6 @@
 	#error	"Don't include this file directly, use 'interface.hpp' instead!"
 #endif
 
-#ifdef __AVR__
-	#include <util/crc16.h>
-#endif
-
 /*#include <xpcc/debug/logger.hpp>
 
 #undef XPCC_LOG_LEVEL
@@ -69,20 +65,19 @@ xpcc::sab::Interface<Device>::sendMessage(uint8_t address, Flags flags,
 		uint8_t command,
 		const void *payload, uint8_t payloadLength)
 {
-	uint8_t crcSend;
+	const uint8_t header[3] = { payloadLength, uint8_t(address | flags), command };
+	
+	uint8_t crcSend = Crc::update(crcInitialValue, header, sizeof(header));
+	crcSend = Crc::update(crcSend, payload, payloadLength);
 	
 	Device::write(syncByte);
-	Device::write(payloadLength);
-	crcSend = crcUpdate(crcInitialValue, payloadLength);
-	Device::write(address | flags);
-	crcSend = crcUpdate(crcSend, address | flags);
-	Device::write(command);
-	crcSend = crcUpdate(crcSend, command);
+	Device::write(header[0]);
+	Device::write(header[1]);
+	Device::write(header[2]);
 	
 	const uint8_t *ptr = static_cast<const uint8_t *>(payload);
 	for (uint_fast8_t i = 0; i < payloadLength; ++i)
 	{
-		crcSend = crcUpdate(crcSend, *ptr);
 		Device::write(*ptr);
 		ptr++;
 	}
@@ -193,17 +188,18 @@ xpcc::sab::Interface<Device>::update()
 				else {
 					length = byte + 3;		// +3 for header, command and crc byte
 					position = 0;
-					crc = crcUpdate(crcInitialValue, byte);
+					crc = Crc::update(crcInitialValue, byte);
 					state = DATA;
 				}
 				break;
 			
 			case DATA:
 				buffer[position] = byte;
-				crc = crcUpdate(crc, byte);
 				
 				position += 1;
 				if (position >= length) {
+					// check the complete frame at once
+					crc = Crc::update(crc, buffer, length);
 					if (crc == 0) {
 						lengthOfReceivedMessage = length;
 						//XPCC_LOG_DEBUG << "SAB received" << xpcc::endl;
@@ -33,6 +33,7 @@
 
 #include <cstddef>
 #include <xpcc/architecture/driver/accessor/flash.hpp>
+#include <xpcc/utils/algorithm.hpp>
 
 #include "interface.hpp"
 
@@ -187,6 +188,12 @@ namespace xpcc
 		 * }
 		 * \endcode
 		 * 
+		 * If the actions are sorted by their command in ascending order the
+		 * slave uses a binary search to find the action for a received
+		 * message. Define the list with SAB__ACTION_TABLE() to have the
+		 * order checked by the compiler. Unsorted lists are searched
+		 * linearly.
+		 * 
 		 * A complete example is available in the \c example/sab folder.
 		 * 
 		 * \author	Fabian Greif
@@ -223,9 +230,22 @@ namespace xpcc
 			void
 			send(bool acknowledge, const void *payload, std::size_t payloadLength);
 			
+			/**
+			 * \brief	Find the action for a command
+			 * 
+			 * Uses a binary search if the action list is sorted. Only the
+			 * commands are read from flash until the action is found.
+			 */
+			bool
+			findAction(uint8_t command, Action& action);
+			
+			static inline uint8_t
+			getCommand(xpcc::accessor::Flash<Action> list, uint8_t index);
+			
 			uint8_t ownAddress;
 			xpcc::accessor::Flash<Action> actionList;
 			uint8_t actionCount;
+			bool actionListSorted;
 			
 			uint8_t currentCommand;
 			Response response;
@@ -290,6 +310,40 @@ namespace xpcc
 			command }
 #endif	// __DOXYGEN__
 
+#ifdef __DOXYGEN__
+	/**
+	 * \brief	Define a sorted list of sab::Action
+	 * 
+	 * The entries are given through a macro which takes the name of the
+	 * entry macro as parameter. The table is stored in flash and the
+	 * compiler checks that the commands are unique and sorted in
+	 * ascending order, which allows the slave to use a binary search.
+	 * 
+	 * Example:
+	 * \code
+	 * #define ACTIONS(ACTION) \
+	 *     ACTION(0x03, sensor, Sensor::doSomething, sizeof(uint32_t)), \
+	 *     ACTION(0x57, sensor, Sensor::sendValue,   0)
+	 * 
+	 * SAB__ACTION_TABLE(actionList, ACTIONS);
+	 * \endcode
+	 * 
+	 * \param	name	Name of the array
+	 * \param	list	Macro defining the entries
+	 * 
+	 * \see		SAB__ACTION()
+	 * \ingroup	sab
+	 */
+	#define	SAB__ACTION_TABLE(name, list)
+#else
+	#define	SAB__ACTION_KEY(command, object, function, length)	(command)
+	
+	#define	SAB__ACTION_TABLE(name, list)	\
+		FLASH_STORAGE(xpcc::sab::Action name[]) = { list(SAB__ACTION) }; \
+		static_assert(xpcc::isStrictlyAscending(list(SAB__ACTION_KEY)), \
+				"Commands of " #name " must be unique and sorted in ascending order")
+#endif	// __DOXYGEN__
+
 #include "slave_impl.hpp"
 
 #endif	// XPCC_SAB__SLAVE_HPP
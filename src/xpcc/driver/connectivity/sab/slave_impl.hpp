@@ -62,10 +62,18 @@ xpcc::sab::Slave<Interface>::Slave(uint8_t address,
 		xpcc::accessor::Flash<Action> list,
 		uint8_t count) : 
 	ownAddress(address), actionList(list), actionCount(count),
-	response(this)
+	actionListSorted(true), response(this)
 {
+	for (uint_fast8_t i = 1; i < count; ++i)
+	{
+		if (getCommand(list, i - 1) >= getCommand(list, i)) {
+			actionListSorted = false;
+			break;
+		}
+	}
+	
 	Interface::initialize();
-}			
+}
 
 // ----------------------------------------------------------------------------
 template <typename Interface>
@@ -81,25 +89,20 @@ xpcc::sab::Slave<Interface>::update()
 			this->response.triggered = false;
 			this->currentCommand = Interface::getCommand();
 			
-			xpcc::accessor::Flash<Action> list = actionList;
-			for (uint_fast8_t i = 0; i < actionCount; ++i, ++list)
+			Action action;
+			if (findAction(this->currentCommand, action))
 			{
-				Action action(*list);
-				if (this->currentCommand == action.command)
+				if (Interface::getPayloadLength() == action.payloadLength)
 				{
-					if (Interface::getPayloadLength() == action.payloadLength)
-					{
-						// execute callback function
-						action.call(this->response, Interface::getPayload());
-						
-						if (!this->response.triggered) {
-							this->response.error(ERROR__NO_RESPONSE);
-						}
-					}
-					else {
-						this->response.error(ERROR__WRONG_PAYLOAD_LENGTH);
+					// execute callback function
+					action.call(this->response, Interface::getPayload());
+					
+					if (!this->response.triggered) {
+						this->response.error(ERROR__NO_RESPONSE);
 					}
-					break;
+				}
+				else {
+					this->response.error(ERROR__WRONG_PAYLOAD_LENGTH);
 				}
 			}
 			
@@ -128,3 +131,49 @@ xpcc::sab::Slave<Interface>::send(bool acknowledge,
 	Interface::sendMessage(this->ownAddress, flags, this->currentCommand,
 			payload, payloadLength);
 }
+
+// ----------------------------------------------------------------------------
+template <typename Interface>
+bool
+xpcc::sab::Slave<Interface>::findAction(uint8_t command, Action& action)
+{
+	if (actionListSorted)
+	{
+		uint_fast8_t low = 0;
+		uint_fast8_t high = actionCount;
+		while (low < high)
+		{
+			uint_fast8_t middle = (low + high) / 2;
+			uint8_t current = getCommand(actionList, middle);
+			if (current < command) {
+				low = middle + 1;
+			}
+			else if (current > command) {
+				high = middle;
+			}
+			else {
+				action = actionList[middle];
+				return true;
+			}
+		}
+	}
+	else
+	{
+		for (uint_fast8_t i = 0; i < actionCount; ++i)
+		{
+			if (getCommand(actionList, i) == command) {
+				action = actionList[i];
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+template <typename Interface>
+uint8_t
+xpcc::sab::Slave<Interface>::getCommand(xpcc::accessor::Flash<Action> list, uint8_t index)
+{
+	// read only the command from flash, not the whole action
+	return xpcc::accessor::asFlash(&list.getPointer()[index].command)[0];
+}
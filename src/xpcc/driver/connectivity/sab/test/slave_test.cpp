@@ -103,6 +103,23 @@ namespace
 		SAB__ACTION(0x03, testingObject, TestingObject::errorFunction, 0),
 		SAB__ACTION(0x04, testingObject, TestingObject::parameterFunction, 2),
 	};
+	
+	#define	SORTED_ACTIONS(ACTION) \
+		ACTION(0x02, testingObject, TestingObject::responseFunction, 0), \
+		ACTION(0x10, testingObject, TestingObject::emptyFunction, 0), \
+		ACTION(0x11, testingObject, TestingObject::errorFunction, 0), \
+		ACTION(0x40, testingObject, TestingObject::parameterFunction, 2), \
+		ACTION(0xf0, testingObject, TestingObject::emptyFunction, 0)
+	
+	SAB__ACTION_TABLE(sortedActionList, SORTED_ACTIONS);
+	
+	FLASH_STORAGE(xpcc::sab::Action unsortedActionList[]) =
+	{
+		SAB__ACTION(0x40, testingObject, TestingObject::parameterFunction, 2),
+		SAB__ACTION(0x11, testingObject, TestingObject::errorFunction, 0),
+		SAB__ACTION(0x02, testingObject, TestingObject::responseFunction, 0),
+		SAB__ACTION(0x10, testingObject, TestingObject::emptyFunction, 0),
+	};
 }
 
 // ----------------------------------------------------------------------------
@@ -267,3 +284,101 @@ SlaveTest::testNoMethod()
 	TEST_ASSERT_EQUALS(TestingInterface::getCommand(), 0x05);
 	TEST_ASSERT_EQUALS(TestingInterface::getPayloadLength(), 1);
 }
+
+// ----------------------------------------------------------------------------
+void
+SlaveTest::testSortedTable()
+{
+	TestingSlave sortedSlave(0x3f,
+			xpcc::accessor::asFlash(sortedActionList),
+			sizeof(sortedActionList) / sizeof(xpcc::sab::Action));
+	
+	const uint8_t commands[] = { 0x02, 0x10, 0x11, 0x40, 0xf0 };
+	const TestingObject::FunctionCode called[] = {
+		TestingObject::RESPONSE, TestingObject::EMPTY, TestingObject::ERROR,
+		TestingObject::PARAMETER, TestingObject::EMPTY };
+	
+	for (uint8_t i = 0; i < sizeof(commands); ++i)
+	{
+		testingObject.reset();
+		
+		uint16_t value = 0x1234;
+		TestingInterface::sendMessage(0x3f, xpcc::sab::REQUEST, commands[i], value);
+		FakeIODevice::moveSendToReceiveBuffer();
+		sortedSlave.update();
+		
+		if (commands[i] == 0x40) {
+			TEST_ASSERT_EQUALS(testingObject.calledFunction, TestingObject::PARAMETER);
+			TEST_ASSERT_EQUALS(testingObject.receivedParameter, value);
+		}
+		else {
+			// wrong payload length, the action is found but not called
+			TEST_ASSERT_EQUALS(testingObject.calledFunction, TestingObject::NONE);
+		}
+		FakeIODevice::reset();
+		
+		TestingInterface::sendMessage(0x3f, xpcc::sab::REQUEST, commands[i]);
+		FakeIODevice::moveSendToReceiveBuffer();
+		sortedSlave.update();
+		
+		if (commands[i] != 0x40) {
+			TEST_ASSERT_EQUALS(testingObject.calledFunction, called[i]);
+		}
+		FakeIODevice::reset();
+	}
+	
+	// commands between and around the entries must not match
+	const uint8_t missing[] = { 0x00, 0x01, 0x03, 0x12, 0x3f, 0x41, 0xef, 0xff };
+	for (uint8_t i = 0; i < sizeof(missing); ++i)
+	{
+		testingObject.reset();
+		
+		TestingInterface::sendMessage(0x3f, xpcc::sab::REQUEST, missing[i]);
+		FakeIODevice::moveSendToReceiveBuffer();
+		sortedSlave.update();
+		
+		TEST_ASSERT_EQUALS(testingObject.calledFunction, TestingObject::NONE);
+		
+		FakeIODevice::moveSendToReceiveBuffer();
+		TestingInterface::update();
+		
+		TEST_ASSERT_TRUE(TestingInterface::isMessageAvailable());
+		TEST_ASSERT_FALSE(TestingInterface::isAcknowledge());
+		TEST_ASSERT_EQUALS(TestingInterface::getCommand(), missing[i]);
+		TEST_ASSERT_EQUALS(TestingInterface::getPayload()[0], xpcc::sab::ERROR__NO_ACTION);
+		
+		TestingInterface::dropMessage();
+		FakeIODevice::reset();
+	}
+}
+
+void
+SlaveTest::testUnsortedList()
+{
+	TestingSlave unsortedSlave(0x3f,
+			xpcc::accessor::asFlash(unsortedActionList),
+			sizeof(unsortedActionList) / sizeof(xpcc::sab::Action));
+	
+	const uint8_t commands[] = { 0x02, 0x10, 0x11 };
+	const TestingObject::FunctionCode called[] = {
+		TestingObject::RESPONSE, TestingObject::EMPTY, TestingObject::ERROR };
+	
+	for (uint8_t i = 0; i < sizeof(commands); ++i)
+	{
+		testingObject.reset();
+		
+		TestingInterface::sendMessage(0x3f, xpcc::sab::REQUEST, commands[i]);
+		FakeIODevice::moveSendToReceiveBuffer();
+		unsortedSlave.update();
+		
+		TEST_ASSERT_EQUALS(testingObject.calledFunction, called[i]);
+		FakeIODevice::reset();
+	}
+	
+	testingObject.reset();
+	TestingInterface::sendMessage(0x3f, xpcc::sab::REQUEST, 0x03);
+	FakeIODevice::moveSendToReceiveBuffer();
+	unsortedSlave.update();
+	
+	TEST_ASSERT_EQUALS(testingObject.calledFunction, TestingObject::NONE);
+}
@@ -61,6 +61,12 @@ public:
 	void
 	testNoMethod();
 	
+	void
+	testSortedTable();
+	
+	void
+	testUnsortedList();
+	
 	
 protected:
 	typedef xpcc::sab::Interface< FakeIODevice > TestingInterface;
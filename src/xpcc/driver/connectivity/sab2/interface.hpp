@@ -36,6 +36,7 @@
 
 #include <xpcc/architecture/utils.hpp>
 #include <xpcc/utils/template_metaprogramming.hpp>
+#include <xpcc/math/utils/crc.hpp>
 
 #include "constants.hpp"
 
@@ -50,6 +51,13 @@ namespace xpcc
 		uint16_t
 		crcUpdate(uint16_t crc, uint8_t data);
 		
+		/**
+		 * \internal
+		 * \brief	CRC of the frames
+		 * \ingroup	sab2
+		 */
+		typedef xpcc::Crc16Ibm Crc;
+		
 		/**
 		 * \brief	SAB2 interface
 		 * 
@@ -165,7 +173,6 @@ namespace xpcc
 			writeByteEscaped(uint8_t data);
 			
 			static uint8_t buffer[N + 4];
-			static uint16_t crc;
 			static Size length;
 			static Size lengthOfReceivedMessage;
 			static bool nextEscaped;
@@ -40,7 +40,6 @@
 
 // ----------------------------------------------------------------------------
 template <typename Device, std::size_t N> uint8_t xpcc::sab2::Interface<Device, N>::buffer[N + 4];
-template <typename Device, std::size_t N> uint16_t xpcc::sab2::Interface<Device, N>::crc = crcInitialValue;
 
 template <typename Device, std::size_t N> typename xpcc::sab2::Interface<Device, N>::Size \
 	xpcc::sab2::Interface<Device, N>::length;
@@ -65,19 +64,19 @@ xpcc::sab2::Interface<Device, N>::sendMessage(uint8_t address, Flags flags,
 		uint8_t command,
 		const void *payload, Size payloadLength)
 {
-	uint16_t crcSend = crcInitialValue;
+	const uint8_t header[2] = { uint8_t(address | flags), command };
+	
+	uint16_t crcSend = Crc::update(crcInitialValue, header, sizeof(header));
+	crcSend = Crc::update(crcSend, payload, payloadLength);
 	
 	Device::write(frameBounderyByte);
 	
-	writeByteEscaped(address | flags);
-	crcSend = crcUpdate(crcSend, address | flags);
-	writeByteEscaped(command);
-	crcSend = crcUpdate(crcSend, command);
+	writeByteEscaped(header[0]);
+	writeByteEscaped(header[1]);
 	
 	const uint8_t *ptr = static_cast<const uint8_t *>(payload);
 	for (uint_fast8_t i = 0; i < payloadLength; ++i)
 	{
-		crcSend = crcUpdate(crcSend, *ptr);
 		writeByteEscaped(*ptr);
 		ptr++;
 	}
@@ -182,6 +181,8 @@ xpcc::sab2::Interface<Device, N>::update()
 			}
 			else {
 				if (length >= 4) {
+					// check the complete frame at once
+					const uint16_t crc = Crc::update(crcInitialValue, buffer, length);
 					if (crc == 0) {
 						lengthOfReceivedMessage = length;
 					}
@@ -191,7 +192,6 @@ xpcc::sab2::Interface<Device, N>::update()
 				}
 			}
 			
-			crc = crcInitialValue;
 			length = 0;
 			nextEscaped = false;
 		}
@@ -214,8 +214,6 @@ xpcc::sab2::Interface<Device, N>::update()
 			else {
 				buffer[length] = data;
 				length += 1;
-				
-				crc = crcUpdate(crc, data);
 			}
 		}
 	}
@@ -31,6 +31,7 @@
 #ifndef XPCC__ADXL345_HPP
 #define XPCC__ADXL345_HPP
 
+#include <xpcc/architecture/driver/clock.hpp>
 #include <xpcc/driver/connectivity/i2c/write_read_adapter.hpp>
 
 namespace xpcc
@@ -137,11 +138,29 @@ namespace xpcc
 			FIFO_CTL_MODE_FIFO = 0x40,
 			FIFO_CTL_MODE_BYPASS = 0x00,
 			FIFO_CTL_TRIGGER = 0x20,
-			FIFO_CTL_SAMPLES_gm = 0x0f,
+			FIFO_CTL_SAMPLES_gm = 0x1f,
 			// FIFO_STATUS register
 			FIFO_STATUS_TRIG = 0x80,
 			FIFO_STATUS_ENTRIES_gm = 0x3f
 		};
+		
+		/// Size of the FIFO including the data registers
+		static const uint8_t FIFO_SIZE = 33;
+		
+		/// One sample read from the FIFO
+		struct FifoSample
+		{
+			/**
+			 * Microseconds since Adxl345::configureFifo()
+			 * 
+			 * Wraps around after about 71.6 minutes, use the unsigned
+			 * difference of two values to get the time between them.
+			 */
+			uint32_t time;
+			
+			/// x, y, z (LSB first)
+			uint8_t data[6];
+		};
 	}
 	
 	/**
@@ -190,6 +209,19 @@ namespace xpcc
 		bool
 		configure(adxl345::Bandwidth bandwidth=adxl345::BANDWIDTH_50HZ, bool streamMode=false, bool enableInterrupt=true);
 		
+		/**
+		 * Switches the FIFO to Stream Mode and sets the watermark.
+		 * 
+		 * With \p enableInterrupt the watermark interrupt replaces the
+		 * data ready interrupt. Call configure() first, the output data
+		 * rate is needed for the timestamps of the samples.
+		 * 
+		 * \param	watermark	number of samples which trigger the
+		 * 						watermark interrupt (up to 31)
+		 */
+		bool
+		configureFifo(uint8_t watermark=16, bool enableInterrupt=true);
+		
 		/**
 		 * read the X-ZDATA0-1 registers and buffer the results
 		 * sets isNewDataAvailable() to \c true
@@ -197,6 +229,34 @@ namespace xpcc
 		void
 		readAccelerometer();
 		
+		/**
+		 * Read all samples stored in the FIFO, but at most \p size.
+		 * 
+		 * All samples are read in one bus transaction, every sample
+		 * with its own burst read of the data registers, chained by
+		 * repeated starts. Call this after the watermark interrupt or
+		 * regularly at least every 32 samples.
+		 * 
+		 * The time of the newest sample is taken from xpcc::Clock when
+		 * the number of stored samples is read. The times of the older
+		 * samples are calculated backwards from the output data rate.
+		 * 
+		 * Sets isNewFifoDataAvailable() to \c true when finished.
+		 * 
+		 * \param	samples	buffer for up to adxl345::FIFO_SIZE samples
+		 * \return	\c false if a FIFO read is already in progress
+		 */
+		bool
+		readFifo(adxl345::FifoSample* samples, uint8_t size=adxl345::FIFO_SIZE);
+		
+		/// \c true, when readFifo() has finished
+		bool
+		isNewFifoDataAvailable();
+		
+		/// Number of samples stored by the last readFifo()
+		uint8_t
+		getFifoCount();
+		
 		/// \return pointer to 8bit array containing xyz accelerations
 		/// Use reinterpret_cast<int16*>(&getData()) to get the results.
 		/// Devide by approx. 256 LSB/g to get the data in gravity.
@@ -238,17 +298,103 @@ namespace xpcc
 		uint8_t
 		readRegister(adxl345::Register reg);
 		
+		/**
+		 * Reads the number of stored samples from FIFO_STATUS, then the
+		 * data registers once per sample.
+		 */
+		class FifoReader : public xpcc::i2c::Delegate
+		{
+		public:
+			FifoReader(uint8_t address);
+			
+			bool
+			initialize(adxl345::FifoSample* samples, uint8_t size);
+			
+			xpcc::i2c::adapter::State
+			getState()
+			{
+				return state;
+			}
+			
+			/// Number of complete samples
+			uint8_t
+			getCount()
+			{
+				return count;
+			}
+			
+			/// Time when the number of stored samples was read
+			xpcc::Timestamp
+			getTimestamp()
+			{
+				return timestamp;
+			}
+			
+			virtual bool
+			attaching();
+			
+			virtual Starting
+			started();
+			
+			virtual Writing
+			writing();
+			
+			virtual Reading
+			reading();
+			
+			virtual void
+			stopped(DetachCause cause);
+			
+		private:
+			enum Phase
+			{
+				START,
+				STATUS_WRITE,
+				STATUS_READ,
+				SAMPLE_WRITE,
+				SAMPLE_READ,
+			};
+			
+			uint8_t address;
+			uint8_t reg;
+			uint8_t fifoStatus;
+			Phase phase;
+			
+			adxl345::FifoSample* samples;
+			uint8_t size;
+			uint8_t count;
+			uint8_t index;
+			
+			xpcc::Timestamp timestamp;
+			volatile xpcc::i2c::adapter::State state;
+		};
+		
 		xpcc::i2c::WriteReadAdapter adapter;
+		FifoReader fifo;
 		
 		enum Status {
 			READ_ACCELEROMETER_PENDING = 0x01,
 			READ_ACCELEROMETER_RUNNING = 0x02,
 			NEW_ACCELEROMETER_DATA = 0x04,
+			READ_FIFO_PENDING = 0x08,
+			READ_FIFO_RUNNING = 0x10,
+			NEW_FIFO_DATA = 0x20,
 		};
 		
 		uint8_t status;
 		uint8_t* data;
 		uint8_t buffer[2];
+		
+		/// BW_RATE code, determines the output data rate
+		uint8_t rate;
+		
+		adxl345::FifoSample* fifoSamples;
+		uint8_t fifoSize;
+		
+		/// Time of the last FIFO read in microseconds since configureFifo(),
+		/// wraps around modulo 2^32
+		uint32_t fifoTime;
+		xpcc::Timestamp fifoTimestamp;
 	};
 	
 }
@@ -35,7 +35,8 @@
 // ----------------------------------------------------------------------------
 template < typename I2cMaster >
 xpcc::Adxl345<I2cMaster>::Adxl345(uint8_t* data, uint8_t address)
-:	status(0), data(data)
+:	fifo(address), status(0), data(data), rate(adxl345::BANDWIDTH_50HZ),
+	fifoSamples(0), fifoSize(0), fifoTime(0)
 {
 	adapter.initialize(address << 1, buffer, 0, data, 0);
 }
@@ -44,6 +45,8 @@ template < typename I2cMaster >
 bool
 xpcc::Adxl345<I2cMaster>::configure(adxl345::Bandwidth bandwidth, bool streamMode, bool enableInterrupt)
 {
+	rate = bandwidth;
+	
 	bool ok = writeRegister(adxl345::REGISTER_POWER_CTL, adxl345::POWER_MEASURE);
 	ok &= writeRegister(adxl345::REGISTER_DATA_FORMAT, adxl345::DATAFORMAT_FULL_RES);
 	ok &= writeRegister(adxl345::REGISTER_BW_RATE, bandwidth);
@@ -52,6 +55,19 @@ xpcc::Adxl345<I2cMaster>::configure(adxl345::Bandwidth bandwidth, bool streamMod
 	return ok;
 }
 
+template < typename I2cMaster >
+bool
+xpcc::Adxl345<I2cMaster>::configureFifo(uint8_t watermark, bool enableInterrupt)
+{
+	bool ok = writeRegister(adxl345::REGISTER_FIFO_CTL,
+			adxl345::FIFO_CTL_MODE_STREAM | (watermark & adxl345::FIFO_CTL_SAMPLES_gm));
+	if (enableInterrupt) ok &= writeRegister(adxl345::REGISTER_INT_ENABLE, adxl345::INTERRUPT_WATERMARK);
+	
+	fifoTime = 0;
+	fifoTimestamp = xpcc::Clock::now();
+	return ok;
+}
+
 template < typename I2cMaster >
 void
 xpcc::Adxl345<I2cMaster>::readAccelerometer()
@@ -59,6 +75,34 @@ xpcc::Adxl345<I2cMaster>::readAccelerometer()
 	status |= READ_ACCELEROMETER_PENDING;
 }
 
+template < typename I2cMaster >
+bool
+xpcc::Adxl345<I2cMaster>::readFifo(adxl345::FifoSample* samples, uint8_t size)
+{
+	if (status & (READ_FIFO_PENDING | READ_FIFO_RUNNING)) {
+		return false;
+	}
+	fifoSamples = samples;
+	fifoSize = size;
+	status |= READ_FIFO_PENDING;
+	return true;
+}
+
+template < typename I2cMaster >
+bool
+xpcc::Adxl345<I2cMaster>::isNewFifoDataAvailable()
+{
+	return status & NEW_FIFO_DATA;
+}
+
+template < typename I2cMaster >
+uint8_t
+xpcc::Adxl345<I2cMaster>::getFifoCount()
+{
+	status &= ~NEW_FIFO_DATA;
+	return fifo.getCount();
+}
+
 template < typename I2cMaster >
 bool
 xpcc::Adxl345<I2cMaster>::isDataReady()
@@ -100,6 +144,36 @@ xpcc::Adxl345<I2cMaster>::update()
 			status |= READ_ACCELEROMETER_RUNNING;
 		}
 	}
+	
+	if (status & READ_FIFO_RUNNING)
+	{
+		if (fifo.getState() != xpcc::i2c::adapter::BUSY)
+		{
+			// the samples are 2^(15 - rate) / 3200 s apart, the newest
+			// one is assumed to be taken when the FIFO status was read
+			xpcc::Timestamp now = fifo.getTimestamp();
+			fifoTime += static_cast<uint32_t>((now - fifoTimestamp).getTime()) * 1000;
+			fifoTimestamp = now;
+			
+			uint8_t count = fifo.getCount();
+			uint8_t shift = adxl345::BANDWIDTH_1600HZ - (rate & 0x0f);
+			for (uint8_t i = 0; i < count; ++i)
+			{
+				uint32_t age = ((static_cast<uint32_t>(count - 1 - i) * 625) << shift) / 2;
+				fifoSamples[i].time = fifoTime - age;
+			}
+			
+			status &= ~READ_FIFO_RUNNING;
+			status |= NEW_FIFO_DATA;
+		}
+	}
+	else if (status & READ_FIFO_PENDING)
+	{
+		if (fifo.initialize(fifoSamples, fifoSize) && I2cMaster::start(&fifo)) {
+			status &= ~READ_FIFO_PENDING;
+			status |= READ_FIFO_RUNNING;
+		}
+	}
 }
 
 // ----------------------------------------------------------------------------
@@ -130,3 +204,143 @@ xpcc::Adxl345<I2cMaster>::readRegister(adxl345::Register reg)
 	return buffer[0];
 }
 
+
+// ----------------------------------------------------------------------------
+template < typename I2cMaster >
+xpcc::Adxl345<I2cMaster>::FifoReader::FifoReader(uint8_t address)
+:	address(address << 1), reg(0), fifoStatus(0), phase(START),
+	samples(0), size(0), count(0), index(0), state(xpcc::i2c::adapter::NO_ERROR)
+{
+}
+
+template < typename I2cMaster >
+bool
+xpcc::Adxl345<I2cMaster>::FifoReader::initialize(adxl345::FifoSample* samples, uint8_t size)
+{
+	if (state == xpcc::i2c::adapter::BUSY) {
+		return false;
+	}
+	this->samples = samples;
+	this->size = size;
+	this->count = 0;
+	return true;
+}
+
+template < typename I2cMaster >
+bool
+xpcc::Adxl345<I2cMaster>::FifoReader::attaching()
+{
+	if (state == xpcc::i2c::adapter::BUSY) {
+		return false;
+	}
+	state = xpcc::i2c::adapter::BUSY;
+	phase = START;
+	count = 0;
+	index = 0;
+	timestamp = xpcc::Clock::now();
+	return true;
+}
+
+template < typename I2cMaster >
+xpcc::i2c::Delegate::Starting
+xpcc::Adxl345<I2cMaster>::FifoReader::started()
+{
+	Starting s;
+	s.address = address;
+	
+	switch (phase)
+	{
+		case START:
+			phase = STATUS_WRITE;
+			s.next = WRITE_OP;
+			break;
+		
+		case STATUS_WRITE:
+			phase = STATUS_READ;
+			s.next = READ_OP;
+			break;
+		
+		case STATUS_READ:
+			timestamp = xpcc::Clock::now();
+			count = fifoStatus & adxl345::FIFO_STATUS_ENTRIES_gm;
+			if (count > size) {
+				count = size;
+			}
+			
+			if (count == 0) {
+				s.next = STOP_OP;
+			}
+			else {
+				phase = SAMPLE_WRITE;
+				s.next = WRITE_OP;
+			}
+			break;
+		
+		case SAMPLE_WRITE:
+			phase = SAMPLE_READ;
+			s.next = READ_OP;
+			break;
+		
+		case SAMPLE_READ:
+			// the FIFO has moved the next sample into the data registers
+			index++;
+			phase = SAMPLE_WRITE;
+			s.next = WRITE_OP;
+			break;
+	}
+	return s;
+}
+
+template < typename I2cMaster >
+xpcc::i2c::Delegate::Writing
+xpcc::Adxl345<I2cMaster>::FifoReader::writing()
+{
+	reg = (phase == STATUS_WRITE) ? adxl345::REGISTER_FIFO_STATUS : adxl345::REGISTER_DATA_X0;
+	
+	Writing w;
+	w.buffer = &reg;
+	w.size = 1;
+	w.next = WRITE_RESTART;
+	return w;
+}
+
+template < typename I2cMaster >
+xpcc::i2c::Delegate::Reading
+xpcc::Adxl345<I2cMaster>::FifoReader::reading()
+{
+	Reading r;
+	if (phase == STATUS_READ)
+	{
+		r.buffer = &fifoStatus;
+		r.size = 1;
+		r.next = READ_RESTART;
+	}
+	else
+	{
+		// all six data registers have to be read to pop the FIFO
+		r.buffer = samples[index].data;
+		r.size = 6;
+		r.next = (index + 1 < count) ? READ_RESTART : READ_STOP;
+	}
+	return r;
+}
+
+template < typename I2cMaster >
+void
+xpcc::Adxl345<I2cMaster>::FifoReader::stopped(DetachCause cause)
+{
+	if (cause == NORMAL_STOP) {
+		state = xpcc::i2c::adapter::NO_ERROR;
+	}
+	else
+	{
+		// only the samples read before the error are valid
+		if (phase == SAMPLE_WRITE || phase == SAMPLE_READ) {
+			count = index;
+		}
+		else {
+			count = 0;
+		}
+		state = xpcc::i2c::adapter::ERROR;
+	}
+}
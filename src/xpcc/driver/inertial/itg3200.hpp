@@ -107,6 +107,10 @@ namespace xpcc
 	/**
 	 * \brief Basic ITG3200 digital gyroscope sensor driver
 	 *
+	 * The ITG3200 has no FIFO. At high sample rates use the data ready
+	 * interrupt and readTemperatureGyroscope(), which reads temperature
+	 * and rotation with a single 8 byte burst.
+	 *
 	 * For further information on the special sensing functions, consult the
 	 * <a href="http://invensense.com/mems/gyro/documents/PS-ITG-3200-00-01.4.pdf">
 	 * datasheet</a>.
@@ -0,0 +1,305 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/driver/connectivity/i2c/mock_master.hpp>
+#include <xpcc/architecture/driver/test/testing_clock.hpp>
+
+#include "../adxl345.hpp"
+
+#include "adxl345_test.hpp"
+
+typedef xpcc::i2c::MockMaster Master;
+
+namespace
+{
+	/**
+	 * Register model of the ADXL345. Reading the last data register
+	 * moves the next sample from the FIFO into the data registers.
+	 */
+	class Adxl345Model : public Master::Slave
+	{
+	public:
+		Adxl345Model() :
+			pointer(0), entries(0), selections(0)
+		{
+			for (uint_fast8_t i = 0; i < sizeof(registers); ++i) {
+				registers[i] = 0;
+			}
+		}
+		
+		virtual bool
+		selected(uint8_t address)
+		{
+			selections++;
+			return (address == 0x1d);
+		}
+		
+		virtual void
+		write(const uint8_t *data, std::size_t size)
+		{
+			pointer = data[0];
+			for (std::size_t i = 1; i < size; ++i) {
+				registers[pointer++] = data[i];
+			}
+		}
+		
+		virtual void
+		read(uint8_t *data, std::size_t size)
+		{
+			bool pop = false;
+			for (std::size_t i = 0; i < size; ++i, ++pointer)
+			{
+				if (pointer == xpcc::adxl345::REGISTER_FIFO_STATUS) {
+					data[i] = entries;
+				}
+				else if (pointer >= xpcc::adxl345::REGISTER_DATA_X0 &&
+						pointer <= xpcc::adxl345::REGISTER_DATA_Z1)
+				{
+					data[i] = fifo[0][pointer - xpcc::adxl345::REGISTER_DATA_X0];
+					pop |= (pointer == xpcc::adxl345::REGISTER_DATA_Z1);
+				}
+				else {
+					data[i] = registers[pointer];
+				}
+			}
+			
+			if (pop && entries > 0)
+			{
+				entries--;
+				for (uint_fast8_t k = 0; k < entries; ++k) {
+					for (uint_fast8_t j = 0; j < 6; ++j) {
+						fifo[k][j] = fifo[k + 1][j];
+					}
+				}
+			}
+		}
+		
+		/// Sample n has the values x = n, y = -n, z = 1000 + n
+		void
+		fill(uint8_t count)
+		{
+			for (uint_fast8_t n = 0; n < count; ++n)
+			{
+				int16_t values[3] = { n, static_cast<int16_t>(-n), static_cast<int16_t>(1000 + n) };
+				for (uint_fast8_t j = 0; j < 3; ++j)
+				{
+					fifo[entries][2*j] = values[j] & 0xff;
+					fifo[entries][2*j + 1] = static_cast<uint16_t>(values[j]) >> 8;
+				}
+				entries++;
+			}
+		}
+		
+		uint8_t registers[0x40];
+		uint8_t pointer;
+		
+		uint8_t fifo[xpcc::adxl345::FIFO_SIZE][6];
+		uint8_t entries;
+		
+		uint8_t selections;
+	};
+	
+	int16_t
+	axis(const xpcc::adxl345::FifoSample& sample, uint8_t axis)
+	{
+		return static_cast<int16_t>(sample.data[2*axis] | (sample.data[2*axis + 1] << 8));
+	}
+	
+	/// Start the transfer and evaluate the result
+	void
+	drain(xpcc::Adxl345<Master>& sensor)
+	{
+		sensor.update();
+		sensor.update();
+	}
+	
+	Adxl345Model model;
+	uint8_t data[6];
+	xpcc::adxl345::FifoSample samples[xpcc::adxl345::FIFO_SIZE];
+}
+
+void
+Adxl345Test::setUp()
+{
+	TestingClock::time = 0;
+	model = Adxl345Model();
+	
+	Master::initialize(Master::DEVICE_PRESENT, Master::AUTO_MODE);
+	Master::attachSlave(&model);
+}
+
+void
+Adxl345Test::tearDown()
+{
+	Master::attachSlave(0);
+}
+
+// ----------------------------------------------------------------------------
+void
+Adxl345Test::testConfigureFifo()
+{
+	xpcc::Adxl345<Master> sensor(data);
+	
+	TEST_ASSERT_TRUE(sensor.configure(xpcc::adxl345::BANDWIDTH_1600HZ, false, false));
+	TEST_ASSERT_TRUE(sensor.configureFifo(20));
+	
+	TEST_ASSERT_EQUALS(model.registers[xpcc::adxl345::REGISTER_BW_RATE], 0x0fU);
+	TEST_ASSERT_EQUALS(model.registers[xpcc::adxl345::REGISTER_FIFO_CTL], 0x80U | 20);
+	TEST_ASSERT_EQUALS(model.registers[xpcc::adxl345::REGISTER_INT_ENABLE],
+			static_cast<uint8_t>(xpcc::adxl345::INTERRUPT_WATERMARK));
+}
+
+void
+Adxl345Test::testReadFifo()
+{
+	xpcc::Adxl345<Master> sensor(data);
+	sensor.configure(xpcc::adxl345::BANDWIDTH_1600HZ, false, false);
+	sensor.configureFifo(20);
+	
+	model.fill(20);
+	model.selections = 0;
+	
+	TEST_ASSERT_TRUE(sensor.readFifo(samples));
+	TEST_ASSERT_FALSE(sensor.isNewFifoDataAvailable());
+	drain(sensor);
+	
+	TEST_ASSERT_TRUE(sensor.isNewFifoDataAvailable());
+	TEST_ASSERT_EQUALS(sensor.getFifoCount(), 20U);
+	TEST_ASSERT_FALSE(sensor.isNewFifoDataAvailable());
+	TEST_ASSERT_EQUALS(model.entries, 0U);
+	
+	// status read plus one burst read per sample
+	TEST_ASSERT_EQUALS(model.selections, 2U + 2 * 20);
+	
+	for (uint_fast8_t n = 0; n < 20; ++n)
+	{
+		TEST_ASSERT_EQUALS(axis(samples[n], 0), n);
+		TEST_ASSERT_EQUALS(axis(samples[n], 1), -n);
+		TEST_ASSERT_EQUALS(axis(samples[n], 2), 1000 + n);
+	}
+}
+
+void
+Adxl345Test::testReadFifoLimited()
+{
+	xpcc::Adxl345<Master> sensor(data);
+	sensor.configure(xpcc::adxl345::BANDWIDTH_1600HZ, false, false);
+	sensor.configureFifo(31);
+	
+	model.fill(xpcc::adxl345::FIFO_SIZE);
+	
+	TEST_ASSERT_TRUE(sensor.readFifo(samples, 10));
+	drain(sensor);
+	TEST_ASSERT_EQUALS(sensor.getFifoCount(), 10U);
+	TEST_ASSERT_EQUALS(model.entries, 23U);
+	
+	// the next read continues with the oldest remaining sample
+	TEST_ASSERT_TRUE(sensor.readFifo(samples));
+	drain(sensor);
+	TEST_ASSERT_EQUALS(sensor.getFifoCount(), 23U);
+	TEST_ASSERT_EQUALS(axis(samples[0], 0), 10);
+	TEST_ASSERT_EQUALS(axis(samples[22], 0), 32);
+}
+
+void
+Adxl345Test::testReadEmptyFifo()
+{
+	xpcc::Adxl345<Master> sensor(data);
+	sensor.configure(xpcc::adxl345::BANDWIDTH_1600HZ, false, false);
+	sensor.configureFifo(16);
+	
+	model.selections = 0;
+	TEST_ASSERT_TRUE(sensor.readFifo(samples));
+	drain(sensor);
+	
+	TEST_ASSERT_TRUE(sensor.isNewFifoDataAvailable());
+	TEST_ASSERT_EQUALS(sensor.getFifoCount(), 0U);
+	
+	// status write, status read and the stop after the address
+	TEST_ASSERT_EQUALS(model.selections, 3U);
+}
+
+void
+Adxl345Test::testReadFifoError()
+{
+	xpcc::Adxl345<Master> sensor(data);
+	sensor.configure(xpcc::adxl345::BANDWIDTH_1600HZ, false, false);
+	sensor.configureFifo(16);
+	model.fill(5);
+	
+	Master::initialize(Master::DEVICE_MISSING, Master::AUTO_MODE);
+	TEST_ASSERT_TRUE(sensor.readFifo(samples));
+	
+	// a second read is refused until the first one has finished
+	TEST_ASSERT_FALSE(sensor.readFifo(samples));
+	drain(sensor);
+	
+	TEST_ASSERT_TRUE(sensor.isNewFifoDataAvailable());
+	TEST_ASSERT_EQUALS(sensor.getFifoCount(), 0U);
+	TEST_ASSERT_EQUALS(model.entries, 5U);
+	
+	Master::initialize(Master::DEVICE_PRESENT, Master::AUTO_MODE);
+	TEST_ASSERT_TRUE(sensor.readFifo(samples));
+	drain(sensor);
+	TEST_ASSERT_EQUALS(sensor.getFifoCount(), 5U);
+}
+
+void
+Adxl345Test::testTimestamps()
+{
+	xpcc::Adxl345<Master> sensor(data);
+	
+	// 3200 Hz output data rate: 312.5 us per sample
+	sensor.configure(xpcc::adxl345::BANDWIDTH_1600HZ, false, false);
+	sensor.configureFifo(16);
+	
+	model.fill(20);
+	TestingClock::time = 100;
+	sensor.readFifo(samples);
+	drain(sensor);
+	TEST_ASSERT_EQUALS(sensor.getFifoCount(), 20U);
+	
+	TEST_ASSERT_EQUALS(samples[19].time, 100000U);
+	TEST_ASSERT_EQUALS(samples[18].time, 100000U - 312);
+	TEST_ASSERT_EQUALS(samples[17].time, 100000U - 625);
+	TEST_ASSERT_EQUALS(samples[0].time, 100000U - 5937);
+	
+	// 100 Hz output data rate
+	sensor.configure(xpcc::adxl345::BANDWIDTH_50HZ, false, false);
+	model.fill(3);
+	TestingClock::time = 150;
+	sensor.readFifo(samples);
+	drain(sensor);
+	TEST_ASSERT_EQUALS(sensor.getFifoCount(), 3U);
+	
+	TEST_ASSERT_EQUALS(samples[2].time, 150000U);
+	TEST_ASSERT_EQUALS(samples[1].time, 140000U);
+	TEST_ASSERT_EQUALS(samples[0].time, 130000U);
+}
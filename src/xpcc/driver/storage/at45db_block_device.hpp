@@ -0,0 +1,103 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__AT45DB_BLOCK_DEVICE_HPP
+#define XPCC__AT45DB_BLOCK_DEVICE_HPP
+
+#include "at45db0x1d.hpp"
+#include "block_device.hpp"
+
+namespace xpcc
+{
+	/**
+	 * \brief	Block device for the Atmel DataFlash
+	 * 
+	 * Blocks are the 256 byte pages of the DataFlash. The two SRAM
+	 * buffers of the device are used alternately: the next page is
+	 * transferred into one buffer while the other one is still
+	 * programmed into the memory. Sequential page writes therefore only
+	 * wait for the programming time (14-35ms), the SPI transfer is free.
+	 * 
+	 * Pages which are still available in one of the buffers are read
+	 * from there.
+	 * 
+	 * \tparam	Pages	Number of pages: 512 (AT45DB011D), 1024 (AT45DB021D),
+	 * 					2048 (AT45DB041D) or 4096 (AT45DB081D)
+	 * 
+	 * \see		At45db0x1d
+	 * \ingroup	storage
+	 */
+	template <typename Spi, typename Cs, uint16_t Pages>
+	class At45dbBlockDevice : public BlockDevice
+	{
+	public:
+		static const uint16_t PAGE_SIZE = 256;
+		
+	public:
+		At45dbBlockDevice();
+		
+		virtual bool
+		initialize();
+		
+		virtual uint16_t
+		getBlockSize() const;
+		
+		virtual uint32_t
+		getBlockCount() const;
+		
+		virtual bool
+		read(uint32_t block, uint8_t *data, uint32_t count);
+		
+		virtual bool
+		write(uint32_t block, const uint8_t *data, uint32_t count);
+		
+		virtual bool
+		flush();
+		
+	private:
+		typedef At45db0x1d<Spi, Cs> Flash;
+		
+		static const uint16_t NO_PAGE = 0xffff;
+		
+		/// Buffer which contains \p page, -1 if none
+		int_fast8_t
+		findBuffer(uint16_t page) const;
+		
+		/// Page stored in the buffers
+		uint16_t bufferPage[2];
+		
+		/// Buffer used for the next write
+		at45db::Buffer nextBuffer;
+	};
+}
+
+#include "at45db_block_device_impl.hpp"
+
+#endif // XPCC__AT45DB_BLOCK_DEVICE_HPP
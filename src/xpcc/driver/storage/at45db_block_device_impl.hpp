@@ -0,0 +1,165 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__AT45DB_BLOCK_DEVICE_HPP
+	#error	"Don't include this file directly, use 'at45db_block_device.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename Spi, typename Cs, uint16_t Pages>
+xpcc::At45dbBlockDevice<Spi, Cs, Pages>::At45dbBlockDevice() :
+	nextBuffer(at45db::BUFFER_0)
+{
+	bufferPage[0] = NO_PAGE;
+	bufferPage[1] = NO_PAGE;
+}
+
+template <typename Spi, typename Cs, uint16_t Pages>
+bool
+xpcc::At45dbBlockDevice<Spi, Cs, Pages>::initialize()
+{
+	bufferPage[0] = NO_PAGE;
+	bufferPage[1] = NO_PAGE;
+	nextBuffer = at45db::BUFFER_0;
+	
+	return Flash::initialize();
+}
+
+template <typename Spi, typename Cs, uint16_t Pages>
+uint16_t
+xpcc::At45dbBlockDevice<Spi, Cs, Pages>::getBlockSize() const
+{
+	return PAGE_SIZE;
+}
+
+template <typename Spi, typename Cs, uint16_t Pages>
+uint32_t
+xpcc::At45dbBlockDevice<Spi, Cs, Pages>::getBlockCount() const
+{
+	return Pages;
+}
+
+// ----------------------------------------------------------------------------
+template <typename Spi, typename Cs, uint16_t Pages>
+bool
+xpcc::At45dbBlockDevice<Spi, Cs, Pages>::read(uint32_t block,
+		uint8_t *data, uint32_t count)
+{
+	if (block > Pages || count > Pages - block) {
+		return false;
+	}
+	
+	while (count > 0)
+	{
+		int_fast8_t buffer = findBuffer(block);
+		if (buffer >= 0)
+		{
+			// the buffer can be read while the other one is programmed
+			if (buffer != nextBuffer) {
+				Flash::waitUntilReady();
+			}
+			Flash::readFromBuffer(static_cast<at45db::Buffer>(buffer),
+					0, data, PAGE_SIZE);
+			
+			block++;
+			data += PAGE_SIZE;
+			count--;
+			continue;
+		}
+		
+		// read all following pages which are not buffered at once
+		uint32_t pages = 1;
+		while (pages < count && findBuffer(block + pages) < 0) {
+			pages++;
+		}
+		
+		Flash::waitUntilReady();
+		Flash::readFromMemory(block * PAGE_SIZE, data, pages * PAGE_SIZE);
+		
+		block += pages;
+		data += pages * PAGE_SIZE;
+		count -= pages;
+	}
+	
+	return true;
+}
+
+template <typename Spi, typename Cs, uint16_t Pages>
+bool
+xpcc::At45dbBlockDevice<Spi, Cs, Pages>::write(uint32_t block,
+		const uint8_t *data, uint32_t count)
+{
+	if (block > Pages || count > Pages - block) {
+		return false;
+	}
+	
+	for (; count > 0; --count, ++block, data += PAGE_SIZE)
+	{
+		// The last page is programmed from the other buffer. Only the
+		// start of the next program operation has to wait for it.
+		Flash::writeToBuffer(nextBuffer, 0, data, PAGE_SIZE);
+		Flash::waitUntilReady();
+		Flash::copyBufferToPage(nextBuffer, block);
+		
+		// the other buffer may contain an old version of the page
+		int_fast8_t old = findBuffer(block);
+		if (old >= 0) {
+			bufferPage[old] = NO_PAGE;
+		}
+		bufferPage[nextBuffer] = block;
+		
+		nextBuffer = (nextBuffer == at45db::BUFFER_0) ?
+				at45db::BUFFER_1 : at45db::BUFFER_0;
+	}
+	
+	return true;
+}
+
+template <typename Spi, typename Cs, uint16_t Pages>
+bool
+xpcc::At45dbBlockDevice<Spi, Cs, Pages>::flush()
+{
+	Flash::waitUntilReady();
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+template <typename Spi, typename Cs, uint16_t Pages>
+int_fast8_t
+xpcc::At45dbBlockDevice<Spi, Cs, Pages>::findBuffer(uint16_t page) const
+{
+	if (bufferPage[0] == page) {
+		return 0;
+	}
+	if (bufferPage[1] == page) {
+		return 1;
+	}
+	return -1;
+}
@@ -0,0 +1,167 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__BLOCK_CACHE_HPP
+#define XPCC__BLOCK_CACHE_HPP
+
+#include <cstddef>
+#include <stdint.h>
+
+#include "block_device.hpp"
+
+namespace xpcc
+{
+	/**
+	 * \brief	Byte addressed access to a block device with a LRU cache
+	 * 
+	 * Keeps the last used \p Blocks blocks of the device in RAM. Writes
+	 * only change the cached copy, the block is written back as a whole
+	 * when it is replaced or flush() is called. Many small writes to a
+	 * page of an EEPROM or DataFlash therefore end up as a single page
+	 * write.
+	 * 
+	 * Accesses which cover complete blocks that are not cached are
+	 * passed directly to the device, so reading or writing large
+	 * buffers does not replace the cached blocks.
+	 * 
+	 * \code
+	 * xpcc::At45dbBlockDevice<Spi, Cs, 2048> flash;
+	 * xpcc::BlockCache<256, 4> cache(flash);
+	 * 
+	 * cache.initialize();
+	 * cache.write(0x1234, data, sizeof(data));
+	 * ...
+	 * cache.flush();
+	 * \endcode
+	 * 
+	 * \tparam	BlockSize	Must be equal to BlockDevice::getBlockSize()
+	 * \tparam	Blocks		Number of cached blocks
+	 * 
+	 * \ingroup	storage
+	 */
+	template <uint16_t BlockSize, uint8_t Blocks>
+	class BlockCache
+	{
+	public:
+		struct Statistics
+		{
+			uint32_t hits;			///< Accessed blocks found in the cache
+			uint32_t misses;		///< Accessed blocks not found in the cache
+			uint32_t blockReads;	///< Blocks read from the device
+			uint32_t blockWrites;	///< Blocks written to the device
+		};
+		
+	public:
+		BlockCache(BlockDevice& device);
+		
+		/**
+		 * \brief	Initialize the device and clear the cache
+		 * 
+		 * \return	\c false if the device is not available or has
+		 * 			another block size
+		 */
+		bool
+		initialize();
+		
+		/// Size of the device in bytes
+		uint32_t
+		getSize() const;
+		
+		/**
+		 * \brief	Read data
+		 * 
+		 * \return	\c false if the range is outside of the device or a
+		 * 			block could not be read
+		 */
+		bool
+		read(uint32_t address, uint8_t *data, std::size_t size);
+		
+		/**
+		 * \brief	Write data
+		 * 
+		 * \return	\c false if the range is outside of the device or a
+		 * 			block could not be read or written
+		 */
+		bool
+		write(uint32_t address, const uint8_t *data, std::size_t size);
+		
+		/// Write back all modified blocks and wait until they are written
+		bool
+		flush();
+		
+		/// Drop all cached blocks, modified blocks are not written!
+		void
+		invalidate();
+		
+		inline const Statistics&
+		getStatistics() const
+		{
+			return statistics;
+		}
+		
+		void
+		resetStatistics();
+		
+	private:
+		struct Entry
+		{
+			uint32_t block;
+			uint32_t lastUse;
+			bool valid;
+			bool dirty;
+		};
+		
+		int_fast16_t
+		find(uint32_t block);
+		
+		/// Number of consecutive uncached blocks, at most \p maximum
+		uint32_t
+		countUncached(uint32_t block, uint32_t maximum);
+		
+		/// Get a free entry, the least recently used one is written back
+		int_fast16_t
+		allocate(uint32_t block);
+		
+		bool
+		writeBack(Entry& entry, uint8_t *data);
+		
+		BlockDevice& device;
+		
+		Entry entries[Blocks];
+		uint8_t buffer[Blocks][BlockSize];
+		uint32_t useCounter;
+		
+		Statistics statistics;
+	};
+}
+
+#include "block_cache_impl.hpp"
+
+#endif // XPCC__BLOCK_CACHE_HPP
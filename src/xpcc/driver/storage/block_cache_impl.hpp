@@ -0,0 +1,305 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__BLOCK_CACHE_HPP
+	#error	"Don't include this file directly, use 'block_cache.hpp' instead!"
+#endif
+
+#include <cstring>
+
+// ----------------------------------------------------------------------------
+template <uint16_t BlockSize, uint8_t Blocks>
+xpcc::BlockCache<BlockSize, Blocks>::BlockCache(BlockDevice& device) :
+	device(device), useCounter(0)
+{
+	invalidate();
+	resetStatistics();
+}
+
+template <uint16_t BlockSize, uint8_t Blocks>
+bool
+xpcc::BlockCache<BlockSize, Blocks>::initialize()
+{
+	invalidate();
+	if (!device.initialize()) {
+		return false;
+	}
+	return (device.getBlockSize() == BlockSize);
+}
+
+template <uint16_t BlockSize, uint8_t Blocks>
+uint32_t
+xpcc::BlockCache<BlockSize, Blocks>::getSize() const
+{
+	return device.getBlockCount() * BlockSize;
+}
+
+// ----------------------------------------------------------------------------
+template <uint16_t BlockSize, uint8_t Blocks>
+bool
+xpcc::BlockCache<BlockSize, Blocks>::read(uint32_t address,
+		uint8_t *data, std::size_t size)
+{
+	if (address > getSize() || size > getSize() - address) {
+		return false;
+	}
+	
+	while (size > 0)
+	{
+		uint32_t block = address / BlockSize;
+		uint16_t offset = address % BlockSize;
+		
+		int_fast16_t index = find(block);
+		if (index < 0 && offset == 0 && size >= BlockSize)
+		{
+			// read complete blocks directly into the target buffer
+			uint32_t count = countUncached(block, size / BlockSize);
+			statistics.misses += count;
+			statistics.blockReads += count;
+			if (!device.read(block, data, count)) {
+				return false;
+			}
+			
+			address += count * BlockSize;
+			data += count * BlockSize;
+			size -= count * BlockSize;
+			continue;
+		}
+		
+		if (index < 0)
+		{
+			statistics.misses++;
+			index = allocate(block);
+			if (index < 0) {
+				return false;
+			}
+			
+			statistics.blockReads++;
+			if (!device.read(block, buffer[index], 1)) {
+				entries[index].valid = false;
+				return false;
+			}
+		}
+		else {
+			statistics.hits++;
+		}
+		
+		entries[index].lastUse = ++useCounter;
+		
+		std::size_t length = BlockSize - offset;
+		if (length > size) {
+			length = size;
+		}
+		std::memcpy(data, buffer[index] + offset, length);
+		
+		address += length;
+		data += length;
+		size -= length;
+	}
+	
+	return true;
+}
+
+template <uint16_t BlockSize, uint8_t Blocks>
+bool
+xpcc::BlockCache<BlockSize, Blocks>::write(uint32_t address,
+		const uint8_t *data, std::size_t size)
+{
+	if (address > getSize() || size > getSize() - address) {
+		return false;
+	}
+	
+	while (size > 0)
+	{
+		uint32_t block = address / BlockSize;
+		uint16_t offset = address % BlockSize;
+		
+		int_fast16_t index = find(block);
+		if (index < 0 && offset == 0 && size >= BlockSize)
+		{
+			// nothing to combine, write the complete blocks directly
+			uint32_t count = countUncached(block, size / BlockSize);
+			statistics.misses += count;
+			statistics.blockWrites += count;
+			if (!device.write(block, data, count)) {
+				return false;
+			}
+			
+			address += count * BlockSize;
+			data += count * BlockSize;
+			size -= count * BlockSize;
+			continue;
+		}
+		
+		if (index < 0)
+		{
+			statistics.misses++;
+			index = allocate(block);
+			if (index < 0) {
+				return false;
+			}
+			
+			// the remaining bytes of the block must be preserved
+			statistics.blockReads++;
+			if (!device.read(block, buffer[index], 1)) {
+				entries[index].valid = false;
+				return false;
+			}
+		}
+		else {
+			statistics.hits++;
+		}
+		
+		entries[index].lastUse = ++useCounter;
+		entries[index].dirty = true;
+		
+		std::size_t length = BlockSize - offset;
+		if (length > size) {
+			length = size;
+		}
+		std::memcpy(buffer[index] + offset, data, length);
+		
+		address += length;
+		data += length;
+		size -= length;
+	}
+	
+	return true;
+}
+
+template <uint16_t BlockSize, uint8_t Blocks>
+bool
+xpcc::BlockCache<BlockSize, Blocks>::flush()
+{
+	// write back in ascending order, some devices are faster then
+	while (true)
+	{
+		int_fast16_t next = -1;
+		for (uint_fast8_t i = 0; i < Blocks; ++i)
+		{
+			if (entries[i].valid && entries[i].dirty &&
+					(next < 0 || entries[i].block < entries[next].block)) {
+				next = i;
+			}
+		}
+		
+		if (next < 0) {
+			break;
+		}
+		if (!writeBack(entries[next], buffer[next])) {
+			return false;
+		}
+	}
+	
+	return device.flush();
+}
+
+template <uint16_t BlockSize, uint8_t Blocks>
+void
+xpcc::BlockCache<BlockSize, Blocks>::invalidate()
+{
+	for (uint_fast8_t i = 0; i < Blocks; ++i) {
+		entries[i].valid = false;
+		entries[i].dirty = false;
+	}
+}
+
+template <uint16_t BlockSize, uint8_t Blocks>
+void
+xpcc::BlockCache<BlockSize, Blocks>::resetStatistics()
+{
+	statistics.hits = 0;
+	statistics.misses = 0;
+	statistics.blockReads = 0;
+	statistics.blockWrites = 0;
+}
+
+// ----------------------------------------------------------------------------
+template <uint16_t BlockSize, uint8_t Blocks>
+int_fast16_t
+xpcc::BlockCache<BlockSize, Blocks>::find(uint32_t block)
+{
+	for (uint_fast8_t i = 0; i < Blocks; ++i) {
+		if (entries[i].valid && entries[i].block == block) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+template <uint16_t BlockSize, uint8_t Blocks>
+uint32_t
+xpcc::BlockCache<BlockSize, Blocks>::countUncached(uint32_t block, uint32_t maximum)
+{
+	uint32_t count = 1;
+	while (count < maximum && find(block + count) < 0) {
+		count++;
+	}
+	return count;
+}
+
+template <uint16_t BlockSize, uint8_t Blocks>
+int_fast16_t
+xpcc::BlockCache<BlockSize, Blocks>::allocate(uint32_t block)
+{
+	uint_fast8_t index = 0;
+	for (uint_fast8_t i = 0; i < Blocks; ++i)
+	{
+		if (!entries[i].valid) {
+			index = i;
+			break;
+		}
+		if (entries[i].lastUse < entries[index].lastUse) {
+			index = i;
+		}
+	}
+	
+	Entry& entry = entries[index];
+	if (entry.valid && entry.dirty && !writeBack(entry, buffer[index])) {
+		return -1;
+	}
+	
+	entry.block = block;
+	entry.valid = true;
+	entry.dirty = false;
+	return index;
+}
+
+template <uint16_t BlockSize, uint8_t Blocks>
+bool
+xpcc::BlockCache<BlockSize, Blocks>::writeBack(Entry& entry, uint8_t *data)
+{
+	statistics.blockWrites++;
+	if (!device.write(entry.block, data, 1)) {
+		return false;
+	}
+	entry.dirty = false;
+	return true;
+}
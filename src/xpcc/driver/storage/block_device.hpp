@@ -0,0 +1,112 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__BLOCK_DEVICE_HPP
+#define XPCC__BLOCK_DEVICE_HPP
+
+#include <stdint.h>
+
+namespace xpcc
+{
+	/**
+	 * \brief	Memory which is read and written in blocks of a fixed size
+	 * 
+	 * A block is the unit in which the memory is written most
+	 * efficiently, e.g. a page of a DataFlash or an EEPROM. Adapters
+	 * exist for xpcc::At45db0x1d, xpcc::SpiRam and xpcc::I2cEeprom.
+	 * 
+	 * Block devices are used through xpcc::BlockCache, which provides
+	 * access with byte addresses and combines small writes into writes
+	 * of complete blocks.
+	 * 
+	 * \see		BlockCache
+	 * \ingroup	storage
+	 */
+	class BlockDevice
+	{
+	public:
+		virtual
+		~BlockDevice()
+		{
+		}
+		
+		/**
+		 * \brief	Initialize the device
+		 * 
+		 * \return	\c false if the device is not available
+		 */
+		virtual bool
+		initialize() = 0;
+		
+		/// Size of a block in bytes
+		virtual uint16_t
+		getBlockSize() const = 0;
+		
+		/// Number of blocks
+		virtual uint32_t
+		getBlockCount() const = 0;
+		
+		/**
+		 * \brief	Read consecutive blocks
+		 * 
+		 * \param		block	Index of the first block
+		 * \param[out]	data	Buffer for <tt>count * getBlockSize()</tt> bytes
+		 * \param		count	Number of blocks
+		 * 
+		 * \return	\c false if the blocks could not be read
+		 */
+		virtual bool
+		read(uint32_t block, uint8_t *data, uint32_t count) = 0;
+		
+		/**
+		 * \brief	Write consecutive blocks
+		 * 
+		 * The write may still be in progress when the function returns,
+		 * reading the blocks returns the new content nevertheless.
+		 * 
+		 * \return	\c false if the blocks could not be written
+		 */
+		virtual bool
+		write(uint32_t block, const uint8_t *data, uint32_t count) = 0;
+		
+		/**
+		 * \brief	Wait until all write operations are finished
+		 * 
+		 * Must be called before the power is switched off.
+		 */
+		virtual bool
+		flush()
+		{
+			return true;
+		}
+	};
+}
+
+#endif // XPCC__BLOCK_DEVICE_HPP
@@ -0,0 +1,98 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__BLOCK_VOLUME_HPP
+#define XPCC__BLOCK_VOLUME_HPP
+
+#include "fat.hpp"
+
+namespace xpcc
+{
+	namespace fat
+	{
+		/**
+		 * \brief	FAT volume stored on a block device
+		 * 
+		 * Uses 512 byte sectors. The sectors are read and written
+		 * through a xpcc::BlockCache, so a device with smaller blocks
+		 * (e.g. the 256 byte pages of a DataFlash) only writes the pages
+		 * which have been changed.
+		 * 
+		 * \code
+		 * xpcc::At45dbBlockDevice<Spi, Cs, 4096> flash;
+		 * xpcc::BlockCache<256, 4> cache(flash);
+		 * xpcc::fat::BlockVolume< xpcc::BlockCache<256, 4> > volume(cache);
+		 * 
+		 * xpcc::fat::FileSystem fileSystem(&volume);
+		 * \endcode
+		 * 
+		 * \tparam	Cache	xpcc::BlockCache
+		 * \ingroup	storage
+		 */
+		template <typename Cache>
+		class BlockVolume : public PhysicalVolume
+		{
+		public:
+			static const uint16_t SECTOR_SIZE = 512;
+			
+		public:
+			BlockVolume(Cache& cache);
+			
+			virtual Status
+			initialize();
+			
+			virtual Status
+			getStatus();
+			
+			virtual Result
+			read(uint8_t *buffer, int32_t sectorNumber, uint8_t sectorCount);
+			
+			virtual Result
+			write(const uint8_t *buffer, int32_t sectorNumber, uint8_t sectorCount);
+			
+			/**
+			 * \brief	Execute a command
+			 * 
+			 * Supports CTRL_SYNC, which flushes the cache, and
+			 * GET_SECTOR_COUNT, GET_SECTOR_SIZE and GET_BLOCK_SIZE.
+			 */
+			virtual Result
+			ioctl(uint8_t command, uint32_t *buffer);
+			
+		private:
+			Cache& cache;
+			Status status;
+		};
+	}
+}
+
+#include "block_volume_impl.hpp"
+
+#endif // XPCC__BLOCK_VOLUME_HPP
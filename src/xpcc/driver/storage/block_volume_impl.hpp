@@ -0,0 +1,123 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__BLOCK_VOLUME_HPP
+	#error	"Don't include this file directly, use 'block_volume.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename Cache>
+xpcc::fat::BlockVolume<Cache>::BlockVolume(Cache& cache) :
+	cache(cache), status(STA_NOINIT)
+{
+}
+
+template <typename Cache>
+xpcc::fat::Status
+xpcc::fat::BlockVolume<Cache>::initialize()
+{
+	status = cache.initialize() ? 0 : STA_NOINIT;
+	return status;
+}
+
+template <typename Cache>
+xpcc::fat::Status
+xpcc::fat::BlockVolume<Cache>::getStatus()
+{
+	return status;
+}
+
+// ----------------------------------------------------------------------------
+template <typename Cache>
+xpcc::fat::Result
+xpcc::fat::BlockVolume<Cache>::read(uint8_t *buffer,
+		int32_t sectorNumber, uint8_t sectorCount)
+{
+	if (status & STA_NOINIT) {
+		return RES_NOTRDY;
+	}
+	if (sectorNumber < 0) {
+		return RES_PARERR;
+	}
+	
+	if (!cache.read(sectorNumber * SECTOR_SIZE, buffer, sectorCount * SECTOR_SIZE)) {
+		return RES_ERROR;
+	}
+	return RES_OK;
+}
+
+template <typename Cache>
+xpcc::fat::Result
+xpcc::fat::BlockVolume<Cache>::write(const uint8_t *buffer,
+		int32_t sectorNumber, uint8_t sectorCount)
+{
+	if (status & STA_NOINIT) {
+		return RES_NOTRDY;
+	}
+	if (sectorNumber < 0) {
+		return RES_PARERR;
+	}
+	
+	if (!cache.write(sectorNumber * SECTOR_SIZE, buffer, sectorCount * SECTOR_SIZE)) {
+		return RES_ERROR;
+	}
+	return RES_OK;
+}
+
+template <typename Cache>
+xpcc::fat::Result
+xpcc::fat::BlockVolume<Cache>::ioctl(uint8_t command, uint32_t *buffer)
+{
+	if (status & STA_NOINIT) {
+		return RES_NOTRDY;
+	}
+	
+	switch (command)
+	{
+		case CTRL_SYNC:
+			return cache.flush() ? RES_OK : RES_ERROR;
+		
+		case GET_SECTOR_COUNT:
+			*buffer = cache.getSize() / SECTOR_SIZE;
+			return RES_OK;
+		
+		case GET_SECTOR_SIZE:
+			// FatFs expects a WORD here
+			*reinterpret_cast<uint16_t *>(buffer) = SECTOR_SIZE;
+			return RES_OK;
+		
+		case GET_BLOCK_SIZE:
+			*buffer = 1;
+			return RES_OK;
+		
+		default:
+			return RES_PARERR;
+	}
+}
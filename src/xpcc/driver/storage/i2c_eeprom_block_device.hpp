@@ -0,0 +1,111 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__I2C_EEPROM_BLOCK_DEVICE_HPP
+#define XPCC__I2C_EEPROM_BLOCK_DEVICE_HPP
+
+#include <xpcc/utils/template_metaprogramming.hpp>
+
+#include "i2c_eeprom.hpp"
+#include "block_device.hpp"
+
+namespace xpcc
+{
+	/**
+	 * \brief	Block device for I2C EEPROMs
+	 * 
+	 * Blocks are the pages of the EEPROM. xpcc::I2cEeprom::write()
+	 * does not check the page boundaries, the EEPROM wraps around to the
+	 * beginning of the page when a write crosses one. Here every page
+	 * is written with a separate write command.
+	 * 
+	 * The EEPROM is busy for up to 5ms after a page write and does not
+	 * acknowledge its address during that time. This is only checked
+	 * before the next access, so the write cycle does not block the
+	 * caller.
+	 * 
+	 * xpcc::I2cEeprom uses a 16-bit address and at most 255 bytes per
+	 * transfer, so only EEPROMs up to 64 KiB (e.g. 24C512) are
+	 * supported. Larger ones like the 24FC1025 select the upper half
+	 * with a bit of the device address and have to be used as two
+	 * separate devices.
+	 * 
+	 * \tparam	PageSize	64 for the 24C256, 128 for the 24C512
+	 * \tparam	Size		Size of the memory in bytes
+	 * 
+	 * \see		I2cEeprom
+	 * \ingroup	storage
+	 */
+	template <typename I2cMaster, uint16_t PageSize = 64, uint32_t Size = 32768>
+	class I2cEepromBlockDevice : public BlockDevice
+	{
+		XPCC__STATIC_ASSERT(Size <= 65536UL, "I2cEeprom can only address 64 KiB");
+		XPCC__STATIC_ASSERT(PageSize <= 255, "I2cEeprom transfers at most 255 bytes");
+		
+	public:
+		/// \param	address		7-bit address of the EEPROM
+		I2cEepromBlockDevice(uint8_t address = 0x50);
+		
+		virtual bool
+		initialize();
+		
+		virtual uint16_t
+		getBlockSize() const;
+		
+		virtual uint32_t
+		getBlockCount() const;
+		
+		virtual bool
+		read(uint32_t block, uint8_t *data, uint32_t count);
+		
+		virtual bool
+		write(uint32_t block, const uint8_t *data, uint32_t count);
+		
+		virtual bool
+		flush();
+		
+	private:
+		static const uint32_t PAGES = Size / PageSize;
+		
+		/// Maximum duration of a write cycle in milliseconds
+		static const uint8_t WRITE_CYCLE_TIMEOUT = 10;
+		
+		/// Wait until the last write cycle is finished
+		bool
+		waitUntilReady();
+		
+		I2cEeprom<I2cMaster> eeprom;
+		bool busy;
+	};
+}
+
+#include "i2c_eeprom_block_device_impl.hpp"
+
+#endif // XPCC__I2C_EEPROM_BLOCK_DEVICE_HPP
@@ -0,0 +1,131 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__I2C_EEPROM_BLOCK_DEVICE_HPP
+	#error	"Don't include this file directly, use 'i2c_eeprom_block_device.hpp' instead!"
+#endif
+
+#include <xpcc/workflow/timeout.hpp>
+
+// ----------------------------------------------------------------------------
+template <typename I2cMaster, uint16_t PageSize, uint32_t Size>
+xpcc::I2cEepromBlockDevice<I2cMaster, PageSize, Size>::I2cEepromBlockDevice(uint8_t address) :
+	eeprom(address), busy(false)
+{
+}
+
+template <typename I2cMaster, uint16_t PageSize, uint32_t Size>
+bool
+xpcc::I2cEepromBlockDevice<I2cMaster, PageSize, Size>::initialize()
+{
+	busy = true;
+	return waitUntilReady();
+}
+
+template <typename I2cMaster, uint16_t PageSize, uint32_t Size>
+uint16_t
+xpcc::I2cEepromBlockDevice<I2cMaster, PageSize, Size>::getBlockSize() const
+{
+	return PageSize;
+}
+
+template <typename I2cMaster, uint16_t PageSize, uint32_t Size>
+uint32_t
+xpcc::I2cEepromBlockDevice<I2cMaster, PageSize, Size>::getBlockCount() const
+{
+	return PAGES;
+}
+
+// ----------------------------------------------------------------------------
+template <typename I2cMaster, uint16_t PageSize, uint32_t Size>
+bool
+xpcc::I2cEepromBlockDevice<I2cMaster, PageSize, Size>::read(uint32_t block,
+		uint8_t *data, uint32_t count)
+{
+	if (block > PAGES || count > PAGES - block || !waitUntilReady()) {
+		return false;
+	}
+	
+	for (; count > 0; --count, ++block, data += PageSize)
+	{
+		if (!eeprom.read(block * PageSize, data, PageSize)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+template <typename I2cMaster, uint16_t PageSize, uint32_t Size>
+bool
+xpcc::I2cEepromBlockDevice<I2cMaster, PageSize, Size>::write(uint32_t block,
+		const uint8_t *data, uint32_t count)
+{
+	if (block > PAGES || count > PAGES - block) {
+		return false;
+	}
+	
+	for (; count > 0; --count, ++block, data += PageSize)
+	{
+		if (!waitUntilReady() ||
+				!eeprom.write(block * PageSize, data, PageSize)) {
+			return false;
+		}
+		busy = true;
+	}
+	return true;
+}
+
+template <typename I2cMaster, uint16_t PageSize, uint32_t Size>
+bool
+xpcc::I2cEepromBlockDevice<I2cMaster, PageSize, Size>::flush()
+{
+	return waitUntilReady();
+}
+
+// ----------------------------------------------------------------------------
+template <typename I2cMaster, uint16_t PageSize, uint32_t Size>
+bool
+xpcc::I2cEepromBlockDevice<I2cMaster, PageSize, Size>::waitUntilReady()
+{
+	if (!busy) {
+		return true;
+	}
+	
+	// acknowledge polling
+	xpcc::Timeout<> timeout(WRITE_CYCLE_TIMEOUT);
+	while (!eeprom.isAvailable())
+	{
+		if (timeout.isExpired()) {
+			return false;
+		}
+	}
+	busy = false;
+	return true;
+}
@@ -0,0 +1,264 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__LOG_STORE_HPP
+#define XPCC__LOG_STORE_HPP
+
+#include <stdint.h>
+
+#include "block_device.hpp"
+
+namespace xpcc
+{
+	/**
+	 * \brief	Append-only record log on a block device
+	 * 
+	 * Records of up to <tt>PageSize - 9</tt> bytes are collected in a
+	 * page buffer in RAM. A page is only written when it is full or
+	 * sync() is called, so appending a record does not cost a page
+	 * read-modify-write. Every page is written once and contains:
+	 * 
+	 * \code
+	 * Offset | Size | Content
+	 * -------+------+----------------------------------------------
+	 *      0 |    4 | sequence number, incremented for every page
+	 *      4 |    2 | number of used bytes after the header
+	 *      6 |    2 | CRC-16 of the header and the used bytes
+	 *      8 |      | records: length (1 byte) followed by the data
+	 * \endcode
+	 * 
+	 * The pages are written in a ring. When the log is full, the oldest
+	 * page is overwritten. Every page is therefore written equally
+	 * often (wear leveling) and every page of a DataFlash sector is
+	 * rewritten regularly, as the datasheet demands.
+	 * 
+	 * Pages with a wrong CRC are ignored. If the power fails while a
+	 * page is written, only the records of this page are lost. The
+	 * records of all pages written before survive.
+	 * 
+	 * initialize() finds the newest page with a binary search over the
+	 * sequence numbers, so it reads about <tt>log2(pages) + 4</tt> pages
+	 * instead of all of them.
+	 * 
+	 * \code
+	 * xpcc::At45dbBlockDevice<Spi, Cs, 2048> flash;
+	 * xpcc::LogStore<256> log(flash);
+	 * 
+	 * log.initialize();
+	 * log.append(data, sizeof(data));
+	 * log.sync();
+	 * 
+	 * xpcc::LogStore<256>::Iterator it = log.getIterator();
+	 * while (it.next()) {
+	 *     process(it.getData(), it.getSize());
+	 * }
+	 * \endcode
+	 * 
+	 * \tparam	PageSize	Must be equal to BlockDevice::getBlockSize()
+	 * 
+	 * \see		At45dbBlockDevice
+	 * \see		I2cEepromBlockDevice
+	 * \ingroup	storage
+	 */
+	template <uint16_t PageSize>
+	class LogStore
+	{
+	public:
+		static const uint8_t HEADER_SIZE = 8;
+		
+		/// Largest record which fits into a page
+		static const uint16_t MAX_RECORD_SIZE = (PageSize - HEADER_SIZE - 1) < 255 ?
+				(PageSize - HEADER_SIZE - 1) : 255;
+		
+		/**
+		 * \brief	Reads all records from the oldest to the newest one
+		 * 
+		 * Includes the records not yet written to the device. The
+		 * iterator becomes invalid when a record is appended.
+		 */
+		class Iterator
+		{
+		public:
+			/**
+			 * \brief	Move to the next record
+			 * 
+			 * Must also be called before the first record is accessed.
+			 * 
+			 * \return	\c false if there are no more records
+			 */
+			bool
+			next();
+			
+			inline const uint8_t *
+			getData() const
+			{
+				return data;
+			}
+			
+			inline uint8_t
+			getSize() const
+			{
+				return size;
+			}
+			
+		private:
+			friend class LogStore;
+			
+			Iterator(LogStore& store);
+			
+			LogStore& store;
+			
+			uint32_t page;
+			uint32_t remainingPages;
+			bool bufferRead;
+			
+			const uint8_t *source;
+			uint16_t used;
+			uint16_t offset;
+			
+			const uint8_t *data;
+			uint8_t size;
+			
+			uint8_t buffer[PageSize];
+		};
+		
+	public:
+		/**
+		 * \param	device		Device with blocks of \p PageSize bytes
+		 * \param	firstPage	First page used for the log
+		 * \param	pages		Number of pages, zero for all pages after \p firstPage
+		 */
+		LogStore(BlockDevice& device, uint32_t firstPage = 0, uint32_t pages = 0);
+		
+		/**
+		 * \brief	Initialize the device and find the end of the log
+		 * 
+		 * \return	\c false if the device is not available, has another
+		 * 			block size or a page could not be read
+		 */
+		bool
+		initialize();
+		
+		/**
+		 * \brief	Append a record
+		 * 
+		 * Writes the page buffer to the device when the record does not
+		 * fit into it anymore.
+		 * 
+		 * \return	\c false if the record is larger than MAX_RECORD_SIZE
+		 * 			or the page could not be written
+		 */
+		bool
+		append(const uint8_t *data, uint8_t size);
+		
+		/**
+		 * \brief	Write all records to the device
+		 * 
+		 * The current page is written even if it is not full, the next
+		 * record starts a new page. Calling sync() often therefore wastes
+		 * space and erase cycles.
+		 */
+		bool
+		sync();
+		
+		/**
+		 * \brief	Delete all records
+		 * 
+		 * Every page is written, which takes a while.
+		 */
+		bool
+		clear();
+		
+		Iterator
+		getIterator();
+		
+		/// Number of pages which contain records
+		inline uint32_t
+		getUsedPages() const
+		{
+			return usedPages;
+		}
+		
+		/// Number of pages available for the log
+		inline uint32_t
+		getPages() const
+		{
+			return pages;
+		}
+		
+		/// Number of pages written to the device since initialize()
+		inline uint32_t
+		getPageWrites() const
+		{
+			return pageWrites;
+		}
+		
+	private:
+		/// Read a page into \p data and check it
+		bool
+		readPage(uint32_t page, uint8_t *data, bool& valid);
+		
+		/// Read a page and get its sequence number
+		bool
+		readSequence(uint32_t page, bool& valid, uint32_t& sequence);
+		
+		bool
+		writePage();
+		
+		static uint32_t
+		getSequence(const uint8_t *page);
+		
+		static uint16_t
+		getUsed(const uint8_t *page);
+		
+		static uint16_t
+		calculateCrc(const uint8_t *page, uint16_t used);
+		
+		BlockDevice& device;
+		uint32_t firstPage;
+		uint32_t pages;
+		
+		/// Newest page on the device
+		uint32_t head;
+		/// Oldest page on the device
+		uint32_t tail;
+		uint32_t usedPages;
+		uint32_t nextSequence;
+		uint32_t pageWrites;
+		
+		/// Page which is filled with new records
+		uint8_t buffer[PageSize];
+		uint16_t used;
+	};
+}
+
+#include "log_store_impl.hpp"
+
+#endif // XPCC__LOG_STORE_HPP
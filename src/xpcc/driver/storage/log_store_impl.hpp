@@ -0,0 +1,339 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__LOG_STORE_HPP
+	#error	"Don't include this file directly, use 'log_store.hpp' instead!"
+#endif
+
+#include <cstring>
+#include <xpcc/math/utils/crc.hpp>
+
+template <uint16_t PageSize>
+const uint8_t xpcc::LogStore<PageSize>::HEADER_SIZE;
+
+template <uint16_t PageSize>
+const uint16_t xpcc::LogStore<PageSize>::MAX_RECORD_SIZE;
+
+// ----------------------------------------------------------------------------
+template <uint16_t PageSize>
+xpcc::LogStore<PageSize>::Iterator::Iterator(LogStore& store) :
+	store(store), page(store.tail), remainingPages(store.usedPages),
+	bufferRead(false), source(0), used(0), offset(0), data(0), size(0)
+{
+}
+
+template <uint16_t PageSize>
+bool
+xpcc::LogStore<PageSize>::Iterator::next()
+{
+	while (offset >= used)
+	{
+		offset = 0;
+		used = 0;
+		if (remainingPages > 0)
+		{
+			uint32_t current = page;
+			page = (page + 1) % store.pages;
+			remainingPages--;
+			
+			bool valid;
+			if (!store.readPage(current, buffer, valid)) {
+				return false;
+			}
+			if (valid) {
+				source = buffer;
+				used = getUsed(buffer);
+			}
+		}
+		else if (!bufferRead)
+		{
+			// records which are not written yet
+			bufferRead = true;
+			source = store.buffer;
+			used = store.used;
+		}
+		else {
+			return false;
+		}
+	}
+	
+	size = source[HEADER_SIZE + offset];
+	data = source + HEADER_SIZE + offset + 1;
+	offset += 1 + size;
+	if (offset > used)
+	{
+		// damaged page, skip the rest
+		offset = used;
+		return next();
+	}
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+template <uint16_t PageSize>
+xpcc::LogStore<PageSize>::LogStore(BlockDevice& device,
+		uint32_t firstPage, uint32_t pages) :
+	device(device), firstPage(firstPage), pages(pages),
+	head(0), tail(0), usedPages(0), nextSequence(0), pageWrites(0), used(0)
+{
+}
+
+template <uint16_t PageSize>
+bool
+xpcc::LogStore<PageSize>::initialize()
+{
+	used = 0;
+	pageWrites = 0;
+	
+	if (!device.initialize() || device.getBlockSize() != PageSize ||
+			firstPage >= device.getBlockCount()) {
+		return false;
+	}
+	
+	if (pages == 0 || pages > device.getBlockCount() - firstPage) {
+		pages = device.getBlockCount() - firstPage;
+	}
+	
+	// The first page is only invalid if it was never written or the
+	// power failed while it was written. The log then starts with the
+	// second page.
+	uint32_t base = 0;
+	bool valid;
+	uint32_t sequence;
+	if (!readSequence(0, valid, sequence)) {
+		return false;
+	}
+	if (!valid && pages > 1)
+	{
+		base = 1;
+		if (!readSequence(1, valid, sequence)) {
+			return false;
+		}
+	}
+	
+	if (!valid)
+	{
+		// empty log
+		head = pages - 1;
+		tail = 0;
+		usedPages = 0;
+		nextSequence = 0;
+		return true;
+	}
+	
+	// All pages up to the newest one were written after the first page
+	// and have a larger sequence number. Older or invalid pages follow.
+	const uint32_t baseSequence = sequence;
+	uint32_t headSequence = sequence;
+	uint32_t low = base;
+	uint32_t high = pages - 1;
+	while (low < high)
+	{
+		uint32_t middle = low + (high - low + 1) / 2;
+		if (!readSequence(middle, valid, sequence)) {
+			return false;
+		}
+		
+		if (valid && sequence >= baseSequence) {
+			low = middle;
+			headSequence = sequence;
+		}
+		else {
+			high = middle - 1;
+		}
+	}
+	head = low;
+	nextSequence = headSequence + 1;
+	
+	// The oldest page follows the newest one, unless the log was not
+	// full yet. The page directly after the newest one may have been
+	// destroyed by a power failure.
+	tail = base;
+	for (uint_fast8_t i = 1; i <= 2 && i < pages; ++i)
+	{
+		uint32_t page = (head + i) % pages;
+		if (!readSequence(page, valid, sequence)) {
+			return false;
+		}
+		if (valid && sequence < headSequence) {
+			tail = page;
+			break;
+		}
+	}
+	usedPages = (head + pages - tail) % pages + 1;
+	
+	return true;
+}
+
+template <uint16_t PageSize>
+bool
+xpcc::LogStore<PageSize>::append(const uint8_t *data, uint8_t size)
+{
+	if (size > MAX_RECORD_SIZE) {
+		return false;
+	}
+	
+	if (HEADER_SIZE + used + 1 + size > PageSize && !writePage()) {
+		return false;
+	}
+	
+	buffer[HEADER_SIZE + used] = size;
+	std::memcpy(buffer + HEADER_SIZE + used + 1, data, size);
+	used += 1 + size;
+	return true;
+}
+
+template <uint16_t PageSize>
+bool
+xpcc::LogStore<PageSize>::sync()
+{
+	return writePage() && device.flush();
+}
+
+template <uint16_t PageSize>
+bool
+xpcc::LogStore<PageSize>::clear()
+{
+	std::memset(buffer, 0xff, PageSize);
+	for (uint32_t page = 0; page < pages; ++page)
+	{
+		if (!device.write(firstPage + page, buffer, 1)) {
+			return false;
+		}
+	}
+	
+	head = pages - 1;
+	tail = 0;
+	usedPages = 0;
+	nextSequence = 0;
+	used = 0;
+	return device.flush();
+}
+
+template <uint16_t PageSize>
+typename xpcc::LogStore<PageSize>::Iterator
+xpcc::LogStore<PageSize>::getIterator()
+{
+	return Iterator(*this);
+}
+
+// ----------------------------------------------------------------------------
+template <uint16_t PageSize>
+bool
+xpcc::LogStore<PageSize>::readPage(uint32_t page, uint8_t *data, bool& valid)
+{
+	if (!device.read(firstPage + page, data, 1)) {
+		return false;
+	}
+	
+	uint16_t length = getUsed(data);
+	uint16_t crc = data[6] | (data[7] << 8);
+	valid = (getSequence(data) != 0xffffffff) &&
+			(length <= PageSize - HEADER_SIZE) &&
+			(calculateCrc(data, length) == crc);
+	return true;
+}
+
+template <uint16_t PageSize>
+bool
+xpcc::LogStore<PageSize>::readSequence(uint32_t page, bool& valid, uint32_t& sequence)
+{
+	// the page buffer is empty while the log is opened
+	if (!readPage(page, buffer, valid)) {
+		return false;
+	}
+	sequence = getSequence(buffer);
+	return true;
+}
+
+template <uint16_t PageSize>
+bool
+xpcc::LogStore<PageSize>::writePage()
+{
+	if (used == 0) {
+		return true;
+	}
+	
+	const uint32_t sequence = nextSequence;
+	buffer[0] = sequence;
+	buffer[1] = sequence >> 8;
+	buffer[2] = sequence >> 16;
+	buffer[3] = sequence >> 24;
+	buffer[4] = used;
+	buffer[5] = used >> 8;
+	std::memset(buffer + HEADER_SIZE + used, 0xff, PageSize - HEADER_SIZE - used);
+	
+	uint16_t crc = calculateCrc(buffer, used);
+	buffer[6] = crc;
+	buffer[7] = crc >> 8;
+	
+	uint32_t page = (head + 1) % pages;
+	pageWrites++;
+	if (!device.write(firstPage + page, buffer, 1)) {
+		return false;
+	}
+	
+	head = page;
+	nextSequence++;
+	if (usedPages == pages) {
+		// the oldest page was overwritten
+		tail = (tail + 1) % pages;
+	}
+	else {
+		usedPages++;
+	}
+	used = 0;
+	return true;
+}
+
+template <uint16_t PageSize>
+uint32_t
+xpcc::LogStore<PageSize>::getSequence(const uint8_t *page)
+{
+	return static_cast<uint32_t>(page[0]) |
+			(static_cast<uint32_t>(page[1]) << 8) |
+			(static_cast<uint32_t>(page[2]) << 16) |
+			(static_cast<uint32_t>(page[3]) << 24);
+}
+
+template <uint16_t PageSize>
+uint16_t
+xpcc::LogStore<PageSize>::getUsed(const uint8_t *page)
+{
+	return page[4] | (page[5] << 8);
+}
+
+template <uint16_t PageSize>
+uint16_t
+xpcc::LogStore<PageSize>::calculateCrc(const uint8_t *page, uint16_t used)
+{
+	uint16_t crc = xpcc::Crc16Ibm::update(0xffff, page, 6);
+	return xpcc::Crc16Ibm::update(crc, page + HEADER_SIZE, used);
+}
@@ -31,11 +31,178 @@
 #ifndef XPCC__SD_HPP
 #define XPCC__SD_HPP
 
+#include <stdint.h>
+
 #include "fat.hpp"
 
 namespace xpcc
 {
-	
+	namespace fat
+	{
+		/**
+		 * \brief	SD card or MMC connected by SPI
+		 * 
+		 * Transfers of several sectors use the multiple block commands
+		 * (CMD18/CMD25), so the card only has to be addressed and only
+		 * needs to program its flash once for all of them. The data
+		 * blocks are transferred with Spi::setBuffer() and
+		 * Spi::transferSync(), which use DMA if the SPI master supports
+		 * it. Transfers of \p BufferSectors or more sectors go directly
+		 * between the card and the buffer given by FatFs.
+		 * 
+		 * Smaller transfers use an internal buffer of \p BufferSectors
+		 * sectors:
+		 * - Reads: When a sector directly following the last read one is
+		 *   requested, the next \p BufferSectors sectors are read at once
+		 *   (read-ahead). FatFs reads a file sector by sector if it is
+		 *   read in small pieces, which then costs one command per
+		 *   \p BufferSectors sectors instead of one per sector. Random
+		 *   reads and reads while the buffer holds sectors to be written
+		 *   only read a single sector.
+		 * - Writes: Consecutive sectors are collected and written with a
+		 *   single command when the buffer is full, another sector is
+		 *   written or FatFs synchronizes the file system (f_sync(),
+		 *   f_close()). A sector which is written again before that is
+		 *   only written once.
+		 * 
+		 * Like with every FatFs volume, data is only guaranteed to be on
+		 * the card after f_sync() or f_close().
+		 * 
+		 * The SPI clock must be between 100 and 400kHz during
+		 * initialize() and can be raised to up to 25MHz afterwards.
+		 * 
+		 * \code
+		 * typedef xpcc::stm32::SpiMaster1 Spi;
+		 * xpcc::fat::SdCardVolume<Spi, CsSd> volume;
+		 * 
+		 * Spi::initialize(Spi::MODE_0, Spi::PRESCALER_256);
+		 * volume.initialize();
+		 * Spi::initialize(Spi::MODE_0, Spi::PRESCALER_4);
+		 * 
+		 * xpcc::fat::FileSystem fileSystem(&volume);
+		 * \endcode
+		 * 
+		 * \tparam	Spi				SPI master
+		 * \tparam	Cs				Chip select pin
+		 * \tparam	BufferSectors	Size of the internal buffer (1..255 sectors)
+		 * 
+		 * \see		http://elm-chan.org/docs/mmc/mmc_e.html
+		 * \ingroup	storage
+		 */
+		template <typename Spi, typename Cs, uint8_t BufferSectors = 4>
+		class SdCardVolume : public PhysicalVolume
+		{
+		public:
+			static const uint16_t SECTOR_SIZE = 512;
+			
+			struct Statistics
+			{
+				uint32_t readCommands;		///< Single and multiple block reads
+				uint32_t writeCommands;		///< Single and multiple block writes
+				uint32_t sectorsRead;		///< Sectors transferred from the card
+				uint32_t sectorsWritten;	///< Sectors transferred to the card
+				uint32_t bufferHits;		///< Sectors read from the internal buffer
+			};
+			
+		public:
+			SdCardVolume();
+			
+			/**
+			 * \brief	Initialize the card
+			 * 
+			 * Supports SD cards version 1 and 2 (SDHC, SDXC) and MMC
+			 * version 3.
+			 */
+			virtual Status
+			initialize();
+			
+			virtual Status
+			getStatus();
+			
+			virtual Result
+			read(uint8_t *buffer, int32_t sectorNumber, uint8_t sectorCount);
+			
+			virtual Result
+			write(const uint8_t *buffer, int32_t sectorNumber, uint8_t sectorCount);
+			
+			/**
+			 * \brief	Execute a command
+			 * 
+			 * Supports CTRL_SYNC, which writes the buffered sectors and
+			 * waits until the card has programmed them, and
+			 * GET_SECTOR_COUNT, GET_SECTOR_SIZE and GET_BLOCK_SIZE.
+			 */
+			virtual Result
+			ioctl(uint8_t command, uint32_t *buffer);
+			
+			/// Card type, combination of the CT_* flags in sd_constants.hpp
+			inline uint8_t
+			getCardType() const
+			{
+				return cardType;
+			}
+			
+			inline const Statistics&
+			getStatistics() const
+			{
+				return statistics;
+			}
+			
+			void
+			resetStatistics();
+			
+		private:
+			bool
+			select();
+			
+			void
+			deselect();
+			
+			bool
+			waitUntilReady(uint16_t milliseconds);
+			
+			/// Send a command and return the R1 response
+			uint8_t
+			sendCommand(uint8_t command, uint32_t argument);
+			
+			bool
+			receiveBlock(uint8_t *data, uint16_t length);
+			
+			/// Send a data block, \c token 0xfd sends the stop token
+			bool
+			transmitBlock(const uint8_t *data, uint8_t token);
+			
+			/// Read the number of sectors from the CSD register
+			bool
+			readCapacity();
+			
+			bool
+			readSectors(uint8_t *data, uint32_t sector, uint8_t count);
+			
+			bool
+			writeSectors(const uint8_t *data, uint32_t sector, uint8_t count);
+			
+			/// Write the buffer if it contains sectors not written yet
+			bool
+			flushBuffer();
+			
+			Status status;
+			uint8_t cardType;
+			uint32_t sectors;
+			
+			uint8_t buffer[BufferSectors * SECTOR_SIZE];
+			uint32_t bufferSector;
+			uint8_t bufferCount;
+			bool bufferDirty;
+			
+			/// Sector after the last one read without the buffer
+			uint32_t nextSector;
+			
+			Statistics statistics;
+		};
+	}
 }
 
+#include "sd_impl.hpp"
+
 #endif // XPCC__SD_HPP
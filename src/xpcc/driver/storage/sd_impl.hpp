@@ -0,0 +1,552 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__SD_HPP
+	#error	"Don't include this file directly, use 'sd.hpp' instead!"
+#endif
+
+#include <cstring>
+#include <xpcc/workflow/timeout.hpp>
+
+#include "sd_constants.hpp"
+
+// ----------------------------------------------------------------------------
+template <typename Spi, typename Cs, uint8_t BufferSectors>
+xpcc::fat::SdCardVolume<Spi, Cs, BufferSectors>::SdCardVolume() :
+	status(STA_NOINIT), cardType(0), sectors(0),
+	bufferSector(0), bufferCount(0), bufferDirty(false), nextSector(0)
+{
+	resetStatistics();
+}
+
+template <typename Spi, typename Cs, uint8_t BufferSectors>
+xpcc::fat::Status
+xpcc::fat::SdCardVolume<Spi, Cs, BufferSectors>::initialize()
+{
+	status = STA_NOINIT;
+	cardType = 0;
+	bufferCount = 0;
+	bufferDirty = false;
+	
+	Cs::setOutput();
+	Cs::set();
+	
+	// at least 74 clock cycles with CS high to enter the native mode
+	for (uint_fast8_t i = 0; i < 10; ++i) {
+		Spi::write(0xff);
+	}
+	
+	uint8_t type = 0;
+	if (sendCommand(CMD0, 0) == 1)
+	{
+		xpcc::Timeout<> timeout(1000);
+		if (sendCommand(CMD8, 0x1aa) == 1)
+		{
+			// SD version 2
+			uint8_t ocr[4];
+			for (uint_fast8_t i = 0; i < 4; ++i) {
+				ocr[i] = Spi::write(0xff);
+			}
+			
+			if (ocr[2] == 0x01 && ocr[3] == 0xaa)
+			{
+				// wait until the card has left the idle state, with HCS set
+				while (!timeout.isExpired() && sendCommand(ACMD41, 1UL << 30) != 0) {
+				}
+				
+				if (!timeout.isExpired() && sendCommand(CMD58, 0) == 0)
+				{
+					for (uint_fast8_t i = 0; i < 4; ++i) {
+						ocr[i] = Spi::write(0xff);
+					}
+					type = (ocr[0] & 0x40) ? (CT_SD2 | CT_BLOCK) : CT_SD2;
+				}
+			}
+		}
+		else
+		{
+			// SD version 1 or MMC version 3
+			uint8_t command;
+			if (sendCommand(ACMD41, 0) <= 1) {
+				type = CT_SD1;
+				command = ACMD41;
+			}
+			else {
+				type = CT_MMC;
+				command = CMD1;
+			}
+			
+			while (!timeout.isExpired() && sendCommand(command, 0) != 0) {
+			}
+			
+			if (timeout.isExpired() || sendCommand(CMD16, SECTOR_SIZE) != 0) {
+				type = 0;
+			}
+		}
+	}
+	cardType = type;
+	
+	if (type != 0 && readCapacity()) {
+		status = 0;
+	}
+	deselect();
+	
+	return status;
+}
+
+template <typename Spi, typename Cs, uint8_t BufferSectors>
+xpcc::fat::Status
+xpcc::fat::SdCardVolume<Spi, Cs, BufferSectors>::getStatus()
+{
+	return status;
+}
+
+// ----------------------------------------------------------------------------
+template <typename Spi, typename Cs, uint8_t BufferSectors>
+xpcc::fat::Result
+xpcc::fat::SdCardVolume<Spi, Cs, BufferSectors>::read(uint8_t *data,
+		int32_t sectorNumber, uint8_t sectorCount)
+{
+	if (status & STA_NOINIT) {
+		return RES_NOTRDY;
+	}
+	if (sectorNumber < 0 || sectorCount == 0 ||
+			static_cast<uint32_t>(sectorNumber) + sectorCount > sectors) {
+		return RES_PARERR;
+	}
+	
+	uint32_t sector = sectorNumber;
+	if (sectorCount >= BufferSectors)
+	{
+		// Large transfers go directly to the destination. Sectors not
+		// yet written to the card must be written first.
+		if (bufferDirty && sector < bufferSector + bufferCount &&
+				bufferSector < sector + sectorCount && !flushBuffer()) {
+			return RES_ERROR;
+		}
+		if (!readSectors(data, sector, sectorCount)) {
+			return RES_ERROR;
+		}
+		nextSector = sector + sectorCount;
+		return RES_OK;
+	}
+	
+	for (; sectorCount > 0; --sectorCount, ++sector, data += SECTOR_SIZE)
+	{
+		uint32_t index = sector - bufferSector;
+		if (index < bufferCount)
+		{
+			std::memcpy(data, buffer + index * SECTOR_SIZE, SECTOR_SIZE);
+			statistics.bufferHits++;
+			continue;
+		}
+		
+		// Sectors which are rewritten are read one by one, so that the
+		// writes can still be collected.
+		bool sequential = (sector == nextSector) ||
+				(bufferCount > 0 && index == bufferCount);
+		if (sequential && !bufferDirty && BufferSectors > 1)
+		{
+			// read-ahead
+			uint8_t count = BufferSectors;
+			if (sectors - sector < count) {
+				count = sectors - sector;
+			}
+			
+			bufferCount = 0;
+			if (!readSectors(buffer, sector, count)) {
+				return RES_ERROR;
+			}
+			bufferSector = sector;
+			bufferCount = count;
+			std::memcpy(data, buffer, SECTOR_SIZE);
+		}
+		else
+		{
+			if (!readSectors(data, sector, 1)) {
+				return RES_ERROR;
+			}
+			nextSector = sector + 1;
+		}
+	}
+	return RES_OK;
+}
+
+template <typename Spi, typename Cs, uint8_t BufferSectors>
+xpcc::fat::Result
+xpcc::fat::SdCardVolume<Spi, Cs, BufferSectors>::write(const uint8_t *data,
+		int32_t sectorNumber, uint8_t sectorCount)
+{
+	if (status & STA_NOINIT) {
+		return RES_NOTRDY;
+	}
+	if (sectorNumber < 0 || sectorCount == 0 ||
+			static_cast<uint32_t>(sectorNumber) + sectorCount > sectors) {
+		return RES_PARERR;
+	}
+	
+	uint32_t sector = sectorNumber;
+	if (sectorCount >= BufferSectors)
+	{
+		// keep the order of the writes
+		if (!flushBuffer()) {
+			return RES_ERROR;
+		}
+		if (sector < bufferSector + bufferCount && bufferSector < sector + sectorCount) {
+			bufferCount = 0;
+		}
+		return writeSectors(data, sector, sectorCount) ? RES_OK : RES_ERROR;
+	}
+	
+	for (; sectorCount > 0; --sectorCount, ++sector, data += SECTOR_SIZE)
+	{
+		uint32_t index = sector - bufferSector;
+		if (bufferDirty && index < bufferCount) {
+			// written again before it was written to the card
+		}
+		else if (bufferDirty && index == bufferCount && bufferCount < BufferSectors) {
+			bufferCount++;
+		}
+		else
+		{
+			if (!flushBuffer()) {
+				return RES_ERROR;
+			}
+			bufferSector = sector;
+			bufferCount = 1;
+			bufferDirty = true;
+			index = 0;
+		}
+		std::memcpy(buffer + index * SECTOR_SIZE, data, SECTOR_SIZE);
+	}
+	return RES_OK;
+}
+
+template <typename Spi, typename Cs, uint8_t BufferSectors>
+xpcc::fat::Result
+xpcc::fat::SdCardVolume<Spi, Cs, BufferSectors>::ioctl(uint8_t command, uint32_t *buffer)
+{
+	if (status & STA_NOINIT) {
+		return RES_NOTRDY;
+	}
+	
+	switch (command)
+	{
+		case CTRL_SYNC:
+		{
+			if (!flushBuffer()) {
+				return RES_ERROR;
+			}
+			
+			// wait until the last block is programmed
+			bool ready = select();
+			deselect();
+			return ready ? RES_OK : RES_ERROR;
+		}
+		
+		case GET_SECTOR_COUNT:
+			*buffer = sectors;
+			return RES_OK;
+		
+		case GET_SECTOR_SIZE:
+			// FatFs expects a WORD here
+			*reinterpret_cast<uint16_t *>(buffer) = SECTOR_SIZE;
+			return RES_OK;
+		
+		case GET_BLOCK_SIZE:
+			// unknown erase block size
+			*buffer = 1;
+			return RES_OK;
+		
+		default:
+			return RES_PARERR;
+	}
+}
+
+template <typename Spi, typename Cs, uint8_t BufferSectors>
+void
+xpcc::fat::SdCardVolume<Spi, Cs, BufferSectors>::resetStatistics()
+{
+	std::memset(&statistics, 0, sizeof(statistics));
+}
+
+// ----------------------------------------------------------------------------
+template <typename Spi, typename Cs, uint8_t BufferSectors>
+bool
+xpcc::fat::SdCardVolume<Spi, Cs, BufferSectors>::select()
+{
+	Cs::reset();
+	
+	// dummy clock to enable DO
+	Spi::write(0xff);
+	if (waitUntilReady(500)) {
+		return true;
+	}
+	
+	deselect();
+	return false;
+}
+
+template <typename Spi, typename Cs, uint8_t BufferSectors>
+void
+xpcc::fat::SdCardVolume<Spi, Cs, BufferSectors>::deselect()
+{
+	Cs::set();
+	
+	// dummy clock to release DO
+	Spi::write(0xff);
+}
+
+template <typename Spi, typename Cs, uint8_t BufferSectors>
+bool
+xpcc::fat::SdCardVolume<Spi, Cs, BufferSectors>::waitUntilReady(uint16_t milliseconds)
+{
+	// the card holds DO low while it is busy
+	xpcc::Timeout<> timeout(milliseconds);
+	while (Spi::write(0xff) != 0xff)
+	{
+		if (timeout.isExpired()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+template <typename Spi, typename Cs, uint8_t BufferSectors>
+uint8_t
+xpcc::fat::SdCardVolume<Spi, Cs, BufferSectors>::sendCommand(uint8_t command, uint32_t argument)
+{
+	if (command & 0x80)
+	{
+		// application specific command
+		command &= 0x7f;
+		uint8_t response = sendCommand(CMD55, 0);
+		if (response > 1) {
+			return response;
+		}
+	}
+	
+	if (command != CMD12)
+	{
+		deselect();
+		if (!select()) {
+			return 0xff;
+		}
+	}
+	
+	Spi::write(command);
+	Spi::write(argument >> 24);
+	Spi::write(argument >> 16);
+	Spi::write(argument >> 8);
+	Spi::write(argument);
+	
+	// only CMD0 and CMD8 need a valid CRC in SPI mode
+	uint8_t crc = 0x01;
+	if (command == CMD0) {
+		crc = 0x95;
+	}
+	else if (command == CMD8) {
+		crc = 0x87;
+	}
+	Spi::write(crc);
+	
+	if (command == CMD12) {
+		// skip the stuff byte
+		Spi::write(0xff);
+	}
+	
+	uint8_t response;
+	uint_fast8_t retries = 10;
+	do {
+		response = Spi::write(0xff);
+	}
+	while ((response & 0x80) && --retries);
+	
+	return response;
+}
+
+template <typename Spi, typename Cs, uint8_t BufferSectors>
+bool
+xpcc::fat::SdCardVolume<Spi, Cs, BufferSectors>::receiveBlock(uint8_t *data, uint16_t length)
+{
+	xpcc::Timeout<> timeout(200);
+	uint8_t token;
+	do {
+		token = Spi::write(0xff);
+	}
+	while (token == 0xff && !timeout.isExpired());
+	
+	if (token != 0xfe) {
+		return false;
+	}
+	
+	Spi::setBuffer(length, 0, data);
+	Spi::transferSync(Spi::TRANSFER_SEND_DUMMY_SAVE_RECEIVE);
+	
+	// discard the CRC
+	Spi::write(0xff);
+	Spi::write(0xff);
+	return true;
+}
+
+template <typename Spi, typename Cs, uint8_t BufferSectors>
+bool
+xpcc::fat::SdCardVolume<Spi, Cs, BufferSectors>::transmitBlock(const uint8_t *data, uint8_t token)
+{
+	if (!waitUntilReady(500)) {
+		return false;
+	}
+	
+	Spi::write(token);
+	if (token == 0xfd) {
+		return true;
+	}
+	
+	// the buffer is only read, the received bytes are discarded
+	Spi::setBuffer(SECTOR_SIZE, const_cast<uint8_t *>(data), 0);
+	Spi::transferSync(Spi::TRANSFER_SEND_BUFFER_DISCARD_RECEIVE);
+	
+	// dummy CRC
+	Spi::write(0xff);
+	Spi::write(0xff);
+	
+	uint8_t response = Spi::write(0xff);
+	return ((response & 0x1f) == 0x05);
+}
+
+template <typename Spi, typename Cs, uint8_t BufferSectors>
+bool
+xpcc::fat::SdCardVolume<Spi, Cs, BufferSectors>::readCapacity()
+{
+	uint8_t csd[16];
+	if (sendCommand(CMD9, 0) != 0 || !receiveBlock(csd, sizeof(csd))) {
+		return false;
+	}
+	
+	if ((csd[0] >> 6) == 1)
+	{
+		// CSD version 2.0, SDHC and SDXC
+		uint32_t size = csd[9] + (static_cast<uint32_t>(csd[8]) << 8) +
+				(static_cast<uint32_t>(csd[7] & 0x3f) << 16) + 1;
+		sectors = size << 10;
+	}
+	else
+	{
+		// CSD version 1.0, SD version 1 and MMC
+		uint8_t shift = (csd[5] & 15) + ((csd[10] & 128) >> 7) + ((csd[9] & 3) << 1) + 2;
+		uint32_t size = (csd[8] >> 6) + (static_cast<uint16_t>(csd[7]) << 2) +
+				(static_cast<uint16_t>(csd[6] & 3) << 10) + 1;
+		sectors = size << (shift - 9);
+	}
+	return true;
+}
+
+template <typename Spi, typename Cs, uint8_t BufferSectors>
+bool
+xpcc::fat::SdCardVolume<Spi, Cs, BufferSectors>::readSectors(uint8_t *data,
+		uint32_t sector, uint8_t count)
+{
+	statistics.readCommands++;
+	statistics.sectorsRead += count;
+	
+	uint32_t address = (cardType & CT_BLOCK) ? sector : sector * SECTOR_SIZE;
+	bool success;
+	if (count == 1)
+	{
+		success = (sendCommand(CMD17, address) == 0) &&
+				receiveBlock(data, SECTOR_SIZE);
+	}
+	else
+	{
+		success = (sendCommand(CMD18, address) == 0);
+		for (; success && count > 0; --count, data += SECTOR_SIZE) {
+			success = receiveBlock(data, SECTOR_SIZE);
+		}
+		sendCommand(CMD12, 0);
+	}
+	deselect();
+	
+	return success;
+}
+
+template <typename Spi, typename Cs, uint8_t BufferSectors>
+bool
+xpcc::fat::SdCardVolume<Spi, Cs, BufferSectors>::writeSectors(const uint8_t *data,
+		uint32_t sector, uint8_t count)
+{
+	statistics.writeCommands++;
+	statistics.sectorsWritten += count;
+	
+	uint32_t address = (cardType & CT_BLOCK) ? sector : sector * SECTOR_SIZE;
+	bool success;
+	if (count == 1)
+	{
+		success = (sendCommand(CMD24, address) == 0) &&
+				transmitBlock(data, 0xfe);
+	}
+	else
+	{
+		// let the card erase the blocks in advance
+		if (cardType & CT_SDC) {
+			sendCommand(ACMD23, count);
+		}
+		
+		success = (sendCommand(CMD25, address) == 0);
+		if (success)
+		{
+			for (; success && count > 0; --count, data += SECTOR_SIZE) {
+				success = transmitBlock(data, 0xfc);
+			}
+			if (!transmitBlock(0, 0xfd)) {
+				success = false;
+			}
+		}
+	}
+	deselect();
+	
+	return success;
+}
+
+template <typename Spi, typename Cs, uint8_t BufferSectors>
+bool
+xpcc::fat::SdCardVolume<Spi, Cs, BufferSectors>::flushBuffer()
+{
+	if (!bufferDirty) {
+		return true;
+	}
+	
+	bufferDirty = false;
+	if (!writeSectors(buffer, bufferSector, bufferCount)) {
+		// the content of the card is unknown now
+		bufferCount = 0;
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,81 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__SPI_RAM_BLOCK_DEVICE_HPP
+#define XPCC__SPI_RAM_BLOCK_DEVICE_HPP
+
+#include "spi_ram.hpp"
+#include "block_device.hpp"
+
+namespace xpcc
+{
+	/**
+	 * \brief	Block device for the serial SRAM
+	 * 
+	 * The SRAM has no page structure in the sequential mode used by
+	 * xpcc::SpiRam, so the block size can be chosen freely. Consecutive
+	 * blocks are transferred with a single read or write command.
+	 * 
+	 * \tparam	BlockSize	Size of a block in bytes
+	 * \tparam	Size		Size of the memory in bytes (32768 for the 23K256)
+	 * 
+	 * \see		SpiRam
+	 * \ingroup	storage
+	 */
+	template <typename Spi, typename Cs, typename Hold,
+			uint16_t BlockSize = 64, uint32_t Size = 32768>
+	class SpiRamBlockDevice : public BlockDevice
+	{
+	public:
+		virtual bool
+		initialize();
+		
+		virtual uint16_t
+		getBlockSize() const;
+		
+		virtual uint32_t
+		getBlockCount() const;
+		
+		virtual bool
+		read(uint32_t block, uint8_t *data, uint32_t count);
+		
+		virtual bool
+		write(uint32_t block, const uint8_t *data, uint32_t count);
+		
+	private:
+		typedef SpiRam<Spi, Cs, Hold> Ram;
+		
+		static const uint32_t BLOCKS = Size / BlockSize;
+	};
+}
+
+#include "spi_ram_block_device_impl.hpp"
+
+#endif // XPCC__SPI_RAM_BLOCK_DEVICE_HPP
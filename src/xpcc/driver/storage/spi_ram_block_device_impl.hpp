@@ -0,0 +1,86 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__SPI_RAM_BLOCK_DEVICE_HPP
+	#error	"Don't include this file directly, use 'spi_ram_block_device.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename Spi, typename Cs, typename Hold, uint16_t BlockSize, uint32_t Size>
+bool
+xpcc::SpiRamBlockDevice<Spi, Cs, Hold, BlockSize, Size>::initialize()
+{
+	return Ram::initialize();
+}
+
+template <typename Spi, typename Cs, typename Hold, uint16_t BlockSize, uint32_t Size>
+uint16_t
+xpcc::SpiRamBlockDevice<Spi, Cs, Hold, BlockSize, Size>::getBlockSize() const
+{
+	return BlockSize;
+}
+
+template <typename Spi, typename Cs, typename Hold, uint16_t BlockSize, uint32_t Size>
+uint32_t
+xpcc::SpiRamBlockDevice<Spi, Cs, Hold, BlockSize, Size>::getBlockCount() const
+{
+	return BLOCKS;
+}
+
+// ----------------------------------------------------------------------------
+template <typename Spi, typename Cs, typename Hold, uint16_t BlockSize, uint32_t Size>
+bool
+xpcc::SpiRamBlockDevice<Spi, Cs, Hold, BlockSize, Size>::read(uint32_t block,
+		uint8_t *data, uint32_t count)
+{
+	if (block > BLOCKS || count > BLOCKS - block) {
+		return false;
+	}
+	
+	Ram::startRead(block * BlockSize);
+	Ram::read(data, count * BlockSize);
+	Ram::finish();
+	return true;
+}
+
+template <typename Spi, typename Cs, typename Hold, uint16_t BlockSize, uint32_t Size>
+bool
+xpcc::SpiRamBlockDevice<Spi, Cs, Hold, BlockSize, Size>::write(uint32_t block,
+		const uint8_t *data, uint32_t count)
+{
+	if (block > BLOCKS || count > BLOCKS - block) {
+		return false;
+	}
+	
+	Ram::startWrite(block * BlockSize);
+	Ram::write(data, count * BlockSize);
+	Ram::finish();
+	return true;
+}
@@ -0,0 +1,118 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/architecture/platform/hosted/storage/at45db_simulator.hpp>
+
+#include <xpcc/driver/storage/at45db_block_device.hpp>
+#include <xpcc/driver/storage/block_cache.hpp>
+
+#include "block_cache_benchmark.hpp"
+
+namespace
+{
+	typedef xpcc::pc::At45dbSimulator Simulator;
+	typedef xpcc::At45db0x1d<Simulator::Spi, Simulator::Cs> Dataflash;
+	typedef xpcc::At45dbBlockDevice<Simulator::Spi, Simulator::Cs, 512> Flash;
+	
+	const uint32_t size = 512 * 256;
+	uint8_t record[16];
+}
+
+void
+BlockCacheBenchmark::setUp()
+{
+	// A status read takes 2us at 8MHz, so programming a page (14ms)
+	// takes about 7000 of them.
+	Simulator::initialize(512);
+	Simulator::setBusyPolls(7000);
+	
+	for (uint_fast8_t i = 0; i < sizeof(record); ++i) {
+		record[i] = i;
+	}
+}
+
+void
+BlockCacheBenchmark::tearDown()
+{
+}
+
+// ----------------------------------------------------------------------------
+void
+BlockCacheBenchmark::benchmarkCachedRecords(unittest::BenchmarkState& state)
+{
+	Flash flash;
+	xpcc::BlockCache<256, 2> cache(flash);
+	cache.initialize();
+	
+	uint32_t address = 0;
+	while (state.keepRunning())
+	{
+		cache.write(address, record, sizeof(record));
+		address = (address + sizeof(record)) % size;
+	}
+	cache.flush();
+}
+
+void
+BlockCacheBenchmark::benchmarkPageRewrite(unittest::BenchmarkState& state)
+{
+	Dataflash::initialize();
+	
+	uint32_t address = 0;
+	while (state.keepRunning())
+	{
+		uint16_t page = address / 256;
+		Dataflash::copyPageToBuffer(page, xpcc::at45db::BUFFER_0);
+		Dataflash::waitUntilReady();
+		Dataflash::writeToBuffer(xpcc::at45db::BUFFER_0, address % 256,
+				record, sizeof(record));
+		Dataflash::copyBufferToPage(xpcc::at45db::BUFFER_0, page);
+		Dataflash::waitUntilReady();
+		
+		address = (address + sizeof(record)) % size;
+	}
+}
+
+void
+BlockCacheBenchmark::benchmarkCachedRead(unittest::BenchmarkState& state)
+{
+	Flash flash;
+	xpcc::BlockCache<256, 2> cache(flash);
+	cache.initialize();
+	
+	uint8_t data[64];
+	while (state.keepRunning())
+	{
+		for (uint32_t address = 0; address < 4096; address += sizeof(data)) {
+			cache.read(address, data, sizeof(data));
+		}
+		unittest::doNotOptimize(data);
+	}
+}
@@ -0,0 +1,61 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/benchmark/benchmark.hpp>
+
+/**
+ * \brief	Appending small records to the simulated DataFlash
+ * 
+ * The simulator decodes every SPI byte and a page program keeps it
+ * busy for as many status reads as would fit into the programming time
+ * at 8MHz. The times are therefore roughly proportional to the time
+ * on a real device, but only the ratios are meaningful.
+ */
+class BlockCacheBenchmark : public unittest::Benchmark
+{
+public:
+	virtual void
+	setUp();
+	
+	virtual void
+	tearDown();
+	
+	/// 16 byte records written through a BlockCache
+	void
+	benchmarkCachedRecords(unittest::BenchmarkState& state);
+	
+	/// 16 byte records, each with a read-modify-write of its page
+	void
+	benchmarkPageRewrite(unittest::BenchmarkState& state);
+	
+	/// 4kB read in 64 byte pieces through a BlockCache
+	void
+	benchmarkCachedRead(unittest::BenchmarkState& state);
+};
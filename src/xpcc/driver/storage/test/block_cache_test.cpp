@@ -0,0 +1,306 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <cstring>
+
+#include <xpcc/driver/storage/block_cache.hpp>
+
+#include "block_cache_test.hpp"
+
+namespace
+{
+	/// 8 blocks with 16 bytes, counts the calls
+	class RamDevice : public xpcc::BlockDevice
+	{
+	public:
+		RamDevice(uint16_t blockSize = 16) :
+			blockSize(blockSize), readCalls(0), writeCalls(0), fail(false)
+		{
+			for (uint_fast8_t i = 0; i < sizeof(memory); ++i) {
+				memory[i] = i;
+			}
+		}
+		
+		virtual bool
+		initialize()
+		{
+			return true;
+		}
+		
+		virtual uint16_t
+		getBlockSize() const
+		{
+			return blockSize;
+		}
+		
+		virtual uint32_t
+		getBlockCount() const
+		{
+			return 8;
+		}
+		
+		virtual bool
+		read(uint32_t block, uint8_t *data, uint32_t count)
+		{
+			readCalls++;
+			std::memcpy(data, memory + block * 16, count * 16);
+			return !fail;
+		}
+		
+		virtual bool
+		write(uint32_t block, const uint8_t *data, uint32_t count)
+		{
+			writeCalls++;
+			if (!fail) {
+				std::memcpy(memory + block * 16, data, count * 16);
+			}
+			return !fail;
+		}
+		
+		uint8_t memory[8 * 16];
+		uint16_t blockSize;
+		
+		uint8_t readCalls;
+		uint8_t writeCalls;
+		bool fail;
+	};
+	
+	typedef xpcc::BlockCache<16, 2> Cache;
+}
+
+// ----------------------------------------------------------------------------
+void
+BlockCacheTest::testInitialize()
+{
+	RamDevice device;
+	Cache cache(device);
+	
+	TEST_ASSERT_TRUE(cache.initialize());
+	TEST_ASSERT_EQUALS(cache.getSize(), 128U);
+	
+	RamDevice other(32);
+	Cache wrongSize(other);
+	TEST_ASSERT_FALSE(wrongSize.initialize());
+}
+
+void
+BlockCacheTest::testReadHit()
+{
+	RamDevice device;
+	Cache cache(device);
+	cache.initialize();
+	
+	uint8_t data[10];
+	TEST_ASSERT_TRUE(cache.read(20, data, 10));
+	TEST_ASSERT_EQUALS(data[0], 20);
+	TEST_ASSERT_EQUALS(data[9], 29);
+	TEST_ASSERT_EQUALS(cache.getStatistics().misses, 1U);
+	TEST_ASSERT_EQUALS(device.readCalls, 1);
+	
+	TEST_ASSERT_TRUE(cache.read(16, data, 4));
+	TEST_ASSERT_EQUALS(data[0], 16);
+	TEST_ASSERT_EQUALS(cache.getStatistics().hits, 1U);
+	TEST_ASSERT_EQUALS(device.readCalls, 1);
+	
+	// crosses into the next block
+	TEST_ASSERT_TRUE(cache.read(30, data, 4));
+	TEST_ASSERT_EQUALS(data[0], 30);
+	TEST_ASSERT_EQUALS(data[3], 33);
+	TEST_ASSERT_EQUALS(cache.getStatistics().hits, 2U);
+	TEST_ASSERT_EQUALS(cache.getStatistics().misses, 2U);
+	TEST_ASSERT_EQUALS(device.readCalls, 2);
+}
+
+void
+BlockCacheTest::testWriteCombining()
+{
+	RamDevice device;
+	Cache cache(device);
+	cache.initialize();
+	
+	for (uint8_t i = 0; i < 16; ++i) {
+		uint8_t value = 0xa0 + i;
+		TEST_ASSERT_TRUE(cache.write(48 + i, &value, 1));
+	}
+	TEST_ASSERT_EQUALS(device.writeCalls, 0);
+	TEST_ASSERT_EQUALS(device.memory[48], 48);
+	
+	uint8_t data[2];
+	cache.read(62, data, 2);
+	TEST_ASSERT_EQUALS(data[0], 0xae);
+	TEST_ASSERT_EQUALS(data[1], 0xaf);
+	
+	TEST_ASSERT_TRUE(cache.flush());
+	TEST_ASSERT_EQUALS(device.writeCalls, 1);
+	TEST_ASSERT_EQUALS(device.memory[48], 0xa0);
+	TEST_ASSERT_EQUALS(device.memory[63], 0xaf);
+	TEST_ASSERT_EQUALS(device.memory[64], 64);
+	
+	// nothing left to write
+	TEST_ASSERT_TRUE(cache.flush());
+	TEST_ASSERT_EQUALS(device.writeCalls, 1);
+}
+
+void
+BlockCacheTest::testLeastRecentlyUsed()
+{
+	RamDevice device;
+	Cache cache(device);
+	cache.initialize();
+	
+	uint8_t value;
+	cache.read(0, &value, 1);
+	cache.read(16, &value, 1);
+	cache.read(1, &value, 1);
+	TEST_ASSERT_EQUALS(device.readCalls, 2);
+	
+	// replaces block 1
+	cache.read(32, &value, 1);
+	TEST_ASSERT_EQUALS(device.readCalls, 3);
+	
+	cache.read(2, &value, 1);
+	TEST_ASSERT_EQUALS(device.readCalls, 3);
+	
+	cache.read(17, &value, 1);
+	TEST_ASSERT_EQUALS(device.readCalls, 4);
+	TEST_ASSERT_EQUALS(value, 17);
+}
+
+void
+BlockCacheTest::testWriteBackOnReplacement()
+{
+	RamDevice device;
+	Cache cache(device);
+	cache.initialize();
+	
+	uint8_t value = 0x55;
+	cache.write(5, &value, 1);
+	cache.read(16, &value, 1);
+	cache.read(32, &value, 1);
+	
+	TEST_ASSERT_EQUALS(device.writeCalls, 1);
+	TEST_ASSERT_EQUALS(device.memory[5], 0x55);
+	TEST_ASSERT_EQUALS(cache.getStatistics().blockWrites, 1U);
+}
+
+void
+BlockCacheTest::testCompleteBlocks()
+{
+	RamDevice device;
+	Cache cache(device);
+	cache.initialize();
+	
+	// read directly with a single call
+	uint8_t data[48];
+	TEST_ASSERT_TRUE(cache.read(16, data, 48));
+	TEST_ASSERT_EQUALS(device.readCalls, 1);
+	TEST_ASSERT_EQUALS(data[0], 16);
+	TEST_ASSERT_EQUALS(data[47], 63);
+	
+	// and nothing was cached
+	uint8_t value;
+	cache.read(16, &value, 1);
+	TEST_ASSERT_EQUALS(device.readCalls, 2);
+	
+	// full blocks are written without reading them first
+	std::memset(data, 0x11, sizeof(data));
+	TEST_ASSERT_TRUE(cache.write(64, data, 32));
+	TEST_ASSERT_EQUALS(device.readCalls, 2);
+	TEST_ASSERT_EQUALS(device.writeCalls, 1);
+	TEST_ASSERT_EQUALS(device.memory[64], 0x11);
+	TEST_ASSERT_EQUALS(device.memory[95], 0x11);
+	TEST_ASSERT_EQUALS(device.memory[96], 96);
+}
+
+void
+BlockCacheTest::testCompleteBlocksCached()
+{
+	RamDevice device;
+	Cache cache(device);
+	cache.initialize();
+	
+	uint8_t value = 0x77;
+	cache.write(20, &value, 1);
+	
+	// block 1 is taken from the cache, blocks 0 and 2 from the device
+	uint8_t data[48];
+	TEST_ASSERT_TRUE(cache.read(0, data, 48));
+	TEST_ASSERT_EQUALS(data[19], 19);
+	TEST_ASSERT_EQUALS(data[20], 0x77);
+	TEST_ASSERT_EQUALS(data[32], 32);
+	
+	// the cached copy is updated, no stale data is written back later
+	std::memset(data, 0x22, sizeof(data));
+	TEST_ASSERT_TRUE(cache.write(0, data, 48));
+	TEST_ASSERT_TRUE(cache.flush());
+	for (uint_fast8_t i = 0; i < 48; ++i) {
+		TEST_ASSERT_EQUALS(device.memory[i], 0x22);
+	}
+}
+
+void
+BlockCacheTest::testOutOfRange()
+{
+	RamDevice device;
+	Cache cache(device);
+	cache.initialize();
+	
+	uint8_t data[4];
+	TEST_ASSERT_TRUE(cache.read(124, data, 4));
+	TEST_ASSERT_FALSE(cache.read(125, data, 4));
+	TEST_ASSERT_FALSE(cache.write(128, data, 1));
+	TEST_ASSERT_FALSE(cache.write(0xffffffff, data, 2));
+}
+
+void
+BlockCacheTest::testDeviceError()
+{
+	RamDevice device;
+	Cache cache(device);
+	cache.initialize();
+	
+	uint8_t value = 1;
+	device.fail = true;
+	TEST_ASSERT_FALSE(cache.read(0, &value, 1));
+	
+	// the failed block is not cached
+	device.fail = false;
+	TEST_ASSERT_TRUE(cache.read(0, &value, 1));
+	TEST_ASSERT_EQUALS(device.readCalls, 2);
+	
+	cache.write(0, &value, 1);
+	device.fail = true;
+	TEST_ASSERT_FALSE(cache.flush());
+	
+	// the block is still modified and written with the next flush
+	device.fail = false;
+	TEST_ASSERT_TRUE(cache.flush());
+	TEST_ASSERT_EQUALS(device.writeCalls, 2);
+}
@@ -0,0 +1,257 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <cstdio>
+#include <cstring>
+
+#include <xpcc/architecture/platform/hosted/storage/at45db_simulator.hpp>
+#include <xpcc/architecture/platform/hosted/storage/spi_ram_simulator.hpp>
+#include <xpcc/architecture/platform/hosted/storage/i2c_eeprom_simulator.hpp>
+
+#include <xpcc/driver/storage/at45db_block_device.hpp>
+#include <xpcc/driver/storage/spi_ram_block_device.hpp>
+#include <xpcc/driver/storage/i2c_eeprom_block_device.hpp>
+#include <xpcc/driver/storage/block_cache.hpp>
+#include <xpcc/driver/storage/block_volume.hpp>
+
+#include "block_device_test.hpp"
+
+namespace
+{
+	typedef xpcc::pc::At45dbSimulator FlashSimulator;
+	typedef xpcc::At45dbBlockDevice<FlashSimulator::Spi, FlashSimulator::Cs, 512> Flash;
+	
+	typedef xpcc::pc::SpiRamSimulator RamSimulator;
+	typedef xpcc::SpiRamBlockDevice<RamSimulator::Spi, RamSimulator::Cs, RamSimulator::Hold> Ram;
+	
+	typedef xpcc::i2c::MockMaster Master;
+	typedef xpcc::I2cEepromBlockDevice<Master> Eeprom;
+	
+	void
+	fill(uint8_t *data, std::size_t size, uint8_t start)
+	{
+		for (std::size_t i = 0; i < size; ++i) {
+			data[i] = start + i;
+		}
+	}
+	
+	uint8_t input[1536];
+	uint8_t output[1536];
+}
+
+// ----------------------------------------------------------------------------
+void
+BlockDeviceTest::testAt45db()
+{
+	FlashSimulator::initialize(512);
+	FlashSimulator::setBusyPolls(3);
+	
+	Flash flash;
+	TEST_ASSERT_TRUE(flash.initialize());
+	TEST_ASSERT_EQUALS(flash.getBlockSize(), 256U);
+	TEST_ASSERT_EQUALS(flash.getBlockCount(), 512U);
+	
+	fill(input, 768, 0);
+	TEST_ASSERT_TRUE(flash.write(10, input, 3));
+	TEST_ASSERT_TRUE(flash.flush());
+	TEST_ASSERT_TRUE(std::memcmp(FlashSimulator::getMemory() + 10 * 256, input, 768) == 0);
+	
+	// pages 9 and 13 are read from the memory, the others partly from the buffers
+	TEST_ASSERT_TRUE(flash.read(9, output, 5));
+	TEST_ASSERT_EQUALS(output[0], 0xff);
+	TEST_ASSERT_TRUE(std::memcmp(output + 256, input, 768) == 0);
+	TEST_ASSERT_EQUALS(output[4 * 256], 0xff);
+	
+	TEST_ASSERT_FALSE(flash.write(511, input, 2));
+	TEST_ASSERT_FALSE(flash.read(512, output, 1));
+	
+	TEST_ASSERT_EQUALS(FlashSimulator::getStatistics().violations, 0U);
+	TEST_ASSERT_EQUALS(FlashSimulator::getStatistics().pagePrograms, 3U);
+}
+
+void
+BlockDeviceTest::testAt45dbDoubleBuffering()
+{
+	FlashSimulator::initialize(512);
+	FlashSimulator::setBusyPolls(5);
+	
+	Flash flash;
+	flash.initialize();
+	
+	fill(input, 1024, 7);
+	flash.write(0, input, 4);
+	
+	// The next page is transferred while the last one is programmed. The
+	// last page is still being programmed.
+	TEST_ASSERT_EQUALS(FlashSimulator::getStatistics().violations, 0U);
+	TEST_ASSERT_EQUALS(FlashSimulator::getStatistics().busyPolls, 3U * 5);
+	
+	// the page in the other buffer is available while the device is busy
+	FlashSimulator::resetStatistics();
+	flash.read(2, output, 1);
+	TEST_ASSERT_EQUALS(FlashSimulator::getStatistics().busyPolls, 0U);
+	TEST_ASSERT_EQUALS(FlashSimulator::getStatistics().pageReads, 0U);
+	TEST_ASSERT_TRUE(std::memcmp(output, input + 512, 256) == 0);
+	
+	flash.read(3, output, 1);
+	TEST_ASSERT_EQUALS(FlashSimulator::getStatistics().busyPolls, 5U);
+	TEST_ASSERT_EQUALS(FlashSimulator::getStatistics().pageReads, 0U);
+	TEST_ASSERT_TRUE(std::memcmp(output, input + 768, 256) == 0);
+	
+	flash.read(0, output, 2);
+	TEST_ASSERT_EQUALS(FlashSimulator::getStatistics().pageReads, 2U);
+	TEST_ASSERT_TRUE(std::memcmp(output, input, 512) == 0);
+	
+	TEST_ASSERT_EQUALS(FlashSimulator::getStatistics().violations, 0U);
+}
+
+void
+BlockDeviceTest::testAt45dbFile()
+{
+	const char *filename = "xpcc_at45db_test.bin";
+	std::remove(filename);
+	
+	TEST_ASSERT_TRUE(FlashSimulator::open(filename, 512));
+	FlashSimulator::setBusyPolls(0);
+	
+	Flash flash;
+	flash.initialize();
+	fill(input, 256, 3);
+	flash.write(100, input, 1);
+	FlashSimulator::close();
+	
+	// the content survives a restart
+	TEST_ASSERT_TRUE(FlashSimulator::open(filename, 512));
+	flash.initialize();
+	flash.read(100, output, 1);
+	TEST_ASSERT_TRUE(std::memcmp(output, input, 256) == 0);
+	FlashSimulator::close();
+	
+	std::remove(filename);
+}
+
+void
+BlockDeviceTest::testSpiRam()
+{
+	RamSimulator::initialize();
+	
+	Ram ram;
+	TEST_ASSERT_TRUE(ram.initialize());
+	TEST_ASSERT_EQUALS(ram.getBlockCount(), 512U);
+	
+	fill(input, 192, 1);
+	RamSimulator::resetStatistics();
+	TEST_ASSERT_TRUE(ram.write(511, input, 1));
+	TEST_ASSERT_TRUE(ram.write(4, input, 3));
+	TEST_ASSERT_TRUE(ram.read(4, output, 3));
+	TEST_ASSERT_TRUE(std::memcmp(output, input, 192) == 0);
+	TEST_ASSERT_TRUE(std::memcmp(RamSimulator::getMemory() + 256, input, 192) == 0);
+	
+	// one command for all blocks
+	TEST_ASSERT_EQUALS(RamSimulator::getStatistics().commands, 3U);
+	TEST_ASSERT_EQUALS(RamSimulator::getStatistics().violations, 0U);
+	
+	TEST_ASSERT_FALSE(ram.write(511, input, 2));
+}
+
+void
+BlockDeviceTest::testI2cEeprom()
+{
+	xpcc::pc::I2cEepromSimulator simulator(0x50, 32768, 64);
+	simulator.setBusyPolls(4);
+	Master::initialize(Master::DEVICE_PRESENT, Master::AUTO_MODE);
+	Master::attachSlave(&simulator);
+	
+	Eeprom eeprom;
+	TEST_ASSERT_TRUE(eeprom.initialize());
+	TEST_ASSERT_EQUALS(eeprom.getBlockCount(), 512U);
+	
+	fill(input, 128, 9);
+	TEST_ASSERT_TRUE(eeprom.write(3, input, 2));
+	TEST_ASSERT_TRUE(eeprom.read(3, output, 2));
+	TEST_ASSERT_TRUE(std::memcmp(output, input, 128) == 0);
+	TEST_ASSERT_TRUE(std::memcmp(simulator.getMemory() + 3 * 64, input, 128) == 0);
+	
+	// one write cycle per page, each waited for once
+	TEST_ASSERT_EQUALS(simulator.getStatistics().pageWrites, 2U);
+	TEST_ASSERT_EQUALS(simulator.getStatistics().pageWraps, 0U);
+	TEST_ASSERT_EQUALS(simulator.getStatistics().busyPolls, 2U * 4);
+	
+	Master::attachSlave(0);
+}
+
+void
+BlockDeviceTest::testI2cEepromPageWrap()
+{
+	xpcc::pc::I2cEepromSimulator simulator(0x50, 32768, 64);
+	Master::initialize(Master::DEVICE_PRESENT, Master::AUTO_MODE);
+	Master::attachSlave(&simulator);
+	
+	// without the block device the write wraps around in the page
+	xpcc::I2cEeprom<Master> eeprom(0x50);
+	fill(input, 8, 0x40);
+	eeprom.write(60, input, 8);
+	
+	TEST_ASSERT_EQUALS(simulator.getStatistics().pageWraps, 1U);
+	TEST_ASSERT_EQUALS(simulator.getMemory()[63], 0x43);
+	TEST_ASSERT_EQUALS(simulator.getMemory()[64], 0xff);
+	TEST_ASSERT_EQUALS(simulator.getMemory()[0], 0x44);
+	
+	Master::attachSlave(0);
+}
+
+void
+BlockDeviceTest::testBlockVolume()
+{
+	FlashSimulator::initialize(512);
+	FlashSimulator::setBusyPolls(2);
+	
+	typedef xpcc::BlockCache<256, 2> Cache;
+	Flash flash;
+	Cache cache(flash);
+	xpcc::fat::BlockVolume<Cache> volume(cache);
+	
+	TEST_ASSERT_EQUALS(volume.read(output, 0, 1), RES_NOTRDY);
+	TEST_ASSERT_EQUALS(volume.initialize(), 0);
+	
+	uint32_t value = 0;
+	TEST_ASSERT_EQUALS(volume.ioctl(GET_SECTOR_COUNT, &value), RES_OK);
+	TEST_ASSERT_EQUALS(value, 256U);
+	
+	fill(input, 1024, 0);
+	TEST_ASSERT_EQUALS(volume.write(input, 5, 2), RES_OK);
+	TEST_ASSERT_EQUALS(volume.read(output, 5, 2), RES_OK);
+	TEST_ASSERT_TRUE(std::memcmp(output, input, 1024) == 0);
+	TEST_ASSERT_EQUALS(volume.ioctl(CTRL_SYNC, 0), RES_OK);
+	TEST_ASSERT_TRUE(std::memcmp(FlashSimulator::getMemory() + 5 * 512, input, 1024) == 0);
+	
+	TEST_ASSERT_EQUALS(volume.read(output, 256, 1), RES_ERROR);
+	TEST_ASSERT_EQUALS(FlashSimulator::getStatistics().violations, 0U);
+}
@@ -0,0 +1,113 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/architecture/platform/hosted/storage/at45db_simulator.hpp>
+
+#include <xpcc/driver/storage/at45db_block_device.hpp>
+#include <xpcc/driver/storage/log_store.hpp>
+
+#include "log_store_benchmark.hpp"
+
+namespace
+{
+	typedef xpcc::pc::At45dbSimulator Simulator;
+	typedef xpcc::At45dbBlockDevice<Simulator::Spi, Simulator::Cs, 2048> Flash;
+	typedef xpcc::LogStore<256> Log;
+	
+	uint8_t record[16];
+}
+
+void
+LogStoreBenchmark::setUp()
+{
+	Simulator::initialize(2048);
+	Simulator::setBusyPolls(7000);
+	
+	for (uint_fast8_t i = 0; i < sizeof(record); ++i) {
+		record[i] = i;
+	}
+}
+
+void
+LogStoreBenchmark::tearDown()
+{
+}
+
+// ----------------------------------------------------------------------------
+void
+LogStoreBenchmark::benchmarkAppend(unittest::BenchmarkState& state)
+{
+	Flash flash;
+	Log log(flash);
+	log.initialize();
+	
+	while (state.keepRunning()) {
+		log.append(record, sizeof(record));
+	}
+	log.sync();
+}
+
+void
+LogStoreBenchmark::benchmarkAppendSync(unittest::BenchmarkState& state)
+{
+	Flash flash;
+	Log log(flash);
+	log.initialize();
+	
+	while (state.keepRunning())
+	{
+		log.append(record, sizeof(record));
+		log.sync();
+	}
+}
+
+void
+LogStoreBenchmark::benchmarkMount(unittest::BenchmarkState& state)
+{
+	Simulator::setBusyPolls(0);
+	
+	Flash flash;
+	{
+		Log log(flash);
+		log.initialize();
+		for (uint_fast16_t i = 0; i < 2500; ++i)
+		{
+			log.append(record, sizeof(record));
+			log.sync();
+		}
+	}
+	
+	while (state.keepRunning())
+	{
+		Log log(flash);
+		log.initialize();
+		unittest::doNotOptimize(log);
+	}
+}
@@ -0,0 +1,339 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/architecture/platform/hosted/storage/at45db_simulator.hpp>
+#include <xpcc/architecture/platform/hosted/storage/i2c_eeprom_simulator.hpp>
+
+#include <xpcc/driver/storage/at45db_block_device.hpp>
+#include <xpcc/driver/storage/i2c_eeprom_block_device.hpp>
+#include <xpcc/driver/storage/log_store.hpp>
+
+#include "log_store_test.hpp"
+
+namespace
+{
+	typedef xpcc::pc::At45dbSimulator Simulator;
+	typedef xpcc::At45dbBlockDevice<Simulator::Spi, Simulator::Cs, 512> Flash;
+	typedef xpcc::At45dbBlockDevice<Simulator::Spi, Simulator::Cs, 16> SmallFlash;
+	typedef xpcc::LogStore<256> Log;
+	
+	/// Record of \p size bytes which starts with its index
+	bool
+	append(Log& log, uint16_t index, uint8_t size = 10)
+	{
+		uint8_t data[255];
+		data[0] = index;
+		data[1] = index >> 8;
+		for (uint_fast8_t i = 2; i < size; ++i) {
+			data[i] = index + i;
+		}
+		return log.append(data, size);
+	}
+	
+	/**
+	 * Check that the log contains the records \p first to \p last in
+	 * order and that their content is not damaged.
+	 */
+	bool
+	check(Log& log, uint16_t first, uint16_t last)
+	{
+		Log::Iterator it = log.getIterator();
+		uint16_t expected = first;
+		while (it.next())
+		{
+			const uint8_t *data = it.getData();
+			uint16_t index = data[0] | (data[1] << 8);
+			if (index != expected || expected > last) {
+				return false;
+			}
+			for (uint_fast8_t i = 2; i < it.getSize(); ++i) {
+				if (data[i] != static_cast<uint8_t>(index + i)) {
+					return false;
+				}
+			}
+			expected++;
+		}
+		return (expected == last + 1);
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+LogStoreTest::testAppend()
+{
+	Simulator::initialize(512);
+	
+	Flash flash;
+	Log log(flash);
+	TEST_ASSERT_TRUE(log.initialize());
+	TEST_ASSERT_EQUALS(log.getPages(), 512U);
+	TEST_ASSERT_EQUALS(log.getUsedPages(), 0U);
+	
+	Log::Iterator empty = log.getIterator();
+	TEST_ASSERT_FALSE(empty.next());
+	
+	// 22 records of 11 bytes fit into a page
+	for (uint16_t i = 0; i < 40; ++i) {
+		TEST_ASSERT_TRUE(append(log, i));
+	}
+	TEST_ASSERT_EQUALS(log.getPageWrites(), 1U);
+	TEST_ASSERT_EQUALS(log.getUsedPages(), 1U);
+	
+	// includes the records which are only in RAM
+	TEST_ASSERT_TRUE(check(log, 0, 39));
+	TEST_ASSERT_EQUALS(Simulator::getStatistics().violations, 0U);
+}
+
+void
+LogStoreTest::testRemount()
+{
+	Simulator::initialize(512);
+	
+	Flash flash;
+	{
+		Log log(flash);
+		log.initialize();
+		for (uint16_t i = 0; i < 40; ++i) {
+			append(log, i);
+		}
+		TEST_ASSERT_TRUE(log.sync());
+		TEST_ASSERT_EQUALS(log.getUsedPages(), 2U);
+		
+		// lost, sync() is not called
+		append(log, 40);
+	}
+	
+	Log log(flash);
+	TEST_ASSERT_TRUE(log.initialize());
+	TEST_ASSERT_EQUALS(log.getUsedPages(), 2U);
+	TEST_ASSERT_TRUE(check(log, 0, 39));
+	
+	// continues after the last page
+	append(log, 40);
+	log.sync();
+	
+	Log log2(flash);
+	log2.initialize();
+	TEST_ASSERT_EQUALS(log2.getUsedPages(), 3U);
+	TEST_ASSERT_TRUE(check(log2, 0, 40));
+}
+
+void
+LogStoreTest::testClear()
+{
+	Simulator::initialize(16);
+	
+	SmallFlash flash;
+	Log log(flash);
+	log.initialize();
+	for (uint16_t i = 0; i < 20; ++i) {
+		append(log, i, 200);
+	}
+	log.sync();
+	TEST_ASSERT_EQUALS(log.getUsedPages(), 16U);
+	
+	TEST_ASSERT_TRUE(log.clear());
+	TEST_ASSERT_EQUALS(log.getUsedPages(), 0U);
+	
+	Log log2(flash);
+	log2.initialize();
+	TEST_ASSERT_EQUALS(log2.getUsedPages(), 0U);
+	Log::Iterator it = log2.getIterator();
+	TEST_ASSERT_FALSE(it.next());
+}
+
+void
+LogStoreTest::testWrapAround()
+{
+	// one record per page, the newest page is found at every position
+	for (uint16_t written = 1; written <= 40; ++written)
+	{
+		Simulator::initialize(16);
+		
+		SmallFlash flash;
+		{
+			Log log(flash);
+			log.initialize();
+			for (uint16_t i = 0; i < written; ++i) {
+				append(log, i);
+				log.sync();
+			}
+		}
+		
+		Log log(flash);
+		TEST_ASSERT_TRUE(log.initialize());
+		
+		uint16_t pages = (written < 16) ? written : 16;
+		TEST_ASSERT_EQUALS(log.getUsedPages(), pages);
+		TEST_ASSERT_TRUE(check(log, written - pages, written - 1));
+	}
+	
+	// every page is written equally often
+	TEST_ASSERT_EQUALS(Simulator::getStatistics().pagePrograms, 40U);
+	TEST_ASSERT_EQUALS(Simulator::getStatistics().violations, 0U);
+}
+
+void
+LogStoreTest::testPowerFailure()
+{
+	// Tears the first page, the last page before the log is full and
+	// pages after the wrap-around.
+	const uint16_t failures[] = { 0, 3, 15, 16, 20, 31 };
+	for (uint_fast8_t k = 0; k < sizeof(failures) / sizeof(failures[0]); ++k)
+	{
+		const uint16_t complete = failures[k];
+		Simulator::initialize(16);
+		Simulator::setPowerFailure(complete);
+		{
+			SmallFlash flash;
+			Log log(flash);
+			log.initialize();
+			for (uint16_t i = 0; i < complete + 3; ++i) {
+				append(log, i, 200);
+				log.sync();
+			}
+		}
+		Simulator::powerOn();
+		
+		SmallFlash flash;
+		Log log(flash);
+		TEST_ASSERT_TRUE(log.initialize());
+		
+		// the torn page is ignored, all older records survive
+		uint16_t pages = (complete < 15) ? complete : 15;
+		TEST_ASSERT_EQUALS(log.getUsedPages(), pages);
+		if (complete > 0) {
+			TEST_ASSERT_TRUE(check(log, complete - pages, complete - 1));
+		}
+		
+		// the torn page is overwritten by the next one
+		append(log, complete, 200);
+		log.sync();
+		
+		Log log2(flash);
+		log2.initialize();
+		TEST_ASSERT_EQUALS(log2.getUsedPages(), pages + 1U);
+		TEST_ASSERT_TRUE(check(log2, complete - pages, complete));
+	}
+}
+
+void
+LogStoreTest::testMountReads()
+{
+	Simulator::initialize(512);
+	
+	Flash flash;
+	{
+		Log log(flash);
+		log.initialize();
+		for (uint16_t i = 0; i < 700; ++i) {
+			append(log, i, 200);
+		}
+		log.sync();
+	}
+	
+	Simulator::resetStatistics();
+	Log log(flash);
+	TEST_ASSERT_TRUE(log.initialize());
+	TEST_ASSERT_EQUALS(log.getUsedPages(), 512U);
+	
+	// binary search instead of reading all 512 pages
+	TEST_ASSERT_TRUE(Simulator::getStatistics().pageReads <= 9U + 4);
+	TEST_ASSERT_TRUE(check(log, 700 - 512, 699));
+}
+
+void
+LogStoreTest::testRecordSize()
+{
+	Simulator::initialize(512);
+	
+	Flash flash;
+	Log log(flash);
+	log.initialize();
+	
+	TEST_ASSERT_EQUALS(Log::MAX_RECORD_SIZE, 247U);
+	TEST_ASSERT_FALSE(append(log, 0, 248));
+	
+	// a record of the maximum size fills a whole page
+	TEST_ASSERT_TRUE(append(log, 0, 247));
+	TEST_ASSERT_TRUE(append(log, 1, 247));
+	TEST_ASSERT_TRUE(append(log, 2, 2));
+	TEST_ASSERT_EQUALS(log.getPageWrites(), 2U);
+	TEST_ASSERT_TRUE(check(log, 0, 2));
+	
+	TEST_ASSERT_EQUALS(xpcc::LogStore<64>::MAX_RECORD_SIZE, 55U);
+	TEST_ASSERT_EQUALS(xpcc::LogStore<512>::MAX_RECORD_SIZE, 255U);
+}
+
+void
+LogStoreTest::testI2cEeprom()
+{
+	typedef xpcc::i2c::MockMaster Master;
+	
+	xpcc::pc::I2cEepromSimulator simulator(0x50, 4096, 64);
+	Master::initialize(Master::DEVICE_PRESENT, Master::AUTO_MODE);
+	Master::attachSlave(&simulator);
+	
+	// the second half of the EEPROM, 32 pages of 64 bytes
+	xpcc::I2cEepromBlockDevice<Master, 64, 4096> eeprom;
+	{
+		xpcc::LogStore<64> log(eeprom, 32);
+		TEST_ASSERT_TRUE(log.initialize());
+		TEST_ASSERT_EQUALS(log.getPages(), 32U);
+		
+		uint8_t data[20];
+		for (uint8_t i = 0; i < 100; ++i)
+		{
+			data[0] = i;
+			log.append(data, sizeof(data));
+		}
+		log.sync();
+		
+		// two records per page, the first 36 records are overwritten
+		TEST_ASSERT_EQUALS(log.getUsedPages(), 32U);
+	}
+	
+	xpcc::LogStore<64> log(eeprom, 32);
+	log.initialize();
+	xpcc::LogStore<64>::Iterator it = log.getIterator();
+	for (uint8_t i = 36; i < 100; ++i)
+	{
+		TEST_ASSERT_TRUE(it.next());
+		TEST_ASSERT_EQUALS(it.getSize(), 20U);
+		TEST_ASSERT_EQUALS(it.getData()[0], i);
+	}
+	TEST_ASSERT_FALSE(it.next());
+	
+	// the first half is not touched
+	TEST_ASSERT_EQUALS(simulator.getMemory()[0], 0xff);
+	TEST_ASSERT_EQUALS(simulator.getMemory()[32 * 64 - 1], 0xff);
+	
+	Master::attachSlave(0);
+}
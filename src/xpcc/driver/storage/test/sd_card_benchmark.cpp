@@ -0,0 +1,225 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <cstdio>
+
+#include <xpcc/architecture/platform/hosted/storage/sd_card_simulator.hpp>
+#include <xpcc/architecture/platform/hosted/storage/image_file_volume.hpp>
+
+#include <xpcc/driver/storage/sd.hpp>
+
+#include "sd_card_benchmark.hpp"
+
+namespace
+{
+	typedef xpcc::pc::SdCardSimulator Simulator;
+	typedef xpcc::fat::SdCardVolume<Simulator::Spi, Simulator::Cs> Volume;
+	typedef xpcc::fat::SdCardVolume<Simulator::Spi, Simulator::Cs, 1> UnbufferedVolume;
+	
+	const UINT fileSize = 256 * 1024;
+	const char *imageFile = "xpcc_sd_card_benchmark.img";
+	
+	uint8_t data[4096];
+	uint32_t random = 1;
+	
+	uint32_t
+	nextRandom()
+	{
+		random = random * 1103515245 + 12345;
+		return random >> 8;
+	}
+	
+	/// Format the volume and create a file of fileSize bytes
+	void
+	createFile(xpcc::fat::PhysicalVolume& volume)
+	{
+		xpcc::fat::FileSystem fileSystem(&volume);
+		f_mkfs(0, 1, 0);
+		
+		FIL file;
+		f_open(&file, "data.bin", FA_CREATE_ALWAYS | FA_WRITE);
+		for (UINT i = 0; i < fileSize; i += sizeof(data))
+		{
+			UINT length;
+			f_write(&file, data, sizeof(data), &length);
+		}
+		f_close(&file);
+	}
+	
+	void
+	sequentialRead(xpcc::fat::PhysicalVolume& volume, unittest::BenchmarkState& state)
+	{
+		xpcc::fat::FileSystem fileSystem(&volume);
+		FIL file;
+		f_open(&file, "data.bin", FA_OPEN_EXISTING | FA_READ);
+		while (state.keepRunning())
+		{
+			UINT length;
+			f_read(&file, data, 64, &length);
+			if (length == 0) {
+				f_lseek(&file, 0);
+			}
+		}
+		f_close(&file);
+	}
+	
+	void
+	sequentialWrite(xpcc::fat::PhysicalVolume& volume, unittest::BenchmarkState& state,
+			UINT size)
+	{
+		xpcc::fat::FileSystem fileSystem(&volume);
+		FIL file;
+		f_open(&file, "log.bin", FA_CREATE_ALWAYS | FA_WRITE);
+		
+		UINT written = 0;
+		while (state.keepRunning())
+		{
+			UINT length;
+			f_write(&file, data, size, &length);
+			written += size;
+			if (written % 4096 == 0) {
+				f_sync(&file);
+			}
+			if (written >= 1024 * 1024) {
+				// start again, don't fill the card
+				f_lseek(&file, 0);
+				f_truncate(&file);
+				written = 0;
+			}
+		}
+		f_close(&file);
+	}
+}
+
+void
+SdCardBenchmark::setUp()
+{
+	for (uint_fast16_t i = 0; i < sizeof(data); ++i) {
+		data[i] = i;
+	}
+	
+	// 8MB card
+	Simulator::initialize(16384);
+	Simulator::setLatency(0, 0);
+	Volume volume;
+	createFile(volume);
+	
+	Simulator::setLatency(250, 2500);
+}
+
+void
+SdCardBenchmark::tearDown()
+{
+}
+
+// ----------------------------------------------------------------------------
+void
+SdCardBenchmark::benchmarkSequentialRead(unittest::BenchmarkState& state)
+{
+	Volume volume;
+	sequentialRead(volume, state);
+}
+
+void
+SdCardBenchmark::benchmarkSequentialReadUnbuffered(unittest::BenchmarkState& state)
+{
+	UnbufferedVolume volume;
+	sequentialRead(volume, state);
+}
+
+void
+SdCardBenchmark::benchmarkSequentialWrite(unittest::BenchmarkState& state)
+{
+	Volume volume;
+	sequentialWrite(volume, state, 64);
+}
+
+void
+SdCardBenchmark::benchmarkSequentialWriteUnbuffered(unittest::BenchmarkState& state)
+{
+	UnbufferedVolume volume;
+	sequentialWrite(volume, state, 64);
+}
+
+void
+SdCardBenchmark::benchmarkLargeWrite(unittest::BenchmarkState& state)
+{
+	Volume volume;
+	sequentialWrite(volume, state, sizeof(data));
+}
+
+void
+SdCardBenchmark::benchmarkRandomRead(unittest::BenchmarkState& state)
+{
+	Volume volume;
+	xpcc::fat::FileSystem fileSystem(&volume);
+	FIL file;
+	f_open(&file, "data.bin", FA_OPEN_EXISTING | FA_READ);
+	while (state.keepRunning())
+	{
+		UINT length;
+		f_lseek(&file, (nextRandom() % (fileSize / 512)) * 512);
+		f_read(&file, data, 512, &length);
+	}
+	f_close(&file);
+}
+
+void
+SdCardBenchmark::benchmarkRandomWrite(unittest::BenchmarkState& state)
+{
+	Volume volume;
+	xpcc::fat::FileSystem fileSystem(&volume);
+	FIL file;
+	f_open(&file, "data.bin", FA_OPEN_EXISTING | FA_WRITE);
+	while (state.keepRunning())
+	{
+		UINT length;
+		f_lseek(&file, (nextRandom() % (fileSize / 64)) * 64);
+		f_write(&file, data, 64, &length);
+		f_sync(&file);
+	}
+	f_close(&file);
+}
+
+void
+SdCardBenchmark::benchmarkImageSequentialRead(unittest::BenchmarkState& state)
+{
+	std::remove(imageFile);
+	{
+		xpcc::pc::ImageFileVolume volume(imageFile, 16384);
+		createFile(volume);
+	}
+	
+	xpcc::pc::ImageFileVolume volume(imageFile);
+	sequentialRead(volume, state);
+	
+	volume.close();
+	std::remove(imageFile);
+}
@@ -0,0 +1,81 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/benchmark/benchmark.hpp>
+
+/**
+ * \brief	File access through FatFs on the simulated SD card
+ * 
+ * The simulated card waits 250 bytes before sending a block and is
+ * busy for 2500 bytes after a written block, about 100us and 1ms at
+ * 20MHz. The times are only a model of a real card, compare the
+ * variants with and without the buffer of xpcc::fat::SdCardVolume.
+ */
+class SdCardBenchmark : public unittest::Benchmark
+{
+public:
+	virtual void
+	setUp();
+	
+	virtual void
+	tearDown();
+	
+	/// 64 byte reads from a 256kB file, with read-ahead
+	void
+	benchmarkSequentialRead(unittest::BenchmarkState& state);
+	
+	/// 64 byte reads from a 256kB file, sector by sector
+	void
+	benchmarkSequentialReadUnbuffered(unittest::BenchmarkState& state);
+	
+	/// 64 byte writes, f_sync() every 4kB, with write coalescing
+	void
+	benchmarkSequentialWrite(unittest::BenchmarkState& state);
+	
+	/// 64 byte writes, f_sync() every 4kB, sector by sector
+	void
+	benchmarkSequentialWriteUnbuffered(unittest::BenchmarkState& state);
+	
+	/// 4kB writes, multiple block writes directly from the buffer
+	void
+	benchmarkLargeWrite(unittest::BenchmarkState& state);
+	
+	/// 512 byte reads at random positions
+	void
+	benchmarkRandomRead(unittest::BenchmarkState& state);
+	
+	/// 64 byte writes at random positions, each followed by f_sync()
+	void
+	benchmarkRandomWrite(unittest::BenchmarkState& state);
+	
+	/// 64 byte reads from a disk image file
+	void
+	benchmarkImageSequentialRead(unittest::BenchmarkState& state);
+};
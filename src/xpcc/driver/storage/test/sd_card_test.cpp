@@ -0,0 +1,300 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <cstdio>
+#include <cstring>
+
+#include <xpcc/architecture/platform/hosted/storage/sd_card_simulator.hpp>
+#include <xpcc/architecture/platform/hosted/storage/image_file_volume.hpp>
+
+#include <xpcc/driver/storage/sd.hpp>
+
+#include "sd_card_test.hpp"
+
+namespace
+{
+	typedef xpcc::pc::SdCardSimulator Simulator;
+	typedef xpcc::fat::SdCardVolume<Simulator::Spi, Simulator::Cs> Volume;
+	
+	void
+	fill(uint8_t *data, std::size_t size, uint8_t start)
+	{
+		for (std::size_t i = 0; i < size; ++i) {
+			data[i] = start + i * 7;
+		}
+	}
+	
+	uint8_t input[8192];
+	uint8_t output[8192];
+	
+	/// Write a file through FatFs and read it back in small pieces
+	bool
+	writeAndReadFile(const char *name)
+	{
+		fill(input, sizeof(input), 3);
+		
+		FIL file;
+		if (f_open(&file, name, FA_CREATE_ALWAYS | FA_WRITE) != FR_OK) {
+			return false;
+		}
+		UINT length;
+		for (uint_fast8_t i = 0; i < 10; ++i)
+		{
+			for (uint_fast16_t k = 0; k < sizeof(input); k += 64) {
+				if (f_write(&file, input + k, 64, &length) != FR_OK || length != 64) {
+					return false;
+				}
+			}
+		}
+		if (f_close(&file) != FR_OK) {
+			return false;
+		}
+		
+		if (f_open(&file, name, FA_OPEN_EXISTING | FA_READ) != FR_OK ||
+				f_size(&file) != 10 * sizeof(input)) {
+			return false;
+		}
+		for (uint_fast8_t i = 0; i < 10; ++i)
+		{
+			std::memset(output, 0, sizeof(output));
+			for (uint_fast16_t k = 0; k < sizeof(output); k += 100)
+			{
+				UINT size = (sizeof(output) - k < 100) ? (sizeof(output) - k) : 100;
+				if (f_read(&file, output + k, size, &length) != FR_OK || length != size) {
+					return false;
+				}
+			}
+			if (std::memcmp(output, input, sizeof(input)) != 0) {
+				return false;
+			}
+		}
+		return (f_close(&file) == FR_OK);
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+SdCardTest::testInitialize()
+{
+	Simulator::initialize(2048);
+	
+	Volume volume;
+	TEST_ASSERT_EQUALS(volume.getStatus(), STA_NOINIT);
+	TEST_ASSERT_EQUALS(volume.read(output, 0, 1), RES_NOTRDY);
+	
+	TEST_ASSERT_EQUALS(volume.initialize(), 0);
+	TEST_ASSERT_EQUALS(volume.getStatus(), 0);
+	TEST_ASSERT_EQUALS(volume.getCardType(), CT_SD2 | CT_BLOCK);
+	
+	uint32_t value = 0;
+	TEST_ASSERT_EQUALS(volume.ioctl(GET_SECTOR_COUNT, &value), RES_OK);
+	TEST_ASSERT_EQUALS(value, 2048U);
+	
+	TEST_ASSERT_EQUALS(volume.read(output, 2047, 2), RES_PARERR);
+	TEST_ASSERT_EQUALS(Simulator::getStatistics().violations, 0U);
+}
+
+void
+SdCardTest::testReadWrite()
+{
+	Simulator::initialize(2048);
+	Simulator::setLatency(10, 20);
+	
+	Volume volume;
+	volume.initialize();
+	Simulator::resetStatistics();
+	
+	// large transfers use the multiple block commands directly
+	fill(input, 8 * 512, 1);
+	TEST_ASSERT_EQUALS(volume.write(input, 100, 8), RES_OK);
+	TEST_ASSERT_TRUE(std::memcmp(Simulator::getMemory() + 100 * 512, input, 8 * 512) == 0);
+	TEST_ASSERT_EQUALS(Simulator::getStatistics().multipleBlockWrites, 1U);
+	TEST_ASSERT_EQUALS(Simulator::getStatistics().blocksWritten, 8U);
+	
+	TEST_ASSERT_EQUALS(volume.read(output, 100, 8), RES_OK);
+	TEST_ASSERT_TRUE(std::memcmp(output, input, 8 * 512) == 0);
+	TEST_ASSERT_EQUALS(Simulator::getStatistics().multipleBlockReads, 1U);
+	TEST_ASSERT_EQUALS(Simulator::getStatistics().blocksRead, 8U);
+	
+	// one buffer transfer per block
+	TEST_ASSERT_EQUALS(Simulator::getStatistics().bufferTransfers, 16U);
+	
+	// single sectors are written on the next sync
+	fill(input, 512, 99);
+	TEST_ASSERT_EQUALS(volume.write(input, 2047, 1), RES_OK);
+	TEST_ASSERT_EQUALS(Simulator::getMemory()[2047 * 512], 0xff);
+	TEST_ASSERT_EQUALS(volume.ioctl(CTRL_SYNC, 0), RES_OK);
+	TEST_ASSERT_TRUE(std::memcmp(Simulator::getMemory() + 2047 * 512, input, 512) == 0);
+	TEST_ASSERT_EQUALS(Simulator::getStatistics().singleBlockWrites, 1U);
+	
+	TEST_ASSERT_EQUALS(volume.read(output, 2047, 1), RES_OK);
+	TEST_ASSERT_TRUE(std::memcmp(output, input, 512) == 0);
+	
+	TEST_ASSERT_EQUALS(Simulator::getStatistics().violations, 0U);
+}
+
+void
+SdCardTest::testReadAhead()
+{
+	Simulator::initialize(2048);
+	fill(Simulator::getMemory(), 2048 * 512, 0);
+	
+	Volume volume;
+	volume.initialize();
+	Simulator::resetStatistics();
+	
+	// reading sector by sector, the first one is not known to be sequential
+	for (uint32_t sector = 10; sector < 31; ++sector)
+	{
+		TEST_ASSERT_EQUALS(volume.read(output, sector, 1), RES_OK);
+		TEST_ASSERT_TRUE(std::memcmp(output, Simulator::getMemory() + sector * 512, 512) == 0);
+	}
+	TEST_ASSERT_EQUALS(Simulator::getStatistics().singleBlockReads, 1U);
+	TEST_ASSERT_EQUALS(Simulator::getStatistics().multipleBlockReads, 5U);
+	TEST_ASSERT_EQUALS(volume.getStatistics().bufferHits, 15U);
+	
+	// other reads in between (e.g. of the FAT) don't stop the read-ahead
+	TEST_ASSERT_EQUALS(volume.read(output, 1000, 1), RES_OK);
+	TEST_ASSERT_EQUALS(volume.read(output, 31, 1), RES_OK);
+	TEST_ASSERT_EQUALS(volume.read(output, 32, 1), RES_OK);
+	TEST_ASSERT_TRUE(std::memcmp(output, Simulator::getMemory() + 32 * 512, 512) == 0);
+	TEST_ASSERT_EQUALS(Simulator::getStatistics().singleBlockReads, 2U);
+	TEST_ASSERT_EQUALS(Simulator::getStatistics().multipleBlockReads, 6U);
+	
+	// random reads only read the requested sector
+	Simulator::resetStatistics();
+	volume.read(output, 500, 1);
+	volume.read(output, 300, 1);
+	volume.read(output, 700, 1);
+	TEST_ASSERT_EQUALS(Simulator::getStatistics().blocksRead, 3U);
+	
+	// read-ahead stops at the end of the card
+	volume.read(output, 2046, 1);
+	volume.read(output, 2047, 1);
+	TEST_ASSERT_TRUE(std::memcmp(output, Simulator::getMemory() + 2047 * 512, 512) == 0);
+	TEST_ASSERT_EQUALS(Simulator::getStatistics().violations, 0U);
+}
+
+void
+SdCardTest::testWriteCoalescing()
+{
+	Simulator::initialize(2048);
+	
+	Volume volume;
+	volume.initialize();
+	Simulator::resetStatistics();
+	
+	fill(input, 10 * 512, 5);
+	for (uint32_t i = 0; i < 10; ++i) {
+		TEST_ASSERT_EQUALS(volume.write(input + i * 512, 100 + i, 1), RES_OK);
+	}
+	
+	// written sectors are read from the buffer
+	TEST_ASSERT_EQUALS(volume.read(output, 109, 1), RES_OK);
+	TEST_ASSERT_TRUE(std::memcmp(output, input + 9 * 512, 512) == 0);
+	
+	// a sector written twice is only transferred once
+	fill(input + 9 * 512, 512, 77);
+	volume.write(input + 9 * 512, 109, 1);
+	
+	TEST_ASSERT_EQUALS(volume.ioctl(CTRL_SYNC, 0), RES_OK);
+	TEST_ASSERT_TRUE(std::memcmp(Simulator::getMemory() + 100 * 512, input, 10 * 512) == 0);
+	
+	// 4 + 4 + 2 sectors
+	TEST_ASSERT_EQUALS(Simulator::getStatistics().multipleBlockWrites, 3U);
+	TEST_ASSERT_EQUALS(Simulator::getStatistics().singleBlockWrites, 0U);
+	TEST_ASSERT_EQUALS(Simulator::getStatistics().blocksWritten, 10U);
+	
+	// a large read of buffered sectors writes them first
+	volume.write(input, 200, 1);
+	TEST_ASSERT_EQUALS(volume.read(output, 198, 4), RES_OK);
+	TEST_ASSERT_TRUE(std::memcmp(output + 2 * 512, input, 512) == 0);
+	TEST_ASSERT_EQUALS(Simulator::getStatistics().singleBlockWrites, 1U);
+	
+	TEST_ASSERT_EQUALS(Simulator::getStatistics().violations, 0U);
+}
+
+void
+SdCardTest::testFileSystem()
+{
+	Simulator::initialize(8192);
+	Simulator::setLatency(5, 10);
+	
+	Volume volume;
+	xpcc::fat::FileSystem fileSystem(&volume);
+	TEST_ASSERT_EQUALS(f_mkfs(0, 1, 0), FR_OK);
+	
+	Simulator::resetStatistics();
+	TEST_ASSERT_TRUE(writeAndReadFile("test.bin"));
+	
+	// the file is read with the read-ahead buffer
+	TEST_ASSERT_TRUE(volume.getStatistics().bufferHits > 0);
+	TEST_ASSERT_TRUE(Simulator::getStatistics().multipleBlockReads > 0);
+	TEST_ASSERT_TRUE(Simulator::getStatistics().multipleBlockWrites > 0);
+	TEST_ASSERT_EQUALS(Simulator::getStatistics().violations, 0U);
+}
+
+void
+SdCardTest::testImageFile()
+{
+	const char *filename = "xpcc_image_test.img";
+	std::remove(filename);
+	
+	{
+		xpcc::pc::ImageFileVolume volume(filename, 4096);
+		TEST_ASSERT_EQUALS(volume.getStatus(), STA_NOINIT);
+		
+		xpcc::fat::FileSystem fileSystem(&volume);
+		TEST_ASSERT_EQUALS(f_mkfs(0, 1, 0), FR_OK);
+		TEST_ASSERT_TRUE(writeAndReadFile("test.bin"));
+		
+		uint32_t value = 0;
+		TEST_ASSERT_EQUALS(volume.ioctl(GET_SECTOR_COUNT, &value), RES_OK);
+		TEST_ASSERT_EQUALS(value, 4096U);
+	}
+	
+	// the size is taken from the existing file
+	xpcc::pc::ImageFileVolume volume(filename);
+	TEST_ASSERT_EQUALS(volume.initialize(), 0);
+	
+	uint32_t value = 0;
+	volume.ioctl(GET_SECTOR_COUNT, &value);
+	TEST_ASSERT_EQUALS(value, 4096U);
+	TEST_ASSERT_EQUALS(volume.read(output, 4095, 2), RES_PARERR);
+	
+	xpcc::fat::FileSystem fileSystem(&volume);
+	FIL file;
+	TEST_ASSERT_EQUALS(f_open(&file, "test.bin", FA_OPEN_EXISTING | FA_READ), FR_OK);
+	TEST_ASSERT_EQUALS(f_size(&file), 10 * sizeof(input));
+	f_close(&file);
+	
+	volume.close();
+	std::remove(filename);
+}
@@ -0,0 +1,151 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__BUFFERED_COLOR_GRAPHIC_DISPLAY_HPP
+#define XPCC__BUFFERED_COLOR_GRAPHIC_DISPLAY_HPP
+
+#include "graphic_display.hpp"
+
+namespace xpcc
+{
+	/**
+	 * \brief	Base class for color displays with a RAM buffer
+	 * 
+	 * Every pixel is stored as a RGB565 value (see glcd::Color) in a
+	 * buffer of Width * Height * 2 bytes. Like BufferedGraphicDisplay the
+	 * content of the real display is not changed until a call of update().
+	 * 
+	 * The drawing operations use the same mapping as the monochrome
+	 * displays: pixels are set in the foreground color, but a black
+	 * foreground color clears them to the background color.
+	 * 
+	 * Multiple buffers can be combined with composite(), e.g. to draw
+	 * a static background and a changing foreground independently.
+	 * 
+	 * \ingroup	lcd
+	 */
+	template <uint16_t Width, uint16_t Height>
+	class BufferedColorGraphicDisplay : public GraphicDisplay
+	{
+	public:
+		BufferedColorGraphicDisplay();
+		
+		virtual
+		~BufferedColorGraphicDisplay()
+		{
+		}
+		
+		virtual inline uint16_t
+		getWidth() const
+		{
+			return Width;
+		}
+		
+		virtual inline uint16_t
+		getHeight() const
+		{
+			return Height;
+		}
+		
+		/**
+		 * \brief	Fill the complete buffer with the background color
+		 * 
+		 * Use fillRectangle() to clear certain areas of the screen.
+		 */
+		virtual void
+		clear();
+		
+		// Faster version adapted for the RAM buffer
+		virtual void
+		drawImageRaw(glcd::Point upperLeft,
+				uint16_t width, uint16_t height,
+				xpcc::accessor::Flash<uint8_t> data);
+		
+		/// Color of a pixel, black for pixels outside the display
+		glcd::Color
+		getPixelColor(int16_t x, int16_t y) const;
+		
+		/// Pixels in RGB565 format, row by row from the upper left corner
+		inline const uint16_t *
+		getBuffer() const
+		{
+			return &this->buffer[0][0];
+		}
+		
+		/**
+		 * \brief	Copy another buffer on top of this one
+		 * 
+		 * \param	layer		Buffer to copy, may be smaller than this one
+		 * \param	position	Position of the upper left corner of
+		 * 						\p layer on this buffer
+		 * \param	transparent	Pixels of \p layer with this color are
+		 * 						not copied
+		 */
+		template <uint16_t LayerWidth, uint16_t LayerHeight>
+		void
+		composite(const BufferedColorGraphicDisplay<LayerWidth, LayerHeight>& layer,
+				glcd::Point position, glcd::Color transparent);
+		
+	protected:
+		/// Color used by the drawing operations
+		inline uint16_t
+		getDrawColor() const
+		{
+			return (this->foregroundColor == glcd::Color::black()) ?
+					this->backgroundColor.getValue() :
+					this->foregroundColor.getValue();
+		}
+		
+		virtual void
+		drawHorizontalLine(glcd::Point start, uint16_t length);
+		
+		virtual void
+		drawVerticalLine(glcd::Point start, uint16_t length);
+		
+		virtual void
+		fillRect(int16_t x, int16_t y, uint16_t width, uint16_t height);
+		
+		virtual void
+		setPixel(int16_t x, int16_t y);
+		
+		virtual void
+		clearPixel(int16_t x, int16_t y);
+		
+		/// \c true if the pixel differs from the background color
+		virtual bool
+		getPixel(int16_t x, int16_t y);
+		
+		uint16_t buffer[Height][Width];
+	};
+}
+
+#include "buffered_color_graphic_display_impl.hpp"
+
+#endif	// XPCC__BUFFERED_COLOR_GRAPHIC_DISPLAY_HPP
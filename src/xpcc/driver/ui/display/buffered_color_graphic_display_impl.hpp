@@ -0,0 +1,185 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__BUFFERED_COLOR_GRAPHIC_DISPLAY_HPP
+	#error	"Don't include this file directly, use 'buffered_color_graphic_display.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <uint16_t Width, uint16_t Height>
+xpcc::BufferedColorGraphicDisplay<Width, Height>::BufferedColorGraphicDisplay()
+{
+	this->clear();
+}
+
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedColorGraphicDisplay<Width, Height>::clear()
+{
+	const uint16_t color = this->backgroundColor.getValue();
+	for (uint_fast16_t y = 0; y < Height; ++y) {
+		for (uint_fast16_t x = 0; x < Width; ++x) {
+			this->buffer[y][x] = color;
+		}
+	}
+	
+	// reset the cursor
+	this->cursor = glcd::Point(0, 0);
+}
+
+// ----------------------------------------------------------------------------
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedColorGraphicDisplay<Width, Height>::drawImageRaw(glcd::Point upperLeft,
+		uint16_t width, uint16_t height,
+		xpcc::accessor::Flash<uint8_t> data)
+{
+	const uint16_t foreground = this->foregroundColor.getValue();
+	const uint16_t background = this->backgroundColor.getValue();
+	
+	for (uint_fast16_t k = 0; k < height; ++k)
+	{
+		const uint16_t y = upperLeft.getY() + k;
+		if (y >= Height) {
+			continue;
+		}
+		
+		// one byte of the image contains eight rows
+		const uint16_t row = (k / 8) * width;
+		const uint8_t mask = 1 << (k & 0x07);
+		for (uint_fast16_t i = 0; i < width; ++i)
+		{
+			const uint16_t x = upperLeft.getX() + i;
+			if (x < Width) {
+				this->buffer[y][x] = (data[row + i] & mask) ? foreground : background;
+			}
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <uint16_t Width, uint16_t Height>
+xpcc::glcd::Color
+xpcc::BufferedColorGraphicDisplay<Width, Height>::getPixelColor(int16_t x, int16_t y) const
+{
+	if (static_cast<uint16_t>(x) < Width && static_cast<uint16_t>(y) < Height) {
+		return glcd::Color(this->buffer[y][x]);
+	}
+	return glcd::Color::black();
+}
+
+template <uint16_t Width, uint16_t Height>
+template <uint16_t LayerWidth, uint16_t LayerHeight>
+void
+xpcc::BufferedColorGraphicDisplay<Width, Height>::composite(
+		const BufferedColorGraphicDisplay<LayerWidth, LayerHeight>& layer,
+		glcd::Point position, glcd::Color transparent)
+{
+	const uint16_t key = transparent.getValue();
+	const uint16_t *source = layer.getBuffer();
+	
+	for (uint_fast16_t k = 0; k < LayerHeight; ++k)
+	{
+		const uint16_t y = position.getY() + k;
+		if (y >= Height) {
+			continue;
+		}
+		
+		for (uint_fast16_t i = 0; i < LayerWidth; ++i)
+		{
+			const uint16_t x = position.getX() + i;
+			const uint16_t color = source[k * LayerWidth + i];
+			if (x < Width && color != key) {
+				this->buffer[y][x] = color;
+			}
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedColorGraphicDisplay<Width, Height>::drawHorizontalLine(
+		glcd::Point start, uint16_t length)
+{
+	this->fillRectangle(start, length, 1);
+}
+
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedColorGraphicDisplay<Width, Height>::drawVerticalLine(
+		glcd::Point start, uint16_t length)
+{
+	this->fillRectangle(start, 1, length);
+}
+
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedColorGraphicDisplay<Width, Height>::fillRect(int16_t x, int16_t y,
+		uint16_t width, uint16_t height)
+{
+	const uint16_t color = this->getDrawColor();
+	for (uint_fast16_t k = y; k < static_cast<uint16_t>(y + height); ++k)
+	{
+		uint16_t *row = &this->buffer[k][x];
+		for (uint_fast16_t i = 0; i < width; ++i) {
+			row[i] = color;
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedColorGraphicDisplay<Width, Height>::setPixel(int16_t x, int16_t y)
+{
+	if (static_cast<uint16_t>(x) < Width && static_cast<uint16_t>(y) < Height) {
+		this->buffer[y][x] = this->foregroundColor.getValue();
+	}
+}
+
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedColorGraphicDisplay<Width, Height>::clearPixel(int16_t x, int16_t y)
+{
+	if (static_cast<uint16_t>(x) < Width && static_cast<uint16_t>(y) < Height) {
+		this->buffer[y][x] = this->backgroundColor.getValue();
+	}
+}
+
+template <uint16_t Width, uint16_t Height>
+bool
+xpcc::BufferedColorGraphicDisplay<Width, Height>::getPixel(int16_t x, int16_t y)
+{
+	if (static_cast<uint16_t>(x) < Width && static_cast<uint16_t>(y) < Height) {
+		return (this->buffer[y][x] != this->backgroundColor.getValue());
+	}
+	return false;
+}
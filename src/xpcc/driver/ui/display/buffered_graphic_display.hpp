@@ -42,6 +42,11 @@ namespace xpcc
 	 * Every operation works on the internal RAM buffer, therefore the content
 	 * of the real display is not changed until a call of update().
 	 * 
+	 * For every page (eight rows of pixels) the range of columns changed
+	 * since the last update() is recorded. Drivers use getDirtyRange() to
+	 * transfer only these bytes and call markClean() afterwards. After
+	 * construction the complete buffer is marked as dirty.
+	 * 
 	 * \tparam	Width	Width of the display.
 	 * \tparam	Height	Height of the display. Must be a multiple of 8!
 	 * 
@@ -55,6 +60,8 @@ namespace xpcc
 		XPCC__STATIC_ASSERT((Height % 8) == 0, "height must be a multiple of 8");
 		
 	public:
+		BufferedGraphicDisplay();
+		
 		virtual
 		~BufferedGraphicDisplay()
 		{
@@ -86,14 +93,56 @@ namespace xpcc
 				uint16_t width, uint16_t height,
 				xpcc::accessor::Flash<uint8_t> data);
 		
+		/**
+		 * \brief	Mark the complete buffer as changed
+		 * 
+		 * The next update() will transfer the whole buffer, e.g. after
+		 * the display controller lost its content.
+		 */
+		void
+		markAllDirty();
+		
+		/**
+		 * \brief	Number of bytes the next update() has to transfer
+		 * 
+		 * Compare with Width * Height / 8 to get the savings of the
+		 * partial update.
+		 */
+		uint16_t
+		getDirtyBytes() const;
+		
 	protected:
+		/**
+		 * \brief	Get the columns of \p page changed since the last update
+		 * 
+		 * \param		page	Page (row / 8)
+		 * \param[out]	start	First changed column
+		 * \param[out]	end		Column after the last changed column
+		 * \return	\c false if nothing changed in this page
+		 */
+		inline bool
+		getDirtyRange(uint16_t page, uint16_t& start, uint16_t& end) const;
+		
+		/// Mark all pages as transferred to the display
+		void
+		markClean();
+		
+		/// Mark the columns \p start to \p end (exclusive) of \p page as changed
+		inline void
+		markDirty(uint16_t page, uint16_t start, uint16_t end);
+		
 		// Faster version adapted for the RAM buffer
 		virtual void
 		drawHorizontalLine(glcd::Point start, uint16_t length);
 		
-		// TODO Faster version adapted for the RAM buffer
-		//virtual void
-		//drawVerticalLine(glcd::Point start, uint8_t length);
+		// Faster version adapted for the RAM buffer, sets up to eight
+		// pixels with a single byte access
+		virtual void
+		drawVerticalLine(glcd::Point start, uint16_t length);
+		
+		// Faster version adapted for the RAM buffer
+		virtual void
+		fillRect(int16_t x, int16_t y, uint16_t width, uint16_t height);
 		
 		virtual void
 		setPixel(int16_t x, int16_t y);
@@ -105,6 +154,11 @@ namespace xpcc
 		getPixel(int16_t x, int16_t y);
 		
 		uint8_t buffer[Width][Height / 8];
+		
+	private:
+		// Changed columns per page, empty if start >= end
+		uint16_t dirtyStart[Height / 8];
+		uint16_t dirtyEnd[Height / 8];
 	};
 }
 
@@ -32,14 +32,97 @@
 	#error	"Don't include this file directly, use 'buffered_graphic_display.hpp' instead!"
 #endif
 
+// ----------------------------------------------------------------------------
+template <uint16_t Width, uint16_t Height>
+xpcc::BufferedGraphicDisplay<Width, Height>::BufferedGraphicDisplay()
+{
+	this->markAllDirty();
+}
+
+// ----------------------------------------------------------------------------
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedGraphicDisplay<Width, Height>::markAllDirty()
+{
+	for (uint_fast16_t page = 0; page < Height / 8; ++page)
+	{
+		this->dirtyStart[page] = 0;
+		this->dirtyEnd[page] = Width;
+	}
+}
+
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedGraphicDisplay<Width, Height>::markClean()
+{
+	for (uint_fast16_t page = 0; page < Height / 8; ++page)
+	{
+		this->dirtyStart[page] = Width;
+		this->dirtyEnd[page] = 0;
+	}
+}
+
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedGraphicDisplay<Width, Height>::markDirty(uint16_t page,
+		uint16_t start, uint16_t end)
+{
+	if (start < this->dirtyStart[page]) {
+		this->dirtyStart[page] = start;
+	}
+	if (end > this->dirtyEnd[page]) {
+		this->dirtyEnd[page] = end;
+	}
+}
+
+template <uint16_t Width, uint16_t Height>
+bool
+xpcc::BufferedGraphicDisplay<Width, Height>::getDirtyRange(uint16_t page,
+		uint16_t& start, uint16_t& end) const
+{
+	start = this->dirtyStart[page];
+	end = this->dirtyEnd[page];
+	return (start < end);
+}
+
+template <uint16_t Width, uint16_t Height>
+uint16_t
+xpcc::BufferedGraphicDisplay<Width, Height>::getDirtyBytes() const
+{
+	uint16_t bytes = 0;
+	for (uint_fast16_t page = 0; page < Height / 8; ++page)
+	{
+		if (this->dirtyStart[page] < this->dirtyEnd[page]) {
+			bytes += this->dirtyEnd[page] - this->dirtyStart[page];
+		}
+	}
+	return bytes;
+}
+
 // ----------------------------------------------------------------------------
 template <uint16_t Width, uint16_t Height>
 void
 xpcc::BufferedGraphicDisplay<Width, Height>::clear()
 {
-	for (uint_fast16_t y = 0; y < Height / 8; ++y) {
-		for (uint_fast16_t x = 0; x < Width; ++x) {
-			this->buffer[x][y] = 0;
+	for (uint_fast16_t y = 0; y < Height / 8; ++y)
+	{
+		// only columns which weren't empty before are marked as changed
+		uint16_t start = Width;
+		uint16_t end = 0;
+		for (uint_fast16_t x = 0; x < Width; ++x)
+		{
+			if (this->buffer[x][y] != 0)
+			{
+				this->buffer[x][y] = 0;
+				if (start == Width) {
+					start = x;
+				}
+				end = x + 1;
+			}
+		}
+		
+		if (start < end) {
+			this->markDirty(y, start, end);
 		}
 	}
 	
@@ -55,23 +138,98 @@ xpcc::BufferedGraphicDisplay<Width, Height>::drawHorizontalLine(
 		uint16_t length)
 {
 	const uint16_t y = start.getY() / 8;
+	if (static_cast<uint16_t>(start.getY()) >= Height) {
+		return;
+	}
+	
+	int32_t first = start.getX();
+	int32_t last = first + length;
+	if (first < 0) {
+		first = 0;
+	}
+	if (last > Width) {
+		last = Width;
+	}
+	if (first >= last) {
+		return;
+	}
+	const uint16_t x = first;
+	const uint16_t end = last;
 	
+	// same mapping as GraphicDisplay::setColor(): black clears the pixels
 	if (this->foregroundColor == glcd::Color::black())
 	{
-		const uint8_t mask = 1 << (start.getY() & 0x07);
-		for (uint_fast16_t x = start.getX(); x < static_cast<uint16_t>(start.getX() + length); ++x) {
-			if( x < Width && y < Height ) {
-				this->buffer[x][y] |= mask;
-			}
+		const uint8_t mask = ~(1 << (start.getY() & 0x07));
+		for (uint_fast16_t i = x; i < end; ++i) {
+			this->buffer[i][y] &= mask;
 		}
 	}
 	else {
-		const uint8_t mask = ~(1 << (start.getY() & 0x07));
-		for (uint_fast16_t x = start.getX(); x < static_cast<uint16_t>(start.getX() + length); ++x) {
-			if( x < Width && y < Height ) {
-				this->buffer[x][y] &= mask;
+		const uint8_t mask = 1 << (start.getY() & 0x07);
+		for (uint_fast16_t i = x; i < end; ++i) {
+			this->buffer[i][y] |= mask;
+		}
+	}
+	this->markDirty(y, x, end);
+}
+
+// ----------------------------------------------------------------------------
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedGraphicDisplay<Width, Height>::drawVerticalLine(
+		glcd::Point start,
+		uint16_t length)
+{
+	if (static_cast<uint16_t>(start.getX()) >= Width) {
+		return;
+	}
+	
+	int32_t first = start.getY();
+	int32_t last = first + length;
+	if (first < 0) {
+		first = 0;
+	}
+	if (last > Height) {
+		last = Height;
+	}
+	if (first < last) {
+		this->fillRect(start.getX(), first, 1, last - first);
+	}
+}
+
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedGraphicDisplay<Width, Height>::fillRect(int16_t x, int16_t y,
+		uint16_t width, uint16_t height)
+{
+	const uint16_t firstPage = y / 8;
+	const uint16_t lastPage = (y + height - 1) / 8;
+	const bool clear = (this->foregroundColor == glcd::Color::black());
+	
+	for (uint_fast16_t page = firstPage; page <= lastPage; ++page)
+	{
+		// all rows of the rectangle inside this page
+		uint8_t mask = 0xff;
+		if (page == firstPage) {
+			mask &= 0xff << (y & 0x07);
+		}
+		if (page == lastPage) {
+			mask &= 0xff >> (7 - ((y + height - 1) & 0x07));
+		}
+		
+		if (clear)
+		{
+			mask = ~mask;
+			for (uint_fast16_t i = x; i < static_cast<uint16_t>(x + width); ++i) {
+				this->buffer[i][page] &= mask;
 			}
 		}
+		else {
+			for (uint_fast16_t i = x; i < static_cast<uint16_t>(x + width); ++i) {
+				this->buffer[i][page] |= mask;
+			}
+		}
+		this->markDirty(page, x, x + width);
 	}
 }
 
@@ -82,30 +240,60 @@ xpcc::BufferedGraphicDisplay<Width, Height>::drawImageRaw(glcd::Point upperLeft,
 		uint16_t width, uint16_t height,
 		xpcc::accessor::Flash<uint8_t> data)
 {
-	if ((upperLeft.getY() & 0x07) == 0)
+	if (upperLeft.getY() < 0) {
+		GraphicDisplay::drawImageRaw(upperLeft, width, height, data);
+		return;
+	}
+	
+	// Every byte of the image is shifted into one or two pages of the
+	// buffer. Bits outside the image are preserved.
+	const uint16_t row = upperLeft.getY() / 8;
+	const uint8_t shift = upperLeft.getY() & 0x07;
+	const uint16_t rowCount = (height + 7) / 8;	// always round up
+	
+	int32_t first = upperLeft.getX();
+	int32_t last = first + width;
+	if (first < 0) {
+		first = 0;
+	}
+	if (last > Width) {
+		last = Width;
+	}
+	if (first >= last || row >= Height / 8) {
+		return;
+	}
+	
+	for (uint_fast16_t k = 0; k < rowCount; ++k)
 	{
-		uint16_t row = upperLeft.getY() / 8;
-		uint16_t rowCount = (height + 7) / 8;	// always round up
+		const uint16_t page = row + k;
+		if (page >= Height / 8) {
+			break;
+		}
+		
+		uint8_t valid = 0xff;
+		if (k == rowCount - 1u && (height & 0x07) != 0) {
+			valid = 0xff >> (8 - (height & 0x07));
+		}
+		const uint16_t mask = static_cast<uint16_t>(valid) << shift;
+		const bool hasNext = (mask > 0xff) && (page + 1 < Height / 8);
 		
-		if ((height & 0x07) == 0)
+		for (uint_fast16_t x = first; x < static_cast<uint16_t>(last); ++x)
 		{
-			for (uint_fast16_t i = 0; i < width; i++)
-			{
-				for (uint_fast16_t k = 0; k < rowCount; k++)
-				{
-					uint16_t x = upperLeft.getX() + i;
-					uint16_t y = k + row;
-
-					if( x < Width && y < Height ) {
-						this->buffer[x][y] = data[i + k * width];
-					}
-				}
+			const uint16_t bits = static_cast<uint16_t>(
+					data[(x - upperLeft.getX()) + k * width] & valid) << shift;
+			
+			this->buffer[x][page] = (this->buffer[x][page] & ~mask) | bits;
+			if (hasNext) {
+				this->buffer[x][page + 1] =
+						(this->buffer[x][page + 1] & ~(mask >> 8)) | (bits >> 8);
 			}
-			return;
+		}
+		
+		this->markDirty(page, first, last);
+		if (hasNext) {
+			this->markDirty(page + 1, first, last);
 		}
 	}
-	
-	GraphicDisplay::drawImageRaw(upperLeft, width, height, data);
 }
 
 // ----------------------------------------------------------------------------
@@ -115,6 +303,7 @@ xpcc::BufferedGraphicDisplay<Width, Height>::setPixel(int16_t x, int16_t y)
 {
 	if (static_cast<uint16_t>(x) < Width && static_cast<uint16_t>(y) < Height) {
 		this->buffer[x][y / 8] |= (1 << (y & 0x07));
+		this->markDirty(y / 8, x, x + 1);
 	}
 }
 
@@ -124,6 +313,7 @@ xpcc::BufferedGraphicDisplay<Width, Height>::clearPixel(int16_t x, int16_t y)
 {
 	if (static_cast<uint16_t>(x) < Width && static_cast<uint16_t>(y) < Height) {
 		this->buffer[x][y / 8] &= ~(1 << (y & 0x07));
+		this->markDirty(y / 8, x, x + 1);
 	}
 }
 
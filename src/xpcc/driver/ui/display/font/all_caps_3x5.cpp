@@ -37,13 +37,15 @@ namespace xpcc
 	{
 		FLASH_STORAGE(uint8_t AllCaps3x5[]) =
 		{
-			0x72, 0x01, // total size of this array
-			3,	// width (may vary)
+			0x34, 0x02, // total size of this array
+			0,	// extended header, flags and width follow the char count
 			5,	// height
 			1,	// hspace
 			1, 	// vspace
 			32,	// first char
 			96,	// char count
+			0x80,	// flags: glyph offset table
+			3,	// width (may vary)
 			
 			// char widths
 			// for each character the separate width in pixels
@@ -156,7 +158,108 @@ namespace xpcc
 			0x11, 0x0E, 0x04, // 125
 			0x04, 0x06, 0x04, // 126
 			0x00, 0x00, 0x00, // 127
+			
+			// glyph offsets
+			// for each character the position of its font data within
+			// this array (low byte, high byte)
+			0x6A, 0x00, // 32
+			0x6D, 0x00, // 33
+			0x6E, 0x00, // 34
+			0x70, 0x00, // 35
+			0x74, 0x00, // 36
+			0x77, 0x00, // 37
+			0x7A, 0x00, // 38
+			0x7E, 0x00, // 39
+			0x7F, 0x00, // 40
+			0x81, 0x00, // 41
+			0x83, 0x00, // 42
+			0x86, 0x00, // 43
+			0x89, 0x00, // 44
+			0x8B, 0x00, // 45
+			0x8E, 0x00, // 46
+			0x8F, 0x00, // 47
+			0x92, 0x00, // 48
+			0x95, 0x00, // 49
+			0x98, 0x00, // 50
+			0x9B, 0x00, // 51
+			0x9E, 0x00, // 52
+			0xA1, 0x00, // 53
+			0xA4, 0x00, // 54
+			0xA7, 0x00, // 55
+			0xAA, 0x00, // 56
+			0xAD, 0x00, // 57
+			0xB0, 0x00, // 58
+			0xB1, 0x00, // 59
+			0xB3, 0x00, // 60
+			0xB6, 0x00, // 61
+			0xB9, 0x00, // 62
+			0xBC, 0x00, // 63
+			0xBF, 0x00, // 64
+			0xC2, 0x00, // 65
+			0xC5, 0x00, // 66
+			0xC8, 0x00, // 67
+			0xCB, 0x00, // 68
+			0xCE, 0x00, // 69
+			0xD1, 0x00, // 70
+			0xD4, 0x00, // 71
+			0xD7, 0x00, // 72
+			0xDA, 0x00, // 73
+			0xDB, 0x00, // 74
+			0xDD, 0x00, // 75
+			0xE0, 0x00, // 76
+			0xE3, 0x00, // 77
+			0xE6, 0x00, // 78
+			0xE9, 0x00, // 79
+			0xEC, 0x00, // 80
+			0xEF, 0x00, // 81
+			0xF2, 0x00, // 82
+			0xF5, 0x00, // 83
+			0xF8, 0x00, // 84
+			0xFB, 0x00, // 85
+			0xFE, 0x00, // 86
+			0x01, 0x01, // 87
+			0x04, 0x01, // 88
+			0x07, 0x01, // 89
+			0x0A, 0x01, // 90
+			0x0D, 0x01, // 91
+			0x0F, 0x01, // 92
+			0x12, 0x01, // 93
+			0x14, 0x01, // 94
+			0x17, 0x01, // 95
+			0x1A, 0x01, // 96
+			0x1C, 0x01, // 97
+			0x1F, 0x01, // 98
+			0x22, 0x01, // 99
+			0x25, 0x01, // 100
+			0x28, 0x01, // 101
+			0x2B, 0x01, // 102
+			0x2E, 0x01, // 103
+			0x31, 0x01, // 104
+			0x34, 0x01, // 105
+			0x35, 0x01, // 106
+			0x37, 0x01, // 107
+			0x3A, 0x01, // 108
+			0x3D, 0x01, // 109
+			0x40, 0x01, // 110
+			0x43, 0x01, // 111
+			0x46, 0x01, // 112
+			0x49, 0x01, // 113
+			0x4C, 0x01, // 114
+			0x4F, 0x01, // 115
+			0x52, 0x01, // 116
+			0x55, 0x01, // 117
+			0x58, 0x01, // 118
+			0x5B, 0x01, // 119
+			0x5E, 0x01, // 120
+			0x61, 0x01, // 121
+			0x64, 0x01, // 122
+			0x67, 0x01, // 123
+			0x6A, 0x01, // 124
+			0x6B, 0x01, // 125
+			0x6E, 0x01, // 126
+			0x71, 0x01, // 127
 		};
+
 	}
 }
 
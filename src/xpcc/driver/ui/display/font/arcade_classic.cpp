@@ -37,13 +37,15 @@ namespace xpcc
 	{
 		FLASH_STORAGE(uint8_t ArcadeClassic[]) =
 		{
-			0x08, 0x03, // total size of this array
-			7,	// width (may vary)
+			0xCA, 0x03, // total size of this array
+			0,	// extended header, flags and width follow the char count
 			8,	// height
 			0,	// hspace
 			1, 	// vspace
 			32,	// first char
 			96,	// char count
+			0x80,	// flags: glyph offset table
+			7,	// width (may vary)
 			
 			// char widths
 			// for each character the separate width in pixels
@@ -156,7 +158,108 @@ namespace xpcc
 			0x00, 0x00, 0x41, 0x77, 0x3E, 0x08, 0x00, // 125
 			0x00, 0x18, 0x0C, 0x1C, 0x18, 0x0C, 0x00, // 126
 			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 127
+			
+			// glyph offsets
+			// for each character the position of its font data within
+			// this array (low byte, high byte)
+			0x6A, 0x00, // 32
+			0x71, 0x00, // 33
+			0x78, 0x00, // 34
+			0x7F, 0x00, // 35
+			0x86, 0x00, // 36
+			0x8D, 0x00, // 37
+			0x94, 0x00, // 38
+			0x9B, 0x00, // 39
+			0xA2, 0x00, // 40
+			0xA9, 0x00, // 41
+			0xB0, 0x00, // 42
+			0xB7, 0x00, // 43
+			0xBE, 0x00, // 44
+			0xC5, 0x00, // 45
+			0xCC, 0x00, // 46
+			0xD3, 0x00, // 47
+			0xDA, 0x00, // 48
+			0xE1, 0x00, // 49
+			0xE8, 0x00, // 50
+			0xEF, 0x00, // 51
+			0xF6, 0x00, // 52
+			0xFD, 0x00, // 53
+			0x04, 0x01, // 54
+			0x0B, 0x01, // 55
+			0x12, 0x01, // 56
+			0x19, 0x01, // 57
+			0x20, 0x01, // 58
+			0x27, 0x01, // 59
+			0x2E, 0x01, // 60
+			0x35, 0x01, // 61
+			0x3C, 0x01, // 62
+			0x43, 0x01, // 63
+			0x4A, 0x01, // 64
+			0x51, 0x01, // 65
+			0x58, 0x01, // 66
+			0x5F, 0x01, // 67
+			0x66, 0x01, // 68
+			0x6D, 0x01, // 69
+			0x74, 0x01, // 70
+			0x7B, 0x01, // 71
+			0x82, 0x01, // 72
+			0x89, 0x01, // 73
+			0x90, 0x01, // 74
+			0x97, 0x01, // 75
+			0x9E, 0x01, // 76
+			0xA5, 0x01, // 77
+			0xAC, 0x01, // 78
+			0xB3, 0x01, // 79
+			0xBA, 0x01, // 80
+			0xC1, 0x01, // 81
+			0xC8, 0x01, // 82
+			0xCF, 0x01, // 83
+			0xD6, 0x01, // 84
+			0xDD, 0x01, // 85
+			0xE4, 0x01, // 86
+			0xEB, 0x01, // 87
+			0xF2, 0x01, // 88
+			0xF9, 0x01, // 89
+			0x00, 0x02, // 90
+			0x07, 0x02, // 91
+			0x0E, 0x02, // 92
+			0x15, 0x02, // 93
+			0x1C, 0x02, // 94
+			0x23, 0x02, // 95
+			0x2A, 0x02, // 96
+			0x31, 0x02, // 97
+			0x38, 0x02, // 98
+			0x3F, 0x02, // 99
+			0x46, 0x02, // 100
+			0x4D, 0x02, // 101
+			0x54, 0x02, // 102
+			0x5B, 0x02, // 103
+			0x62, 0x02, // 104
+			0x69, 0x02, // 105
+			0x70, 0x02, // 106
+			0x77, 0x02, // 107
+			0x7E, 0x02, // 108
+			0x85, 0x02, // 109
+			0x8C, 0x02, // 110
+			0x93, 0x02, // 111
+			0x9A, 0x02, // 112
+			0xA1, 0x02, // 113
+			0xA8, 0x02, // 114
+			0xAF, 0x02, // 115
+			0xB6, 0x02, // 116
+			0xBD, 0x02, // 117
+			0xC4, 0x02, // 118
+			0xCB, 0x02, // 119
+			0xD2, 0x02, // 120
+			0xD9, 0x02, // 121
+			0xE0, 0x02, // 122
+			0xE7, 0x02, // 123
+			0xEE, 0x02, // 124
+			0xF5, 0x02, // 125
+			0xFC, 0x02, // 126
+			0x03, 0x03, // 127
 		};
+
 	}
 }
 
@@ -47,7 +47,7 @@ namespace xpcc
 		 * - first char      : 32
 		 * - last char       : 128
 		 * - number of chars : 96
-		 * - size in bytes   : 776
+		 * - size in bytes   : 970
 		 * 
 		 * \ingroup	font
 		 */
@@ -37,13 +37,15 @@ namespace xpcc
 	{
 		FLASH_STORAGE(uint8_t Assertion[]) =
 		{
-			0x18, 0x05, // total size of this array
-			7,	// width (may vary)
+			0xDA, 0x05, // total size of this array
+			0,	// extended header, flags and width follow the char count
 			15,	// height
 			0,	// hspace
 			1, 	// vspace
 			32,	// first char
 			96,	// char count
+			0x80,	// flags: glyph offset table
+			7,	// width (may vary)
 			
 			// char widths
 			// for each character the separate width in pixels
@@ -156,7 +158,108 @@ namespace xpcc
 			0x01, 0x01, 0xBF, 0xFE, 0x40, 0x10, 0x10, 0x1F, 0x0F, 0x00, // 125
 			0xC0, 0x60, 0xE0, 0xC0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, // 126
 			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 127
+			
+			// glyph offsets
+			// for each character the position of its font data within
+			// this array (low byte, high byte)
+			0x6A, 0x00, // 32
+			0x78, 0x00, // 33
+			0x7C, 0x00, // 34
+			0x86, 0x00, // 35
+			0x9A, 0x00, // 36
+			0xA8, 0x00, // 37
+			0xBC, 0x00, // 38
+			0xCC, 0x00, // 39
+			0xD0, 0x00, // 40
+			0xD8, 0x00, // 41
+			0xE0, 0x00, // 42
+			0xF0, 0x00, // 43
+			0xFC, 0x00, // 44
+			0x02, 0x01, // 45
+			0x0C, 0x01, // 46
+			0x10, 0x01, // 47
+			0x1C, 0x01, // 48
+			0x2A, 0x01, // 49
+			0x32, 0x01, // 50
+			0x40, 0x01, // 51
+			0x4E, 0x01, // 52
+			0x5C, 0x01, // 53
+			0x6A, 0x01, // 54
+			0x78, 0x01, // 55
+			0x84, 0x01, // 56
+			0x92, 0x01, // 57
+			0xA0, 0x01, // 58
+			0xA4, 0x01, // 59
+			0xAA, 0x01, // 60
+			0xB4, 0x01, // 61
+			0xBE, 0x01, // 62
+			0xC8, 0x01, // 63
+			0xD6, 0x01, // 64
+			0xEC, 0x01, // 65
+			0xFA, 0x01, // 66
+			0x08, 0x02, // 67
+			0x16, 0x02, // 68
+			0x24, 0x02, // 69
+			0x32, 0x02, // 70
+			0x40, 0x02, // 71
+			0x4E, 0x02, // 72
+			0x5C, 0x02, // 73
+			0x60, 0x02, // 74
+			0x6E, 0x02, // 75
+			0x7C, 0x02, // 76
+			0x88, 0x02, // 77
+			0x9C, 0x02, // 78
+			0xAA, 0x02, // 79
+			0xB8, 0x02, // 80
+			0xC6, 0x02, // 81
+			0xD4, 0x02, // 82
+			0xE2, 0x02, // 83
+			0xF0, 0x02, // 84
+			0xFC, 0x02, // 85
+			0x0A, 0x03, // 86
+			0x18, 0x03, // 87
+			0x30, 0x03, // 88
+			0x3E, 0x03, // 89
+			0x4A, 0x03, // 90
+			0x58, 0x03, // 91
+			0x60, 0x03, // 92
+			0x6C, 0x03, // 93
+			0x74, 0x03, // 94
+			0x82, 0x03, // 95
+			0x90, 0x03, // 96
+			0x96, 0x03, // 97
+			0xA4, 0x03, // 98
+			0xB2, 0x03, // 99
+			0xC0, 0x03, // 100
+			0xCE, 0x03, // 101
+			0xDC, 0x03, // 102
+			0xE6, 0x03, // 103
+			0xF4, 0x03, // 104
+			0x02, 0x04, // 105
+			0x06, 0x04, // 106
+			0x0E, 0x04, // 107
+			0x1C, 0x04, // 108
+			0x20, 0x04, // 109
+			0x34, 0x04, // 110
+			0x42, 0x04, // 111
+			0x50, 0x04, // 112
+			0x5E, 0x04, // 113
+			0x6C, 0x04, // 114
+			0x78, 0x04, // 115
+			0x86, 0x04, // 116
+			0x90, 0x04, // 117
+			0x9E, 0x04, // 118
+			0xAC, 0x04, // 119
+			0xC4, 0x04, // 120
+			0xD2, 0x04, // 121
+			0xE0, 0x04, // 122
+			0xEA, 0x04, // 123
+			0xF4, 0x04, // 124
+			0xF8, 0x04, // 125
+			0x02, 0x05, // 126
+			0x0C, 0x05, // 127
 		};
+
 	}
 }
 
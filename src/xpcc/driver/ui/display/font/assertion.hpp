@@ -47,7 +47,7 @@ namespace xpcc
 		 * - first char      : 32
 		 * - last char       : 128
 		 * - number of chars : 96
-		 * - size in bytes   : 1304
+		 * - size in bytes   : 1498
 		 * 
 		 * \ingroup	font
 		 */
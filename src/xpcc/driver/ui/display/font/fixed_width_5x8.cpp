@@ -37,13 +37,15 @@ namespace xpcc
 	{
 		FLASH_STORAGE(uint8_t FixedWidth5x8[]) =
 		{
-			0x48, 0x02, // total size of this array
-			5,	// width (may vary)
+			0x0A, 0x03, // total size of this array
+			0,	// extended header, flags and width follow the char count
 			8,	// height
 			0,	// hspace
 			1, 	// vspace
 			32,	// first char
 			96,	// char count
+			0x80,	// flags: glyph offset table
+			5,	// width (may vary)
 			
 			// char widths
 			// for each character the separate width in pixels
@@ -156,7 +158,108 @@ namespace xpcc
 			0x00, 0x41, 0x41, 0x3E, 0x08, // 125
 			0x10, 0x08, 0x10, 0x08, 0x00, // 126
 			0x7C, 0x46, 0x43, 0x46, 0x7C, // 127
+			
+			// glyph offsets
+			// for each character the position of its font data within
+			// this array (low byte, high byte)
+			0x6A, 0x00, // 32
+			0x6F, 0x00, // 33
+			0x74, 0x00, // 34
+			0x79, 0x00, // 35
+			0x7E, 0x00, // 36
+			0x83, 0x00, // 37
+			0x88, 0x00, // 38
+			0x8D, 0x00, // 39
+			0x92, 0x00, // 40
+			0x97, 0x00, // 41
+			0x9C, 0x00, // 42
+			0xA1, 0x00, // 43
+			0xA6, 0x00, // 44
+			0xAB, 0x00, // 45
+			0xB0, 0x00, // 46
+			0xB5, 0x00, // 47
+			0xBA, 0x00, // 48
+			0xBF, 0x00, // 49
+			0xC4, 0x00, // 50
+			0xC9, 0x00, // 51
+			0xCE, 0x00, // 52
+			0xD3, 0x00, // 53
+			0xD8, 0x00, // 54
+			0xDD, 0x00, // 55
+			0xE2, 0x00, // 56
+			0xE7, 0x00, // 57
+			0xEC, 0x00, // 58
+			0xF1, 0x00, // 59
+			0xF6, 0x00, // 60
+			0xFB, 0x00, // 61
+			0x00, 0x01, // 62
+			0x05, 0x01, // 63
+			0x0A, 0x01, // 64
+			0x0F, 0x01, // 65
+			0x14, 0x01, // 66
+			0x19, 0x01, // 67
+			0x1E, 0x01, // 68
+			0x23, 0x01, // 69
+			0x28, 0x01, // 70
+			0x2D, 0x01, // 71
+			0x32, 0x01, // 72
+			0x37, 0x01, // 73
+			0x3C, 0x01, // 74
+			0x41, 0x01, // 75
+			0x46, 0x01, // 76
+			0x4B, 0x01, // 77
+			0x50, 0x01, // 78
+			0x55, 0x01, // 79
+			0x5A, 0x01, // 80
+			0x5F, 0x01, // 81
+			0x64, 0x01, // 82
+			0x69, 0x01, // 83
+			0x6E, 0x01, // 84
+			0x73, 0x01, // 85
+			0x78, 0x01, // 86
+			0x7D, 0x01, // 87
+			0x82, 0x01, // 88
+			0x87, 0x01, // 89
+			0x8C, 0x01, // 90
+			0x91, 0x01, // 91
+			0x96, 0x01, // 92
+			0x9B, 0x01, // 93
+			0xA0, 0x01, // 94
+			0xA5, 0x01, // 95
+			0xAA, 0x01, // 96
+			0xAF, 0x01, // 97
+			0xB4, 0x01, // 98
+			0xB9, 0x01, // 99
+			0xBE, 0x01, // 100
+			0xC3, 0x01, // 101
+			0xC8, 0x01, // 102
+			0xCD, 0x01, // 103
+			0xD2, 0x01, // 104
+			0xD7, 0x01, // 105
+			0xDC, 0x01, // 106
+			0xE1, 0x01, // 107
+			0xE6, 0x01, // 108
+			0xEB, 0x01, // 109
+			0xF0, 0x01, // 110
+			0xF5, 0x01, // 111
+			0xFA, 0x01, // 112
+			0xFF, 0x01, // 113
+			0x04, 0x02, // 114
+			0x09, 0x02, // 115
+			0x0E, 0x02, // 116
+			0x13, 0x02, // 117
+			0x18, 0x02, // 118
+			0x1D, 0x02, // 119
+			0x22, 0x02, // 120
+			0x27, 0x02, // 121
+			0x2C, 0x02, // 122
+			0x31, 0x02, // 123
+			0x36, 0x02, // 124
+			0x3B, 0x02, // 125
+			0x40, 0x02, // 126
+			0x45, 0x02, // 127
 		};
+
 	}
 }
 
@@ -37,13 +37,15 @@ namespace xpcc
 	{
 		FLASH_STORAGE(uint8_t Numbers14x32[]) =
 		{
-			0x42, 0x02, // total size of this array
-			14,	// width (may vary)
+			0x44, 0x02, // total size of this array
+			0,	// extended header, flags and width follow the char count
 			32,	// height
 			3,	// hspace
 			4, 	// vspace
 			48,	// first char
 			10,	// char count
+			0,	// flags: none
+			14,	// width (may vary)
 			
 			// char widths
 			// for each character the separate width in pixels
@@ -62,6 +64,51 @@ namespace xpcc
 			0xE0, 0xF8, 0xFC, 0xFE, 0x1E, 0x0F, 0x0F, 0x0F, 0x0F, 0x1E, 0xFE, 0xFC, 0xF8, 0xE0, 0x0F, 0x3F, 0x7F, 0xFF, 0xF0, 0xE0, 0xC0, 0xC0, 0xE0, 0xF0, 0xFF, 0x7F, 0x3F, 0x0F, 0xF0, 0xFC, 0xFE, 0xFF, 0x0F, 0x07, 0x03, 0x03, 0x07, 0x0F, 0xFF, 0xFE, 0xFC, 0xF0, 0x07, 0x1F, 0x3F, 0x7F, 0x78, 0xF0, 0xF0, 0xF0, 0xF0, 0x78, 0x7F, 0x3F, 0x1F, 0x07, // 56
 			0xE0, 0xF8, 0xFC, 0xFE, 0x1E, 0x0F, 0x0F, 0x0F, 0x0F, 0x1E, 0xFE, 0xFC, 0xF8, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0xC0, 0x80, 0x80, 0xC0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x3E, 0x7E, 0x7C, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0x7F, 0x7F, 0x3F, 0x0F, // 57
 		};
+
+		FLASH_STORAGE(uint8_t Numbers14x32Rle[]) =
+		{
+			0xF8, 0x01, // total size of this array
+			0,	// extended header, flags and width follow the char count
+			32,	// height
+			3,	// hspace
+			4, 	// vspace
+			48,	// first char
+			10,	// char count
+			0x80 | 0x40,	// flags: glyph offset table | compressed data
+			14,	// width (may vary)
+			
+			// char widths
+			// for each character the separate width in pixels
+			14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 
+			
+			// font data
+			// PackBits compressed bit field of every character
+			0x04, 0xF0, 0xFC, 0xFE, 0xFE, 0x1F, 0xFD, 0x0F, 0x04, 0x1F, 0xFE, 0xFE, 0xFC, 0xF0, 0xFD, 0xFF, 0x05, 0x00, 0x00, 0x80, 0xC0, 0xF0, 0x7C, 0xF9, 0xFF, 0x05, 0x3E, 0x0F, 0x03, 0x01, 0x00, 0x00, 0xFD, 0xFF, 0x04, 0x0F, 0x3F, 0x7F, 0x7F, 0xF8, 0xFD, 0xF0, 0x04, 0xF8, 0x7F, 0x7F, 0x3F, 0x0F, // 48
+			0xFD, 0x00, 0x04, 0x80, 0xE0, 0xF0, 0xFC, 0x7E, 0xFE, 0xFF, 0x00, 0xFE, 0xFE, 0x00, 0x06, 0x0C, 0x0F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0xFD, 0xFF, 0xF7, 0x00, 0xFD, 0xFF, 0xF7, 0x00, 0x04, 0x7F, 0xFF, 0xFF, 0x7F, 0x00, // 49
+			0x04, 0x30, 0x7C, 0x7E, 0x3E, 0x1F, 0xFD, 0x0F, 0x04, 0x1F, 0xFE, 0xFE, 0xFC, 0xF0, 0xFB, 0x00, 0x12, 0x80, 0xC0, 0xE0, 0xF0, 0xFF, 0xFF, 0x7F, 0x1F, 0xC0, 0xF0, 0xF8, 0xFC, 0x7E, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0xFF, 0xF8, 0xF0, 0x00, 0x60, // 50
+			0x04, 0x30, 0x7C, 0x7E, 0x3E, 0x1F, 0xFD, 0x0F, 0x04, 0x1F, 0xFE, 0xFE, 0xFC, 0xF0, 0xFC, 0x00, 0x00, 0x80, 0xFE, 0xC0, 0x04, 0xE0, 0xFF, 0xFF, 0x7F, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFE, 0x03, 0x09, 0x07, 0xFF, 0xFF, 0xFE, 0xF8, 0x0C, 0x3E, 0x7E, 0x7C, 0xF8, 0xFD, 0xF0, 0x04, 0xF8, 0x7F, 0x7F, 0x3F, 0x0F, // 51
+			0xFD, 0x00, 0x03, 0x80, 0xF0, 0xFC, 0xFE, 0xFE, 0xFF, 0x00, 0xFE, 0xFE, 0x00, 0x06, 0x80, 0xF0, 0xFE, 0xFF, 0x3F, 0x07, 0x00, 0xFD, 0xFF, 0x05, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xE7, 0xFD, 0xE0, 0xFD, 0xFF, 0x02, 0xE0, 0xE0, 0x00, 0xFA, 0x01, 0x05, 0x7F, 0xFF, 0xFF, 0x7F, 0x01, 0x01, // 52
+			0x00, 0xFE, 0xFE, 0xFF, 0xF8, 0x0F, 0x00, 0x06, 0xFD, 0xFF, 0x00, 0xE0, 0xFB, 0xF0, 0x03, 0xE0, 0xC0, 0x80, 0x01, 0xFE, 0x03, 0x01, 0x01, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFD, 0xFF, 0x04, 0x0C, 0x3E, 0x7E, 0x7C, 0xF8, 0xFE, 0xF0, 0x05, 0xF8, 0xFC, 0x7F, 0x3F, 0x1F, 0x07, // 53
+			0x04, 0xE0, 0xF8, 0xFC, 0xFE, 0x1E, 0xFD, 0x0F, 0x04, 0x1F, 0x3E, 0x7E, 0x7C, 0x30, 0xFD, 0xFF, 0x00, 0xE0, 0xFB, 0xF0, 0x02, 0xE0, 0xC0, 0x80, 0xFD, 0xFF, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x01, 0xFD, 0xFF, 0x04, 0x07, 0x1F, 0x3F, 0x7F, 0x78, 0xFD, 0xF0, 0x04, 0x78, 0x7F, 0x3F, 0x1F, 0x07, // 54
+			0x00, 0x06, 0xF8, 0x0F, 0xFE, 0xFF, 0x00, 0xFE, 0xFB, 0x00, 0x07, 0x80, 0xE0, 0xF8, 0xFE, 0xFF, 0x3F, 0x0F, 0x03, 0xFC, 0x00, 0x00, 0xFE, 0xFE, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0x7F, 0xFC, 0x00, // 55
+			0x04, 0xE0, 0xF8, 0xFC, 0xFE, 0x1E, 0xFD, 0x0F, 0x25, 0x1E, 0xFE, 0xFC, 0xF8, 0xE0, 0x0F, 0x3F, 0x7F, 0xFF, 0xF0, 0xE0, 0xC0, 0xC0, 0xE0, 0xF0, 0xFF, 0x7F, 0x3F, 0x0F, 0xF0, 0xFC, 0xFE, 0xFF, 0x0F, 0x07, 0x03, 0x03, 0x07, 0x0F, 0xFF, 0xFE, 0xFC, 0xF0, 0x07, 0x1F, 0x3F, 0x7F, 0x78, 0xFD, 0xF0, 0x04, 0x78, 0x7F, 0x3F, 0x1F, 0x07, // 56
+			0x04, 0xE0, 0xF8, 0xFC, 0xFE, 0x1E, 0xFD, 0x0F, 0x05, 0x1E, 0xFE, 0xFC, 0xF8, 0xE0, 0x3F, 0xFE, 0xFF, 0x05, 0xE0, 0xC0, 0x80, 0x80, 0xC0, 0xE0, 0xFD, 0xFF, 0x04, 0x00, 0x00, 0x01, 0x03, 0x03, 0xFD, 0x07, 0x00, 0x03, 0xFD, 0xFF, 0x04, 0x0C, 0x3E, 0x7E, 0x7C, 0xF8, 0xFD, 0xF0, 0x04, 0xF8, 0x7F, 0x7F, 0x3F, 0x0F, // 57
+			
+			// glyph offsets
+			// for each character the position of its font data within
+			// this array (low byte, high byte)
+			0x14, 0x00, // 48
+			0x44, 0x00, // 49
+			0x68, 0x00, // 50
+			0x96, 0x00, // 51
+			0xC9, 0x00, // 52
+			0xF8, 0x00, // 53
+			0x25, 0x01, // 54
+			0x55, 0x01, // 55
+			0x79, 0x01, // 56
+			0xB0, 0x01, // 57
+		};
+
 	}
 }
 
@@ -47,11 +47,20 @@ namespace xpcc
 		 * - first char      : 48
 		 * - last char       : 58
 		 * - number of chars : 10
-		 * - size in bytes   : 578
+		 * - size in bytes   : 580
 		 * 
 		 * \ingroup	font
 		 */
 		EXTERN_FLASH_STORAGE(uint8_t Numbers14x32[]);
+		
+		/**
+		 * \brief	Numbers 14x32, compressed
+		 * 
+		 * Same font with PackBits compressed font data, 504 bytes.
+		 * 
+		 * \ingroup	font
+		 */
+		EXTERN_FLASH_STORAGE(uint8_t Numbers14x32Rle[]);
 	}
 }
 
@@ -37,13 +37,15 @@ namespace xpcc
 	{
 		FLASH_STORAGE(uint8_t Numbers40x57[]) =
 		{
-			0x02, 0x0B, // total size of this array
-			40,	// width (may vary)
+			0x04, 0x0B, // total size of this array
+			0,	// extended header, flags and width follow the char count
 			56,	// height
 			4,	// hspace
 			0, 	// vspace
 			48,	// first char
 			10,	// char count
+			0,	// flags: none
+			40,	// width (may vary)
 			
 			// char widths
 			// for each character the separate width in pixels
@@ -62,6 +64,51 @@ namespace xpcc
 			0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0x00, 0x00, 0x00, 0x07, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xF0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0xE0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC1, 0xE3, 0xE7, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xF1, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0xE0, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x07, 0x0F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x0F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, // 56
 			0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x1F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0x1F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x87, 0xC7, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x1F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 57
 		};
+
+		FLASH_STORAGE(uint8_t Numbers40x57Rle[]) =
+		{
+			0xBF, 0x04, // total size of this array
+			0,	// extended header, flags and width follow the char count
+			56,	// height
+			4,	// hspace
+			0, 	// vspace
+			48,	// first char
+			10,	// char count
+			0x80 | 0x40,	// flags: glyph offset table | compressed data
+			40,	// width (may vary)
+			
+			// char widths
+			// for each character the separate width in pixels
+			40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 
+			
+			// font data
+			// PackBits compressed bit field of every character
+			0xFC, 0x00, 0x06, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xF8, 0xFF, 0xFE, 0xFE, 0x06, 0xFC, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0xF9, 0x00, 0x02, 0xE0, 0xFC, 0xFE, 0xF8, 0xFF, 0x02, 0x1F, 0x0F, 0x07, 0xFC, 0x03, 0x02, 0x07, 0x0F, 0x1F, 0xF7, 0xFF, 0x01, 0xFC, 0xE0, 0xFE, 0x00, 0x00, 0xE0, 0xF6, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x0F, 0xF6, 0xFF, 0x01, 0xE0, 0x00, 0xF5, 0xFF, 0xF2, 0x00, 0xF5, 0xFF, 0x01, 0x00, 0x07, 0xF6, 0xFF, 0x00, 0xF0, 0xF4, 0x00, 0x00, 0xF0, 0xF6, 0xFF, 0x05, 0x07, 0x00, 0x00, 0x01, 0x0F, 0x3F, 0xF8, 0xFF, 0x03, 0xFE, 0xF8, 0xF0, 0xE0, 0xFC, 0xC0, 0x02, 0xE0, 0xF0, 0xF8, 0xF7, 0xFF, 0x01, 0x3F, 0x0F, 0xF9, 0x00, 0x06, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x3F, 0xFE, 0x7F, 0xF8, 0xFF, 0xFE, 0x7F, 0x06, 0x3F, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0xFB, 0x00, // 48
+			0xF2, 0x00, 0x08, 0x80, 0xC0, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFE, 0xF8, 0xFF, 0xF4, 0x00, 0x06, 0x10, 0x78, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xED, 0xFF, 0xF2, 0x00, 0x02, 0x03, 0x0F, 0x1F, 0xFE, 0x0F, 0x06, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x00, 0xF5, 0xFF, 0xE5, 0x00, 0xF5, 0xFF, 0xE5, 0x00, 0xF5, 0xFF, 0xE5, 0x00, 0xF5, 0xFF, 0xE5, 0x00, 0xF5, 0xFF, 0xFA, 0x00, // 49
+			0x07, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFE, 0xFC, 0xFE, 0xFE, 0xF7, 0xFF, 0xFD, 0xFE, 0x06, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0xFA, 0x00, 0x0C, 0x03, 0x07, 0x0F, 0x3F, 0x7F, 0x7F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0xFB, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x1F, 0xF6, 0xFF, 0x00, 0xF8, 0xE8, 0x00, 0x02, 0xC0, 0xE0, 0xF8, 0xF7, 0xFF, 0x01, 0x3F, 0x0F, 0xF1, 0x00, 0x07, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0xF9, 0xFF, 0x04, 0x7F, 0x3F, 0x1F, 0x07, 0x03, 0xF5, 0x00, 0x05, 0x80, 0xC0, 0xF0, 0xF8, 0xFC, 0xFE, 0xF8, 0xFF, 0x06, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0xF3, 0x00, 0x02, 0x80, 0xF0, 0xFC, 0xF5, 0xFF, 0x02, 0xCF, 0xC7, 0xC3, 0xEE, 0xC0, 0xFE, 0x00, 0xDC, 0xFF, 0x00, 0x00, // 50
+			0x03, 0x00, 0x00, 0x20, 0xF0, 0xFE, 0xF8, 0x01, 0xFC, 0xFC, 0xFD, 0xFE, 0xF6, 0xFF, 0xFE, 0xFE, 0xFE, 0xFC, 0x04, 0xF8, 0xF0, 0xF0, 0xE0, 0x80, 0xF8, 0x00, 0x05, 0x03, 0x0F, 0x1F, 0x1F, 0x0F, 0x0F, 0xFE, 0x07, 0xF9, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x1F, 0xF7, 0xFF, 0x01, 0xFE, 0xF8, 0xF3, 0x00, 0xF8, 0xE0, 0xFE, 0xF0, 0x01, 0xF8, 0xFE, 0xF9, 0xFF, 0x03, 0x7F, 0x3F, 0x0F, 0x03, 0xF3, 0x00, 0xF7, 0x7F, 0xF8, 0xFF, 0x06, 0xFD, 0xFD, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0xE7, 0x00, 0x03, 0x01, 0x01, 0x03, 0x0F, 0xF6, 0xFF, 0x00, 0xF8, 0xFE, 0x00, 0x01, 0x80, 0xF8, 0xFE, 0xF0, 0xFD, 0xE0, 0xF7, 0xC0, 0xFE, 0xE0, 0x02, 0xF0, 0xF8, 0xFE, 0xF7, 0xFF, 0x04, 0x3F, 0x07, 0x00, 0x00, 0x18, 0xFD, 0x3F, 0xFC, 0x7F, 0xF5, 0xFF, 0xFC, 0x7F, 0x07, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0xFD, 0x00, // 51
+			0xF0, 0x00, 0x05, 0x80, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0xF5, 0xFF, 0xF1, 0x00, 0x04, 0x80, 0xE0, 0xF0, 0xF8, 0xFE, 0xFB, 0xFF, 0x00, 0x7F, 0xF5, 0xFF, 0xF6, 0x00, 0x03, 0xC0, 0xE0, 0xF8, 0xFC, 0xFA, 0xFF, 0x05, 0x3F, 0x1F, 0x07, 0x03, 0x01, 0x00, 0xF5, 0xFF, 0xFB, 0x00, 0x03, 0x80, 0xE0, 0xF8, 0xFC, 0xFA, 0xFF, 0x03, 0x7F, 0x1F, 0x07, 0x01, 0xFA, 0x00, 0xF5, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0xF6, 0xFF, 0xF6, 0xFE, 0xF5, 0xFF, 0xFC, 0xFE, 0xEA, 0x07, 0xF5, 0xFF, 0xFC, 0x07, 0xEA, 0x00, 0xF5, 0xFF, 0xFC, 0x00, // 52
+			0xFB, 0x00, 0xE3, 0xFF, 0xF8, 0x00, 0x00, 0xFE, 0xF7, 0xFF, 0xED, 0x03, 0xF8, 0x00, 0xF7, 0xFF, 0x00, 0xF1, 0xFD, 0xF0, 0xFD, 0xE0, 0xFE, 0xC0, 0xFE, 0x80, 0xF3, 0x00, 0xF7, 0x3F, 0xFC, 0x7F, 0xF5, 0xFF, 0x05, 0xFE, 0xFE, 0xFC, 0xF0, 0xE0, 0x80, 0xE8, 0x00, 0x03, 0x01, 0x03, 0x07, 0x0F, 0xF6, 0xFF, 0x00, 0xFC, 0xFD, 0x00, 0x00, 0xC0, 0xFE, 0xF0, 0xFD, 0xE0, 0xF7, 0xC0, 0xFE, 0xE0, 0x02, 0xF0, 0xF8, 0xFE, 0xF7, 0xFF, 0x01, 0x3F, 0x07, 0xFE, 0x00, 0x00, 0x18, 0xFE, 0x3F, 0xFC, 0x7F, 0xF5, 0xFF, 0xFD, 0x7F, 0xFE, 0x3F, 0x05, 0x1F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0xFC, 0x00, // 53
+			0xF7, 0x00, 0x08, 0x80, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFD, 0xFC, 0xFC, 0xFE, 0xFB, 0xFF, 0x00, 0xFC, 0xF8, 0x00, 0x04, 0xC0, 0xE0, 0xF0, 0xFC, 0xFE, 0xF9, 0xFF, 0x04, 0x7F, 0x7F, 0x3F, 0x1F, 0x1F, 0xFE, 0x0F, 0xFD, 0x07, 0xFB, 0x03, 0xFB, 0x00, 0x01, 0xE0, 0xFC, 0xF6, 0xFF, 0x01, 0xE7, 0xE3, 0xF7, 0xF0, 0xFE, 0xE0, 0x03, 0xC0, 0xC0, 0x80, 0x80, 0xFA, 0x00, 0x00, 0xFC, 0xF6, 0xFF, 0x01, 0x7F, 0x7F, 0xF9, 0x3F, 0x01, 0x7F, 0x7F, 0xF7, 0xFF, 0x06, 0xFE, 0xFC, 0xF8, 0xE0, 0x00, 0x00, 0x7F, 0xF6, 0xFF, 0x00, 0x80, 0xF5, 0x00, 0x01, 0x01, 0x03, 0xF6, 0xFF, 0x04, 0xFE, 0x00, 0x00, 0x07, 0x3F, 0xF7, 0xFF, 0x03, 0xFC, 0xF0, 0xE0, 0xE0, 0xFB, 0xC0, 0x03, 0xE0, 0xF0, 0xF8, 0xFE, 0xF8, 0xFF, 0x02, 0x7F, 0x1F, 0x03, 0xFC, 0x00, 0x04, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0xFE, 0x3F, 0xFE, 0x7F, 0xF7, 0xFF, 0xFE, 0x7F, 0x06, 0x3F, 0x3F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0xFC, 0x00, // 54
+			0xDA, 0xFF, 0x00, 0x00, 0xEC, 0x03, 0x02, 0x83, 0xE3, 0xF3, 0xF7, 0xFF, 0x04, 0x7F, 0x3F, 0x1F, 0x07, 0x03, 0xEF, 0x00, 0x03, 0xC0, 0xF0, 0xFC, 0xFE, 0xF8, 0xFF, 0x03, 0x3F, 0x0F, 0x07, 0x01, 0xED, 0x00, 0x02, 0xE0, 0xF8, 0xFE, 0xF8, 0xFF, 0x02, 0x3F, 0x0F, 0x03, 0xEB, 0x00, 0x01, 0xC0, 0xF8, 0xF7, 0xFF, 0x02, 0x7F, 0x0F, 0x01, 0xEA, 0x00, 0x01, 0xC0, 0xFC, 0xF7, 0xFF, 0x01, 0x3F, 0x03, 0xE8, 0x00, 0x00, 0xF8, 0xF6, 0xFF, 0x00, 0x07, 0xEE, 0x00, // 55
+			0xFD, 0x00, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFD, 0xFE, 0xF7, 0xFF, 0xFE, 0xFE, 0x07, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0xFC, 0x00, 0x01, 0xF0, 0xFC, 0xF7, 0xFF, 0x03, 0x3F, 0x0F, 0x07, 0x07, 0xFC, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x3F, 0xF7, 0xFF, 0x01, 0xFE, 0xF8, 0xFE, 0x00, 0x02, 0x07, 0x3F, 0x7F, 0xF8, 0xFF, 0x05, 0xFE, 0xF8, 0xF0, 0xE0, 0xC0, 0xC0, 0xFE, 0x80, 0x03, 0xC0, 0xE0, 0xF0, 0xFC, 0xF9, 0xFF, 0x03, 0x7F, 0x3F, 0x0F, 0x03, 0xFC, 0x00, 0x04, 0x80, 0xC1, 0xE3, 0xE7, 0xF7, 0xEA, 0xFF, 0x05, 0xFB, 0xF1, 0xF0, 0xE0, 0xC0, 0x80, 0xFE, 0x00, 0x02, 0xE0, 0xFC, 0xFE, 0xF8, 0xFF, 0x03, 0x1F, 0x07, 0x03, 0x01, 0xFD, 0x00, 0x06, 0x01, 0x01, 0x03, 0x03, 0x07, 0x0F, 0x3F, 0xF7, 0xFF, 0x04, 0xFE, 0xF0, 0x00, 0x0F, 0x7F, 0xF7, 0xFF, 0x03, 0xFC, 0xF0, 0xE0, 0xE0, 0xFA, 0xC0, 0x03, 0xE0, 0xE0, 0xF0, 0xFC, 0xF7, 0xFF, 0x01, 0x7F, 0x0F, 0xFE, 0x00, 0x07, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0xFD, 0x7F, 0xF6, 0xFF, 0xFD, 0x7F, 0x07, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0xFE, 0x00, // 56
+			0xFD, 0x00, 0x06, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xF7, 0xFF, 0xFD, 0xFE, 0x07, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0xFD, 0x00, 0x02, 0xC0, 0xF8, 0xFE, 0xF8, 0xFF, 0x04, 0x7F, 0x1F, 0x0F, 0x07, 0x07, 0xFC, 0x03, 0x04, 0x07, 0x07, 0x0F, 0x1F, 0x7F, 0xF8, 0xFF, 0x03, 0xFE, 0xF8, 0xE0, 0x00, 0xF5, 0xFF, 0x01, 0xC0, 0x80, 0xF4, 0x00, 0x00, 0x03, 0xF6, 0xFF, 0x05, 0xFC, 0x00, 0x07, 0x1F, 0x3F, 0x7F, 0xF7, 0xFF, 0x01, 0xFE, 0xFE, 0xF8, 0xFC, 0x01, 0xFE, 0xFE, 0xF6, 0xFF, 0x00, 0x7F, 0xFB, 0x00, 0x03, 0x01, 0x01, 0x03, 0x03, 0xFD, 0x07, 0xF7, 0x0F, 0x02, 0x87, 0xC7, 0xF7, 0xF7, 0xFF, 0x01, 0x7F, 0x0F, 0xFC, 0x00, 0x00, 0x40, 0xFA, 0xC0, 0xFC, 0xE0, 0x05, 0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFE, 0xF8, 0xFF, 0x04, 0x7F, 0x3F, 0x1F, 0x07, 0x01, 0xF9, 0x00, 0xF9, 0xFF, 0xFC, 0x7F, 0xFD, 0x3F, 0x08, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x01, 0xF8, 0x00, // 57
+			
+			// glyph offsets
+			// for each character the position of its font data within
+			// this array (low byte, high byte)
+			0x14, 0x00, // 48
+			0x9A, 0x00, // 49
+			0xD8, 0x00, // 50
+			0x51, 0x01, // 51
+			0xD5, 0x01, // 52
+			0x2A, 0x02, // 53
+			0x8A, 0x02, // 54
+			0x1E, 0x03, // 55
+			0x69, 0x03, // 56
+			0x16, 0x04, // 57
+		};
+
 	}
 }
 
@@ -47,11 +47,20 @@ namespace xpcc
 		 * - first char      : 48
 		 * - last char       : 58
 		 * - number of chars : 10
-		 * - size in bytes   : 2818
+		 * - size in bytes   : 2820
 		 * 
 		 * \ingroup	font
 		 */
 		EXTERN_FLASH_STORAGE(uint8_t Numbers40x57[]);
+		
+		/**
+		 * \brief	Numbers 40x57, compressed
+		 * 
+		 * Same font with PackBits compressed font data, 1215 bytes.
+		 * 
+		 * \ingroup	font
+		 */
+		EXTERN_FLASH_STORAGE(uint8_t Numbers40x57Rle[]);
 	}
 }
 
@@ -37,13 +37,15 @@ namespace xpcc
 	{
 		FLASH_STORAGE(uint8_t Numbers46x64[]) =
 		{
-			0x72, 0x0E, // total size of this array
-			46,	// width (may vary)
+			0x74, 0x0E, // total size of this array
+			0,	// extended header, flags and width follow the char count
 			64,	// height
 			4,	// hspace
 			4, 	// vspace
 			48,	// first char
 			10,	// char count
+			0,	// flags: none
+			46,	// width (may vary)
 			
 			// char widths
 			// for each character the separate width in pixels
@@ -62,6 +64,51 @@ namespace xpcc
 			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x1F, 0x1F, 0x0F, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x1F, 0x0F, 0x0F, 0x1F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0x80, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0x1F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, // 56
 			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x1F, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x1F, 0x1F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xE0, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xF0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0xC0, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x1F, 0x0F, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x3F, 0x3F, 0x1F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 57
 		};
+
+		FLASH_STORAGE(uint8_t Numbers46x64Rle[]) =
+		{
+			0x65, 0x05, // total size of this array
+			0,	// extended header, flags and width follow the char count
+			64,	// height
+			4,	// hspace
+			4, 	// vspace
+			48,	// first char
+			10,	// char count
+			0x80 | 0x40,	// flags: glyph offset table | compressed data
+			46,	// width (may vary)
+			
+			// char widths
+			// for each character the separate width in pixels
+			46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 
+			
+			// font data
+			// PackBits compressed bit field of every character
+			0xFA, 0x00, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xF7, 0xFF, 0xFD, 0xFE, 0x06, 0xFC, 0xFC, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0xF8, 0x00, 0x03, 0x80, 0xE0, 0xF8, 0xFE, 0xF7, 0xFF, 0x03, 0x3F, 0x1F, 0x0F, 0x0F, 0xFB, 0x07, 0x03, 0x0F, 0x0F, 0x1F, 0x3F, 0xF7, 0xFF, 0x03, 0xFE, 0xF8, 0xE0, 0x80, 0xFE, 0x00, 0x00, 0xF8, 0xF6, 0xFF, 0x01, 0x7F, 0x07, 0xF1, 0x00, 0x01, 0x07, 0x7F, 0xF6, 0xFF, 0x01, 0xFC, 0x00, 0xF4, 0xFF, 0xED, 0x00, 0xE7, 0xFF, 0xED, 0x00, 0xF4, 0xFF, 0x01, 0x00, 0x3F, 0xF6, 0xFF, 0x01, 0xFE, 0xC0, 0xF1, 0x00, 0x01, 0xE0, 0xFE, 0xF6, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0x03, 0x01, 0x0F, 0x1F, 0x7F, 0xF7, 0xFF, 0x03, 0xFC, 0xF8, 0xF0, 0xF0, 0xFB, 0xE0, 0x03, 0xF0, 0xF0, 0xF8, 0xFC, 0xF7, 0xFF, 0x03, 0x7F, 0x1F, 0x07, 0x01, 0xF8, 0x00, 0x06, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x3F, 0x3F, 0xFD, 0x7F, 0xF7, 0xFF, 0xFD, 0x7F, 0x06, 0x3F, 0x3F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0xFA, 0x00, // 48
+			0xEE, 0x00, 0x09, 0x80, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFE, 0xF8, 0xFF, 0xF1, 0x00, 0x02, 0x60, 0xF0, 0xF0, 0xFE, 0xF8, 0x02, 0xFC, 0xFC, 0xFE, 0xEC, 0xFF, 0xF0, 0x00, 0x03, 0x01, 0x07, 0x3F, 0x7F, 0xFE, 0x3F, 0x01, 0x1F, 0x1F, 0xFE, 0x0F, 0x03, 0x07, 0x07, 0x03, 0x01, 0xF4, 0xFF, 0xE0, 0x00, 0xF4, 0xFF, 0xE0, 0x00, 0xF4, 0xFF, 0xE0, 0x00, 0xF4, 0xFF, 0xE0, 0x00, 0xF4, 0xFF, 0xE0, 0x00, 0xF4, 0xFF, 0xF9, 0x00, // 49
+			0x0B, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFD, 0xFE, 0xF6, 0xFF, 0xFD, 0xFE, 0xFE, 0xFC, 0x04, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0xF9, 0x00, 0x04, 0x01, 0x03, 0x0F, 0x1F, 0x3F, 0xFD, 0xFF, 0x06, 0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0xFA, 0x07, 0xFE, 0x0F, 0x01, 0x1F, 0x7F, 0xF6, 0xFF, 0x01, 0xFC, 0xE0, 0xF6, 0x00, 0x01, 0x01, 0x01, 0xEE, 0x00, 0x00, 0xC0, 0xF5, 0xFF, 0x00, 0x7F, 0xE8, 0x00, 0x05, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFE, 0xF7, 0xFF, 0x03, 0x7F, 0x3F, 0x0F, 0x03, 0xEF, 0x00, 0x06, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0xF7, 0xFF, 0x06, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0xF2, 0x00, 0x05, 0x80, 0xC0, 0xF0, 0xF8, 0xFC, 0xFE, 0xF6, 0xFF, 0x05, 0x7F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0xED, 0x00, 0x02, 0xC0, 0xF8, 0xFE, 0xF4, 0xFF, 0x02, 0xEF, 0xE3, 0xE1, 0xEB, 0xE0, 0xFC, 0x00, 0xD8, 0xFF, 0x01, 0x00, 0x00, // 50
+			0x07, 0x00, 0x00, 0x60, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFE, 0xFC, 0xFD, 0xFE, 0xF6, 0xFF, 0xFD, 0xFE, 0x07, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0x80, 0xF6, 0x00, 0x08, 0x01, 0x07, 0x1F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0xFE, 0x0F, 0xF9, 0x07, 0x04, 0x0F, 0x0F, 0x1F, 0x3F, 0x7F, 0xF6, 0xFF, 0x01, 0xFC, 0xE0, 0xE3, 0x00, 0x02, 0x80, 0xC0, 0xF0, 0xF6, 0xFF, 0x01, 0x7F, 0x1F, 0xF0, 0x00, 0xF7, 0xFE, 0xF6, 0xFF, 0x05, 0xDF, 0xDF, 0x8F, 0x87, 0x03, 0x01, 0xEE, 0x00, 0xF6, 0x0F, 0xFE, 0x1F, 0x02, 0x3F, 0x3F, 0x7F, 0xF8, 0xFF, 0x04, 0xFE, 0xFE, 0xF8, 0xF0, 0xC0, 0xE0, 0x00, 0x00, 0x83, 0xF4, 0xFF, 0xFD, 0x00, 0x02, 0x80, 0xF8, 0xFC, 0xFE, 0xF8, 0xFD, 0xF0, 0xF5, 0xE0, 0xFE, 0xF0, 0x02, 0xF8, 0xFC, 0xFE, 0xF6, 0xFF, 0x02, 0x3F, 0x0F, 0x01, 0xFE, 0x00, 0x01, 0x18, 0x1F, 0xFD, 0x3F, 0xFB, 0x7F, 0xF4, 0xFF, 0xFD, 0x7F, 0xFE, 0x3F, 0x06, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x01, 0xFB, 0x00, // 51
+			0xEC, 0x00, 0x05, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0xF5, 0xFF, 0xEC, 0x00, 0x05, 0x80, 0xC0, 0xE0, 0xF8, 0xFC, 0xFE, 0xEE, 0xFF, 0xF1, 0x00, 0x04, 0x80, 0xE0, 0xF0, 0xFC, 0xFE, 0xF9, 0xFF, 0x03, 0x3F, 0x1F, 0x07, 0x03, 0xF4, 0xFF, 0xF6, 0x00, 0x03, 0x80, 0xE0, 0xF8, 0xFC, 0xF9, 0xFF, 0x04, 0x7F, 0x1F, 0x0F, 0x03, 0x01, 0xFC, 0x00, 0xF4, 0xFF, 0xFA, 0x00, 0x02, 0xC0, 0xF0, 0xFC, 0xF7, 0xFF, 0x02, 0xDF, 0xC7, 0xC1, 0xF7, 0xC0, 0xF4, 0xFF, 0xFA, 0xC0, 0xD3, 0xFF, 0xE7, 0x01, 0xF4, 0xFF, 0xFA, 0x01, 0xE7, 0x00, 0xF4, 0xFF, 0xFA, 0x00, // 52
+			0xF9, 0x00, 0xDF, 0xFF, 0xF6, 0x00, 0xF5, 0xFF, 0xEA, 0x07, 0xF7, 0x00, 0x00, 0xE0, 0xF6, 0xFF, 0x00, 0x0F, 0xE1, 0x00, 0x00, 0x80, 0xF0, 0xFF, 0xFC, 0xFE, 0xFE, 0xFC, 0xFE, 0xF8, 0x04, 0xF0, 0xE0, 0xE0, 0xC0, 0x80, 0xF5, 0x00, 0xF6, 0x07, 0xFB, 0x0F, 0xFE, 0x1F, 0x03, 0x3F, 0x3F, 0x7F, 0x7F, 0xF6, 0xFF, 0x02, 0xFE, 0xFC, 0xF0, 0xE0, 0x00, 0x00, 0x03, 0xF4, 0xFF, 0xFD, 0x00, 0x01, 0xC0, 0xFC, 0xFE, 0xF8, 0xFC, 0xF0, 0xF5, 0xE0, 0xFE, 0xF0, 0x02, 0xF8, 0xFC, 0xFE, 0xF7, 0xFF, 0x03, 0x7F, 0x3F, 0x0F, 0x01, 0xFE, 0x00, 0x01, 0x18, 0x1F, 0xFD, 0x3F, 0xFC, 0x7F, 0xF3, 0xFF, 0xFD, 0x7F, 0xFE, 0x3F, 0x06, 0x1F, 0x1F, 0x0F, 0x07, 0x07, 0x03, 0x01, 0xFB, 0x00, // 53
+			0xF2, 0x00, 0x05, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xFE, 0xF0, 0xFE, 0xF8, 0xFB, 0xFC, 0xFA, 0xFE, 0x00, 0xE0, 0xF6, 0x00, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFE, 0xF7, 0xFF, 0x01, 0x7F, 0x7F, 0xFE, 0x3F, 0xFC, 0x1F, 0xFA, 0x0F, 0xFA, 0x00, 0x03, 0x80, 0xE0, 0xF8, 0xFE, 0xF7, 0xFF, 0x05, 0x3F, 0x1F, 0x07, 0x07, 0x03, 0x01, 0xE9, 0x00, 0x01, 0x80, 0xFC, 0xF4, 0xFF, 0xFE, 0xFE, 0xF5, 0xFF, 0xFD, 0xFE, 0x07, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xC0, 0xFD, 0x00, 0xF4, 0xFF, 0xFE, 0x0F, 0xF6, 0x07, 0x04, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0xF6, 0xFF, 0x03, 0xFE, 0xF8, 0xC0, 0x0F, 0xF5, 0xFF, 0x00, 0xF0, 0xEF, 0x00, 0x00, 0x80, 0xF4, 0xFF, 0x04, 0x00, 0x01, 0x0F, 0x3F, 0x7F, 0xF7, 0xFF, 0x04, 0xFE, 0xF8, 0xF8, 0xF0, 0xF0, 0xFA, 0xE0, 0x04, 0xF0, 0xF0, 0xF8, 0xFC, 0xFE, 0xF7, 0xFF, 0x02, 0x7F, 0x1F, 0x07, 0xFB, 0x00, 0x05, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0xFE, 0x3F, 0xFE, 0x7F, 0xF5, 0xFF, 0xFD, 0x7F, 0x07, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0xFC, 0x00, // 54
+			0x00, 0x00, 0xD6, 0xFF, 0xFE, 0x00, 0xE9, 0x07, 0x02, 0x87, 0xE7, 0xF7, 0xF5, 0xFF, 0x03, 0x3F, 0x1F, 0x07, 0x03, 0xEA, 0x00, 0x02, 0xC0, 0xF0, 0xFC, 0xF6, 0xFF, 0x03, 0x3F, 0x0F, 0x07, 0x01, 0xE9, 0x00, 0x02, 0x80, 0xE0, 0xFC, 0xF6, 0xFF, 0x02, 0x3F, 0x0F, 0x03, 0xE6, 0x00, 0x01, 0xE0, 0xFC, 0xF6, 0xFF, 0x01, 0x3F, 0x07, 0xE5, 0x00, 0x01, 0x80, 0xF8, 0xF6, 0xFF, 0x01, 0x7F, 0x0F, 0xE3, 0x00, 0x00, 0xF8, 0xF5, 0xFF, 0x00, 0x07, 0xE2, 0x00, 0x00, 0xFC, 0xF5, 0xFF, 0x00, 0x03, 0xEB, 0x00, // 55
+			0xFB, 0x00, 0x07, 0xC0, 0xE0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFD, 0xFE, 0xF7, 0xFF, 0xFD, 0xFE, 0x07, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0xF9, 0x00, 0x02, 0xC0, 0xF8, 0xFE, 0xF7, 0xFF, 0x04, 0x7F, 0x3F, 0x1F, 0x0F, 0x0F, 0xFC, 0x07, 0x04, 0x0F, 0x0F, 0x1F, 0x3F, 0x7F, 0xF6, 0xFF, 0x01, 0xFC, 0xE0, 0xFC, 0x00, 0x00, 0x3F, 0xF5, 0xFF, 0x02, 0xF0, 0xC0, 0x80, 0xF7, 0x00, 0x01, 0x80, 0xE0, 0xF6, 0xFF, 0x01, 0x7F, 0x1F, 0xFB, 0x00, 0x05, 0x01, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xF7, 0xFF, 0x07, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xFC, 0xFE, 0xF9, 0xFF, 0x05, 0xBF, 0x1F, 0x1F, 0x0F, 0x03, 0x01, 0xFA, 0x00, 0x06, 0x80, 0xC0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFE, 0xFA, 0xFF, 0x04, 0x7F, 0x3F, 0x1F, 0x0F, 0x0F, 0xFE, 0x1F, 0x03, 0x3F, 0x3F, 0x7F, 0x7F, 0xF7, 0xFF, 0x05, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0x80, 0xFE, 0x00, 0x00, 0xFC, 0xF5, 0xFF, 0x01, 0x07, 0x01, 0xF4, 0x00, 0x02, 0x01, 0x03, 0x07, 0xF5, 0xFF, 0x05, 0xFC, 0x00, 0x00, 0x07, 0x1F, 0x7F, 0xF6, 0xFF, 0x03, 0xFC, 0xF8, 0xF0, 0xF0, 0xF9, 0xE0, 0x03, 0xF0, 0xF0, 0xF8, 0xFC, 0xF6, 0xFF, 0x02, 0x7F, 0x1F, 0x03, 0xFC, 0x00, 0x08, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0xFD, 0x7F, 0xF5, 0xFF, 0xFD, 0x7F, 0x08, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x01, 0xFD, 0x00, // 56
+			0xFB, 0x00, 0x07, 0xC0, 0xE0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xF6, 0xFF, 0xFE, 0xFE, 0xFE, 0xFC, 0x05, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0xF9, 0x00, 0x02, 0xE0, 0xF8, 0xFE, 0xF7, 0xFF, 0x03, 0x7F, 0x1F, 0x1F, 0x0F, 0xFA, 0x07, 0x03, 0x0F, 0x1F, 0x1F, 0x7F, 0xF7, 0xFF, 0x03, 0xFE, 0xF8, 0xE0, 0x80, 0xFE, 0x00, 0xF4, 0xFF, 0x00, 0x01, 0xF2, 0x00, 0x01, 0x01, 0x0F, 0xF5, 0xFF, 0x04, 0xF0, 0x00, 0x00, 0x07, 0x3F, 0xF6, 0xFF, 0x02, 0xFE, 0xF8, 0xF0, 0xFE, 0xE0, 0xF8, 0xC0, 0xFE, 0xE0, 0xF4, 0xFF, 0xFC, 0x00, 0x07, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0xEF, 0xFF, 0x00, 0x7F, 0xF4, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xF7, 0x01, 0x03, 0x81, 0xC0, 0xF0, 0xF8, 0xF6, 0xFF, 0x02, 0x7F, 0x0F, 0x01, 0xFA, 0x00, 0x00, 0x60, 0xFA, 0xE0, 0xFC, 0xF0, 0xFE, 0xF8, 0x02, 0xFC, 0xFC, 0xFE, 0xF6, 0xFF, 0x05, 0x7F, 0x3F, 0x1F, 0x0F, 0x03, 0x01, 0xF6, 0x00, 0xF9, 0xFF, 0xFB, 0x7F, 0xFD, 0x3F, 0xFE, 0x1F, 0x06, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x01, 0x01, 0xF5, 0x00, // 57
+			
+			// glyph offsets
+			// for each character the position of its font data within
+			// this array (low byte, high byte)
+			0x14, 0x00, // 48
+			0xAD, 0x00, // 49
+			0xF5, 0x00, // 50
+			0x86, 0x01, // 51
+			0x1C, 0x02, // 52
+			0x76, 0x02, // 53
+			0xE4, 0x02, // 54
+			0x8A, 0x03, // 55
+			0xDC, 0x03, // 56
+			0xAE, 0x04, // 57
+		};
+
 	}
 }
 
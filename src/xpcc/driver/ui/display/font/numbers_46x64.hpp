@@ -47,11 +47,20 @@ namespace xpcc
 		 * - first char      : 48
 		 * - last char       : 58
 		 * - number of chars : 10
-		 * - size in bytes   : 3698
+		 * - size in bytes   : 3700
 		 * 
 		 * \ingroup	font
 		 */
 		EXTERN_FLASH_STORAGE(uint8_t Numbers46x64[]);
+		
+		/**
+		 * \brief	Numbers 46x64, compressed
+		 * 
+		 * Same font with PackBits compressed font data, 1381 bytes.
+		 * 
+		 * \ingroup	font
+		 */
+		EXTERN_FLASH_STORAGE(uint8_t Numbers46x64Rle[]);
 	}
 }
 
@@ -37,13 +37,15 @@ namespace xpcc
 	{
 		FLASH_STORAGE(uint8_t ScriptoNarrow[]) =
 		{
-			0x7E, 0x01, // total size of this array
-			3,	// width (may vary)
+			0x3E, 0x02, // total size of this array
+			0,	// extended header, flags and width follow the char count
 			7,	// height
 			0,	// hspace
 			1, 	// vspace
 			32,	// first char
 			95,	// char count
+			0x80,	// flags: glyph offset table
+			3,	// width (may vary)
 			
 			// char widths
 			// for each character the separate width in pixels
@@ -155,7 +157,107 @@ namespace xpcc
 			0x33, // 124
 			0x41, 0x36, 0x08, // 125
 			0x08, 0x04, 0x0C, 0x08, 0x04, // 126
+			
+			// glyph offsets
+			// for each character the position of its font data within
+			// this array (low byte, high byte)
+			0x69, 0x00, // 32
+			0x6C, 0x00, // 33
+			0x6D, 0x00, // 34
+			0x70, 0x00, // 35
+			0x75, 0x00, // 36
+			0x7A, 0x00, // 37
+			0x80, 0x00, // 38
+			0x84, 0x00, // 39
+			0x85, 0x00, // 40
+			0x87, 0x00, // 41
+			0x89, 0x00, // 42
+			0x8D, 0x00, // 43
+			0x90, 0x00, // 44
+			0x92, 0x00, // 45
+			0x95, 0x00, // 46
+			0x97, 0x00, // 47
+			0x99, 0x00, // 48
+			0x9C, 0x00, // 49
+			0x9E, 0x00, // 50
+			0xA1, 0x00, // 51
+			0xA4, 0x00, // 52
+			0xA7, 0x00, // 53
+			0xAA, 0x00, // 54
+			0xAD, 0x00, // 55
+			0xB0, 0x00, // 56
+			0xB3, 0x00, // 57
+			0xB6, 0x00, // 58
+			0xB7, 0x00, // 59
+			0xB9, 0x00, // 60
+			0xBC, 0x00, // 61
+			0xBF, 0x00, // 62
+			0xC2, 0x00, // 63
+			0xC6, 0x00, // 64
+			0xC9, 0x00, // 65
+			0xCC, 0x00, // 66
+			0xCF, 0x00, // 67
+			0xD2, 0x00, // 68
+			0xD5, 0x00, // 69
+			0xD8, 0x00, // 70
+			0xDB, 0x00, // 71
+			0xDE, 0x00, // 72
+			0xE1, 0x00, // 73
+			0xE2, 0x00, // 74
+			0xE5, 0x00, // 75
+			0xE8, 0x00, // 76
+			0xEB, 0x00, // 77
+			0xEF, 0x00, // 78
+			0xF2, 0x00, // 79
+			0xF5, 0x00, // 80
+			0xF8, 0x00, // 81
+			0xFB, 0x00, // 82
+			0xFE, 0x00, // 83
+			0x01, 0x01, // 84
+			0x04, 0x01, // 85
+			0x07, 0x01, // 86
+			0x0A, 0x01, // 87
+			0x0E, 0x01, // 88
+			0x12, 0x01, // 89
+			0x15, 0x01, // 90
+			0x18, 0x01, // 91
+			0x1A, 0x01, // 92
+			0x1C, 0x01, // 93
+			0x1E, 0x01, // 94
+			0x21, 0x01, // 95
+			0x24, 0x01, // 96
+			0x26, 0x01, // 97
+			0x29, 0x01, // 98
+			0x2C, 0x01, // 99
+			0x2F, 0x01, // 100
+			0x32, 0x01, // 101
+			0x35, 0x01, // 102
+			0x37, 0x01, // 103
+			0x3A, 0x01, // 104
+			0x3D, 0x01, // 105
+			0x3E, 0x01, // 106
+			0x40, 0x01, // 107
+			0x43, 0x01, // 108
+			0x44, 0x01, // 109
+			0x49, 0x01, // 110
+			0x4C, 0x01, // 111
+			0x4F, 0x01, // 112
+			0x52, 0x01, // 113
+			0x55, 0x01, // 114
+			0x58, 0x01, // 115
+			0x5C, 0x01, // 116
+			0x5F, 0x01, // 117
+			0x62, 0x01, // 118
+			0x65, 0x01, // 119
+			0x6A, 0x01, // 120
+			0x6D, 0x01, // 121
+			0x70, 0x01, // 122
+			0x74, 0x01, // 123
+			0x77, 0x01, // 124
+			0x78, 0x01, // 125
+			0x7B, 0x01, // 126
 		};
+
 	}
 }
 
@@ -47,7 +47,7 @@ namespace xpcc
 		 * - first char      : 32
 		 * - last char       : 127
 		 * - number of chars : 95
-		 * - size in bytes   : 382
+		 * - size in bytes   : 574
 		 * 
 		 * \ingroup	font
 		 */
@@ -335,6 +335,40 @@ namespace xpcc
 				uint16_t width, uint16_t height,
 				xpcc::accessor::Flash<uint8_t> data);
 		
+		/**
+		 * Draw a compressed image.
+		 * 
+		 * Same layout as for drawImage() but the image data is
+		 * compressed with PackBits, e.g. the \c *_rle images generated
+		 * by the bitmap builder. These are only generated for images
+		 * which get smaller.
+		 * 
+		 * \param upperLeft		Upper left corner
+		 * \param image			Compressed image data
+		 * 
+		 * \see	drawCompressedImageRaw()
+		 */
+		void
+		drawCompressedImage(glcd::Point upperLeft,
+				xpcc::accessor::Flash<uint8_t> image);
+		
+		/**
+		 * Draw a compressed image.
+		 * 
+		 * \p data is a PackBits stream of the image data as expected by
+		 * drawImageRaw(). A header byte n < 128 is followed by n + 1
+		 * literal bytes, a header byte n > 128 by one byte which is
+		 * repeated 257 - n times. 128 is ignored.
+		 * 
+		 * The data is decoded while drawing, no buffer is needed. Literal
+		 * bytes are passed on to drawImageRaw(), repeated bytes are drawn
+		 * as filled rectangles.
+		 */
+		void
+		drawCompressedImageRaw(glcd::Point upperLeft,
+				uint16_t width, uint16_t height,
+				xpcc::accessor::Flash<uint8_t> data);
+		
 		/**
 		 * Fill a rectangle.
 		 */
@@ -357,7 +391,9 @@ namespace xpcc
 		/**
 		 * Set a new font.
 		 * 
-		 * Default font is xpcc::font::FixedWidth5x8.
+		 * Default font is xpcc::font::FixedWidth5x8. The compressed
+		 * variants of the larger fonts (e.g. xpcc::font::Numbers14x32Rle)
+		 * are decoded while drawing.
 		 * 
 		 * \param	newFont	Active font
 		 * \see		xpcc::font
@@ -421,6 +457,22 @@ namespace xpcc
 		void
 		write(char c);
 		
+		/**
+		 * Write a string at the cursor position.
+		 * 
+		 * The font header is evaluated only once for the whole string,
+		 * but every glyph is still drawn with its own drawImageRaw() call.
+		 * Used when writing strings through the IOStream interface.
+		 */
+		void
+		drawString(const char* s);
+		
+		/**
+		 * Width of the longest line of \p s in the current font.
+		 */
+		uint16_t
+		getStringWidth(const char* s) const;
+		
 	protected:
 		/// helper method for drawCircle() and drawEllipse()
 		void
@@ -432,6 +484,18 @@ namespace xpcc
 		virtual void
 		drawVerticalLine(glcd::Point start, uint16_t length);
 		
+		/**
+		 * Fill a rectangle in the current foreground color.
+		 * 
+		 * The rectangle is already clipped to the display. The default
+		 * implementation draws one horizontal line per row, drivers
+		 * override it (together with drawHorizontalLine() and
+		 * drawVerticalLine()) with a version suited to their memory
+		 * layout.
+		 */
+		virtual void
+		fillRect(int16_t x, int16_t y, uint16_t width, uint16_t height);
+		
 		virtual void
 		setPixel(int16_t x, int16_t y) = 0;
 		
@@ -455,7 +519,9 @@ namespace xpcc
 			virtual void
 			write(char c);
 			
-			using IODevice::write;
+			/// Draw a complete string
+			virtual void
+			write(const char* s);
 			
 			// unused
 			virtual void
@@ -0,0 +1,147 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include "graphic_display.hpp"
+
+// ----------------------------------------------------------------------------
+void
+xpcc::GraphicDisplay::drawCompressedImage(glcd::Point upperLeft,
+		xpcc::accessor::Flash<uint8_t> image)
+{
+	uint8_t width = image[0];
+	uint8_t height = image[1];
+	
+	drawCompressedImageRaw(upperLeft, width, height,
+			xpcc::accessor::Flash<uint8_t>(image.getPointer() + 2));
+}
+
+void
+xpcc::GraphicDisplay::drawCompressedImageRaw(glcd::Point upperLeft,
+		uint16_t width, uint16_t height,
+		xpcc::accessor::Flash<uint8_t> data)
+{
+	if (width == 0) {
+		return;
+	}
+	
+	// Repeated bytes are drawn as rectangles, with the foreground color
+	// for the set and black for the cleared bits. With a black foreground
+	// color drawImageRaw() still sets the pixels, therefore the rectangles
+	// can't be used in that case.
+	const glcd::Color color = this->foregroundColor;
+	const bool useRectangles = !(color == glcd::Color::black());
+	
+	const uint16_t rows = (height + 7) / 8;
+	
+	uint16_t position = 0;
+	uint16_t column = 0;
+	uint16_t row = 0;
+	
+	uint8_t count = 0;		// remaining bytes of the current run
+	bool repeat = false;
+	uint8_t value = 0;
+	
+	while (row < rows)
+	{
+		if (count == 0)
+		{
+			const uint8_t header = data[position++];
+			if (header < 128) {
+				count = header + 1;
+				repeat = false;
+			}
+			else if (header > 128) {
+				count = 257 - header;
+				repeat = true;
+				value = data[position++];
+			}
+			continue;
+		}
+		
+		// a run may continue in the next page row
+		uint16_t length = width - column;
+		if (length > count) {
+			length = count;
+		}
+		
+		const int16_t x = upperLeft.getX() + column;
+		const int16_t y = upperLeft.getY() + row * 8;
+		const uint8_t rowHeight = (height - row * 8 > 8) ? 8 : (height - row * 8);
+		
+		if (!repeat)
+		{
+			this->drawImageRaw(glcd::Point(x, y), length, rowHeight,
+					xpcc::accessor::Flash<uint8_t>(data.getPointer() + position));
+			position += length;
+		}
+		else if (useRectangles)
+		{
+			// one rectangle for every block of equal bits
+			uint8_t start = 0;
+			for (uint8_t bit = 1; bit <= rowHeight; ++bit)
+			{
+				const bool set = value & (1 << start);
+				if (bit == rowHeight || set != bool(value & (1 << bit)))
+				{
+					this->setColor(set ? color : glcd::Color::black());
+					this->fillRectangle(x, y + start, length, bit - start);
+					start = bit;
+				}
+			}
+			
+			// drawImageRaw() might depend on the foreground color
+			this->setColor(color);
+		}
+		else
+		{
+			for (uint16_t i = 0; i < length; ++i)
+			{
+				uint8_t byte = value;
+				for (uint8_t j = 0; j < rowHeight; ++j)
+				{
+					if (byte & 0x01) {
+						this->setPixel(x + i, y + j);
+					}
+					else {
+						this->clearPixel(x + i, y + j);
+					}
+					byte >>= 1;
+				}
+			}
+		}
+		
+		count -= length;
+		column += length;
+		if (column == width) {
+			column = 0;
+			row++;
+		}
+	}
+}
@@ -35,16 +35,36 @@ void
 xpcc::GraphicDisplay::fillRectangle(glcd::Point upperLeft,
 		uint16_t width, uint16_t height)
 {
-	for (uint16_t i = upperLeft.getX();
-			(i < upperLeft.getX() + width) && (i < getWidth());
-			++i)
-	{
-		for (uint16_t k = upperLeft.getY();
-				(k < upperLeft.getY() + height) && (k < getHeight());
-				++k)
-		{
-			(this->*draw)(i, k);
-		}
+	int32_t x1 = upperLeft.getX();
+	int32_t y1 = upperLeft.getY();
+	int32_t x2 = x1 + width;
+	int32_t y2 = y1 + height;
+	
+	// clip to the display
+	if (x1 < 0) {
+		x1 = 0;
+	}
+	if (y1 < 0) {
+		y1 = 0;
+	}
+	if (x2 > getWidth()) {
+		x2 = getWidth();
+	}
+	if (y2 > getHeight()) {
+		y2 = getHeight();
+	}
+	
+	if (x1 < x2 && y1 < y2) {
+		this->fillRect(x1, y1, x2 - x1, y2 - y1);
+	}
+}
+
+void
+xpcc::GraphicDisplay::fillRect(int16_t x, int16_t y,
+		uint16_t width, uint16_t height)
+{
+	for (uint16_t i = 0; i < height; ++i) {
+		this->drawHorizontalLine(glcd::Point(x, y + i), width);
 	}
 }
 
@@ -30,6 +30,77 @@
 
 #include "graphic_display.hpp"
 
+// ----------------------------------------------------------------------------
+namespace
+{
+	// Layout of the font header
+	enum
+	{
+		FONT_SIZE = 0,		// 16-bit, total size of the font array
+		FONT_WIDTH = 2,		// 0 marks the extended header
+		FONT_HEIGHT = 3,
+		FONT_HSPACE = 4,
+		FONT_VSPACE = 5,
+		FONT_FIRST = 6,
+		FONT_COUNT = 7,
+		FONT_WIDTH_TABLE = 8,
+		
+		// extended header
+		FONT_FLAGS = 8,
+		FONT_EXTENDED_WIDTH = 9,
+		FONT_EXTENDED_WIDTH_TABLE = 10,
+	};
+	
+	// bits of FONT_FLAGS
+	const uint8_t glyphOffsetTable = 0x80;
+	const uint8_t compressedData = 0x40;
+	
+	// Fonts with the plain header always have a width > 0, have no
+	// flags and are not compressed.
+	inline bool
+	hasExtendedHeader(xpcc::accessor::Flash<uint8_t> font)
+	{
+		return (font[FONT_WIDTH] == 0);
+	}
+	
+	inline uint8_t
+	getFlags(xpcc::accessor::Flash<uint8_t> font)
+	{
+		return hasExtendedHeader(font) ? font[FONT_FLAGS] : 0;
+	}
+	
+	inline uint8_t
+	getWidthTable(xpcc::accessor::Flash<uint8_t> font)
+	{
+		return hasExtendedHeader(font) ? FONT_EXTENDED_WIDTH_TABLE : FONT_WIDTH_TABLE;
+	}
+	
+	// Position of the font data for the index-th character in the font
+	uint16_t
+	getGlyphOffset(xpcc::accessor::Flash<uint8_t> font, uint8_t flags,
+			uint8_t widthTable, uint8_t index)
+	{
+		const uint8_t count = font[FONT_COUNT];
+		if (flags & glyphOffsetTable)
+		{
+			// the table with two bytes per character forms the end
+			// of the font array
+			const uint16_t size = font[FONT_SIZE] | (font[FONT_SIZE + 1] << 8);
+			const uint16_t entry = size - 2 * (count - index);
+			return font[entry] | (font[entry + 1] << 8);
+		}
+		
+		// older fonts without the table => sum up the size of all
+		// preceding characters
+		const uint8_t usedRows = (font[FONT_HEIGHT] + 7) / 8;	// round up
+		uint16_t offset = widthTable + count;
+		for (uint8_t i = 0; i < index; i++) {
+			offset += font[widthTable + i] * usedRows;
+		}
+		return offset;
+	}
+}
+
 // ----------------------------------------------------------------------------
 uint8_t
 xpcc::GraphicDisplay::getFontHeight() const
@@ -37,64 +108,108 @@ xpcc::GraphicDisplay::getFontHeight() const
 	if (!this->font.isValid())
 		return 0;
 	
-	return font[3];
+	return font[FONT_HEIGHT];
 }
 
 // ----------------------------------------------------------------------------
 void
 xpcc::GraphicDisplay::write(char c)
+{
+	const char s[2] = { c, '\0' };
+	this->drawString(s);
+}
+
+void
+xpcc::GraphicDisplay::drawString(const char* s)
 {
 	if (!this->font.isValid())
 		return;
 	
-	const uint8_t character = static_cast<uint8_t>(c);
-	const uint8_t height = font[3];
-	const uint8_t hspace = font[4];
-	const uint8_t vspace = font[5];
+	const uint8_t height = font[FONT_HEIGHT];
+	const uint8_t hspace = font[FONT_HSPACE];
+	const uint8_t vspace = font[FONT_VSPACE];
+	const uint8_t first = font[FONT_FIRST];
+	const uint8_t count = font[FONT_COUNT];
 	
-	if (character == '\n') {
-		this->cursor.set(0, this->cursor.getY() + height + hspace);
-		return;
-	}
+	const uint8_t flags = getFlags(font);
+	const uint8_t widthTable = getWidthTable(font);
 	
-	const uint8_t first = font[6];
-	const uint8_t count = font[7];
+	// compressed fonts always contain the offset table
+	const bool compressed = (flags & compressedData);
 	
-	if (character >= (first + count) || character < first) {
-		// character is not contained in this font set
-		return;
-	}
-	
-	const uint8_t offsetWidthTable = 8;
-	
-	uint16_t offset = count + offsetWidthTable;
-	uint8_t position = character - first + offsetWidthTable;
-	const uint8_t usedRows = (height + 7) / 8;	// round up
-	for (uint8_t i = offsetWidthTable; i < position; i++)
+	char c;
+	while ((c = *s++))
 	{
-		offset += font[i] * usedRows;
+		const uint8_t character = static_cast<uint8_t>(c);
+		if (character == '\n') {
+			this->cursor.set(0, this->cursor.getY() + height + hspace);
+			continue;
+		}
+		
+		if (character >= (first + count) || character < first) {
+			// character is not contained in this font set
+			continue;
+		}
+		
+		const uint8_t index = character - first;
+		const uint8_t width = font[widthTable + index];
+		
+		const accessor::Flash<uint8_t> glyph = accessor::asFlash(font.getPointer() +
+				getGlyphOffset(font, flags, widthTable, index));
+		if (compressed) {
+			this->drawCompressedImageRaw(cursor, width, height, glyph);
+		}
+		else {
+			this->drawImageRaw(cursor, width, height, glyph);
+		}
+		
+		// all characters below 128 have whitespace afterwards (number given
+		// by vspace).
+		if (character < 128) {
+			cursor.setX(cursor.getX() + width + vspace);
+		}
+		else {
+			cursor.setX(cursor.getX() + width);
+		}
 	}
-	uint8_t width = font[position];
-	
-	this->drawImageRaw(cursor, width, height,
-			accessor::asFlash(font.getPointer() + offset));
+}
+
+uint16_t
+xpcc::GraphicDisplay::getStringWidth(const char* s) const
+{
+	if (!this->font.isValid())
+		return 0;
 	
-	cursor.setX(cursor.getX() + width);
+	const uint8_t vspace = font[FONT_VSPACE];
+	const uint8_t first = font[FONT_FIRST];
+	const uint8_t count = font[FONT_COUNT];
+	const uint8_t widthTable = getWidthTable(font);
 	
-	// all characters below 128 have whitespace afterwards (number given
-	// by vspace).
-	if (character < 128) {
-		//glcd::Color oldColor = this->color;
+	uint16_t width = 0;
+	uint16_t lineWidth = 0;
+	char c;
+	while ((c = *s++))
+	{
+		const uint8_t character = static_cast<uint8_t>(c);
+		if (character == '\n') {
+			lineWidth = 0;
+			continue;
+		}
 		
-		//this->setColor(glcd::Color::white());
-		for (uint_fast8_t i = 0; i < vspace; ++i) {
-			//this->drawVerticalLine(cursor, height);
-			cursor.setX(cursor.getX() + 1);
+		if (character >= (first + count) || character < first) {
+			continue;
 		}
 		
-		// restore color
-		//this->setColor(oldColor);
+		lineWidth += font[widthTable + character - first];
+		if (character < 128) {
+			lineWidth += vspace;
+		}
+		
+		if (lineWidth > width) {
+			width = lineWidth;
+		}
 	}
+	return width;
 }
 
 // ----------------------------------------------------------------------------
@@ -104,6 +219,12 @@ xpcc::GraphicDisplay::Writer::write(char c)
 	this->parent->write(c);
 }
 
+void
+xpcc::GraphicDisplay::Writer::write(const char* s)
+{
+	this->parent->drawString(s);
+}
+
 void
 xpcc::GraphicDisplay::Writer::flush()
 {
@@ -15,5 +15,43 @@ namespace bitmap
 		0xff, 0xff, 0x00, 0x00, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x00, 0x50, 0x50, 0x51, 0xdf, 0x51, 0x50, 0x50, 0x00, 0x07, 0x04, 0x04, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x3e, 0x7e, 0xfc, 0xf8, 0xf0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x80, 0x80, 0x40, 0x40, 0x20, 0x20, 0x10, 0x10, 0xa8, 0x08, 0x04, 0x44, 0x43, 0x04, 0xc4, 0x28, 0xc8, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80, 0xff, 0xff,
 		0x0f, 0x3f, 0x78, 0x68, 0xe8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xdc, 0xdf, 0xdc, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc3, 0xc7, 0xcf, 0xdf, 0xff, 0xff, 0xfc, 0xf8, 0xf1, 0xe3, 0xc7, 0xcf, 0xdf, 0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0xff, 0xc0, 0xc0, 0xc0, 0xc1, 0xc1, 0xc2, 0xc2, 0xc4, 0xc4, 0xc9, 0xca, 0xd0, 0xd1, 0xe1, 0xd0, 0xd1, 0xca, 0xc9, 0xc4, 0xc4, 0xc2, 0xc2, 0xc1, 0xc1, 0xe0, 0x60, 0x78, 0x3f, 0x0f,
 	};
+	
+	FLASH_STORAGE(uint8_t logo_rca_90x64_rle[]) =
+	{
+		90, 64,
+		0x04, 0xf0, 0xfc, 0x1e, 0x06, 0x07, 0xf9, 0x03, 0xfa, 0xfb, 0x03, 0x7b, 0x7b, 0xfb, 0xfb, 0xfe,
+		0xf3, 0x01, 0xe3, 0xc3, 0xf9, 0x03, 0x02, 0xe3, 0xf3, 0xf3, 0xfd, 0xfb, 0x01, 0x7b, 0x7b, 0xfd,
+		0xfb, 0x02, 0xf3, 0xf3, 0xe3, 0xf8, 0x03, 0x00, 0xc3, 0xf7, 0xfb, 0x00, 0xc3, 0xf6, 0x03, 0x06,
+		0x07, 0x06, 0x1e, 0xfc, 0xf0, 0xff, 0xff, 0xf6, 0x00, 0xfa, 0xff, 0x01, 0xc0, 0xc0, 0xfc, 0xff,
+		0x01, 0x7f, 0x3f, 0xf9, 0x00, 0xfa, 0xff, 0x01, 0x00, 0x00, 0xfa, 0x3f, 0xf9, 0x00, 0x00, 0xfc,
+		0xfc, 0xff, 0x01, 0x1f, 0x1f, 0xfc, 0xff, 0x00, 0xfc, 0xf4, 0x00, 0xfd, 0xff, 0xf6, 0x00, 0xfa,
+		0xff, 0x01, 0x03, 0x03, 0xfb, 0xff, 0x00, 0xfe, 0xf9, 0x00, 0xfa, 0xff, 0x01, 0xc0, 0xc0, 0xfa,
+		0xfe, 0xfa, 0x00, 0x00, 0xfe, 0xfb, 0xff, 0x01, 0x3c, 0x3c, 0xfb, 0xff, 0x00, 0xfe, 0xf5, 0x00,
+		0xfd, 0xff, 0xfe, 0x08, 0x09, 0xe8, 0x28, 0xc8, 0x08, 0x08, 0x88, 0x08, 0x08, 0xeb, 0x8b, 0xfe,
+		0x0b, 0x0a, 0x8b, 0x0b, 0x08, 0xe8, 0x8b, 0x0b, 0x0b, 0x8b, 0x0b, 0x0b, 0x8b, 0xfe, 0x08, 0x0b,
+		0x88, 0x88, 0x08, 0xe8, 0x08, 0x08, 0x89, 0x09, 0x8b, 0x0b, 0xeb, 0x8b, 0xfd, 0x0b, 0x03, 0xcb,
+		0x2b, 0xc9, 0x09, 0xfe, 0x88, 0x06, 0x08, 0x08, 0x88, 0x88, 0x08, 0xeb, 0x8b, 0xfe, 0x0b, 0x04,
+		0x8b, 0x0b, 0x08, 0x08, 0x8b, 0xfc, 0x0b, 0x00, 0x8b, 0xfe, 0x08, 0x02, 0xe8, 0x08, 0xe8, 0xfb,
+		0x08, 0xfd, 0xff, 0xfe, 0x20, 0x27, 0x2f, 0x21, 0x2e, 0x20, 0x27, 0x28, 0x27, 0x20, 0x2f, 0x28,
+		0x27, 0x20, 0x27, 0x28, 0x27, 0x20, 0x27, 0x28, 0x20, 0x27, 0x2a, 0x23, 0x20, 0x2f, 0xe1, 0x20,
+		0x27, 0x28, 0x28, 0x20, 0x27, 0x28, 0x20, 0x27, 0x28, 0x2f, 0x20, 0x2f, 0x28, 0x27, 0xfe, 0x20,
+		0x16, 0x2f, 0x21, 0x2f, 0x20, 0x2e, 0x2a, 0x2f, 0x20, 0x27, 0x28, 0x28, 0x20, 0xef, 0x20, 0x2f,
+		0xa0, 0xa7, 0xaa, 0xa1, 0xa0, 0xaf, 0xa0, 0xaf, 0xfe, 0xa0, 0x0d, 0xa7, 0xaa, 0xa1, 0xa8, 0xa0,
+		0xa7, 0xa8, 0xa7, 0xa0, 0xa8, 0xa0, 0xa0, 0x20, 0x20, 0xfd, 0xff, 0x02, 0x88, 0x88, 0xe8, 0xfc,
+		0x28, 0x00, 0xe8, 0xfe, 0x88, 0xfe, 0xc8, 0xfe, 0x88, 0x00, 0xff, 0xfe, 0x01, 0x01, 0x02, 0xfc,
+		0xfe, 0x20, 0x00, 0xff, 0xf7, 0x00, 0x07, 0x06, 0x0e, 0x1e, 0x3e, 0xfe, 0xfc, 0xf8, 0xf0, 0xf5,
+		0x00, 0x1b, 0xff, 0x00, 0x00, 0xff, 0x80, 0xa4, 0xaa, 0x92, 0x80, 0x82, 0xbe, 0x82, 0x80, 0xbc,
+		0x92, 0xbc, 0x80, 0xbe, 0x8a, 0xb4, 0x80, 0x82, 0xbe, 0x82, 0x80, 0xff, 0x00, 0x00, 0xfd, 0xff,
+		0x02, 0x00, 0x00, 0x03, 0xfc, 0x02, 0x0a, 0x03, 0x00, 0x50, 0x50, 0x51, 0xdf, 0x51, 0x50, 0x50,
+		0x00, 0x07, 0xfe, 0x04, 0x01, 0x02, 0x01, 0xfe, 0x00, 0x07, 0xff, 0x00, 0x00, 0x3e, 0x7e, 0xfc,
+		0xf8, 0xf0, 0xfb, 0xe0, 0x00, 0xf0, 0xfd, 0xff, 0x05, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0x80, 0xfb,
+		0x00, 0x18, 0xff, 0x00, 0x80, 0x80, 0x40, 0x40, 0x20, 0x20, 0x10, 0x10, 0xa8, 0x08, 0x04, 0x44,
+		0x43, 0x04, 0xc4, 0x28, 0xc8, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0xfe, 0x80, 0x06, 0xff, 0xff,
+		0x0f, 0x3f, 0x78, 0x68, 0xe8, 0xf8, 0xc8, 0x02, 0xdc, 0xdf, 0xdc, 0xf5, 0xc8, 0x00, 0xff, 0xfc,
+		0xc0, 0xfb, 0xc1, 0x13, 0xc3, 0xc7, 0xcf, 0xdf, 0xff, 0xff, 0xfc, 0xf8, 0xf1, 0xe3, 0xc7, 0xcf,
+		0xdf, 0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0xff, 0xfe, 0xc0, 0x19, 0xc1, 0xc1, 0xc2, 0xc2, 0xc4,
+		0xc4, 0xc9, 0xca, 0xd0, 0xd1, 0xe1, 0xd0, 0xd1, 0xca, 0xc9, 0xc4, 0xc4, 0xc2, 0xc2, 0xc1, 0xc1,
+		0xe0, 0x60, 0x78, 0x3f, 0x0f,
+	};
 }
 
@@ -15,6 +15,15 @@ namespace bitmap
 	 * - Height : 64
 	 */
 	EXTERN_FLASH_STORAGE(uint8_t logo_xpcc_90x64[]);
+	
+	/**
+	 * \brief	Generated bitmap, PackBits compressed
+	 * 
+	 * Draw with xpcc::GraphicDisplay::drawCompressedImage().
+	 * 
+	 * - Size   : 329 bytes (uncompressed 722 bytes)
+	 */
+	EXTERN_FLASH_STORAGE(uint8_t logo_xpcc_90x64_rle[]);
 }
 
 #endif // BITMAP__LOGO_XPCC_90X64_HPP
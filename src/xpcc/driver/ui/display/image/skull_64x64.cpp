@@ -15,5 +15,32 @@ namespace bitmap
 		0x00, 0x00, 0x00, 0x00, 0xe0, 0xb0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x10, 0x18, 0x08, 0x0c, 0x0c, 0x86, 0xc2, 0xc3, 0x6f, 0x7e, 0x70, 0xc1, 0x83, 0x82, 0x07, 0x04, 0x07, 0x08, 0x0f, 0x09, 0x0f, 0x09, 0x0f, 0x09, 0x05, 0x04, 0x05, 0x82, 0xc3, 0xe0, 0x70, 0x7f, 0x6f, 0xc6, 0xcc, 0x8c, 0x08, 0x18, 0x10, 0x30, 0x20, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xc0, 0x00, 0x00, 0x00,
 		0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x7e, 0x60, 0x40, 0x60, 0x30, 0x1c, 0x06, 0x02, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x02, 0x02, 0x02, 0x06, 0x06, 0x06, 0x02, 0x02, 0x02, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x02, 0x06, 0x1c, 0x30, 0x60, 0x40, 0x60, 0x3c, 0x06, 0x03, 0x01, 0x00, 0x00, 0x00,
 	};
+	
+	FLASH_STORAGE(uint8_t skull_64x64_rle[]) =
+	{
+		64, 64,
+		0xf3, 0x00, 0x0c, 0x80, 0xe0, 0x60, 0x30, 0x18, 0x08, 0x0c, 0x0c, 0x04, 0x06, 0x06, 0x02, 0x02,
+		0xf6, 0x03, 0x0c, 0x02, 0x02, 0x06, 0x06, 0x04, 0x0c, 0x0c, 0x18, 0x18, 0x30, 0x60, 0xc0, 0x80,
+		0xe9, 0x00, 0x04, 0xf0, 0x3e, 0x07, 0x01, 0xc0, 0xe0, 0x00, 0x04, 0xc0, 0x03, 0x0f, 0x7c, 0xf0,
+		0xec, 0x00, 0x05, 0x7f, 0xf0, 0x80, 0x03, 0x3f, 0xf0, 0xe2, 0x00, 0x05, 0xf0, 0x3f, 0x03, 0x80,
+		0xf0, 0x7f, 0xf4, 0x00, 0x04, 0xc0, 0xc0, 0x40, 0xc0, 0x80, 0xfd, 0x00, 0x08, 0x01, 0x07, 0x0e,
+		0xfc, 0x7f, 0x00, 0x00, 0x3e, 0xfe, 0xfb, 0xff, 0x01, 0x7f, 0x1f, 0xfa, 0x00, 0x01, 0x3f, 0x7f,
+		0xfb, 0xff, 0x08, 0xfe, 0x3c, 0x00, 0x00, 0x7f, 0xfc, 0x0e, 0x07, 0x01, 0xfe, 0x00, 0x04, 0x80,
+		0x80, 0xc0, 0x80, 0x80, 0xfe, 0x00, 0x03, 0xf0, 0xb8, 0x9e, 0x8f, 0xfe, 0x80, 0x12, 0x83, 0x07,
+		0x0c, 0x18, 0x18, 0x30, 0x30, 0x60, 0x6f, 0xfc, 0xf0, 0xe0, 0xc0, 0xc0, 0xc1, 0xc1, 0x83, 0x03,
+		0x01, 0xfe, 0x00, 0x06, 0xfc, 0xfe, 0xff, 0x00, 0xff, 0xfe, 0xf8, 0xfe, 0x00, 0x19, 0x01, 0x03,
+		0x83, 0x81, 0xc1, 0xc0, 0xe0, 0xe0, 0xf0, 0xfc, 0xcf, 0x40, 0x60, 0x30, 0x10, 0x1c, 0x0e, 0x03,
+		0x01, 0x00, 0x01, 0x1f, 0x30, 0x60, 0xc0, 0x00, 0xf9, 0x01, 0x2e, 0x03, 0x02, 0x06, 0x04, 0x0c,
+		0x0c, 0x18, 0x18, 0x30, 0x30, 0x63, 0xff, 0x31, 0x0d, 0xe3, 0x0f, 0x5c, 0xf0, 0x90, 0xf0, 0x11,
+		0xe1, 0x20, 0xe0, 0x10, 0xf1, 0x11, 0xf0, 0x90, 0x90, 0xdc, 0x0f, 0xf1, 0x0f, 0xf9, 0xff, 0xc7,
+		0x61, 0x61, 0x30, 0x30, 0x18, 0x18, 0x0c, 0x04, 0x06, 0x02, 0xfa, 0x03, 0x00, 0x01, 0xfd, 0x00,
+		0x01, 0xe0, 0xb0, 0xfb, 0x30, 0x28, 0x10, 0x18, 0x08, 0x0c, 0x0c, 0x86, 0xc2, 0xc3, 0x6f, 0x7e,
+		0x70, 0xc1, 0x83, 0x82, 0x07, 0x04, 0x07, 0x08, 0x0f, 0x09, 0x0f, 0x09, 0x0f, 0x09, 0x05, 0x04,
+		0x05, 0x82, 0xc3, 0xe0, 0x70, 0x7f, 0x6f, 0xc6, 0xcc, 0x8c, 0x08, 0x18, 0x10, 0x30, 0x20, 0xfa,
+		0x60, 0x00, 0xc0, 0xf9, 0x00, 0x0c, 0x01, 0x07, 0x7e, 0x60, 0x40, 0x60, 0x30, 0x1c, 0x06, 0x02,
+		0x03, 0x01, 0x01, 0xfb, 0x00, 0x03, 0x01, 0x01, 0x03, 0x03, 0xfe, 0x02, 0xfe, 0x06, 0xfe, 0x02,
+		0x03, 0x03, 0x03, 0x01, 0x01, 0xfb, 0x00, 0x0d, 0x01, 0x01, 0x03, 0x02, 0x06, 0x1c, 0x30, 0x60,
+		0x40, 0x60, 0x3c, 0x06, 0x03, 0x01, 0xfe, 0x00,
+	};
 }
 
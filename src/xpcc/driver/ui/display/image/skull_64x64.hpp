@@ -15,6 +15,15 @@ namespace bitmap
 	 * - Height : 64
 	 */
 	EXTERN_FLASH_STORAGE(uint8_t skull_64x64[]);
+	
+	/**
+	 * \brief	Generated bitmap, PackBits compressed
+	 * 
+	 * Draw with xpcc::GraphicDisplay::drawCompressedImage().
+	 * 
+	 * - Size   : 346 bytes (uncompressed 514 bytes)
+	 */
+	EXTERN_FLASH_STORAGE(uint8_t skull_64x64_rle[]);
 }
 
 #endif // BITMAP__SKULL_64X64_HPP
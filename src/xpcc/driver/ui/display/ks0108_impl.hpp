@@ -99,36 +99,48 @@ template < typename E, typename RW, typename RS,
 void
 xpcc::Ks0108<E, RW, RS, PIN_CS1, PIN_CS2, PORT>::update()
 {
-	this->selectLeftChip();
-	this->waitBusy();
-	this->writeCommand(KS0108_SET_Y_ADDRESS | 0);
-	
-	this->selectRightChip();
-	this->waitBusy();
-	this->writeCommand(KS0108_SET_Y_ADDRESS | 0);
-	
 	for (uint8_t page = 0; page < 8; ++page)
 	{
-		this->selectLeftChip();
-		this->waitBusy();
-		this->writeCommand(KS0108_SET_X_PAGE | page);
-		
-		this->selectRightChip();
-		this->waitBusy();
-		this->writeCommand(KS0108_SET_X_PAGE | page);
+		uint16_t start;
+		uint16_t end;
+		if (!this->getDirtyRange(page, start, end)) {
+			continue;
+		}
 		
-		uint8_t i;
-		for (i = 0; i < 64; ++i)
+		// columns 0..63 are handled by the left, 64..127 by the right chip
+		if (start < 64)
 		{
 			this->selectLeftChip();
 			this->waitBusy();
-			this->writeData(this->buffer[i][page]);
+			this->writeCommand(KS0108_SET_X_PAGE | page);
+			this->waitBusy();
+			this->writeCommand(KS0108_SET_Y_ADDRESS | start);
+			
+			for (uint8_t i = start; i < end && i < 64; ++i)
+			{
+				this->waitBusy();
+				this->writeData(this->buffer[i][page]);
+			}
+		}
+		
+		if (end > 64)
+		{
+			const uint8_t first = (start > 64) ? start : 64;
 			
 			this->selectRightChip();
 			this->waitBusy();
-			this->writeData(this->buffer[i + 64][page]);
+			this->writeCommand(KS0108_SET_X_PAGE | page);
+			this->waitBusy();
+			this->writeCommand(KS0108_SET_Y_ADDRESS | (first - 64));
+			
+			for (uint8_t i = first; i < end; ++i)
+			{
+				this->waitBusy();
+				this->writeData(this->buffer[i][page]);
+			}
 		}
 	}
+	this->markClean();
 }
 
 // ----------------------------------------------------------------------------
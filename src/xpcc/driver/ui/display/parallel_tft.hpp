@@ -102,9 +102,24 @@ namespace xpcc
 		virtual bool
 		getPixel(int16_t x, int16_t y);
 		
+		// Filled areas are streamed into a window of the display RAM
+		// instead of setting the cursor for every pixel
+		virtual void
+		drawHorizontalLine(glcd::Point start, uint16_t length);
+		
+		virtual void
+		drawVerticalLine(glcd::Point start, uint16_t length);
+		
+		virtual void
+		fillRect(int16_t x, int16_t y, uint16_t width, uint16_t height);
+		
 		void
 		writeCursor(uint16_t x, uint16_t y);
 		
+		/// Limit the RAM address increment to the given (inclusive) area
+		void
+		writeWindow(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+		
 		void
 		writeRegister(uint16_t reg, uint16_t value);
 		
@@ -183,6 +183,40 @@ xpcc::ParallelTft<INTERFACE>::getPixel(int16_t x, int16_t y)
 	return false;
 }
 
+// ----------------------------------------------------------------------------
+template <typename INTERFACE>
+void
+xpcc::ParallelTft<INTERFACE>::drawHorizontalLine(glcd::Point start, uint16_t length)
+{
+	this->fillRectangle(start, length, 1);
+}
+
+template <typename INTERFACE>
+void
+xpcc::ParallelTft<INTERFACE>::drawVerticalLine(glcd::Point start, uint16_t length)
+{
+	this->fillRectangle(start, 1, length);
+}
+
+template <typename INTERFACE>
+void
+xpcc::ParallelTft<INTERFACE>::fillRect(int16_t x, int16_t y,
+		uint16_t width, uint16_t height)
+{
+	writeWindow(x, y, x + width - 1, y + height - 1);
+	
+	// The address counter wraps around inside the window, therefore
+	// the pixels can be written in one go.
+	interface.writeIndex(0x0022);
+	const uint16_t color = foregroundColor.getValue();
+	for (uint32_t i = 0; i < static_cast<uint32_t>(width) * height; i++)
+	{
+		interface.writeData(color);
+	}
+	
+	writeWindow(0, 0, MAX_X - 1, MAX_Y - 1);
+}
+
 // ----------------------------------------------------------------------------
 template <typename INTERFACE>
 void
@@ -216,3 +250,45 @@ xpcc::ParallelTft<INTERFACE>::writeCursor(uint16_t x, uint16_t y)
 		break;
 	}
 }
+
+template <typename INTERFACE>
+void
+xpcc::ParallelTft<INTERFACE>::writeWindow(uint16_t x1, uint16_t y1,
+		uint16_t x2, uint16_t y2)
+{
+	// same transformation as in writeCursor()
+#if  ( DISP_ORIENTATION == 90 ) || ( DISP_ORIENTATION == 270 )
+
+	uint16_t startX = (MAX_Y - 1) - y2;
+	uint16_t endX   = (MAX_Y - 1) - y1;
+	uint16_t startY = x1;
+	uint16_t endY   = x2;
+
+#elif  ( DISP_ORIENTATION == 0 ) || ( DISP_ORIENTATION == 180 )
+
+	uint16_t startX = x1;
+	uint16_t endX   = x2;
+	uint16_t startY = (MAX_Y - 1) - y2;
+	uint16_t endY   = (MAX_Y - 1) - y1;
+
+#endif
+	
+	switch (deviceCode)
+	{
+	default:
+		interface.writeRegister(0x0050, startX);
+		interface.writeRegister(0x0051, endX);
+		interface.writeRegister(0x0052, startY);
+		interface.writeRegister(0x0053, endY);
+		break;
+		
+	case Device::SSD1298:
+	case Device::SSD1289:
+		interface.writeRegister(0x0044, (endX << 8) | startX);
+		interface.writeRegister(0x0045, startY);
+		interface.writeRegister(0x0046, endY);
+		break;
+	}
+	
+	writeCursor(x1, y1);
+}
@@ -64,9 +64,24 @@ namespace xpcc
 		setInvert(bool invert);
 		
 	protected:
+		/// Size of the RAM buffer in bytes
+		enum
+		{
+			COLUMNS = Width,
+			PAGES = Height / 8,
+		};
+		
 		ALWAYS_INLINE void
 		initialize(xpcc::accessor::Flash<uint8_t> configuration, uint8_t size);
 		
+		/**
+		 * Set the position for the following data bytes
+		 * 
+		 * Expects the chip select to be active, leaves A0 in data mode.
+		 */
+		void
+		writePageAddress(uint8_t page, uint8_t column);
+		
 		SPI spi;
 		CS cs;
 		A0 a0;
@@ -0,0 +1,146 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__ST7565_ASYNC_HPP
+#define XPCC__ST7565_ASYNC_HPP
+
+#include <xpcc/driver/connectivity/spi/spi_master.hpp>
+
+#include "st7565.hpp"
+
+namespace xpcc
+{
+	/**
+	 * \brief	Asynchronous update for ST7565 based displays
+	 * 
+	 * Adds a second buffer to a ST7565 driver. startUpdate() copies
+	 * the changed parts of the RAM buffer to the transmit buffer and
+	 * returns. The data is then sent page by page with
+	 * SpiMaster::transfer() while the next frame is drawn into the RAM
+	 * buffer. With a SPI master supporting DMA the CPU is only needed
+	 * to set the address of every page.
+	 * 
+	 * Example:
+	 * \code
+	 * xpcc::St7565Async< xpcc::DogM128<Spi, Cs, A0, Reset, true> > display;
+	 * 
+	 * display.initialize();
+	 * while (1)
+	 * {
+	 *     if (!display.run())
+	 *     {
+	 *         // previous frame sent => draw the next one
+	 *         display.clear();
+	 *         display.drawString("Hello");
+	 *         display.startUpdate();
+	 *     }
+	 *     
+	 *     // do something else
+	 * }
+	 * \endcode
+	 * 
+	 * The transmit buffer needs the same amount of RAM as the display
+	 * buffer (Width * Height / 8 bytes).
+	 * 
+	 * setInvert() must not be used while an update is running.
+	 * 
+	 * \tparam	Display		Driver derived from xpcc::St7565, e.g.
+	 * 						xpcc::DogM128. Its SPI master must support
+	 * 						setBuffer(), transfer() and isFinished().
+	 * 
+	 * \see		xpcc::pc::ThreadedSpiMaster
+	 * \ingroup	lcd
+	 */
+	template <typename Display>
+	class St7565Async : public Display
+	{
+	public:
+		St7565Async();
+		
+		/**
+		 * \brief	Update the display and wait until it is finished
+		 */
+		virtual void
+		update();
+		
+		/**
+		 * \brief	Start the transfer of the changed parts of the buffer
+		 * 
+		 * The RAM buffer can be changed as soon as this method returns.
+		 * 
+		 * \return	\c false if the previous update is still running,
+		 * 			nothing is done in this case.
+		 */
+		bool
+		startUpdate();
+		
+		/**
+		 * \brief	Continue a running update
+		 * 
+		 * Must be called regularly, starts the transfer of the next
+		 * page when the previous one is finished.
+		 * 
+		 * \return	\c true while the update is running
+		 */
+		bool
+		run();
+		
+	protected:
+		/**
+		 * \brief	Called from run() when an update is finished
+		 * 
+		 * Default implementation does nothing.
+		 */
+		virtual void
+		updateFinished();
+		
+	private:
+		enum State
+		{
+			IDLE,
+			START,
+			TRANSFER,
+		};
+		
+		State state;
+		uint8_t page;
+		
+		// page-wise, as sent to the display
+		uint8_t transmitBuffer[Display::PAGES][Display::COLUMNS];
+		
+		// columns to transmit per page, empty if start >= end
+		uint8_t transmitStart[Display::PAGES];
+		uint8_t transmitEnd[Display::PAGES];
+	};
+}
+
+#include "st7565_async_impl.hpp"
+
+#endif // XPCC__ST7565_ASYNC_HPP
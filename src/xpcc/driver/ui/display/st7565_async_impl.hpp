@@ -0,0 +1,134 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__ST7565_ASYNC_HPP
+	#error	"Don't include this file directly, use 'st7565_async.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename Display>
+xpcc::St7565Async<Display>::St7565Async() :
+	state(IDLE), page(0)
+{
+}
+
+template <typename Display>
+void
+xpcc::St7565Async<Display>::update()
+{
+	// finish the previous update first
+	while (this->run()) {
+	}
+	
+	this->startUpdate();
+	while (this->run()) {
+	}
+}
+
+template <typename Display>
+bool
+xpcc::St7565Async<Display>::startUpdate()
+{
+	if (state != IDLE) {
+		return false;
+	}
+	
+	for (uint8_t y = 0; y < Display::PAGES; ++y)
+	{
+		uint16_t start;
+		uint16_t end;
+		if (!this->getDirtyRange(y, start, end)) {
+			start = end = 0;
+		}
+		
+		// transpose the changed bytes, the RAM buffer is organized
+		// in columns
+		for (uint16_t x = start; x < end; ++x) {
+			this->transmitBuffer[y][x] = this->buffer[x][y];
+		}
+		this->transmitStart[y] = start;
+		this->transmitEnd[y] = end;
+	}
+	this->markClean();
+	
+	page = 0;
+	state = START;
+	return true;
+}
+
+template <typename Display>
+bool
+xpcc::St7565Async<Display>::run()
+{
+	switch (state)
+	{
+		case IDLE:
+			return false;
+		
+		case START:
+			this->cs.reset();
+			break;
+		
+		case TRANSFER:
+			if (!this->spi.isFinished()) {
+				return true;
+			}
+			page++;
+			break;
+	}
+	
+	// skip the unchanged pages
+	while (page < Display::PAGES && transmitStart[page] >= transmitEnd[page]) {
+		page++;
+	}
+	
+	if (page >= Display::PAGES)
+	{
+		this->cs.set();
+		state = IDLE;
+		this->updateFinished();
+		return false;
+	}
+	
+	const uint8_t start = transmitStart[page];
+	this->writePageAddress(page, start);
+	
+	this->spi.setBuffer(transmitEnd[page] - start, &transmitBuffer[page][start]);
+	this->spi.transfer(SpiMaster::TRANSFER_SEND_BUFFER_DISCARD_RECEIVE);
+	
+	state = TRANSFER;
+	return true;
+}
+
+template <typename Display>
+void
+xpcc::St7565Async<Display>::updateFinished()
+{
+}
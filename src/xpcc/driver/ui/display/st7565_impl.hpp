@@ -42,25 +42,39 @@ xpcc::St7565<SPI, CS, A0, Reset, Width, Height, TopView>::update()
 	cs.reset();
 	for(uint8_t y = 0; y < (Height / 8); ++y)
 	{
-		// command mode
-		a0.reset();
-		spi.write(ST7565_PAGE_ADDRESS | y);		// Row select
-		spi.write(ST7565_COL_ADDRESS_MSB);		// Column select high
-		
-		if (TopView) {
-			spi.write(ST7565_COL_ADDRESS_LSB | 4);	// Column select low
-		}
-		else {
-			spi.write(ST7565_COL_ADDRESS_LSB);	// Column select low
+		uint16_t start;
+		uint16_t end;
+		if (!this->getDirtyRange(y, start, end)) {
+			// nothing changed in this page
+			continue;
 		}
 		
-		// switch to data mode
-		a0.set();
-		for(uint8_t x = 0; x < Width; ++x) {
+		this->writePageAddress(y, start);
+		for(uint16_t x = start; x < end; ++x) {
 			spi.write(this->buffer[x][y]);
 		}
 	}
 	cs.set();
+	this->markClean();
+}
+
+template <typename SPI, typename CS, typename A0, typename Reset, unsigned int Width, unsigned int Height, bool TopView>
+void
+xpcc::St7565<SPI, CS, A0, Reset, Width, Height, TopView>::writePageAddress(
+		uint8_t page, uint8_t column)
+{
+	// the controller has 132 columns, in top view the first four
+	// are not connected
+	column += (TopView ? 4 : 0);
+	
+	// command mode
+	a0.reset();
+	spi.write(ST7565_PAGE_ADDRESS | page);					// Row select
+	spi.write(ST7565_COL_ADDRESS_MSB | (column >> 4));		// Column select high
+	spi.write(ST7565_COL_ADDRESS_LSB | (column & 0x0f));	// Column select low
+	
+	// switch to data mode
+	a0.set();
 }
 
 template <typename SPI, typename CS, typename A0, typename Reset, unsigned int Width, unsigned int Height, bool TopView>
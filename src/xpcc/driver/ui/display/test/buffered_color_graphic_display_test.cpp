@@ -0,0 +1,150 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include "../buffered_color_graphic_display.hpp"
+
+#include "buffered_color_graphic_display_test.hpp"
+
+namespace
+{
+	template <uint16_t Width, uint16_t Height>
+	class TestDisplay : public xpcc::BufferedColorGraphicDisplay<Width, Height>
+	{
+	public:
+		virtual void
+		update()
+		{
+		}
+		
+		uint16_t
+		countPixels(xpcc::glcd::Color color) const
+		{
+			uint16_t count = 0;
+			for (uint16_t i = 0; i < Width * Height; ++i) {
+				if (this->getBuffer()[i] == color.getValue()) {
+					count++;
+				}
+			}
+			return count;
+		}
+	};
+	
+	// 3x10 pixel
+	FLASH_STORAGE(uint8_t image[]) =
+	{
+		0x01, 0x02, 0xff,
+		0x00, 0x03, 0x02,
+	};
+}
+
+// ----------------------------------------------------------------------------
+void
+BufferedColorGraphicDisplayTest::testClear()
+{
+	TestDisplay<20, 10> display;
+	TEST_ASSERT_EQUALS(display.countPixels(xpcc::glcd::Color::black()), 200);
+	
+	display.setBackgroundColor(xpcc::glcd::Color::navy());
+	display.setCursor(3, 4);
+	display.clear();
+	TEST_ASSERT_EQUALS(display.countPixels(xpcc::glcd::Color::navy()), 200);
+	TEST_ASSERT_EQUALS(display.getCursor(), xpcc::glcd::Point(0, 0));
+}
+
+void
+BufferedColorGraphicDisplayTest::testDrawing()
+{
+	TestDisplay<20, 10> display;
+	
+	display.setColor(xpcc::glcd::Color::red());
+	display.fillRectangle(-2, 8, 5, 5);
+	TEST_ASSERT_EQUALS(display.countPixels(xpcc::glcd::Color::red()), 6);
+	TEST_ASSERT_TRUE(display.getPixelColor(0, 9) == xpcc::glcd::Color::red());
+	TEST_ASSERT_TRUE(display.getPixelColor(3, 9) == xpcc::glcd::Color::black());
+	
+	display.setColor(xpcc::glcd::Color::lime());
+	display.drawLine(5, 0, 5, 10);
+	display.drawLine(0, 0, 20, 0);
+	TEST_ASSERT_EQUALS(display.countPixels(xpcc::glcd::Color::lime()), 10 + 19);
+	
+	display.setColor(xpcc::glcd::Color::blue());
+	display.drawPixel(19, 9);
+	display.drawPixel(20, 9);
+	display.drawPixel(-1, 0);
+	TEST_ASSERT_EQUALS(display.countPixels(xpcc::glcd::Color::blue()), 1);
+	
+	// black clears to the background color
+	display.setBackgroundColor(xpcc::glcd::Color::white());
+	display.setColor(xpcc::glcd::Color::black());
+	display.fillRectangle(0, 0, 20, 1);
+	TEST_ASSERT_EQUALS(display.countPixels(xpcc::glcd::Color::white()), 20);
+}
+
+void
+BufferedColorGraphicDisplayTest::testImage()
+{
+	TestDisplay<20, 10> display;
+	display.setColor(xpcc::glcd::Color::yellow());
+	display.setBackgroundColor(xpcc::glcd::Color::gray());
+	
+	display.drawImageRaw(xpcc::glcd::Point(18, 1), 3, 10,
+			xpcc::accessor::asFlash(image));
+	
+	// only two columns and nine rows are visible
+	TEST_ASSERT_EQUALS(display.countPixels(xpcc::glcd::Color::yellow()) +
+			display.countPixels(xpcc::glcd::Color::gray()), 18);
+	TEST_ASSERT_TRUE(display.getPixelColor(18, 1) == xpcc::glcd::Color::yellow());
+	TEST_ASSERT_TRUE(display.getPixelColor(18, 2) == xpcc::glcd::Color::gray());
+	TEST_ASSERT_TRUE(display.getPixelColor(19, 2) == xpcc::glcd::Color::yellow());
+	TEST_ASSERT_TRUE(display.getPixelColor(19, 9) == xpcc::glcd::Color::yellow());
+	TEST_ASSERT_TRUE(display.getPixelColor(18, 9) == xpcc::glcd::Color::gray());
+}
+
+void
+BufferedColorGraphicDisplayTest::testComposite()
+{
+	TestDisplay<20, 10> background;
+	background.setColor(xpcc::glcd::Color::navy());
+	background.fillRectangle(0, 0, 20, 10);
+	
+	TestDisplay<4, 4> layer;
+	layer.setColor(xpcc::glcd::Color::red());
+	layer.drawPixel(0, 0);
+	layer.drawPixel(3, 3);
+	
+	background.composite(layer, xpcc::glcd::Point(17, 2), xpcc::glcd::Color::black());
+	TEST_ASSERT_EQUALS(background.countPixels(xpcc::glcd::Color::red()), 1);
+	TEST_ASSERT_TRUE(background.getPixelColor(17, 2) == xpcc::glcd::Color::red());
+	
+	// without transparency the complete visible area is copied
+	background.composite(layer, xpcc::glcd::Point(-2, 8), xpcc::glcd::Color::white());
+	TEST_ASSERT_EQUALS(background.countPixels(xpcc::glcd::Color::black()), 4);
+	TEST_ASSERT_EQUALS(background.countPixels(xpcc::glcd::Color::navy()), 200 - 5);
+}
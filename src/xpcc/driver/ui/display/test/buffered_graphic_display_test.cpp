@@ -0,0 +1,195 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include "../buffered_graphic_display.hpp"
+
+#include "buffered_graphic_display_test.hpp"
+
+namespace
+{
+	class TestDisplay : public xpcc::BufferedGraphicDisplay<40, 24>
+	{
+	public:
+		TestDisplay()
+		{
+			for (uint_fast8_t x = 0; x < 40; ++x) {
+				for (uint_fast8_t page = 0; page < 3; ++page) {
+					this->buffer[x][page] = 0;
+				}
+			}
+		}
+		
+		virtual void
+		update()
+		{
+		}
+		
+		bool
+		isPixelSet(int16_t x, int16_t y)
+		{
+			return this->getPixel(x, y);
+		}
+		
+		bool
+		operator == (const TestDisplay& other) const
+		{
+			for (uint_fast8_t x = 0; x < 40; ++x) {
+				for (uint_fast8_t page = 0; page < 3; ++page) {
+					if (this->buffer[x][page] != other.buffer[x][page]) {
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+		
+		void
+		fillPixelByPixel(int16_t x, int16_t y, int16_t width, int16_t height)
+		{
+			for (int16_t i = x; i < x + width; ++i) {
+				for (int16_t k = y; k < y + height; ++k) {
+					this->drawPixel(i, k);
+				}
+			}
+		}
+	};
+	
+	// 10x12 pixel, second row only four pixels high
+	FLASH_STORAGE(uint8_t image[]) =
+	{
+		0x81, 0x42, 0x24, 0x18, 0xff, 0x00, 0x55, 0xaa, 0x0f, 0xf0,
+		0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0xff,
+	};
+	
+	bool
+	getImagePixel(int16_t x, int16_t y)
+	{
+		return (image[x + (y / 8) * 10] >> (y & 0x07)) & 0x01;
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+BufferedGraphicDisplayTest::testFillRectangle()
+{
+	const int16_t rectangles[][4] = {
+		{ 0, 0, 40, 24 },
+		{ 3, 5, 10, 2 },
+		{ 3, 5, 10, 3 },
+		{ 1, 7, 5, 10 },
+		{ 0, 8, 40, 8 },
+		{ 35, 20, 10, 10 },
+		{ -3, -5, 10, 10 },
+		{ 2, 2, 0, 4 },
+	};
+	
+	for (uint_fast8_t i = 0; i < sizeof(rectangles) / sizeof(rectangles[0]); ++i)
+	{
+		const int16_t *r = rectangles[i];
+		
+		TestDisplay display;
+		TestDisplay reference;
+		
+		display.fillRectangle(r[0], r[1], r[2], r[3]);
+		reference.fillPixelByPixel(r[0], r[1], r[2], r[3]);
+		TEST_ASSERT_TRUE(display == reference);
+		
+		// clear a smaller area again
+		display.setColor(xpcc::glcd::Color::black());
+		reference.setColor(xpcc::glcd::Color::black());
+		display.fillRectangle(r[0] + 1, r[1] + 1, r[2] / 2, r[3] / 2);
+		reference.fillPixelByPixel(r[0] + 1, r[1] + 1, r[2] / 2, r[3] / 2);
+		TEST_ASSERT_TRUE(display == reference);
+	}
+}
+
+void
+BufferedGraphicDisplayTest::testVerticalLine()
+{
+	TestDisplay display;
+	TestDisplay reference;
+	
+	display.drawLine(5, 3, 5, 20);
+	reference.fillPixelByPixel(5, 3, 1, 17);
+	TEST_ASSERT_TRUE(display == reference);
+	
+	display.drawLine(39, -10, 39, 30);
+	reference.fillPixelByPixel(39, 0, 1, 24);
+	TEST_ASSERT_TRUE(display == reference);
+	
+	// outside the display
+	display.drawLine(40, 0, 40, 10);
+	display.drawLine(-1, 0, -1, 10);
+	TEST_ASSERT_TRUE(display == reference);
+	
+	TEST_ASSERT_TRUE(display.isPixelSet(5, 3));
+	TEST_ASSERT_FALSE(display.isPixelSet(5, 2));
+	TEST_ASSERT_FALSE(display.isPixelSet(5, 20));
+}
+
+void
+BufferedGraphicDisplayTest::testImage()
+{
+	const int16_t positions[][2] = {
+		{ 0, 0 },
+		{ 3, 8 },
+		{ 5, 3 },
+		{ 0, 7 },
+		{ 35, 13 },
+		{ -4, 6 },
+	};
+	
+	for (uint_fast8_t i = 0; i < sizeof(positions) / sizeof(positions[0]); ++i)
+	{
+		const int16_t x = positions[i][0];
+		const int16_t y = positions[i][1];
+		
+		TestDisplay display;
+		TestDisplay reference;
+		
+		// surrounding pixels must not be changed by the image
+		display.fillRectangle(0, 0, 40, 24);
+		reference.fillRectangle(0, 0, 40, 24);
+		
+		display.drawImageRaw(xpcc::glcd::Point(x, y), 10, 12,
+				xpcc::accessor::asFlash(image));
+		
+		reference.setColor(xpcc::glcd::Color::black());
+		for (int16_t k = 0; k < 10; ++k) {
+			for (int16_t m = 0; m < 12; ++m) {
+				if (!getImagePixel(k, m)) {
+					reference.drawPixel(x + k, y + m);
+				}
+			}
+		}
+		
+		TEST_ASSERT_TRUE(display == reference);
+	}
+}
@@ -0,0 +1,198 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <cstring>
+
+#include "../buffered_graphic_display.hpp"
+#include "../buffered_color_graphic_display.hpp"
+#include "../image.hpp"
+
+#include "compressed_image_test.hpp"
+
+namespace
+{
+	class TestDisplay : public xpcc::BufferedGraphicDisplay<128, 64>
+	{
+	public:
+		TestDisplay()
+		{
+			// striped background to detect pixels which are not drawn
+			for (uint_fast8_t x = 0; x < 128; ++x) {
+				for (uint_fast8_t page = 0; page < 8; ++page) {
+					this->buffer[x][page] = (x & 1) ? 0x5a : 0xc3;
+				}
+			}
+		}
+		
+		virtual void
+		update()
+		{
+		}
+		
+		bool
+		operator == (const TestDisplay& other) const
+		{
+			return (std::memcmp(this->buffer, other.buffer, sizeof(this->buffer)) == 0);
+		}
+	};
+	
+	class TestColorDisplay : public xpcc::BufferedColorGraphicDisplay<48, 32>
+	{
+	public:
+		virtual void
+		update()
+		{
+		}
+		
+		bool
+		operator == (const TestColorDisplay& other) const
+		{
+			return (std::memcmp(this->buffer, other.buffer, sizeof(this->buffer)) == 0);
+		}
+	};
+	
+	// 12x13 pixels
+	FLASH_STORAGE(uint8_t raw[]) =
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x81, 0x42, 0x24, 0x18,
+		0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x00, 0x00,
+	};
+	
+	// Runs across the end of a page row and the no-op header 128
+	FLASH_STORAGE(uint8_t compressed[]) =
+	{
+		0xfc, 0x00,						// 5x 0x00
+		0x80,							// no-op
+		0xfe, 0xff,						// 3x 0xff
+		0x02, 0x81, 0x42, 0x24,			// 3 literal bytes
+		0xf7, 0x18,						// 10x 0x18
+		0x02, 0x1f, 0x00, 0x00,			// 3 literal bytes
+	};
+	
+	const uint8_t *images[][2] = {
+		{ bitmap::skull_64x64, bitmap::skull_64x64_rle },
+		{ bitmap::logo_xpcc_90x64, bitmap::logo_xpcc_90x64_rle },
+		{ bitmap::logo_rca_90x64, bitmap::logo_rca_90x64_rle },
+		{ bitmap::logo_eurobot_90x64, bitmap::logo_eurobot_90x64_rle },
+	};
+	
+	const xpcc::glcd::Point positions[] = {
+		xpcc::glcd::Point(0, 0),
+		xpcc::glcd::Point(5, 8),
+		xpcc::glcd::Point(7, 3),
+		xpcc::glcd::Point(100, 30),
+		xpcc::glcd::Point(-10, 0),
+	};
+}
+
+// ----------------------------------------------------------------------------
+void
+CompressedImageTest::testStream()
+{
+	for (uint_fast8_t i = 0; i < sizeof(positions) / sizeof(positions[0]); ++i)
+	{
+		TestDisplay display;
+		TestDisplay reference;
+		
+		display.drawCompressedImageRaw(positions[i], 12, 13,
+				xpcc::accessor::asFlash(compressed));
+		reference.drawImageRaw(positions[i], 12, 13,
+				xpcc::accessor::asFlash(raw));
+		
+		TEST_ASSERT_TRUE(display == reference);
+	}
+}
+
+void
+CompressedImageTest::testImages()
+{
+	for (uint_fast8_t i = 0; i < sizeof(images) / sizeof(images[0]); ++i)
+	{
+		for (uint_fast8_t k = 0; k < sizeof(positions) / sizeof(positions[0]); ++k)
+		{
+			TestDisplay display;
+			TestDisplay reference;
+			
+			display.drawCompressedImage(positions[k],
+					xpcc::accessor::asFlash(images[i][1]));
+			reference.drawImage(positions[k],
+					xpcc::accessor::asFlash(images[i][0]));
+			
+			TEST_ASSERT_TRUE(display == reference);
+		}
+	}
+}
+
+void
+CompressedImageTest::testBlackForeground()
+{
+	TestDisplay display;
+	TestDisplay reference;
+	
+	display.setColor(xpcc::glcd::Color::black());
+	reference.setColor(xpcc::glcd::Color::black());
+	
+	display.drawCompressedImage(xpcc::glcd::Point(3, 5),
+			xpcc::accessor::asFlash(bitmap::skull_64x64_rle));
+	reference.drawImage(xpcc::glcd::Point(3, 5),
+			xpcc::accessor::asFlash(bitmap::skull_64x64));
+	
+	TEST_ASSERT_TRUE(display == reference);
+	
+	// the color is restored afterwards
+	display.fillRectangle(0, 0, 10, 10);
+	reference.fillRectangle(0, 0, 10, 10);
+	TEST_ASSERT_TRUE(display == reference);
+}
+
+void
+CompressedImageTest::testColorDisplay()
+{
+	TestColorDisplay display;
+	TestColorDisplay reference;
+	
+	display.setColor(xpcc::glcd::Color::red());
+	reference.setColor(xpcc::glcd::Color::red());
+	display.setBackgroundColor(xpcc::glcd::Color::blue());
+	reference.setBackgroundColor(xpcc::glcd::Color::blue());
+	
+	display.drawCompressedImage(xpcc::glcd::Point(-4, 2),
+			xpcc::accessor::asFlash(bitmap::skull_64x64_rle));
+	reference.drawImage(xpcc::glcd::Point(-4, 2),
+			xpcc::accessor::asFlash(bitmap::skull_64x64));
+	
+	display.drawCompressedImageRaw(xpcc::glcd::Point(30, 20), 12, 13,
+			xpcc::accessor::asFlash(compressed));
+	reference.drawImageRaw(xpcc::glcd::Point(30, 20), 12, 13,
+			xpcc::accessor::asFlash(raw));
+	
+	TEST_ASSERT_TRUE(display == reference);
+	TEST_ASSERT_TRUE(display.getPixelColor(40, 0) == xpcc::glcd::Color::black());
+}
@@ -0,0 +1,213 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <cstring>
+
+#include "../buffered_graphic_display.hpp"
+#include "../font.hpp"
+
+#include "font_test.hpp"
+
+namespace
+{
+	class TestDisplay : public xpcc::BufferedGraphicDisplay<128, 64>
+	{
+	public:
+		TestDisplay()
+		{
+			std::memset(this->buffer, 0, sizeof(this->buffer));
+		}
+		
+		virtual void
+		update()
+		{
+		}
+		
+		bool
+		operator == (const TestDisplay& other) const
+		{
+			return (std::memcmp(this->buffer, other.buffer, sizeof(this->buffer)) == 0);
+		}
+	};
+	
+	const uint8_t *fonts[] = {
+		xpcc::font::ScriptoNarrow,
+		xpcc::font::AllCaps3x5,
+		xpcc::font::FixedWidth5x8,
+		xpcc::font::Assertion,
+		xpcc::font::ArcadeClassic,
+		xpcc::font::Numbers14x32,
+		xpcc::font::Numbers40x57,
+		xpcc::font::Numbers46x64,
+	};
+	
+	// only the fonts which get smaller with PackBits have a compressed variant
+	const uint8_t *compressedFonts[][2] = {
+		{ xpcc::font::Numbers14x32, xpcc::font::Numbers14x32Rle },
+		{ xpcc::font::Numbers40x57, xpcc::font::Numbers40x57Rle },
+		{ xpcc::font::Numbers46x64, xpcc::font::Numbers46x64Rle },
+	};
+	
+	uint8_t fontCopy[4000];
+	
+	// Copy of the font with the plain 8 byte header used before the
+	// extended header, i.e. without flags and without glyph offset table
+	void
+	copyWithPlainHeader(const uint8_t *font, uint8_t width)
+	{
+		const uint16_t size = font[0] | (font[1] << 8);
+		std::memcpy(fontCopy, font, 8);
+		std::memcpy(fontCopy + 8, font + 10, size - 10);
+		fontCopy[0] = (size - 2) & 0xff;
+		fontCopy[1] = (size - 2) >> 8;
+		fontCopy[2] = width;
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+FontTest::testGlyphOffsetTable()
+{
+	for (uint_fast8_t i = 0; i < sizeof(fonts) / sizeof(fonts[0]); ++i)
+	{
+		const uint8_t *font = fonts[i];
+		const uint16_t size = font[0] | (font[1] << 8);
+		TEST_ASSERT_TRUE(size <= sizeof(fontCopy));
+		TEST_ASSERT_EQUALS(font[2], 0);
+		
+		// fonts with only a few characters have no offset table
+		TEST_ASSERT_EQUALS(font[8] & ~0x80, 0);
+		TEST_ASSERT_EQUALS((font[8] & 0x80) != 0, font[7] > 16);
+		
+		// the same font in the old format, the width byte must not be
+		// mistaken for flags even for wide fonts
+		const uint8_t widths[3] = { font[9], 64, 200 };
+		for (uint_fast8_t w = 0; w < 3; ++w)
+		{
+			copyWithPlainHeader(font, widths[w]);
+			
+			const uint8_t first = font[6];
+			const uint8_t count = font[7];
+			for (uint_fast16_t c = first; c < first + count; ++c)
+			{
+				TestDisplay display;
+				TestDisplay reference;
+				
+				display.setFont(font);
+				display.setCursor(3, 0);
+				display.write(c);
+				
+				reference.setFont(fontCopy);
+				reference.setCursor(3, 0);
+				reference.write(c);
+				
+				TEST_ASSERT_TRUE(display == reference);
+				TEST_ASSERT_EQUALS(display.getCursor(), reference.getCursor());
+			}
+		}
+	}
+}
+
+void
+FontTest::testCompressedFonts()
+{
+	for (uint_fast8_t i = 0; i < sizeof(compressedFonts) / sizeof(compressedFonts[0]); ++i)
+	{
+		const uint8_t *font = compressedFonts[i][0];
+		const uint8_t *compressed = compressedFonts[i][1];
+		
+		TEST_ASSERT_EQUALS(compressed[2], 0);
+		TEST_ASSERT_EQUALS(compressed[8], 0xc0);
+		TEST_ASSERT_EQUALS(compressed[9], font[9]);
+		
+		const uint8_t first = font[6];
+		const uint8_t count = font[7];
+		for (uint_fast16_t c = first; c < first + count; ++c)
+		{
+			TestDisplay display;
+			TestDisplay reference;
+			
+			// some text around the character to check that nothing
+			// else gets overwritten
+			display.drawString("xpcc xpcc");
+			reference.drawString("xpcc xpcc");
+			
+			display.setFont(compressed);
+			display.setCursor(3, 5);
+			display.write(c);
+			
+			reference.setFont(font);
+			reference.setCursor(3, 5);
+			reference.write(c);
+			
+			TEST_ASSERT_TRUE(display == reference);
+			TEST_ASSERT_EQUALS(display.getCursor(), reference.getCursor());
+		}
+	}
+}
+
+void
+FontTest::testDrawString()
+{
+	TestDisplay display;
+	TestDisplay reference;
+	
+	display.drawString("Hello\nxpcc!");
+	
+	const char *s = "Hello\nxpcc!";
+	while (*s) {
+		reference.write(*s++);
+	}
+	
+	TEST_ASSERT_TRUE(display == reference);
+	TEST_ASSERT_EQUALS(display.getCursor(), reference.getCursor());
+	
+	// strings written to the stream use the same path
+	TestDisplay stream;
+	stream << "Hello\nxpcc!";
+	TEST_ASSERT_TRUE(stream == reference);
+}
+
+void
+FontTest::testStringWidth()
+{
+	TestDisplay display;
+	
+	// five pixel wide characters plus one pixel spacing
+	TEST_ASSERT_EQUALS(display.getStringWidth(""), 0);
+	TEST_ASSERT_EQUALS(display.getStringWidth("abc"), 18);
+	TEST_ASSERT_EQUALS(display.getStringWidth("ab\nabcd\nc"), 24);
+	
+	display.drawString("abcd");
+	TEST_ASSERT_EQUALS(display.getCursor().getX(), 24);
+	
+	display.setFont(xpcc::font::Numbers46x64);
+	TEST_ASSERT_EQUALS(display.getStringWidth("42"), 2 * (46 + 4));
+}
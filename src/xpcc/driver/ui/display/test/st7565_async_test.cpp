@@ -0,0 +1,292 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include "../st7565_async.hpp"
+
+#include "st7565_async_test.hpp"
+
+namespace
+{
+	// Records every byte written to the display together with the
+	// state of the A0 line (false = command, true = data)
+	struct Transfer
+	{
+		static const uint16_t capacity = 2048;
+		
+		static uint8_t data[capacity];
+		static bool isData[capacity];
+		static uint16_t count;
+		static bool dataMode;
+		static bool selected;
+		
+		static void
+		reset()
+		{
+			count = 0;
+		}
+		
+		static void
+		append(uint8_t byte)
+		{
+			if (count < capacity)
+			{
+				data[count] = byte;
+				isData[count] = dataMode;
+				++count;
+			}
+		}
+	};
+	
+	uint8_t Transfer::data[Transfer::capacity];
+	bool Transfer::isData[Transfer::capacity];
+	uint16_t Transfer::count = 0;
+	bool Transfer::dataMode = false;
+	bool Transfer::selected = false;
+	
+	// Simulates a DMA transfer which needs some calls of isFinished()
+	// and reads the buffer at the end of the transfer
+	struct DmaSpi : public xpcc::SpiMaster
+	{
+		static uint8_t *buffer;
+		static uint16_t length;
+		static uint8_t remainingPolls;
+		static uint8_t transfers;
+		
+		static uint8_t
+		write(uint8_t data)
+		{
+			TEST_ASSERT_EQUALS(remainingPolls, 0);
+			Transfer::append(data);
+			return 0;
+		}
+		
+		static bool
+		setBuffer(uint16_t len, uint8_t* transmit=0, uint8_t* =0,
+				BufferIncrease =BUFFER_INCR_BOTH)
+		{
+			buffer = transmit;
+			length = len;
+			return true;
+		}
+		
+		static bool
+		transfer(TransferOptions =TRANSFER_SEND_BUFFER_SAVE_RECEIVE)
+		{
+			remainingPolls = 3;
+			transfers++;
+			return true;
+		}
+		
+		static bool
+		isFinished()
+		{
+			if (remainingPolls > 0)
+			{
+				if (--remainingPolls > 0) {
+					return false;
+				}
+				
+				for (uint16_t i = 0; i < length; ++i) {
+					Transfer::append(buffer[i]);
+				}
+			}
+			return true;
+		}
+	};
+	
+	uint8_t *DmaSpi::buffer = 0;
+	uint16_t DmaSpi::length = 0;
+	uint8_t DmaSpi::remainingPolls = 0;
+	uint8_t DmaSpi::transfers = 0;
+	
+	struct DummyPin
+	{
+		static void setOutput() {}
+		static void set() {}
+		static void reset() {}
+	};
+	
+	struct CsPin
+	{
+		static void setOutput() {}
+		static void set() { Transfer::selected = false; }
+		static void reset() { Transfer::selected = true; }
+	};
+	
+	struct A0Pin
+	{
+		static void setOutput() {}
+		static void set() { Transfer::dataMode = true; }
+		static void reset() { Transfer::dataMode = false; }
+	};
+	
+	class TestDisplay : public xpcc::St7565Async< xpcc::St7565<DmaSpi,
+			CsPin, A0Pin, DummyPin, 128, 64, false> >
+	{
+	public:
+		TestDisplay() :
+			finished(0)
+		{
+		}
+		
+		uint8_t finished;
+		
+	protected:
+		virtual void
+		updateFinished()
+		{
+			finished++;
+		}
+	};
+}
+
+// ----------------------------------------------------------------------------
+void
+St7565AsyncTest::setUp()
+{
+	Transfer::reset();
+	Transfer::dataMode = false;
+	Transfer::selected = false;
+	DmaSpi::transfers = 0;
+}
+
+void
+St7565AsyncTest::testUpdate()
+{
+	TestDisplay display;
+	
+	TEST_ASSERT_FALSE(display.run());
+	TEST_ASSERT_TRUE(display.startUpdate());
+	
+	// a running update can't be restarted
+	TEST_ASSERT_FALSE(display.startUpdate());
+	
+	uint16_t calls = 0;
+	while (display.run()) {
+		calls++;
+	}
+	TEST_ASSERT_FALSE(Transfer::selected);
+	
+	// 8 pages with 3 command bytes each
+	TEST_ASSERT_EQUALS(DmaSpi::transfers, 8);
+	TEST_ASSERT_EQUALS(Transfer::count, 8 * (128 + 3));
+	TEST_ASSERT_EQUALS(display.finished, 1);
+	TEST_ASSERT_TRUE(calls >= 8 * 2);
+	
+	TEST_ASSERT_EQUALS(Transfer::data[0], 0xB0);
+	TEST_ASSERT_EQUALS(Transfer::data[1], 0x10);
+	TEST_ASSERT_EQUALS(Transfer::data[2], 0x00);
+	TEST_ASSERT_FALSE(Transfer::isData[2]);
+	TEST_ASSERT_TRUE(Transfer::isData[3]);
+	TEST_ASSERT_EQUALS(Transfer::data[131], 0xB1);
+	
+	// only the changed page, column 10 to 20
+	Transfer::reset();
+	DmaSpi::transfers = 0;
+	display.drawLine(10, 20, 20, 20);
+	
+	TEST_ASSERT_TRUE(display.startUpdate());
+	TEST_ASSERT_EQUALS(display.getDirtyBytes(), 0);
+	while (display.run()) {
+	}
+	
+	TEST_ASSERT_EQUALS(DmaSpi::transfers, 1);
+	TEST_ASSERT_EQUALS(Transfer::count, 3 + 10);
+	TEST_ASSERT_EQUALS(Transfer::data[0], 0xB2);
+	TEST_ASSERT_EQUALS(Transfer::data[1], 0x10);
+	TEST_ASSERT_EQUALS(Transfer::data[2], 0x0A);
+	TEST_ASSERT_EQUALS(Transfer::data[3], 0x10);
+	TEST_ASSERT_EQUALS(display.finished, 2);
+	
+	// nothing changed => finished without a transfer
+	Transfer::reset();
+	TEST_ASSERT_TRUE(display.startUpdate());
+	TEST_ASSERT_FALSE(display.run());
+	TEST_ASSERT_EQUALS(Transfer::count, 0);
+	TEST_ASSERT_EQUALS(display.finished, 3);
+}
+
+void
+St7565AsyncTest::testDrawWhileTransmitting()
+{
+	TestDisplay display;
+	display.clear();
+	display.update();
+	Transfer::reset();
+	
+	display.fillRectangle(0, 0, 8, 8);
+	TEST_ASSERT_TRUE(display.startUpdate());
+	TEST_ASSERT_TRUE(display.run());
+	
+	// next frame
+	display.clear();
+	display.fillRectangle(0, 8, 8, 8);
+	
+	while (display.run()) {
+	}
+	
+	TEST_ASSERT_EQUALS(Transfer::count, 3 + 8);
+	TEST_ASSERT_EQUALS(Transfer::data[0], 0xB0);
+	for (uint8_t i = 0; i < 8; ++i) {
+		TEST_ASSERT_EQUALS(Transfer::data[3 + i], 0xff);
+	}
+	
+	// second frame clears page 0 and fills page 1
+	Transfer::reset();
+	display.update();
+	TEST_ASSERT_EQUALS(Transfer::count, 2 * (3 + 8));
+	TEST_ASSERT_EQUALS(Transfer::data[0], 0xB0);
+	TEST_ASSERT_EQUALS(Transfer::data[3], 0x00);
+	TEST_ASSERT_EQUALS(Transfer::data[11], 0xB1);
+	TEST_ASSERT_EQUALS(Transfer::data[14], 0xff);
+}
+
+void
+St7565AsyncTest::testSynchronousUpdate()
+{
+	TestDisplay display;
+	display.update();
+	TEST_ASSERT_EQUALS(Transfer::count, 8 * (128 + 3));
+	TEST_ASSERT_EQUALS(display.finished, 1);
+	
+	// finishes a running update before starting a new one
+	Transfer::reset();
+	display.drawPixel(0, 0);
+	display.startUpdate();
+	display.run();
+	display.drawPixel(1, 0);
+	display.update();
+	
+	TEST_ASSERT_EQUALS(Transfer::count, 2 * (3 + 1));
+	TEST_ASSERT_EQUALS(Transfer::data[3], 0x01);
+	TEST_ASSERT_EQUALS(Transfer::data[6], 0x01);	// column 1
+	TEST_ASSERT_EQUALS(Transfer::data[7], 0x01);
+	TEST_ASSERT_EQUALS(display.finished, 3);
+}
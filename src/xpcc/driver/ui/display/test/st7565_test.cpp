@@ -0,0 +1,240 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include "../st7565.hpp"
+
+#include "st7565_test.hpp"
+
+namespace
+{
+	// Records every byte written to the display together with the
+	// state of the A0 line (false = command, true = data)
+	struct Transfer
+	{
+		static const uint16_t capacity = 2048;
+		
+		static uint8_t data[capacity];
+		static bool isData[capacity];
+		static uint16_t count;
+		static bool dataMode;
+		
+		static void
+		reset()
+		{
+			count = 0;
+		}
+		
+		static uint16_t
+		getDataBytes()
+		{
+			uint16_t bytes = 0;
+			for (uint16_t i = 0; i < count; ++i) {
+				if (isData[i]) {
+					++bytes;
+				}
+			}
+			return bytes;
+		}
+	};
+	
+	uint8_t Transfer::data[Transfer::capacity];
+	bool Transfer::isData[Transfer::capacity];
+	uint16_t Transfer::count = 0;
+	bool Transfer::dataMode = false;
+	
+	struct RecordingSpi
+	{
+		static uint8_t
+		write(uint8_t data)
+		{
+			if (Transfer::count < Transfer::capacity)
+			{
+				Transfer::data[Transfer::count] = data;
+				Transfer::isData[Transfer::count] = Transfer::dataMode;
+				++Transfer::count;
+			}
+			return 0;
+		}
+	};
+	
+	struct DummyPin
+	{
+		static void setOutput() {}
+		static void set() {}
+		static void reset() {}
+	};
+	
+	struct A0Pin
+	{
+		static void setOutput() {}
+		static void set() { Transfer::dataMode = true; }
+		static void reset() { Transfer::dataMode = false; }
+	};
+	
+	template <bool TopView>
+	class TestDisplay : public xpcc::St7565<RecordingSpi, DummyPin, A0Pin,
+			DummyPin, 128, 64, TopView>
+	{
+	public:
+		uint8_t
+		getBuffer(uint16_t x, uint16_t page) const
+		{
+			return this->buffer[x][page];
+		}
+	};
+}
+
+// ----------------------------------------------------------------------------
+void
+St7565Test::setUp()
+{
+	Transfer::reset();
+	Transfer::dataMode = false;
+}
+
+void
+St7565Test::testFullUpdate()
+{
+	TestDisplay<false> display;
+	
+	TEST_ASSERT_EQUALS(display.getDirtyBytes(), 128 * 64 / 8);
+	
+	display.update();
+	
+	// 8 pages with 3 command bytes each
+	TEST_ASSERT_EQUALS(Transfer::count, 8 * (128 + 3));
+	TEST_ASSERT_EQUALS(Transfer::getDataBytes(), 8 * 128);
+	
+	TEST_ASSERT_EQUALS(Transfer::data[0], 0xB0);
+	TEST_ASSERT_EQUALS(Transfer::data[1], 0x10);
+	TEST_ASSERT_EQUALS(Transfer::data[2], 0x00);
+	TEST_ASSERT_EQUALS(Transfer::data[131], 0xB1);
+	
+	// nothing changed => nothing transferred
+	TEST_ASSERT_EQUALS(display.getDirtyBytes(), 0);
+	Transfer::reset();
+	display.update();
+	TEST_ASSERT_EQUALS(Transfer::count, 0);
+	
+	display.markAllDirty();
+	TEST_ASSERT_EQUALS(display.getDirtyBytes(), 128 * 64 / 8);
+}
+
+void
+St7565Test::testPartialUpdate()
+{
+	TestDisplay<false> display;
+	display.clear();
+	display.update();
+	Transfer::reset();
+	
+	// page 2, column 10
+	display.drawPixel(10, 20);
+	TEST_ASSERT_EQUALS(display.getDirtyBytes(), 1);
+	
+	display.update();
+	TEST_ASSERT_EQUALS(Transfer::count, 4);
+	TEST_ASSERT_EQUALS(Transfer::data[0], 0xB2);
+	TEST_ASSERT_EQUALS(Transfer::data[1], 0x10);
+	TEST_ASSERT_EQUALS(Transfer::data[2], 0x0A);
+	TEST_ASSERT_FALSE(Transfer::isData[2]);
+	TEST_ASSERT_EQUALS(Transfer::data[3], 0x10);
+	TEST_ASSERT_TRUE(Transfer::isData[3]);
+	
+	// horizontal line in page 5 from column 40 to 99 (end exclusive)
+	Transfer::reset();
+	display.drawLine(40, 42, 100, 42);
+	TEST_ASSERT_EQUALS(display.getDirtyBytes(), 60);
+	
+	display.update();
+	TEST_ASSERT_EQUALS(Transfer::count, 3 + 60);
+	TEST_ASSERT_EQUALS(Transfer::data[0], 0xB5);
+	TEST_ASSERT_EQUALS(Transfer::data[1], 0x12);
+	TEST_ASSERT_EQUALS(Transfer::data[2], 0x08);
+	for (uint8_t i = 0; i < 60; ++i) {
+		TEST_ASSERT_EQUALS(Transfer::data[3 + i], 0x04);
+	}
+	
+	// two pixels in the same page span all columns between them
+	Transfer::reset();
+	display.drawPixel(0, 0);
+	display.drawPixel(127, 1);
+	TEST_ASSERT_EQUALS(display.getDirtyBytes(), 128);
+	
+	// pixels outside the display are ignored
+	display.update();
+	display.drawPixel(128, 0);
+	display.drawPixel(-1, 10);
+	display.drawPixel(0, 64);
+	TEST_ASSERT_EQUALS(display.getDirtyBytes(), 0);
+}
+
+void
+St7565Test::testClear()
+{
+	TestDisplay<false> display;
+	display.clear();
+	display.update();
+	
+	// clearing an empty display changes nothing
+	display.clear();
+	TEST_ASSERT_EQUALS(display.getDirtyBytes(), 0);
+	
+	display.drawPixel(3, 3);
+	display.drawPixel(70, 63);
+	display.update();
+	
+	display.clear();
+	TEST_ASSERT_EQUALS(display.getDirtyBytes(), 2);
+	
+	Transfer::reset();
+	display.update();
+	TEST_ASSERT_EQUALS(Transfer::getDataBytes(), 2);
+	TEST_ASSERT_EQUALS(display.getBuffer(3, 0), 0);
+	TEST_ASSERT_EQUALS(display.getBuffer(70, 7), 0);
+}
+
+void
+St7565Test::testTopView()
+{
+	TestDisplay<true> display;
+	display.clear();
+	display.update();
+	Transfer::reset();
+	
+	display.drawPixel(30, 0);
+	display.update();
+	
+	TEST_ASSERT_EQUALS(Transfer::count, 4);
+	TEST_ASSERT_EQUALS(Transfer::data[0], 0xB0);
+	TEST_ASSERT_EQUALS(Transfer::data[1], 0x12);
+	TEST_ASSERT_EQUALS(Transfer::data[2], 0x02);
+	TEST_ASSERT_EQUALS(Transfer::data[3], 0x01);
+}
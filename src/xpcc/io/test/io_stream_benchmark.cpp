@@ -0,0 +1,134 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/io/iostream.hpp>
+
+#include "io_stream_benchmark.hpp"
+
+// ----------------------------------------------------------------------------
+// IODevice which only counts the written characters, so that the
+// numbers contain as little of the device as possible
+namespace
+{
+	class CountingDevice : public xpcc::IODevice
+	{
+	public:
+		CountingDevice() :
+			bytesWritten(0)
+		{
+		}
+		
+		virtual void
+		write(char)
+		{
+			this->bytesWritten++;
+		}
+		
+		using xpcc::IODevice::write;
+		
+		virtual void
+		flush()
+		{
+		}
+		
+		virtual bool
+		read(char& /*c*/)
+		{
+			return false;
+		}
+		
+		uint32_t bytesWritten;
+	};
+	
+	CountingDevice device;
+}
+
+// ----------------------------------------------------------------------------
+void
+IoStreamBenchmark::benchmarkString(unittest::BenchmarkState& state)
+{
+	xpcc::IOStream stream(device);
+	while (state.keepRunning()) {
+		stream << "abcdefghijklmnopqrstuvwxyz";
+	}
+	unittest::doNotOptimize(device.bytesWritten);
+}
+
+void
+IoStreamBenchmark::benchmarkStreamUint16(unittest::BenchmarkState& state)
+{
+	xpcc::IOStream stream(device);
+	uint16_t value = 0;
+	while (state.keepRunning())
+	{
+		stream << value;
+		value += 1237;
+	}
+	unittest::doNotOptimize(device.bytesWritten);
+}
+
+void
+IoStreamBenchmark::benchmarkStreamInt32(unittest::BenchmarkState& state)
+{
+	xpcc::IOStream stream(device);
+	int32_t value = -2147483647;
+	while (state.keepRunning())
+	{
+		stream << value;
+		value += 104729;
+	}
+	unittest::doNotOptimize(device.bytesWritten);
+}
+
+void
+IoStreamBenchmark::benchmarkStreamFloat(unittest::BenchmarkState& state)
+{
+	xpcc::IOStream stream(device);
+	float value = -1000.0f;
+	while (state.keepRunning())
+	{
+		stream << value;
+		value += 0.37f;
+	}
+	unittest::doNotOptimize(device.bytesWritten);
+}
+
+void
+IoStreamBenchmark::benchmarkPrintf(unittest::BenchmarkState& state)
+{
+	xpcc::IOStream stream(device);
+	uint16_t value = 0;
+	while (state.keepRunning())
+	{
+		stream.printf("%u: %lx\n", value, static_cast<uint32_t>(value) << 12);
+		value++;
+	}
+	unittest::doNotOptimize(device.bytesWritten);
+}
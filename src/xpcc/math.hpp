@@ -40,6 +40,7 @@
 #include "math/geometry.hpp"
 #include "math/matrix.hpp"
 #include "math/lu_decomposition.hpp"
+#include "math/cholesky_decomposition.hpp"
 #include "math/interpolation.hpp"
 #include "math/utils.hpp"
 
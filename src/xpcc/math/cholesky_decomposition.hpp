@@ -0,0 +1,95 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__CHOLESKY_DECOMPOSITION_HPP
+#define XPCC__CHOLESKY_DECOMPOSITION_HPP
+
+#include "matrix.hpp"
+
+namespace xpcc
+{
+	/**
+	 * \brief	Cholesky decomposition of symmetric positive-definite matrices
+	 * 
+	 * Factorise a matrix A into a lower triangular matrix L such
+	 * that A = L*L^T. The decomposition needs about half the operations
+	 * of the LU decomposition and is numerically stable without pivoting,
+	 * therefore the method of choice for covariance matrices (e.g. in a
+	 * Kalman filter). Solving for a full matrix B costs about the same as
+	 * with the LU decomposition.
+	 * 
+	 * All operations work in place, no temporary matrices are needed.
+	 * 
+	 * \ingroup	matrix
+	 */
+	class CholeskyDecomposition
+	{
+	public:
+		/**
+		 * \brief	In-place decomposition
+		 * 
+		 * Only the lower triangle of \p a is used. It is replaced by L,
+		 * the upper triangle is not modified.
+		 * 
+		 * \return	\c false if the matrix is not positive-definite
+		 */
+		template <typename T, uint8_t N>
+		static bool
+		decompose(Matrix<T, N, N> *a);
+		
+		/**
+		 * \brief	Solve A*X = B with L from decompose()
+		 * 
+		 * \param		l	Decomposed matrix (lower triangle is used)
+		 * \param[in,out]	b	Right hand sides (one per column), replaced
+		 * 						by the solution X
+		 */
+		template <typename T, uint8_t N, uint8_t M>
+		static void
+		solve(const Matrix<T, N, N> &l, Matrix<T, N, M> *b);
+		
+		/**
+		 * \brief	Solve A*X = B in place
+		 * 
+		 * \p a is replaced by its decomposition and \p b by the
+		 * solution X.
+		 * 
+		 * \return	\c false if A is not positive-definite, \p b is
+		 * 			undefined then
+		 */
+		template <typename T, uint8_t N, uint8_t M>
+		static bool
+		solve(Matrix<T, N, N> *a, Matrix<T, N, M> *b);
+	};
+}
+
+#include "cholesky_decomposition_impl.hpp"
+
+#endif // XPCC__CHOLESKY_DECOMPOSITION_HPP
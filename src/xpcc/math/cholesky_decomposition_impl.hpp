@@ -0,0 +1,126 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__CHOLESKY_DECOMPOSITION_HPP
+	#error	"Don't include this file directly, use 'cholesky_decomposition.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t SIZE>
+bool
+xpcc::CholeskyDecomposition::decompose(xpcc::Matrix<T, SIZE, SIZE> *a)
+{
+	T *l = a->ptr();
+	
+	for (uint_fast8_t j = 0; j < SIZE; ++j)
+	{
+		T *rowJ = &l[j*SIZE];
+		
+		T diagonal = rowJ[j];
+		for (uint_fast8_t k = 0; k < j; ++k) {
+			diagonal -= rowJ[k] * rowJ[k];
+		}
+		
+		if (!(diagonal > 0)) {
+			return false;
+		}
+		diagonal = std::sqrt(diagonal);
+		rowJ[j] = diagonal;
+		
+		const T factor = T(1) / diagonal;
+		for (uint_fast8_t i = j + 1; i < SIZE; ++i)
+		{
+			T *rowI = &l[i*SIZE];
+			
+			T sum = rowI[j];
+			for (uint_fast8_t k = 0; k < j; ++k) {
+				sum -= rowI[k] * rowJ[k];
+			}
+			rowI[j] = sum * factor;
+		}
+	}
+	
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t SIZE, uint8_t M>
+void
+xpcc::CholeskyDecomposition::solve(
+		const xpcc::Matrix<T, SIZE, SIZE> &l,
+		xpcc::Matrix<T, SIZE, M> *b)
+{
+	const T *a = l.ptr();
+	T *x = b->ptr();
+	
+	// forward substitution: L*Y = B
+	for (uint_fast8_t i = 0; i < SIZE; ++i)
+	{
+		const T *row = &a[i*SIZE];
+		const T factor = T(1) / row[i];
+		for (uint_fast8_t j = 0; j < M; ++j)
+		{
+			T sum = x[i*M + j];
+			for (uint_fast8_t k = 0; k < i; ++k) {
+				sum -= row[k] * x[k*M + j];
+			}
+			x[i*M + j] = sum * factor;
+		}
+	}
+	
+	// backward substitution: L^T*X = Y, with L^T[i][k] = L[k][i]
+	for (uint_fast8_t i = SIZE; i-- > 0; )
+	{
+		const T factor = T(1) / a[i*SIZE + i];
+		for (uint_fast8_t j = 0; j < M; ++j)
+		{
+			T sum = x[i*M + j];
+			for (uint_fast8_t k = i + 1; k < SIZE; ++k) {
+				sum -= a[k*SIZE + i] * x[k*M + j];
+			}
+			x[i*M + j] = sum * factor;
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t SIZE, uint8_t M>
+bool
+xpcc::CholeskyDecomposition::solve(
+		xpcc::Matrix<T, SIZE, SIZE> *a,
+		xpcc::Matrix<T, SIZE, M> *b)
+{
+	if (!decompose(a)) {
+		return false;
+	}
+	
+	solve(*a, b);
+	return true;
+}
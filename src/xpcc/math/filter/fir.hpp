@@ -32,6 +32,7 @@
 #define XPCC__FIR_HPP
 
 #include <stdint.h>
+#include <cstddef>
 
 namespace xpcc
 {
@@ -40,6 +41,13 @@ namespace xpcc
 	 *
 	 * g[n] = SUM(h[k]x[n-k])
 	 * 
+	 * The taps are stored in a buffer of N + BLOCK_SIZE entries, the
+	 * history has only to be moved every BLOCK_SIZE samples. When whole
+	 * buffers are processed with filter() a larger BLOCK_SIZE therefore
+	 * reduces the overhead. update() and filter() sum the products in
+	 * the same order, so their results are bit-identical, also for
+	 * floating point types.
+	 * 
 	 * \todo	
 	 * 
 	 * \author	Kevin Laeufer
@@ -92,7 +100,32 @@ namespace xpcc
 			{
 				return output;
 			}
+			
+			/**
+			 * \brief	Filter a block of samples
+			 * 
+			 * Same as calling append() and update() for every sample,
+			 * the filter state is carried over between calls, so a long
+			 * stream can be processed in multiple blocks. getValue()
+			 * returns the last output value afterwards.
+			 * 
+			 * \param	input	\p n input samples
+			 * \param	output	buffer for \p n output values, may be
+			 * 					the same as \p input
+			 * \param	n		number of samples
+			 */
+			void
+			filter(const T *input, T *output, std::size_t n);
 		
+		private:
+			/// Move the last N-1 taps to the end of the buffer
+			void
+			shiftTaps();
+			
+			/// Calculates SUM(h[k]x[n-k]) for the taps starting at \p tap
+			T
+			calculate(const T *tap) const;
+			
 		private:
 			T output;	
 			T taps[N+BLOCK_SIZE];
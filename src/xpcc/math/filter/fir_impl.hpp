@@ -98,8 +98,7 @@ xpcc::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor>::append(const T& input)
 		taps_index--;
 	}
 	else{
-		for(int i = N + BLOCK_SIZE - 1; i > BLOCK_SIZE; i--)
-			taps[i] = taps[i - BLOCK_SIZE - 1];
+		shiftTaps();
 		taps_index = BLOCK_SIZE;
 	}
 	taps[taps_index] = input;
@@ -126,8 +125,65 @@ xpcc::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor>::update()
 	printf("\n");
 #endif // FIR_DEBUG_UPDATE
 
+	output = calculate(taps + taps_index) / ScaleFactor;
+#ifdef FIR_DEBUG_UPDATE
+	printf("sum=%.3f\n", output);
+#endif // FIR_DEBUG_UPDATE
+}
+
+// -----------------------------------------------------------------------------
+template<typename T, int N, int BLOCK_SIZE, signed int ScaleFactor>
+void
+xpcc::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor>::filter(const T *input,
+		T *output, std::size_t n)
+{
+	const T *outputStart = output;
+	while (n > 0)
+	{
+		if (taps_index == 0) {
+			shiftTaps();
+			taps_index = BLOCK_SIZE + 1;
+		}
+		
+		// process as many samples as possible without moving the taps
+		std::size_t count = n;
+		if (count > static_cast<std::size_t>(taps_index)) {
+			count = taps_index;
+		}
+		n -= count;
+		
+		for (std::size_t i = 0; i < count; i++)
+		{
+			taps_index--;
+			taps[taps_index] = input[i];
+			output[i] = calculate(taps + taps_index) / ScaleFactor;
+		}
+		input += count;
+		output += count;
+	}
+	if (output != outputStart) {
+		this->output = output[-1];
+	}
+}
+
+// -----------------------------------------------------------------------------
+template<typename T, int N, int BLOCK_SIZE, signed int ScaleFactor>
+void
+xpcc::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor>::shiftTaps()
+{
+	for(int i = N + BLOCK_SIZE - 1; i > BLOCK_SIZE; i--)
+		taps[i] = taps[i - BLOCK_SIZE - 1];
+}
+
+// -----------------------------------------------------------------------------
+template<typename T, int N, int BLOCK_SIZE, signed int ScaleFactor>
+T
+xpcc::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor>::calculate(const T *tap) const
+{
+	// A single accumulator summed in ascending order, floating point
+	// results therefore don't depend on whether update() or filter()
+	// is used.
 	T sum = (T)0;
-	T *tap = taps + taps_index;
 	for(int i = 0; i < (N - (N%4)); i++){
 		FIR_DEBUG_SUM(tap[i], coefficients[i]);
 		sum += tap[i]*coefficients[i]; i++;
@@ -142,9 +198,6 @@ xpcc::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor>::update()
 		FIR_DEBUG_SUM(tap[i], coefficients[i]);
 		sum += tap[i]*coefficients[i];
 	}
-	output = sum / ScaleFactor;
-#ifdef FIR_DEBUG_UPDATE
-	printf("sum=%.3f\n", output);
-#endif // FIR_DEBUG_UPDATE
+	return sum;
 }
 #endif // XPCC__FIR_IMPL_HPP
@@ -32,6 +32,9 @@
 #define XPCC_FILTER__MEDIAN_HPP
 
 #include <stdint.h>
+#include <cstddef>
+
+#include <xpcc/utils/template_metaprogramming.hpp>
 
 namespace xpcc
 {
@@ -43,9 +46,16 @@ namespace xpcc
 		 * Calculates the median of a input set. Useful for eliminating spikes
 		 * from the input. Adds a group delay of N/2 ticks for the signal.
 		 * 
-		 * Implementation are available for N = 3, 5, 7 and 9. To find
-		 * the median the signal values will be partly sorted, but only as much
-		 * as needed to find the median.
+		 * Optimized implementations are available for N = 3, 5, 7 and 9.
+		 * To find the median the signal values will be partly sorted, but
+		 * only as much as needed to find the median.
+		 * 
+		 * For all other values of N the samples are kept in two heaps
+		 * around the median: a max-heap with the smaller and a min-heap
+		 * with the larger half of the values. Every append() replaces the
+		 * oldest sample and restores the heaps in O(log N), so even
+		 * large windows are cheap. For even N the upper one of the two
+		 * middle values is returned.
 		 * 
 		 * \code
 		 * // create a new filter for five samples
@@ -79,17 +89,70 @@ namespace xpcc
 			 */
 			Median(const T& initialValue = 0);
 			
-			/// Append new value
+			/// Append new value, O(log N)
 			void
 			append(const T& input);
 			
 			/// calculate median
 			void
-			udpate();
+			update();
 			
 			/// Get median value
 			const T
 			getValue() const;
+			
+			/**
+			 * \brief	Filter a block of samples
+			 * 
+			 * Same as calling append(), update() and getValue() for
+			 * every sample. \p output may be the same as \p input.
+			 */
+			void
+			filter(const T *input, T *output, std::size_t n);
+			
+		private:
+			// Signed position inside the heap, see heapAt()
+			typedef typename xpcc::tmp::Select<
+					(N < 128),
+					int8_t,
+					int16_t >::Result Index;
+			
+			/**
+			 * Heap position i is the median for i == 0, positive
+			 * positions form the min-heap, negative ones the max-heap.
+			 * The children of position i are at 2i and 2i+1 (2i-1 for
+			 * the max-heap).
+			 */
+			inline Index&
+			heapAt(Index i);
+			
+			inline bool
+			isLess(Index i, Index j);
+			
+			/// Swap the positions \p i and \p j if (i < j)
+			inline bool
+			compareAndExchange(Index i, Index j);
+			
+			void
+			minSortDown(Index i);
+			
+			void
+			maxSortDown(Index i);
+			
+			bool
+			minSortUp(Index i);
+			
+			bool
+			maxSortUp(Index i);
+			
+			static const Index minCount = (N - 1) / 2;
+			static const Index maxCount = N / 2;
+			
+			T data[N];			///< ring buffer with the samples
+			Index position[N];	///< heap position of each sample
+			Index heap[N];		///< sample index for each heap position
+			Index index;		///< oldest sample
+			T median;
 		};
 	}
 }
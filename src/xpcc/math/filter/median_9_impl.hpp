@@ -46,6 +46,9 @@ namespace xpcc
 			
 			const T
 			getValue() const;
+			
+			void
+			filter(const T *input, T *output, std::size_t n);
 		
 		private:
 			uint_fast8_t index;
@@ -117,3 +120,15 @@ xpcc::filter::Median<T, 9>::getValue() const
 {
 	return sorted[4];
 }
+
+template <typename T>
+void
+xpcc::filter::Median<T, 9>::filter(const T *input, T *output, std::size_t n)
+{
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		this->append(input[i]);
+		this->update();
+		output[i] = this->getValue();
+	}
+}
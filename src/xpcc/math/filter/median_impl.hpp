@@ -45,4 +45,174 @@
 #undef XPCC_MEDIAN__SWAP
 
 // ----------------------------------------------------------------------------
-// TODO General implementation
+// General implementation, see
+// http://stackoverflow.com/questions/5527437 for a description of the
+// algorithm.
+template <typename T, int N>
+xpcc::filter::Median<T, N>::Median(const T& initialValue) :
+	index(0), median(initialValue)
+{
+	// all values are equal, so any distribution fulfills the heap properties
+	for (Index i = 0; i < N; ++i)
+	{
+		data[i] = initialValue;
+		position[i] = ((i + 1) / 2) * ((i & 1) ? -1 : 1);
+		heapAt(position[i]) = i;
+	}
+}
+
+template <typename T, int N>
+void
+xpcc::filter::Median<T, N>::append(const T& input)
+{
+	const Index p = position[index];
+	const T old = data[index];
+	
+	data[index] = input;
+	if (++index >= N) {
+		index = 0;
+	}
+	
+	if (p > 0)
+	{
+		// new value is in the min-heap
+		if (old < input) {
+			minSortDown(p * 2);
+		}
+		else if (minSortUp(p)) {
+			maxSortDown(-1);
+		}
+	}
+	else if (p < 0)
+	{
+		// new value is in the max-heap
+		if (input < old) {
+			maxSortDown(p * 2);
+		}
+		else if (maxSortUp(p)) {
+			minSortDown(1);
+		}
+	}
+	else
+	{
+		// new value replaces the median
+		if (maxCount > 0) {
+			maxSortDown(-1);
+		}
+		if (minCount > 0) {
+			minSortDown(1);
+		}
+	}
+}
+
+template <typename T, int N>
+void
+xpcc::filter::Median<T, N>::update()
+{
+	median = data[heapAt(0)];
+}
+
+template <typename T, int N>
+const T
+xpcc::filter::Median<T, N>::getValue() const
+{
+	return median;
+}
+
+template <typename T, int N>
+void
+xpcc::filter::Median<T, N>::filter(const T *input, T *output, std::size_t n)
+{
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		this->append(input[i]);
+		output[i] = data[heapAt(0)];
+	}
+	if (n > 0) {
+		median = output[n - 1];
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, int N>
+typename xpcc::filter::Median<T, N>::Index&
+xpcc::filter::Median<T, N>::heapAt(Index i)
+{
+	return heap[i + maxCount];
+}
+
+template <typename T, int N>
+bool
+xpcc::filter::Median<T, N>::isLess(Index i, Index j)
+{
+	return (data[heapAt(i)] < data[heapAt(j)]);
+}
+
+template <typename T, int N>
+bool
+xpcc::filter::Median<T, N>::compareAndExchange(Index i, Index j)
+{
+	if (!isLess(i, j)) {
+		return false;
+	}
+	
+	Index temp = heapAt(i);
+	heapAt(i) = heapAt(j);
+	heapAt(j) = temp;
+	
+	position[heapAt(i)] = i;
+	position[heapAt(j)] = j;
+	return true;
+}
+
+template <typename T, int N>
+void
+xpcc::filter::Median<T, N>::minSortDown(Index i)
+{
+	for (; i <= minCount; i *= 2)
+	{
+		// select the smaller child
+		if (i > 1 && i < minCount && isLess(i + 1, i)) {
+			++i;
+		}
+		if (!compareAndExchange(i, i / 2)) {
+			break;
+		}
+	}
+}
+
+template <typename T, int N>
+void
+xpcc::filter::Median<T, N>::maxSortDown(Index i)
+{
+	for (; i >= -maxCount; i *= 2)
+	{
+		// select the larger child
+		if (i < -1 && i > -maxCount && isLess(i, i - 1)) {
+			--i;
+		}
+		if (!compareAndExchange(i / 2, i)) {
+			break;
+		}
+	}
+}
+
+template <typename T, int N>
+bool
+xpcc::filter::Median<T, N>::minSortUp(Index i)
+{
+	while (i > 0 && compareAndExchange(i, i / 2)) {
+		i /= 2;
+	}
+	return (i == 0);
+}
+
+template <typename T, int N>
+bool
+xpcc::filter::Median<T, N>::maxSortUp(Index i)
+{
+	while (i < 0 && compareAndExchange(i / 2, i)) {
+		i /= 2;
+	}
+	return (i == 0);
+}
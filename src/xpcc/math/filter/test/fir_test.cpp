@@ -60,6 +60,56 @@ FirTest::testFir()
 	testFilter<int, 5, 2, 10>(delay_line_coeffs, delay_line_taps, 5, delay_line_results);
 }
 
+void
+FirTest::testBlockFilter()
+{
+	const float coeffs[7] = {0.1f, -0.25f, 0.5f, 1.0f, 0.5f, -0.25f, 0.1f};
+	
+	float input[50];
+	for (int i = 0; i < 50; i++) {
+		input[i] = static_cast<float>((i * 7) % 11) - 5.0f;
+	}
+	
+	xpcc::filter::Fir<float, 7, 4> stream(coeffs);
+	float expected[50];
+	for (int i = 0; i < 50; i++) {
+		stream.append(input[i]);
+		stream.update();
+		expected[i] = stream.getValue();
+	}
+	
+	// processed in blocks of different sizes, which don't match BLOCK_SIZE
+	xpcc::filter::Fir<float, 7, 4> block(coeffs);
+	float output[50];
+	block.filter(input, output, 3);
+	block.filter(input + 3, output + 3, 0);
+	block.filter(input + 3, output + 3, 1);
+	block.filter(input + 4, output + 4, 17);
+	block.filter(input + 21, output + 21, 29);
+	
+	for (int i = 0; i < 50; i++) {
+		TEST_ASSERT_EQUALS(output[i], expected[i]);
+	}
+	TEST_ASSERT_EQUALS(block.getValue(), expected[49]);
+	
+	// block and streaming operation can be mixed
+	block.reset();
+	block.filter(input, output, 10);
+	block.append(input[10]);
+	block.update();
+	TEST_ASSERT_EQUALS(block.getValue(), expected[10]);
+	
+	// in-place operation
+	float buffer[39];
+	for (int i = 0; i < 39; i++) {
+		buffer[i] = input[i + 11];
+	}
+	block.filter(buffer, buffer, 39);
+	for (int i = 0; i < 39; i++) {
+		TEST_ASSERT_EQUALS(buffer[i], expected[i + 11]);
+	}
+}
+
 /* Length of results array needs to be len(taps) + len(coeff) */
 template<typename T, int N, int BLOCK_SIZE, unsigned int ScaleFactor>
 void FirTest::testFilter(const float (&coeff)[N],
@@ -36,6 +36,9 @@ public:
 
 	void
 	testFir();
+	
+	void
+	testBlockFilter();
 
 private:
 	/* Length of results array needs to be len(taps) + len(coeff) */
@@ -70,6 +70,55 @@ namespace
 		{ 10,	10, 10, 10, 10 },
 		{ 10,	10, 10, 10, 10 },
 	};
+	
+	// Pseudo random values with a lot of duplicates
+	int16_t
+	getSample(int i)
+	{
+		return static_cast<int16_t>(((i * 7919) % 211) - 100);
+	}
+	
+	// Reference implementation: sort the last N samples
+	template <int N>
+	int16_t
+	calculateMedian(const int16_t *window)
+	{
+		int16_t sorted[N];
+		for (int i = 0; i < N; ++i)
+		{
+			int j = i;
+			for (; j > 0 && sorted[j - 1] > window[i]; --j) {
+				sorted[j] = sorted[j - 1];
+			}
+			sorted[j] = window[i];
+		}
+		return sorted[N / 2];
+	}
+	
+	template <int N>
+	bool
+	checkGenericMedian()
+	{
+		xpcc::filter::Median<int16_t, N> filter(3);
+		
+		int16_t window[N];
+		for (int i = 0; i < N; ++i) {
+			window[i] = 3;
+		}
+		
+		for (int i = 0; i < 4 * N + 50; ++i)
+		{
+			window[i % N] = getSample(i);
+			
+			filter.append(getSample(i));
+			filter.update();
+			
+			if (filter.getValue() != calculateMedian<N>(window)) {
+				return false;
+			}
+		}
+		return true;
+	}
 }
 
 void
@@ -117,3 +166,71 @@ MedianTest::testMedian()
 		TEST_ASSERT_EQUALS(filter9.getValue(), testData[i].median9);
 	}
 }
+
+void
+MedianTest::testGenericMedian()
+{
+	xpcc::filter::Median<uint8_t, 11> filter(5);
+	TEST_ASSERT_EQUALS(filter.getValue(), 5);
+	
+	filter.append(100);
+	filter.append(100);
+	filter.append(100);
+	filter.append(100);
+	filter.append(100);
+	filter.update();
+	TEST_ASSERT_EQUALS(filter.getValue(), 5);
+	
+	filter.append(100);
+	TEST_ASSERT_EQUALS(filter.getValue(), 5);
+	filter.update();
+	TEST_ASSERT_EQUALS(filter.getValue(), 100);
+	
+	TEST_ASSERT_TRUE(checkGenericMedian<1>());
+	TEST_ASSERT_TRUE(checkGenericMedian<2>());
+	TEST_ASSERT_TRUE(checkGenericMedian<4>());
+	TEST_ASSERT_TRUE(checkGenericMedian<11>());
+	TEST_ASSERT_TRUE(checkGenericMedian<31>());
+	TEST_ASSERT_TRUE(checkGenericMedian<32>());
+	TEST_ASSERT_TRUE(checkGenericMedian<101>());
+	TEST_ASSERT_TRUE(checkGenericMedian<255>());
+}
+
+void
+MedianTest::testFilter()
+{
+	int16_t input[80];
+	for (int i = 0; i < 80; ++i) {
+		input[i] = getSample(i);
+	}
+	
+	xpcc::filter::Median<int16_t, 5> filter5;
+	xpcc::filter::Median<int16_t, 31> filter31;
+	xpcc::filter::Median<int16_t, 5> reference5;
+	xpcc::filter::Median<int16_t, 31> reference31;
+	
+	int16_t output5[80];
+	int16_t output31[80];
+	filter5.filter(input, output5, 30);
+	filter5.filter(input + 30, output5 + 30, 50);
+	filter31.filter(input, output31, 80);
+	
+	for (int i = 0; i < 80; ++i)
+	{
+		reference5.append(input[i]);
+		reference5.update();
+		reference31.append(input[i]);
+		reference31.update();
+		
+		TEST_ASSERT_EQUALS(output5[i], reference5.getValue());
+		TEST_ASSERT_EQUALS(output31[i], reference31.getValue());
+	}
+	TEST_ASSERT_EQUALS(filter31.getValue(), reference31.getValue());
+	
+	// in-place
+	xpcc::filter::Median<int16_t, 31> inPlace;
+	inPlace.filter(input, input, 80);
+	for (int i = 0; i < 80; ++i) {
+		TEST_ASSERT_EQUALS(input[i], output31[i]);
+	}
+}
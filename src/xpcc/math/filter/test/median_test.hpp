@@ -38,4 +38,10 @@ public:
 	
 	void
 	testMedian();
+	
+	void
+	testGenericMedian();
+	
+	void
+	testFilter();
 };
@@ -34,12 +34,39 @@
 #include <cmath>
 #include <stdint.h>
 #include <xpcc/architecture/utils.hpp>
+#include <xpcc/math/utils/fast_math.hpp>
+
+// The kernel selection has to be identical in the library and in the
+// project code, otherwise the inline templates differ between the
+// translation units.
+#include <xpcc_config.hpp>
 
 namespace xpcc
 {
+	/**
+	 * \brief	Math kernels used by the geometry classes for single
+	 * 			precision and integer types
+	 * 
+	 * xpcc::math::StandardMath by default. Set \c GEOMETRY_FAST_MATH to
+	 * \c 1 in the project configuration to use the approximations of
+	 * xpcc::math::FastMath.
+	 * 
+	 * This header includes <xpcc_config.hpp> itself, so the library
+	 * and the project code always use the same kernel.
+	 * 
+	 * \ingroup	geometry
+	 */
+#if defined(GEOMETRY_FAST_MATH) && GEOMETRY_FAST_MATH
+	typedef math::FastMath GeometricMath;
+#else
+	typedef math::StandardMath GeometricMath;
+#endif
+	
 	/**
 	 * \brief	Traits for all geometric classes
 	 * 
+	 * \c Math selects the implementation of the square root and
+	 * trigonometric functions, see xpcc::GeometricMath.
 	 * 
 	 * \ingroup	geometry
 	 * \author	Fabian Greif
@@ -49,6 +76,8 @@ namespace xpcc
 	{
 		static const bool isValidType = false;
 		
+		typedef math::StandardMath Math;
+		
 		/**
 		 * \brief	Round if converting from a floating point base to
 		 * 			a integer base.
@@ -68,6 +97,7 @@ namespace xpcc
 	{
 		static const bool isValidType = true;
 		
+		typedef GeometricMath Math;
 		typedef float FloatType;
 		typedef int16_t WideType;
 		
@@ -84,6 +114,7 @@ namespace xpcc
 	{
 		static const bool isValidType = true;
 		
+		typedef GeometricMath Math;
 		typedef float FloatType;
 		typedef int16_t WideType;
 		
@@ -99,6 +130,7 @@ namespace xpcc
 	{
 		static const bool isValidType = true;
 		
+		typedef GeometricMath Math;
 		typedef float FloatType;
 		typedef int32_t WideType;
 		
@@ -114,6 +146,7 @@ namespace xpcc
 	{
 		static const bool isValidType = true;
 		
+		typedef GeometricMath Math;
 		typedef float FloatType;
 		
 		// Usually the range of a int32_t is big enough so that no
@@ -133,6 +166,7 @@ namespace xpcc
 	{
 		static const bool isValidType = true;
 		
+		typedef GeometricMath Math;
 		typedef float FloatType;
 		typedef float WideType;
 		
@@ -148,6 +182,7 @@ namespace xpcc
 	{
 		static const bool isValidType = true;
 		
+		typedef math::StandardMath Math;
 		typedef double FloatType;
 		typedef double WideType;
 		
@@ -63,9 +63,15 @@ namespace xpcc
 		
 		PointSet2D(const PointSet2D& other);
 		
+		/// Takes over the points of \p other without copying them
+		PointSet2D(PointSet2D&& other);
+		
 		PointSet2D&
 		operator = (const PointSet2D& other);
 		
+		PointSet2D&
+		operator = (PointSet2D&& other);
+		
 		/// Number of points contained in the set
 		inline SizeType
 		getNumberOfPoints() const;
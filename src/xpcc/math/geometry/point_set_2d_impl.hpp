@@ -45,6 +45,12 @@ xpcc::PointSet2D<T>::PointSet2D(const PointSet2D<T>& other) :
 {
 }
 
+template <typename T>
+xpcc::PointSet2D<T>::PointSet2D(PointSet2D<T>&& other) :
+	points(std::move(other.points))
+{
+}
+
 template <typename T>
 xpcc::PointSet2D<T>&
 xpcc::PointSet2D<T>::operator = (const PointSet2D<T>& other)
@@ -53,6 +59,14 @@ xpcc::PointSet2D<T>::operator = (const PointSet2D<T>& other)
 	return *this;
 }
 
+template <typename T>
+xpcc::PointSet2D<T>&
+xpcc::PointSet2D<T>::operator = (PointSet2D<T>&& other)
+{
+	this->points = std::move(other.points);
+	return *this;
+}
+
 // ----------------------------------------------------------------------------
 template <typename T>
 typename xpcc::PointSet2D<T>::SizeType
@@ -67,9 +67,14 @@ namespace xpcc
 		
 		Polygon2D(const Polygon2D& other);
 		
+		Polygon2D(Polygon2D&& other);
+		
 		Polygon2D&
 		operator = (const Polygon2D& other);
 		
+		Polygon2D&
+		operator = (Polygon2D&& other);
+		
 		/// append a point to the polygon
 		Polygon2D&
 		operator << (const Vector<T, 2>& point);
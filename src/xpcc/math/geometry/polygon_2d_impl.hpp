@@ -45,6 +45,12 @@ xpcc::Polygon2D<T>::Polygon2D(const Polygon2D<T>& other) :
 {
 }
 
+template <typename T>
+xpcc::Polygon2D<T>::Polygon2D(Polygon2D<T>&& other) :
+	PointSet2D<T>(std::move(other))
+{
+}
+
 template <typename T>
 xpcc::Polygon2D<T>&
 xpcc::Polygon2D<T>::operator = (const Polygon2D<T>& other)
@@ -53,6 +59,14 @@ xpcc::Polygon2D<T>::operator = (const Polygon2D<T>& other)
 	return *this;
 }
 
+template <typename T>
+xpcc::Polygon2D<T>&
+xpcc::Polygon2D<T>::operator = (Polygon2D<T>&& other)
+{
+	this->points = std::move(other.points);
+	return *this;
+}
+
 // ----------------------------------------------------------------------------
 template <typename T>
 xpcc::Polygon2D<T>&
@@ -34,6 +34,8 @@
 #include <cmath>
 #include <stdint.h>
 
+#include "geometric_traits.hpp"
+
 namespace xpcc
 {
 	// forward declaration
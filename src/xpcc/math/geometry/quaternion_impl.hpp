@@ -65,9 +65,11 @@ xpcc::Quaternion<T>::Quaternion(const Vector<T, 3> &axis, T angle)
 	y(),
 	z()
 {
-	float sinAngleOver2 = std::sin(angle / 2);
+	float sinAngleOver2;
+	float cosAngleOver2;
+	GeometricTraits<T>::Math::sinCos(angle / 2, sinAngleOver2, cosAngleOver2);
 	
-	w = std::cos(angle / 2);
+	w = cosAngleOver2;
 	x = reinterpret_cast<const T*>(&axis)[0]*sinAngleOver2;
 	y = reinterpret_cast<const T*>(&axis)[1]*sinAngleOver2;
 	z = reinterpret_cast<const T*>(&axis)[2]*sinAngleOver2;
@@ -285,7 +287,7 @@ template<class T>
 float
 xpcc::Quaternion<T>::getLength() const
 {
-	return std::sqrt(getLengthSquared());
+	return GeometricTraits<T>::Math::sqrt(getLengthSquared());
 }
 
 // ----------------------------------------------------------------------------
@@ -315,7 +317,13 @@ template<class T>
 xpcc::Quaternion<T>&
 xpcc::Quaternion<T>::normalize()
 {
-	return scale(1.0f);
+	float s = GeometricTraits<T>::Math::invSqrt(getLengthSquared());
+	w *= s;
+	x *= s;
+	y *= s;
+	z *= s;
+	
+	return *this;
 }
 
 // ----------------------------------------------------------------------------
@@ -344,7 +352,9 @@ template<class T>
 xpcc::Quaternion<T>
 xpcc::Quaternion<T>::normalized() const
 {
-	return scaled(1.0f);
+	Quaternion q(*this);
+	q.normalize();
+	return q;
 }
 
 // ----------------------------------------------------------------------------
@@ -45,7 +45,7 @@ namespace xpcc
 		t = math::mul(this->x, this->x);
 		t = math::mac(t, this-> y, this->y);
 		
-		return math::sqrt(t);
+		return GeometricTraits<int16_t>::Math::sqrt(static_cast<uint32_t>(t));
 	}
 
 	template<>
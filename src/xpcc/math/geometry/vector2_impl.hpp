@@ -147,7 +147,7 @@ xpcc::Vector<T, 2>::getLength() const
 	float tx = this->x;
 	float ty = this->y;
 	
-	return GeometricTraits<T>::round(std::sqrt(tx*tx + ty*ty));
+	return GeometricTraits<T>::round(GeometricTraits<T>::Math::sqrt(tx*tx + ty*ty));
 }
 
 // ----------------------------------------------------------------------------
@@ -166,7 +166,8 @@ template<typename T>
 float
 xpcc::Vector<T, 2>::getAngle() const
 {
-	return std::atan2(this->y, this->x);
+	return GeometricTraits<T>::Math::atan2(static_cast<FloatType>(this->y),
+			static_cast<FloatType>(this->x));
 }
 
 // ----------------------------------------------------------------------------
@@ -220,8 +221,9 @@ template<typename T>
 xpcc::Vector<T, 2>&
 xpcc::Vector<T, 2>::rotate(float phi)
 {
-	float c = std::cos(phi);
-	float s = std::sin(phi);
+	float c;
+	float s;
+	GeometricTraits<T>::Math::sinCos(phi, s, c);
 	
 	// without rounding the result might be false for T = integer
 	T tx =    GeometricTraits<T>::round(c * this->x - s * this->y);
@@ -48,6 +48,9 @@ namespace xpcc
 }
 
 #include "interpolation/linear.hpp"
+#include "interpolation/linear_precomputed.hpp"
+#include "interpolation/linear_uniform.hpp"
 #include "interpolation/lagrange.hpp"
+#include "interpolation/lagrange_barycentric.hpp"
 
 #endif	// XPCC__INTERPOLATION_HPP
@@ -0,0 +1,122 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_INTERPOLATION__LAGRANGE_BARYCENTRIC_HPP
+#define	XPCC_INTERPOLATION__LAGRANGE_BARYCENTRIC_HPP
+
+#include <stdint.h>
+
+#include <xpcc/utils/arithmetic_traits.hpp>
+#include <xpcc/container/pair.hpp>
+#include <xpcc/architecture/driver/accessor.hpp>
+
+#include <xpcc/utils/template_metaprogramming.hpp>
+
+namespace xpcc
+{
+	namespace interpolation
+	{
+		/**
+		 * \brief	Lagrange Interpolation in barycentric form
+		 * 
+		 * Calculates the same polynomial as xpcc::interpolation::Lagrange,
+		 * but the barycentric weights are calculated once in the
+		 * constructor. Every interpolation then needs O(N) instead of
+		 * O(N^2) operations.
+		 * 
+		 * Example:
+		 * \code
+		 * typedef xpcc::Pair<float, float> Point;
+		 * 
+		 * // interpolate x^2 over the range of 1 <= x <= 3
+		 * Point points[3] =
+		 * {
+		 *     { 1, 1 },
+		 *     { 2, 4 },
+		 *     { 3, 9 }
+		 * };
+		 * 
+		 * xpcc::interpolation::LagrangeBarycentric<Point, 3> value(points);
+		 * 
+		 * ...
+		 * float output = value.interpolate(1.5f);
+		 * // output => 2.25;
+		 * \endcode
+		 * 
+		 * \see http://en.wikipedia.org/wiki/Lagrange_polynomial#Barycentric_interpolation
+		 * 
+		 * \tparam	T	Any specialization of xpcc::Pair<> with a floating
+		 * 				point type as second template argument.
+		 * \tparam	N	Number of supporting points
+		 * \tparam	Accessor	Accessor class. Can be xpcc::accessor::Ram,
+		 * 						xpcc::accessor::Flash or any self defined
+		 * 						accessor class.
+		 * 						Default is xpcc::accessor::Ram.
+		 * 
+		 * \ingroup	interpolation
+		 */
+		template <typename T,
+				  uint8_t N,
+				  template <typename> class Accessor = ::xpcc::accessor::Ram>
+		class LagrangeBarycentric
+		{
+		public:
+			typedef typename T::FirstType InputType;
+			typedef typename T::SecondType OutputType;
+			
+			XPCC__STATIC_ASSERT(xpcc::ArithmeticTraits<OutputType>::isFloatingPoint, 
+					"Only floating point types are allowed as second type of xpcc::Pair");
+		public:
+			/**
+			 * \brief	Constructor
+			 * 
+			 * \param	supportingPoints	Array of \p N supporting points
+			 */
+			LagrangeBarycentric(Accessor<T> supportingPoints);
+			
+			/**
+			 * \brief	Perform a Lagrange-interpolation
+			 * 
+			 * \param 	value	input value
+			 * \return	interpolated value
+			 */
+			OutputType 
+			interpolate(const InputType& value) const;
+			
+		private:
+			const Accessor<T> supportingPoints;
+			OutputType weight[N];
+		};
+	}
+}
+
+#include "lagrange_barycentric_impl.hpp"
+
+#endif	// XPCC_INTERPOLATION__LAGRANGE_BARYCENTRIC_HPP
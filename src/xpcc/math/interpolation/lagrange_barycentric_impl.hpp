@@ -0,0 +1,85 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_INTERPOLATION__LAGRANGE_BARYCENTRIC_HPP
+   #error "Don't include this file directly. Use 'xpcc/math/interpolation/lagrange_barycentric.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename T,
+		  uint8_t N,
+		  template <typename> class Accessor>
+xpcc::interpolation::LagrangeBarycentric<T, N, Accessor>::LagrangeBarycentric(
+		Accessor<T> supportingPoints) :
+	supportingPoints(supportingPoints)
+{
+	for (uint_fast8_t i = 0; i < N; ++i)
+	{
+		const OutputType xi = static_cast<OutputType>(supportingPoints[i].getFirst());
+		
+		OutputType product = 1;
+		for (uint_fast8_t j = 0; j < N; ++j)
+		{
+			if (i != j) {
+				product *= xi - static_cast<OutputType>(supportingPoints[j].getFirst());
+			}
+		}
+		this->weight[i] = 1 / product;
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <typename T,
+		  uint8_t N,
+		  template <typename> class Accessor>
+typename xpcc::interpolation::LagrangeBarycentric<T, N, Accessor>::OutputType
+xpcc::interpolation::LagrangeBarycentric<T, N, Accessor>::interpolate(
+		const InputType& value) const
+{
+	OutputType numerator = 0;
+	OutputType denominator = 0;
+	for (uint_fast8_t i = 0; i < N; ++i)
+	{
+		const T point(this->supportingPoints[i]);
+		const OutputType difference = static_cast<OutputType>(value) -
+				static_cast<OutputType>(point.getFirst());
+		
+		if (difference == 0) {
+			// exactly on a supporting point, the formula would divide by zero
+			return point.getSecond();
+		}
+		
+		const OutputType t = this->weight[i] / difference;
+		numerator += t * point.getSecond();
+		denominator += t;
+	}
+	
+	return numerator / denominator;
+}
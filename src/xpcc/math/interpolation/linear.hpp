@@ -32,6 +32,7 @@
 #define	XPCC_INTERPOLATION__LINEAR_HPP
 
 #include <stdint.h>
+#include <cstddef>
 
 #include <xpcc/utils/arithmetic_traits.hpp>
 #include <xpcc/container/pair.hpp>
@@ -97,6 +98,11 @@ namespace xpcc
 		 * int16_t b = value.interpolate(a);
 		 * \endcode
 		 * 
+		 * The supporting points have to be sorted by their input value. The
+		 * segment containing the input value is found by a binary search.
+		 * 
+		 * \see		LinearPrecomputed, LinearUniform
+		 * 
 		 * \tparam	T			Any specialization of xpcc::Pair<>
 		 * \tparam	Accessor	Accessor class. Can be xpcc::accessor::Ram,
 		 * 						xpcc::accessor::Flash or any self defined
@@ -135,7 +141,63 @@ namespace xpcc
 			OutputType 
 			interpolate(const InputType& value) const;
 			
-		private:
+			/**
+			 * \brief	Interpolate a block of values
+			 * 
+			 * Consecutive values of a stream of samples usually lie in the
+			 * same segment. Therefore the segment of the previous value is
+			 * checked first before searching again.
+			 * 
+			 * \param	input	input values
+			 * \param	output	interpolated values, may be the same as
+			 * 					\p input if the types are equal
+			 * \param	n		number of values
+			 */
+			void
+			interpolate(const InputType *input, OutputType *output, std::size_t n) const;
+			
+		protected:
+			/**
+			 * \brief	Find the first supporting point with an input value
+			 * 			greater than or equal to \p value
+			 * 
+			 * \return	Index of the supporting point. \c 0 if \p value is
+			 * 			before the first point and \c numberOfPoints if
+			 * 			\p value is behind the last point.
+			 */
+			uint8_t
+			findSegment(const InputType& value) const;
+			
+			/// Check if \p value lies between the points index-1 and index
+			bool
+			isInSegment(const InputType& value, uint8_t index) const;
+			
+			/// Interpolate between the points index-1 and index
+			OutputType
+			interpolateSegment(const InputType& value, uint8_t index) const;
+			
+			/**
+			 * \brief	Interpolation shared with the derived classes
+			 * 
+			 * Values outside of the supporting points are clamped to the
+			 * first or last point, the segments in between are calculated
+			 * by \p interpolator.interpolateSegment().
+			 */
+			template <typename Interpolator>
+			OutputType
+			interpolateWith(const Interpolator& interpolator,
+					const InputType& value) const;
+			
+			template <typename Interpolator>
+			void
+			interpolateWith(const Interpolator& interpolator,
+					const InputType *input, OutputType *output, std::size_t n) const;
+			
+			template <typename Interpolator>
+			OutputType
+			interpolateWith(const Interpolator& interpolator,
+					const InputType& value, uint8_t index) const;
+			
 			const Accessor<T> supportingPoints;
 			const uint8_t numberOfPoints; 
 		};
@@ -47,36 +47,117 @@ template <typename T,
 typename xpcc::interpolation::Linear<T, Accessor>::OutputType
 xpcc::interpolation::Linear<T, Accessor>::interpolate(const InputType& value) const
 {
-	T current(this->supportingPoints[0]);
-	
-	if (value <= current.getFirst()) {
-		return current.getSecond();
+	return this->interpolateWith(*this, value);
+}
+
+template <typename T,
+		  template <typename> class Accessor>
+void
+xpcc::interpolation::Linear<T, Accessor>::interpolate(
+		const InputType *input, OutputType *output, std::size_t n) const
+{
+	this->interpolateWith(*this, input, output, n);
+}
+
+// ----------------------------------------------------------------------------
+template <typename T,
+		  template <typename> class Accessor>
+template <typename Interpolator>
+typename xpcc::interpolation::Linear<T, Accessor>::OutputType
+xpcc::interpolation::Linear<T, Accessor>::interpolateWith(
+		const Interpolator& interpolator, const InputType& value) const
+{
+	return this->interpolateWith(interpolator, value, this->findSegment(value));
+}
+
+template <typename T,
+		  template <typename> class Accessor>
+template <typename Interpolator>
+void
+xpcc::interpolation::Linear<T, Accessor>::interpolateWith(
+		const Interpolator& interpolator,
+		const InputType *input, OutputType *output, std::size_t n) const
+{
+	uint8_t index = 0;
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		const InputType value = input[i];
+		if (!this->isInSegment(value, index)) {
+			index = this->findSegment(value);
+		}
+		output[i] = this->interpolateWith(interpolator, value, index);
+	}
+}
+
+template <typename T,
+		  template <typename> class Accessor>
+template <typename Interpolator>
+typename xpcc::interpolation::Linear<T, Accessor>::OutputType
+xpcc::interpolation::Linear<T, Accessor>::interpolateWith(
+		const Interpolator& interpolator, const InputType& value,
+		uint8_t index) const
+{
+	if (index == 0) {
+		return this->supportingPoints[0].getSecond();
+	}
+	else if (index >= this->numberOfPoints) {
+		return this->supportingPoints[this->numberOfPoints - 1].getSecond();
 	}
 	
-	T last(current);
-	uint8_t i;
-	for (i = 1; i < this->numberOfPoints; ++i)
+	return interpolator.interpolateSegment(value, index);
+}
+
+// ----------------------------------------------------------------------------
+template <typename T,
+		  template <typename> class Accessor>
+uint8_t
+xpcc::interpolation::Linear<T, Accessor>::findSegment(const InputType& value) const
+{
+	uint_fast8_t low = 0;
+	uint_fast8_t high = this->numberOfPoints;
+	while (low < high)
 	{
-		current = this->supportingPoints[i];
-		
-		if (value <= current.getFirst())
-		{
-			InputType x1_in = last.getFirst();
-			InputType x2_in = current.getFirst();
-			
-			OutputType x1_out = last.getSecond();
-			OutputType x2_out = current.getSecond();
-			
-			InputType a = value - x1_in;		// >0
-			WideType b = static_cast<OutputSignedType>(x2_out) - 
-						 static_cast<OutputSignedType>(x1_out);
-			InputType c = x2_in - x1_in;		// >0
-			
-			return static_cast<OutputType>(((a * b) / c) + x1_out);
+		uint_fast8_t middle = (low + high) / 2;
+		if (this->supportingPoints[middle].getFirst() < value) {
+			low = middle + 1;
+		}
+		else {
+			high = middle;
 		}
-		
-		last = current;
 	}
+	return low;
+}
+
+template <typename T,
+		  template <typename> class Accessor>
+bool
+xpcc::interpolation::Linear<T, Accessor>::isInSegment(
+		const InputType& value, uint8_t index) const
+{
+	return (index > 0 && index < this->numberOfPoints &&
+			this->supportingPoints[index - 1].getFirst() < value &&
+			value <= this->supportingPoints[index].getFirst());
+}
+
+template <typename T,
+		  template <typename> class Accessor>
+typename xpcc::interpolation::Linear<T, Accessor>::OutputType
+xpcc::interpolation::Linear<T, Accessor>::interpolateSegment(
+		const InputType& value, uint8_t index) const
+{
+	const T last(this->supportingPoints[index - 1]);
+	const T current(this->supportingPoints[index]);
+	
+	InputType x1_in = last.getFirst();
+	InputType x2_in = current.getFirst();
+	
+	OutputType x1_out = last.getSecond();
+	OutputType x2_out = current.getSecond();
+	
+	InputType a = value - x1_in;		// >0
+	WideType b = static_cast<OutputSignedType>(x2_out) - 
+				 static_cast<OutputSignedType>(x1_out);
+	InputType c = x2_in - x1_in;		// >0
 	
-	return current.getSecond();
+	return static_cast<OutputType>(((a * b) / c) + x1_out);
 }
@@ -0,0 +1,132 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_INTERPOLATION__LINEAR_PRECOMPUTED_HPP
+#define	XPCC_INTERPOLATION__LINEAR_PRECOMPUTED_HPP
+
+#include <xpcc/utils/template_metaprogramming.hpp>
+
+#include "linear.hpp"
+
+namespace xpcc
+{
+	namespace interpolation
+	{
+		/**
+		 * \brief	Linear interpolation with precomputed slopes
+		 * 
+		 * Works like xpcc::interpolation::Linear but calculates the slope
+		 * of every segment in the constructor. An interpolation then needs
+		 * a multiplication instead of a division, at the cost of
+		 * N-1 slopes in RAM.
+		 * 
+		 * The slopes are stored as \c float for integer output types.
+		 * Because of the rounding of the slope the result may differ by
+		 * one from xpcc::interpolation::Linear for these types.
+		 * 
+		 * Example:
+		 * \code
+		 * typedef xpcc::Pair<uint16_t, int16_t> Point;
+		 * 
+		 * FLASH_STORAGE(Point supportingPoints[4]) =
+		 * {
+		 *     {    0, -400 },
+		 *     {  800,    0 },
+		 *     { 2000, 1200 },
+		 *     { 4095, 1500 }
+		 * };
+		 * 
+		 * xpcc::interpolation::LinearPrecomputed<Point, 4, xpcc::accessor::Flash>
+		 *         temperature(xpcc::accessor::asFlash(supportingPoints));
+		 * 
+		 * int16_t t = temperature.interpolate(adcValue);
+		 * \endcode
+		 * 
+		 * \tparam	T			Any specialization of xpcc::Pair<>
+		 * \tparam	N			Number of supporting points
+		 * \tparam	Accessor	Accessor class, see
+		 * 						xpcc::interpolation::Linear
+		 * 
+		 * \ingroup	interpolation
+		 */
+		template <typename T,
+				  uint8_t N,
+				  template <typename> class Accessor = ::xpcc::accessor::Ram>
+		class LinearPrecomputed : public Linear<T, Accessor>
+		{
+		public:
+			typedef typename Linear<T, Accessor>::InputType InputType;
+			typedef typename Linear<T, Accessor>::OutputType OutputType;
+			typedef typename Linear<T, Accessor>::WideType WideType;
+			
+			typedef typename xpcc::tmp::Select<
+					ArithmeticTraits<OutputType>::isFloatingPoint,
+					OutputType,
+					float >::Result SlopeType;
+			
+		public:
+			/**
+			 * \brief	Constructor
+			 * 
+			 * \param	supportingPoints	Array of \p N supporting points
+			 */
+			LinearPrecomputed(Accessor<T> supportingPoints);
+			
+			/**
+			 * \brief	Perform a linear interpolation
+			 * 
+			 * \param 	value	input value
+			 * \return	interpolated value
+			 */
+			OutputType 
+			interpolate(const InputType& value) const;
+			
+			/**
+			 * \brief	Interpolate a block of values
+			 * 
+			 * \see		Linear::interpolate(const InputType*, OutputType*, std::size_t)
+			 */
+			void
+			interpolate(const InputType *input, OutputType *output, std::size_t n) const;
+			
+		private:
+			friend class Linear<T, Accessor>;
+			
+			OutputType
+			interpolateSegment(const InputType& value, uint8_t index) const;
+			
+			SlopeType slope[N - 1];
+		};
+	}
+}
+
+#include "linear_precomputed_impl.hpp"
+
+#endif	// XPCC_INTERPOLATION__LINEAR_PRECOMPUTED_HPP
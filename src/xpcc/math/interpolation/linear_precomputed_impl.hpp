@@ -0,0 +1,93 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_INTERPOLATION__LINEAR_PRECOMPUTED_HPP
+   #error "Don't include this file directly. Use 'xpcc/math/interpolation/linear_precomputed.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename T,
+		  uint8_t N,
+		  template <typename> class Accessor>
+xpcc::interpolation::LinearPrecomputed<T, N, Accessor>::LinearPrecomputed(
+		Accessor<T> supportingPoints) :
+	Linear<T, Accessor>(supportingPoints, N)
+{
+	T last(supportingPoints[0]);
+	for (uint_fast8_t i = 0; i < N - 1; ++i)
+	{
+		T current(supportingPoints[i + 1]);
+		
+		this->slope[i] =
+				(static_cast<SlopeType>(current.getSecond()) -
+				 static_cast<SlopeType>(last.getSecond())) /
+				(static_cast<SlopeType>(current.getFirst()) -
+				 static_cast<SlopeType>(last.getFirst()));
+		
+		last = current;
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <typename T,
+		  uint8_t N,
+		  template <typename> class Accessor>
+typename xpcc::interpolation::LinearPrecomputed<T, N, Accessor>::OutputType
+xpcc::interpolation::LinearPrecomputed<T, N, Accessor>::interpolate(
+		const InputType& value) const
+{
+	return this->interpolateWith(*this, value);
+}
+
+template <typename T,
+		  uint8_t N,
+		  template <typename> class Accessor>
+void
+xpcc::interpolation::LinearPrecomputed<T, N, Accessor>::interpolate(
+		const InputType *input, OutputType *output, std::size_t n) const
+{
+	this->interpolateWith(*this, input, output, n);
+}
+
+// ----------------------------------------------------------------------------
+template <typename T,
+		  uint8_t N,
+		  template <typename> class Accessor>
+typename xpcc::interpolation::LinearPrecomputed<T, N, Accessor>::OutputType
+xpcc::interpolation::LinearPrecomputed<T, N, Accessor>::interpolateSegment(
+		const InputType& value, uint8_t index) const
+{
+	const T last(this->supportingPoints[index - 1]);
+	
+	SlopeType offset = this->slope[index - 1] *
+			static_cast<SlopeType>(value - last.getFirst());
+	
+	return static_cast<OutputType>(static_cast<WideType>(offset) + last.getSecond());
+}
@@ -0,0 +1,132 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_INTERPOLATION__LINEAR_UNIFORM_HPP
+#define	XPCC_INTERPOLATION__LINEAR_UNIFORM_HPP
+
+#include <stdint.h>
+#include <cstddef>
+
+#include <xpcc/utils/arithmetic_traits.hpp>
+#include <xpcc/architecture/driver/accessor.hpp>
+#include <xpcc/utils/template_metaprogramming.hpp>
+
+namespace xpcc
+{
+	namespace interpolation
+	{
+		/**
+		 * \brief	Linear interpolation on a uniform grid
+		 * 
+		 * The supporting points are spaced 2^Shift apart, starting at
+		 * \p start. Only the output values have to be stored. The segment
+		 * is found by a shift and the interpolation divides by a power of
+		 * two, so neither a search nor a real division is needed.
+		 * 
+		 * The results are identical to xpcc::interpolation::Linear with
+		 * the same supporting points.
+		 * 
+		 * Example:
+		 * \code
+		 * // Output values for the inputs 0, 256, 512, ..., 4096
+		 * FLASH_STORAGE(int16_t table[17]) =
+		 * {
+		 *     -400, -310, -225, ...
+		 * };
+		 * 
+		 * xpcc::interpolation::LinearUniform<uint16_t, int16_t, 8, xpcc::accessor::Flash>
+		 *         temperature(0, xpcc::accessor::asFlash(table), 17);
+		 * 
+		 * int16_t t = temperature.interpolate(adcValue);
+		 * \endcode
+		 * 
+		 * \tparam	InputType	Integer type of the input values
+		 * \tparam	OutputType	Type of the output values
+		 * \tparam	Shift		Distance of the supporting points is 2^Shift
+		 * \tparam	Accessor	Accessor class, see
+		 * 						xpcc::interpolation::Linear
+		 * 
+		 * \ingroup	interpolation
+		 */
+		template <typename InputType,
+				  typename OutputType,
+				  uint8_t Shift,
+				  template <typename> class Accessor = ::xpcc::accessor::Ram>
+		class LinearUniform
+		{
+		public:
+			typedef typename ArithmeticTraits< InputType >::UnsignedType InputUnsignedType;
+			typedef typename ArithmeticTraits< OutputType >::SignedType OutputSignedType;
+			typedef typename ArithmeticTraits< OutputSignedType >::WideType WideType;
+			
+			XPCC__STATIC_ASSERT(ArithmeticTraits<InputType>::isInteger,
+					"Only integer types are allowed as input type");
+			
+		public:
+			/**
+			 * \brief	Constructor
+			 * 
+			 * \param	start			Input value of the first point
+			 * \param	values			Output values of the supporting points
+			 * \param	numberOfValues	length of \p values
+			 */
+			LinearUniform(InputType start, Accessor<OutputType> values,
+					std::size_t numberOfValues);
+			
+			/**
+			 * \brief	Perform a linear interpolation
+			 * 
+			 * \param 	value	input value
+			 * \return	interpolated value
+			 */
+			OutputType
+			interpolate(const InputType& value) const;
+			
+			/**
+			 * \brief	Interpolate a block of values
+			 * 
+			 * \param	input	input values
+			 * \param	output	interpolated values
+			 * \param	n		number of values
+			 */
+			void
+			interpolate(const InputType *input, OutputType *output, std::size_t n) const;
+			
+		private:
+			const InputType start;
+			const Accessor<OutputType> values;
+			const std::size_t numberOfValues;
+		};
+	}
+}
+
+#include "linear_uniform_impl.hpp"
+
+#endif	// XPCC_INTERPOLATION__LINEAR_UNIFORM_HPP
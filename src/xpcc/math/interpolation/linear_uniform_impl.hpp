@@ -0,0 +1,89 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_INTERPOLATION__LINEAR_UNIFORM_HPP
+   #error "Don't include this file directly. Use 'xpcc/math/interpolation/linear_uniform.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename InputType,
+		  typename OutputType,
+		  uint8_t Shift,
+		  template <typename> class Accessor>
+xpcc::interpolation::LinearUniform<InputType, OutputType, Shift, Accessor>::LinearUniform(
+		InputType start, Accessor<OutputType> values, std::size_t numberOfValues) :
+	start(start), values(values), numberOfValues(numberOfValues)
+{
+}
+
+// ----------------------------------------------------------------------------
+template <typename InputType,
+		  typename OutputType,
+		  uint8_t Shift,
+		  template <typename> class Accessor>
+OutputType
+xpcc::interpolation::LinearUniform<InputType, OutputType, Shift, Accessor>::interpolate(
+		const InputType& value) const
+{
+	if (value <= this->start) {
+		return this->values[0];
+	}
+	
+	const InputUnsignedType offset = value - this->start;
+	const std::size_t index = offset >> Shift;
+	if (index >= this->numberOfValues - 1) {
+		return this->values[this->numberOfValues - 1];
+	}
+	
+	const InputUnsignedType a = offset & ((static_cast<InputUnsignedType>(1) << Shift) - 1);
+	
+	const OutputType x1_out = this->values[index];
+	const OutputType x2_out = this->values[index + 1];
+	WideType b = static_cast<OutputSignedType>(x2_out) -
+				 static_cast<OutputSignedType>(x1_out);
+	
+	// signed division by a constant power of two, the compiler replaces it
+	// by a shift but keeps the rounding of xpcc::interpolation::Linear.
+	return static_cast<OutputType>(
+			((static_cast<WideType>(a) * b) / static_cast<WideType>(1UL << Shift)) + x1_out);
+}
+
+template <typename InputType,
+		  typename OutputType,
+		  uint8_t Shift,
+		  template <typename> class Accessor>
+void
+xpcc::interpolation::LinearUniform<InputType, OutputType, Shift, Accessor>::interpolate(
+		const InputType *input, OutputType *output, std::size_t n) const
+{
+	for (std::size_t i = 0; i < n; ++i) {
+		output[i] = this->interpolate(input[i]);
+	}
+}
@@ -29,6 +29,7 @@
 // ----------------------------------------------------------------------------
 
 #include <xpcc/math/interpolation/lagrange.hpp>
+#include <xpcc/math/interpolation/lagrange_barycentric.hpp>
 
 #include "lagrange_interpolation_test.hpp"
 
@@ -70,4 +71,43 @@ LagrangeInterpolationTest::testInterpolation()
 	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(3.5f), 12.25f);
 }
 
-
+void 
+LagrangeInterpolationTest::testBarycentric()
+{
+	typedef xpcc::Pair<float, float> Point;
+	
+	Point square[3] =
+	{
+		{ 1, 1 },
+		{ 2, 4 },
+		{ 3, 9 }
+	};
+	
+	xpcc::interpolation::LagrangeBarycentric<Point, 3> value(square);
+	
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(1.f),   1.f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(1.5f),  2.25f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(2.f),   4.f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(2.5f),  6.25f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(3.f),   9.f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(3.5f), 12.25f);
+	
+	// same polynomial as the classic form
+	typedef xpcc::Pair<int8_t, float> IntegerPoint;
+	
+	IntegerPoint points[5] =
+	{
+		{ -4,  2.f },
+		{ -1, -1.f },
+		{  0,  0.5f },
+		{  3,  1.f },
+		{  5, -2.f }
+	};
+	
+	xpcc::interpolation::Lagrange<IntegerPoint> classic(points, 5);
+	xpcc::interpolation::LagrangeBarycentric<IntegerPoint, 5> barycentric(points);
+	
+	for (int8_t x = -6; x <= 7; ++x) {
+		TEST_ASSERT_EQUALS_DELTA(barycentric.interpolate(x), classic.interpolate(x), 1e-4f);
+	}
+}
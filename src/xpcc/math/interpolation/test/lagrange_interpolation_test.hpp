@@ -37,6 +37,9 @@ struct LagrangeInterpolationTest : public unittest::TestSuite
 	
 	void
 	testInterpolation();
+	
+	void
+	testBarycentric();
 };
 
 
@@ -29,6 +29,8 @@
 // ----------------------------------------------------------------------------
 
 #include <xpcc/math/interpolation/linear.hpp>
+#include <xpcc/math/interpolation/linear_precomputed.hpp>
+#include <xpcc/math/interpolation/linear_uniform.hpp>
 
 #include "linear_interpolation_test.hpp"
 
@@ -91,3 +93,172 @@ LinearInterpolationTest::testInterpolationFlash()
 	TEST_ASSERT_EQUALS(value.interpolate(230), 20000);
 	TEST_ASSERT_EQUALS(value.interpolate(250), 20000);
 }
+
+// ----------------------------------------------------------------------------
+namespace
+{
+	typedef xpcc::Pair<int16_t, int16_t> Point;
+	
+	// x^2 / 64 starting at -640, the supporting points are 40 apart
+	void
+	createPoints(Point *points, uint8_t n)
+	{
+		for (uint8_t i = 0; i < n; ++i)
+		{
+			int16_t x = -640 + 40 * i;
+			Point point = { x, static_cast<int16_t>((int32_t(x) * x) / 64) };
+			points[i] = point;
+		}
+	}
+	
+	// Linear search as reference
+	int16_t
+	reference(const Point *points, uint8_t n, int16_t value)
+	{
+		if (value <= points[0].getFirst()) {
+			return points[0].getSecond();
+		}
+		for (uint8_t i = 1; i < n; ++i)
+		{
+			if (value <= points[i].getFirst())
+			{
+				int32_t a = value - points[i - 1].getFirst();
+				int32_t b = points[i].getSecond() - points[i - 1].getSecond();
+				int32_t c = points[i].getFirst() - points[i - 1].getFirst();
+				return (a * b) / c + points[i - 1].getSecond();
+			}
+		}
+		return points[n - 1].getSecond();
+	}
+}
+
+void
+LinearInterpolationTest::testManyPoints()
+{
+	Point points[33];
+	
+	for (uint8_t n = 1; n <= 33; ++n)
+	{
+		createPoints(points, n);
+		xpcc::interpolation::Linear<Point> value(points, n);
+		
+		for (int16_t x = -700; x <= 700; x += 7) {
+			TEST_ASSERT_EQUALS(value.interpolate(x), reference(points, n, x));
+		}
+		for (uint8_t i = 0; i < n; ++i) {
+			TEST_ASSERT_EQUALS(value.interpolate(points[i].getFirst()), points[i].getSecond());
+		}
+	}
+}
+
+void
+LinearInterpolationTest::testBlock()
+{
+	Point points[33];
+	createPoints(points, 33);
+	
+	xpcc::interpolation::Linear<Point> value(points, 33);
+	
+	// ascending, descending and jumping input values
+	int16_t input[300];
+	for (int16_t i = 0; i < 100; ++i) {
+		input[i] = -700 + 14 * i;
+		input[100 + i] = 700 - 13 * i;
+		input[200 + i] = (i & 1) ? (-650 + 11 * i) : (650 - 11 * i);
+	}
+	
+	int16_t output[300];
+	value.interpolate(input, output, 300);
+	
+	for (int16_t i = 0; i < 300; ++i) {
+		TEST_ASSERT_EQUALS(output[i], value.interpolate(input[i]));
+	}
+}
+
+void
+LinearInterpolationTest::testPrecomputed()
+{
+	Point points[33];
+	createPoints(points, 33);
+	
+	xpcc::interpolation::Linear<Point> linear(points, 33);
+	xpcc::interpolation::LinearPrecomputed<Point, 33> precomputed(points);
+	
+	int16_t input[201];
+	for (int16_t x = -700; x <= 700; x += 7)
+	{
+		// may differ by one because of the rounding of the slope
+		TEST_ASSERT_EQUALS_DELTA(precomputed.interpolate(x), linear.interpolate(x), 1);
+		input[(x + 700) / 7] = x;
+	}
+	for (uint8_t i = 0; i < 33; ++i) {
+		TEST_ASSERT_EQUALS(precomputed.interpolate(points[i].getFirst()), points[i].getSecond());
+	}
+	
+	int16_t output[201];
+	precomputed.interpolate(input, output, 201);
+	for (uint8_t i = 0; i < 201; ++i) {
+		TEST_ASSERT_EQUALS(output[i], precomputed.interpolate(input[i]));
+	}
+	
+	// floating point output
+	typedef xpcc::Pair<uint8_t, float> FloatPoint;
+	FloatPoint floatPoints[3] =
+	{
+		{  10, -50.f },
+		{  50,   0.f },
+		{ 100,  25.f }
+	};
+	
+	xpcc::interpolation::LinearPrecomputed<FloatPoint, 3> value(floatPoints);
+	
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(  0), -50.f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate( 30), -25.f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate( 75),  12.5f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(101),  25.f);
+}
+
+FLASH_STORAGE(int16_t uniformValues[9]) =
+{
+	-200, -100, 0, 400, 350, 350, 1000, -30000, 30000
+};
+
+void
+LinearInterpolationTest::testUniform()
+{
+	// supporting points at -100, -68, -36, ..., 156
+	Point points[9];
+	for (uint8_t i = 0; i < 9; ++i) {
+		Point point = { static_cast<int16_t>(-100 + 32 * i), uniformValues[i] };
+		points[i] = point;
+	}
+	
+	xpcc::interpolation::Linear<Point> linear(points, 9);
+	xpcc::interpolation::LinearUniform<int16_t, int16_t, 5, xpcc::accessor::Flash>
+			uniform(-100, xpcc::accessor::asFlash(uniformValues), 9);
+	
+	int16_t input[400];
+	for (int16_t x = -200; x < 200; ++x)
+	{
+		TEST_ASSERT_EQUALS(uniform.interpolate(x), linear.interpolate(x));
+		input[x + 200] = x;
+	}
+	
+	int16_t output[400];
+	uniform.interpolate(input, output, 400);
+	for (int16_t i = 0; i < 400; ++i) {
+		TEST_ASSERT_EQUALS(output[i], linear.interpolate(input[i]));
+	}
+	
+	// unsigned input, e.g. the value of an ADC
+	xpcc::interpolation::LinearUniform<uint16_t, int16_t, 9, xpcc::accessor::Flash>
+			adc(0, xpcc::accessor::asFlash(uniformValues), 9);
+	
+	TEST_ASSERT_EQUALS(adc.interpolate(0), -200);
+	TEST_ASSERT_EQUALS(adc.interpolate(256), -150);
+	TEST_ASSERT_EQUALS(adc.interpolate(1024), 0);
+	TEST_ASSERT_EQUALS(adc.interpolate(1280), 200);
+	TEST_ASSERT_EQUALS(adc.interpolate(4095), 29882);
+	TEST_ASSERT_EQUALS(adc.interpolate(4096), 30000);
+	TEST_ASSERT_EQUALS(adc.interpolate(65535), 30000);
+}
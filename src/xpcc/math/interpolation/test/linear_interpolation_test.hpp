@@ -37,5 +37,17 @@ struct LinearInterpolationTest : public unittest::TestSuite
 	
 	void
 	testInterpolationFlash();
+	
+	void
+	testManyPoints();
+	
+	void
+	testBlock();
+	
+	void
+	testPrecomputed();
+	
+	void
+	testUniform();
 };
 
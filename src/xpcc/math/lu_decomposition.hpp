@@ -75,6 +75,48 @@ namespace xpcc
 				const Matrix<T, N, N> &u,
 				Matrix<T, BXWIDTH, N> *xb);
 		
+		/**
+		 * \brief	In-place decomposition with partial pivoting
+		 * 
+		 * Afterwards \p lu contains U in the upper triangle (including
+		 * the diagonal) and L without its unit diagonal in the lower
+		 * triangle. No further matrices are needed.
+		 * 
+		 * \param[in,out]	lu		Matrix A, replaced by L and U
+		 * \param[out]		pivot	Row k was exchanged with row pivot[k]
+		 * \return	\c false if the matrix is singular
+		 */
+		template <typename T, uint8_t N>
+		static bool
+		decompose(Matrix<T, N, N> *lu, Vector<int8_t, N> *pivot);
+		
+		/**
+		 * \brief	Solve A*X = B with a decomposition from
+		 * 			decompose(Matrix *lu, Vector *pivot)
+		 * 
+		 * \param		lu		Decomposed matrix A
+		 * \param		pivot	Row exchanges of the decomposition
+		 * \param[in,out]	b	Right hand sides (one per column), replaced
+		 * 						by the solution X
+		 */
+		template <typename T, uint8_t N, uint8_t M>
+		static void
+		solve(const Matrix<T, N, N> &lu,
+				const Vector<int8_t, N> &pivot,
+				Matrix<T, N, M> *b);
+		
+		/**
+		 * \brief	Solve A*X = B in place
+		 * 
+		 * \p a is replaced by its decomposition and \p b by the
+		 * solution X.
+		 * 
+		 * \return	\c false if A is singular, \p b is undefined then
+		 */
+		template <typename T, uint8_t N, uint8_t M>
+		static bool
+		solve(Matrix<T, N, N> *a, Matrix<T, N, M> *b);
+		
 	private:
 		template<typename T, uint8_t OFFSET, uint8_t WIDTH, uint8_t HEIGHT>
 		class LUSubDecomposition
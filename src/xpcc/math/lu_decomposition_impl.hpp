@@ -75,6 +75,150 @@ xpcc::LUDecomposition::solve(
 	return LUSubDecomposition<T, 0, SIZE, SIZE>::solve(l, u, xb);
 }
 
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t SIZE>
+bool
+xpcc::LUDecomposition::decompose(
+		xpcc::Matrix<T, SIZE, SIZE> *lu,
+		xpcc::Vector<int8_t, SIZE> *pivot)
+{
+	T *a = lu->ptr();
+	
+	for (uint_fast8_t k = 0; k < SIZE; ++k)
+	{
+		// find the row with the largest absolute value in this column
+		uint_fast8_t maxRow = k;
+		T max = (a[k*SIZE + k] < 0) ? -a[k*SIZE + k] : a[k*SIZE + k];
+		for (uint_fast8_t i = k + 1; i < SIZE; ++i)
+		{
+			T v = (a[i*SIZE + k] < 0) ? -a[i*SIZE + k] : a[i*SIZE + k];
+			if (v > max)
+			{
+				max = v;
+				maxRow = i;
+			}
+		}
+		
+		(*pivot)[k] = maxRow;
+		if (max == 0) {
+			return false;
+		}
+		
+		if (maxRow != k)
+		{
+			for (uint_fast8_t j = 0; j < SIZE; ++j)
+			{
+				T temp = a[k*SIZE + j];
+				a[k*SIZE + j] = a[maxRow*SIZE + j];
+				a[maxRow*SIZE + j] = temp;
+			}
+		}
+		
+		const T *pivotRow = &a[k*SIZE];
+		const T factor = T(1) / pivotRow[k];
+		for (uint_fast8_t i = k + 1; i < SIZE; ++i)
+		{
+			T *row = &a[i*SIZE];
+			const T l = row[k] * factor;
+			row[k] = l;
+			for (uint_fast8_t j = k + 1; j < SIZE; ++j) {
+				row[j] -= l * pivotRow[j];
+			}
+		}
+	}
+	
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t SIZE, uint8_t M>
+void
+xpcc::LUDecomposition::solve(
+		const xpcc::Matrix<T, SIZE, SIZE> &lu,
+		const xpcc::Vector<int8_t, SIZE> &pivot,
+		xpcc::Matrix<T, SIZE, M> *b)
+{
+	const T *a = lu.ptr();
+	T *x = b->ptr();
+	
+	// apply the row exchanges to B
+	for (uint_fast8_t k = 0; k < SIZE; ++k)
+	{
+		const uint_fast8_t p = static_cast<uint8_t>(pivot[k]);
+		if (p != k)
+		{
+			for (uint_fast8_t j = 0; j < M; ++j)
+			{
+				T temp = x[k*M + j];
+				x[k*M + j] = x[p*M + j];
+				x[p*M + j] = temp;
+			}
+		}
+	}
+	
+	// The rows are accumulated in a local copy, which cannot alias the
+	// other rows of X. This lets the compiler keep it in registers.
+	T sum[M];
+	
+	// forward substitution: L*Y = B (L has a unit diagonal)
+	for (uint_fast8_t i = 1; i < SIZE; ++i)
+	{
+		T *row = &x[i*M];
+		for (uint_fast8_t j = 0; j < M; ++j) {
+			sum[j] = row[j];
+		}
+		for (uint_fast8_t k = 0; k < i; ++k)
+		{
+			const T l = a[i*SIZE + k];
+			const T *other = &x[k*M];
+			for (uint_fast8_t j = 0; j < M; ++j) {
+				sum[j] -= l * other[j];
+			}
+		}
+		for (uint_fast8_t j = 0; j < M; ++j) {
+			row[j] = sum[j];
+		}
+	}
+	
+	// backward substitution: U*X = Y
+	for (uint_fast8_t i = SIZE; i-- > 0; )
+	{
+		T *row = &x[i*M];
+		for (uint_fast8_t j = 0; j < M; ++j) {
+			sum[j] = row[j];
+		}
+		for (uint_fast8_t k = i + 1; k < SIZE; ++k)
+		{
+			const T u = a[i*SIZE + k];
+			const T *other = &x[k*M];
+			for (uint_fast8_t j = 0; j < M; ++j) {
+				sum[j] -= u * other[j];
+			}
+		}
+		
+		const T factor = T(1) / a[i*SIZE + i];
+		for (uint_fast8_t j = 0; j < M; ++j) {
+			row[j] = sum[j] * factor;
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t SIZE, uint8_t M>
+bool
+xpcc::LUDecomposition::solve(
+		xpcc::Matrix<T, SIZE, SIZE> *a,
+		xpcc::Matrix<T, SIZE, M> *b)
+{
+	xpcc::Vector<int8_t, SIZE> pivot;
+	if (!decompose(a, &pivot)) {
+		return false;
+	}
+	
+	solve(*a, pivot, b);
+	return true;
+}
+
 //=============================================================================
 // PRIVATE CLASS xpcc::LUDecomposition::RowOperation
 //=============================================================================
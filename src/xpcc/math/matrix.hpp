@@ -46,6 +46,35 @@
 
 namespace xpcc
 {
+	/**
+	 * \internal
+	 * \brief	Compile-time unrolled dot product
+	 * 
+	 * Multiplies N elements of \p row with every STRIDE-th element of
+	 * \p column. The summation order is the same as for a simple loop.
+	 */
+	template<typename T, uint8_t N, uint8_t STRIDE>
+	struct MatrixDotProduct
+	{
+		static inline T
+		calculate(const T *row, const T *column)
+		{
+			return MatrixDotProduct<T, N - 1, STRIDE>::calculate(row, column) +
+					row[N - 1] * column[(N - 1) * STRIDE];
+		}
+	};
+	
+	/// \internal
+	template<typename T, uint8_t STRIDE>
+	struct MatrixDotProduct<T, 1, STRIDE>
+	{
+		static inline T
+		calculate(const T *row, const T *column)
+		{
+			return row[0] * column[0];
+		}
+	};
+	
 	/**
 	 * \brief	Class for handling common matrix operations
 	 * 
@@ -173,9 +202,14 @@ namespace xpcc
 		/// Matrix multiplication with matrices with the same size
 		Matrix operator *= (const Matrix &rhs);
 		
-		/// Matrix multiplication with different size matrices
+		/**
+		 * \brief	Matrix multiplication with different size matrices
+		 * 
+		 * The inner products are unrolled at compile time and
+		 * accumulated in registers.
+		 */
 		template<uint8_t RHSCOL>
-		Matrix<T, ROWS, ROWS>
+		Matrix<T, ROWS, RHSCOL>
 		operator * (const Matrix<T, COLUMNS, RHSCOL> &rhs) const;
 		
 		Matrix<T, COLUMNS, ROWS>
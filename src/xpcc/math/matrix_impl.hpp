@@ -261,20 +261,18 @@ xpcc::Matrix<T, ROWS, COLUMNS>::operator -= (const xpcc::Matrix<T, ROWS, COLUMNS
 // ----------------------------------------------------------------------------
 template<typename T, uint8_t ROWS, uint8_t COLUMNS>
 template<uint8_t RHSCOL>
-xpcc::Matrix<T, ROWS, ROWS>
+xpcc::Matrix<T, ROWS, RHSCOL>
 xpcc::Matrix<T, ROWS, COLUMNS>::operator * (const Matrix<T, COLUMNS, RHSCOL> &rhs) const
 {
-	xpcc::Matrix<T, ROWS, ROWS> m;
+	xpcc::Matrix<T, ROWS, RHSCOL> m;
 	
 	for (uint_fast8_t i = 0; i < ROWS; ++i)
 	{
+		const T *row = &element[i * COLUMNS];
 		for (uint_fast8_t j = 0; j < RHSCOL; ++j)
 		{
-			m[j][i] = element[j * COLUMNS] * rhs[0][i];
-			for (uint_fast8_t x = 1; x < COLUMNS; ++x)
-			{
-				m[j][i] += element[j * COLUMNS + x] * rhs[x][i];
-			}
+			m.element[i * RHSCOL + j] =
+					MatrixDotProduct<T, COLUMNS, RHSCOL>::calculate(row, &rhs.element[j]);
 		}
 	}
 	return m;
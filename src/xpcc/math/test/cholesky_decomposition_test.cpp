@@ -0,0 +1,114 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/math/cholesky_decomposition.hpp>
+
+#include "cholesky_decomposition_test.hpp"
+
+namespace
+{
+	// symmetric and positive-definite
+	const float a6[36] = {
+		10.0f,  1.0f,  2.0f,  0.5f,  0.0f,  1.0f,
+		 1.0f,  8.0f,  0.5f,  1.0f,  2.0f,  0.0f,
+		 2.0f,  0.5f, 12.0f,  1.5f,  0.5f,  1.0f,
+		 0.5f,  1.0f,  1.5f,  9.0f,  1.0f,  0.5f,
+		 0.0f,  2.0f,  0.5f,  1.0f,  7.0f,  2.0f,
+		 1.0f,  0.0f,  1.0f,  0.5f,  2.0f, 11.0f,
+	};
+	
+	const float x6[12] = {
+		 1.0f, -2.0f,
+		 2.0f,  0.5f,
+		-1.0f,  3.0f,
+		 0.5f,  1.0f,
+		 3.0f, -1.5f,
+		-2.0f,  0.0f,
+	};
+}
+
+void
+CholeskyDecompositionTest::testDecompose()
+{
+	xpcc::Matrix<float, 6, 6> a(a6);
+	
+	TEST_ASSERT_TRUE(xpcc::CholeskyDecomposition::decompose(&a));
+	
+	// rebuild A from L*L^T
+	xpcc::Matrix<float, 6, 6> l = xpcc::Matrix<float, 6, 6>::zeroMatrix();
+	for (uint8_t i = 0; i < 6; ++i) {
+		for (uint8_t j = 0; j <= i; ++j) {
+			l[i][j] = a[i][j];
+		}
+	}
+	
+	xpcc::Matrix<float, 6, 6> llt = l * l.asTransposed();
+	for (uint8_t i = 0; i < 36; ++i) {
+		TEST_ASSERT_EQUALS_DELTA(llt.element[i], a6[i], 1e-4f);
+	}
+	
+	// upper triangle is untouched
+	TEST_ASSERT_EQUALS(a[0][5], a6[5]);
+	TEST_ASSERT_EQUALS(a[4][5], a6[4 * 6 + 5]);
+}
+
+void
+CholeskyDecompositionTest::testSolve()
+{
+	const xpcc::Matrix<float, 6, 6> a(a6);
+	const xpcc::Matrix<float, 6, 2> x(x6);
+	
+	xpcc::Matrix<float, 6, 2> b = a * x;
+	xpcc::Matrix<float, 6, 6> l = a;
+	
+	TEST_ASSERT_TRUE(xpcc::CholeskyDecomposition::solve(&l, &b));
+	for (uint8_t i = 0; i < 12; ++i) {
+		TEST_ASSERT_EQUALS_DELTA(b.element[i], x.element[i], 1e-4f);
+	}
+	
+	xpcc::Matrix<float, 6, 1> column = x.getColumn(0);
+	xpcc::Matrix<float, 6, 1> c = a * column;
+	xpcc::CholeskyDecomposition::solve(l, &c);
+	for (uint8_t i = 0; i < 6; ++i) {
+		TEST_ASSERT_EQUALS_DELTA(c[i][0], x[i][0], 1e-4f);
+	}
+}
+
+void
+CholeskyDecompositionTest::testNotPositiveDefinite()
+{
+	const float m[4] = {
+		1.0f, 2.0f,
+		2.0f, 1.0f,
+	};
+	xpcc::Matrix<float, 2, 2> a(m);
+	
+	TEST_ASSERT_FALSE(xpcc::CholeskyDecomposition::decompose(&a));
+}
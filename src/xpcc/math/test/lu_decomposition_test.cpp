@@ -0,0 +1,140 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/math/lu_decomposition.hpp>
+
+#include "lu_decomposition_test.hpp"
+
+namespace
+{
+	// symmetric and positive-definite
+	const float a6[36] = {
+		10.0f,  1.0f,  2.0f,  0.5f,  0.0f,  1.0f,
+		 1.0f,  8.0f,  0.5f,  1.0f,  2.0f,  0.0f,
+		 2.0f,  0.5f, 12.0f,  1.5f,  0.5f,  1.0f,
+		 0.5f,  1.0f,  1.5f,  9.0f,  1.0f,  0.5f,
+		 0.0f,  2.0f,  0.5f,  1.0f,  7.0f,  2.0f,
+		 1.0f,  0.0f,  1.0f,  0.5f,  2.0f, 11.0f,
+	};
+	
+	const float x6[12] = {
+		 1.0f, -2.0f,
+		 2.0f,  0.5f,
+		-1.0f,  3.0f,
+		 0.5f,  1.0f,
+		 3.0f, -1.5f,
+		-2.0f,  0.0f,
+	};
+}
+
+void
+LuDecompositionTest::testDecompose()
+{
+	// needs pivoting, the first element is zero
+	const float m[9] = {
+		0.0f, 2.0f, 1.0f,
+		4.0f, 1.0f, 3.0f,
+		2.0f, 5.0f, 1.0f,
+	};
+	xpcc::Matrix<float, 3, 3> a(m);
+	xpcc::Vector<int8_t, 3> pivot;
+	
+	TEST_ASSERT_TRUE(xpcc::LUDecomposition::decompose(&a, &pivot));
+	TEST_ASSERT_EQUALS(pivot[0], 1);
+	
+	// rebuild P*A from L and U
+	xpcc::Matrix<float, 3, 3> l = xpcc::Matrix<float, 3, 3>::identityMatrix();
+	xpcc::Matrix<float, 3, 3> u = xpcc::Matrix<float, 3, 3>::zeroMatrix();
+	for (uint8_t i = 0; i < 3; ++i) {
+		for (uint8_t j = 0; j < 3; ++j) {
+			if (j < i) {
+				l[i][j] = a[i][j];
+			}
+			else {
+				u[i][j] = a[i][j];
+			}
+		}
+	}
+	
+	xpcc::Matrix<float, 3, 3> pa(m);
+	for (uint8_t k = 0; k < 3; ++k) {
+		for (uint8_t j = 0; j < 3; ++j) {
+			float temp = pa[k][j];
+			pa[k][j] = pa[pivot[k]][j];
+			pa[pivot[k]][j] = temp;
+		}
+	}
+	
+	xpcc::Matrix<float, 3, 3> lu = l * u;
+	for (uint8_t i = 0; i < 9; ++i) {
+		TEST_ASSERT_EQUALS_DELTA(lu.element[i], pa.element[i], 1e-5f);
+	}
+}
+
+void
+LuDecompositionTest::testSolve()
+{
+	const xpcc::Matrix<float, 6, 6> a(a6);
+	const xpcc::Matrix<float, 6, 2> x(x6);
+	
+	xpcc::Matrix<float, 6, 2> b = a * x;
+	xpcc::Matrix<float, 6, 6> lu = a;
+	
+	TEST_ASSERT_TRUE(xpcc::LUDecomposition::solve(&lu, &b));
+	for (uint8_t i = 0; i < 12; ++i) {
+		TEST_ASSERT_EQUALS_DELTA(b.element[i], x.element[i], 1e-4f);
+	}
+	
+	// reuse the decomposition for a second right hand side
+	xpcc::Vector<int8_t, 6> pivot;
+	xpcc::Matrix<float, 6, 6> decomposed = a;
+	TEST_ASSERT_TRUE(xpcc::LUDecomposition::decompose(&decomposed, &pivot));
+	
+	xpcc::Matrix<float, 6, 1> column = x.getColumn(1);
+	xpcc::Matrix<float, 6, 1> c = a * column;
+	xpcc::LUDecomposition::solve(decomposed, pivot, &c);
+	for (uint8_t i = 0; i < 6; ++i) {
+		TEST_ASSERT_EQUALS_DELTA(c[i][0], x[i][1], 1e-4f);
+	}
+}
+
+void
+LuDecompositionTest::testSingular()
+{
+	const float m[9] = {
+		1.0f, 2.0f, 3.0f,
+		2.0f, 4.0f, 6.0f,
+		0.0f, 0.0f, 0.0f,
+	};
+	xpcc::Matrix<float, 3, 3> a(m);
+	xpcc::Matrix<float, 3, 1> b = xpcc::Matrix<float, 3, 1>::zeroMatrix();
+	
+	TEST_ASSERT_FALSE(xpcc::LUDecomposition::solve(&a, &b));
+}
@@ -337,6 +337,18 @@ MatrixTest::testMatrixMultiplication()
 	TEST_ASSERT_EQUALS(g[0][1], 28);
 	TEST_ASSERT_EQUALS(g[1][0], 49);
 	TEST_ASSERT_EQUALS(g[1][1], 64);
+	
+	// the result has the number of columns of the right hand side
+	xpcc::Matrix<int16_t, 2, 1> h = f * a;
+	
+	TEST_ASSERT_EQUALS(h[0][0], 14);
+	TEST_ASSERT_EQUALS(h[1][0], 32);
+	
+	xpcc::Matrix<int16_t, 3, 2> k = c * e;
+	
+	TEST_ASSERT_EQUALS(k[0][0], 9 + 36 + 75);
+	TEST_ASSERT_EQUALS(k[0][1], 18 + 48 + 90);
+	TEST_ASSERT_EQUALS(k[2][1], 58 + 160 + 306);
 }
 
 void
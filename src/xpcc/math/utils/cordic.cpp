@@ -0,0 +1,238 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/architecture/driver/accessor.hpp>
+
+#include "cordic.hpp"
+
+namespace
+{
+	// atan(2^-i) as fraction of a full turn
+	FLASH_STORAGE(int32_t atanTable[28]) =
+	{
+		536870912, 316933406, 167458907, 85004756, 42667331, 21354465,
+		10679838, 5340245, 2670163, 1335087, 667544, 333772, 166886,
+		83443, 41722, 20861, 10430, 5215, 2608, 1304, 652, 326, 163,
+		81, 41, 20, 10, 5
+	};
+	
+	const uint8_t iterations = 28;
+	
+	// 1/K = prod(1 / sqrt(1 + 2^(-2i))) as Q30 and Q32
+	const int32_t inverseGainQ30 = 652032874L;
+	const uint32_t inverseGainQ32 = 2608131496UL;
+	
+	// The values are scaled to [2^27, 2^28) so that the growth by the
+	// gain K = 1.647 doesn't overflow the 32-bit registers.
+	const uint32_t lowerLimit = 1UL << 27;
+	const uint32_t upperLimit = 1UL << 28;
+}
+
+const int32_t xpcc::math::Cordic::one;
+
+// ----------------------------------------------------------------------------
+int8_t
+xpcc::math::Cordic::normalize(int32_t& x, int32_t& y)
+{
+	const bool negativeX = (x < 0);
+	const bool negativeY = (y < 0);
+	
+	// unsigned to be able to represent the absolute value of INT32_MIN
+	uint32_t ux = negativeX ? -static_cast<uint32_t>(x) : x;
+	uint32_t uy = negativeY ? -static_cast<uint32_t>(y) : y;
+	
+	uint32_t maximum = (ux > uy) ? ux : uy;
+	int8_t shift = 0;
+	while (maximum >= upperLimit) {
+		maximum >>= 1;
+		shift--;
+	}
+	while (maximum < lowerLimit) {
+		maximum <<= 1;
+		shift++;
+	}
+	
+	if (shift > 0) {
+		ux <<= shift;
+		uy <<= shift;
+	}
+	else {
+		ux >>= -shift;
+		uy >>= -shift;
+	}
+	
+	x = negativeX ? -static_cast<int32_t>(ux) : static_cast<int32_t>(ux);
+	y = negativeY ? -static_cast<int32_t>(uy) : static_cast<int32_t>(uy);
+	
+	return shift;
+}
+
+xpcc::math::Cordic::Angle
+xpcc::math::Cordic::vectoring(int32_t& x, int32_t& y)
+{
+	xpcc::accessor::Flash<int32_t> table = xpcc::accessor::asFlash(atanTable);
+	
+	// rotate the vector onto the x-axis and sum up the angles
+	Angle angle = 0;
+	for (uint_fast8_t i = 0; i < iterations; ++i)
+	{
+		const int32_t dx = x >> i;
+		const int32_t dy = y >> i;
+		if (y > 0) {
+			x += dy;
+			y -= dx;
+			angle += table[i];
+		}
+		else {
+			x -= dy;
+			y += dx;
+			angle -= table[i];
+		}
+	}
+	return angle;
+}
+
+// ----------------------------------------------------------------------------
+xpcc::math::Cordic::Angle
+xpcc::math::Cordic::atan2(int32_t y, int32_t x)
+{
+	if (x == 0 && y == 0) {
+		return 0;
+	}
+	
+	normalize(x, y);
+	
+	// The iterations converge only for -Pi/2..Pi/2, therefore vectors
+	// in the left half-plane are rotated by 90 degree first.
+	Angle offset = 0;
+	if (x < 0)
+	{
+		const int32_t t = x;
+		if (y >= 0) {
+			x = y;
+			y = -t;
+			offset = 1L << 30;
+		}
+		else {
+			x = -y;
+			y = t;
+			offset = -(1L << 30);
+		}
+	}
+	
+	return offset + vectoring(x, y);
+}
+
+// ----------------------------------------------------------------------------
+void
+xpcc::math::Cordic::sinCos(Angle angle, int32_t& sin, int32_t& cos)
+{
+	// Reduce the angle to -Pi/2..Pi/2 by rotating by Pi, which negates
+	// sine and cosine.
+	bool negate = false;
+	if (angle > (1L << 30) || angle < -(1L << 30))
+	{
+		angle = static_cast<Angle>(static_cast<uint32_t>(angle) + (1UL << 31));
+		negate = true;
+	}
+	
+	xpcc::accessor::Flash<int32_t> table = xpcc::accessor::asFlash(atanTable);
+	
+	// start with the inverse gain to get a vector of length one at the end
+	int32_t x = inverseGainQ30;
+	int32_t y = 0;
+	for (uint_fast8_t i = 0; i < iterations; ++i)
+	{
+		const int32_t dx = x >> i;
+		const int32_t dy = y >> i;
+		if (angle >= 0) {
+			x -= dy;
+			y += dx;
+			angle -= table[i];
+		}
+		else {
+			x += dy;
+			y -= dx;
+			angle += table[i];
+		}
+	}
+	
+	if (negate) {
+		x = -x;
+		y = -y;
+	}
+	cos = x;
+	sin = y;
+}
+
+// ----------------------------------------------------------------------------
+uint32_t
+xpcc::math::Cordic::hypot(int32_t x, int32_t y)
+{
+	if (x == 0 && y == 0) {
+		return 0;
+	}
+	
+	const int8_t shift = normalize(x, y);
+	if (x < 0) {
+		x = -x;
+	}
+	
+	vectoring(x, y);
+	
+	// x = K * length, x < 2^30
+	uint64_t length = static_cast<uint64_t>(x) * inverseGainQ32;
+	
+	// undo the scaling and round to nearest, shift is at least -4
+	length += (1ULL << (31 + shift));
+	return static_cast<uint32_t>(length >> (32 + shift));
+}
+
+// ----------------------------------------------------------------------------
+xpcc::math::Cordic::Angle
+xpcc::math::Cordic::fromRadian(float angle)
+{
+	// reduce to -0.5..0.5 turns before the conversion to avoid an overflow
+	float turns = angle * 0.15915494309189535f;		// 1 / (2 * Pi)
+	turns -= static_cast<int32_t>(turns);
+	if (turns >= 0.5f) {
+		turns -= 1.0f;
+	}
+	else if (turns < -0.5f) {
+		turns += 1.0f;
+	}
+	
+	const float value = turns * 4294967296.f;
+	if (value >= 2147483648.f) {
+		// rounding error, Pi and -Pi are the same angle
+		return static_cast<Angle>(-2147483647L - 1);
+	}
+	return static_cast<Angle>(value);
+}
@@ -0,0 +1,119 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_MATH__CORDIC_HPP
+#define	XPCC_MATH__CORDIC_HPP
+
+#include <stdint.h>
+
+namespace xpcc
+{
+	namespace math
+	{
+		/**
+		 * \brief	Fixed point trigonometry with the CORDIC algorithm
+		 * 
+		 * Calculates atan2, sine, cosine and the length of a vector only
+		 * with additions and shifts, which is considerably faster than the
+		 * floating point functions of the C library on targets without
+		 * a FPU.
+		 * 
+		 * Angles are stored as binary fractions of a full turn, i.e.
+		 * 2^32 corresponds to 2*Pi. Additions and subtractions of angles
+		 * wrap around automatically, so no normalization is necessary.
+		 * 
+		 * Maximum errors (verified by the unit tests):
+		 * - atan2(): 1e-7 rad (plus the resolution of the input values)
+		 * - sinCos(): 5e-8
+		 * - hypot(): 2 + 1e-7 * length
+		 * 
+		 * \see		http://en.wikipedia.org/wiki/CORDIC
+		 * \see		xpcc::math::FastMath
+		 * \ingroup	math
+		 */
+		class Cordic
+		{
+		public:
+			/// Angle as binary fraction of a full turn, 2^32 = 2*Pi
+			typedef int32_t Angle;
+			
+			/// Value of 1.0 of the results of sinCos()
+			static const int32_t one = 1L << 30;
+			
+			/**
+			 * \brief	Angle of the vector (x, y)
+			 * 
+			 * \return	Angle between -Pi and Pi, zero for (0, 0)
+			 */
+			static Angle
+			atan2(int32_t y, int32_t x);
+			
+			/**
+			 * \brief	Sine and cosine of an angle
+			 * 
+			 * \param	angle	input angle
+			 * \param	sin		sine as Q30 fixed point value (see #one)
+			 * \param	cos		cosine as Q30 fixed point value
+			 */
+			static void
+			sinCos(Angle angle, int32_t& sin, int32_t& cos);
+			
+			/**
+			 * \brief	Length of the vector (x, y)
+			 * 
+			 * Works for the full range of the input values without
+			 * an overflow.
+			 */
+			static uint32_t
+			hypot(int32_t x, int32_t y);
+			
+			/// Convert a CORDIC angle to radian
+			static inline float
+			toRadian(Angle angle)
+			{
+				// 2 * Pi / 2^32
+				return static_cast<float>(angle) * 1.4629180792671596e-9f;
+			}
+			
+			/// Convert an angle in radian to a CORDIC angle
+			static Angle
+			fromRadian(float angle);
+			
+		private:
+			static int8_t
+			normalize(int32_t& x, int32_t& y);
+			
+			static Angle
+			vectoring(int32_t& x, int32_t& y);
+		};
+	}
+}
+
+#endif	// XPCC_MATH__CORDIC_HPP
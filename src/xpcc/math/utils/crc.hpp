@@ -0,0 +1,107 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__CRC_HPP
+#define XPCC__CRC_HPP
+
+#include <cstddef>
+#include <stdint.h>
+
+#include <xpcc/architecture/utils.hpp>
+
+namespace xpcc
+{
+	/**
+	 * \brief	Cyclic redundancy check
+	 * 
+	 * For CRCs which shift the data to the right (LSB first), the
+	 * polynomial is given in its reversed form, e.g. 0x8C instead of
+	 * 0x31 for x^8 + x^5 + x^4 + 1.
+	 * 
+	 * On the AVR the bytes are processed with the functions from
+	 * <util/crc16.h> to save flash. All other targets use precalculated
+	 * tables (4 * 256 entries per polynomial): update() for a single
+	 * byte uses one table lookup, the block version processes four
+	 * bytes at once with four tables ("slice-by-4").
+	 * 
+	 * Tables are available for the polynomials of Crc8Dallas and
+	 * Crc16Ibm.
+	 * 
+	 * Example:
+	 * \code
+	 * uint8_t crc = xpcc::Crc8Dallas::update(0x00, data, length);
+	 * \endcode
+	 * 
+	 * \tparam	T			\c uint8_t or \c uint16_t
+	 * \tparam	Polynomial	Reversed polynomial
+	 * 
+	 * \ingroup	math
+	 */
+	template <typename T, T Polynomial>
+	class Crc
+	{
+	public:
+		/// Add one byte to the CRC
+		static T
+		update(T crc, uint8_t data);
+		
+		/// Add a block of bytes to the CRC
+		static T
+		update(T crc, const void *data, std::size_t length);
+		
+	private:
+		// table[k][i] is the CRC of the byte i followed by k zero bytes
+		static const T table[4][256];
+	};
+	
+	/**
+	 * \brief	CRC-8 of the Dallas/Maxim 1-Wire devices
+	 * 
+	 * x^8 + x^5 + x^4 + 1, used by SAB and AMNB.
+	 * 
+	 * \see		<a href="http://www.maxim-ic.com/app-notes/index.mvp/id/27" target="_blank">
+	 * 			Understanding and Using Cyclic Redundancy Checks with Maxim iButton Products</a>
+	 * \ingroup	math
+	 */
+	typedef Crc<uint8_t, 0x8C> Crc8Dallas;
+	
+	/**
+	 * \brief	CRC-16 (IBM, also known as CRC-16-ANSI)
+	 * 
+	 * x^16 + x^15 + x^2 + 1, used by SAB2 and RPR.
+	 * 
+	 * \ingroup	math
+	 */
+	typedef Crc<uint16_t, 0xA001> Crc16Ibm;
+}
+
+#include "crc_impl.hpp"
+
+#endif // XPCC__CRC_HPP
@@ -0,0 +1,130 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__CRC_HPP
+	#error	"Don't include this file directly, use 'crc.hpp' instead!"
+#endif
+
+#ifdef __AVR__
+#	include <util/crc16.h>
+#endif
+
+#ifdef __AVR__
+
+template <typename T, T Polynomial>
+T
+xpcc::Crc<T, Polynomial>::update(T crc, uint8_t data)
+{
+	crc ^= data;
+	for (uint_fast8_t i = 0; i < 8; ++i)
+	{
+		if (crc & 1) {
+			crc = (crc >> 1) ^ Polynomial;
+		}
+		else {
+			crc = (crc >> 1);
+		}
+	}
+	return crc;
+}
+
+namespace xpcc
+{
+	template <>
+	inline uint8_t
+	Crc<uint8_t, 0x8C>::update(uint8_t crc, uint8_t data)
+	{
+		return _crc_ibutton_update(crc, data);
+	}
+	
+	template <>
+	inline uint16_t
+	Crc<uint16_t, 0xA001>::update(uint16_t crc, uint8_t data)
+	{
+		return _crc16_update(crc, data);
+	}
+}
+
+template <typename T, T Polynomial>
+T
+xpcc::Crc<T, Polynomial>::update(T crc, const void *data, std::size_t length)
+{
+	const uint8_t *ptr = static_cast<const uint8_t *>(data);
+	for (std::size_t i = 0; i < length; ++i) {
+		crc = update(crc, ptr[i]);
+	}
+	return crc;
+}
+
+#else
+
+namespace xpcc
+{
+	// defined in 'pc/crc_table.cpp'
+	template <>
+	const uint8_t Crc<uint8_t, 0x8C>::table[4][256];
+	
+	template <>
+	const uint16_t Crc<uint16_t, 0xA001>::table[4][256];
+}
+
+template <typename T, T Polynomial>
+inline T
+xpcc::Crc<T, Polynomial>::update(T crc, uint8_t data)
+{
+	return (crc >> 8) ^ table[0][(crc ^ data) & 0xff];
+}
+
+template <typename T, T Polynomial>
+T
+xpcc::Crc<T, Polynomial>::update(T crc, const void *data, std::size_t length)
+{
+	const uint8_t *ptr = static_cast<const uint8_t *>(data);
+	
+	// The CRC is at most two bytes wide and only changes the first
+	// two bytes of every block.
+	uint32_t value = crc;
+	for (; length >= 4; length -= 4, ptr += 4)
+	{
+		value ^= ptr[0] | (ptr[1] << 8);
+		value = table[3][value & 0xff] ^
+				table[2][(value >> 8) & 0xff] ^
+				table[1][ptr[2]] ^
+				table[0][ptr[3]];
+	}
+	crc = value;
+	
+	for (; length > 0; --length) {
+		crc = update(crc, *ptr++);
+	}
+	return crc;
+}
+
+#endif
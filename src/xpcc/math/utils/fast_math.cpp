@@ -0,0 +1,108 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include "cordic.hpp"
+#include "fast_math.hpp"
+
+// ----------------------------------------------------------------------------
+float
+xpcc::math::FastMath::atan2(float y, float x)
+{
+	const float absX = (x < 0) ? -x : x;
+	const float absY = (y < 0) ? -y : y;
+	const float maximum = (absX > absY) ? absX : absY;
+	if (maximum == 0) {
+		return 0;
+	}
+	
+	// Scale the values to [2^27, 2^28) for the conversion to integers.
+	// The factor is a power of two created directly from the exponent,
+	// so the scaling is exact and needs no division.
+	uint32_t bits;
+	std::memcpy(&bits, &maximum, sizeof(bits));
+	const int16_t exponent = 281 - static_cast<int16_t>((bits >> 23) & 0xff);
+	if (exponent < 1 || exponent > 254) {
+		// denormalized or very large values
+		return std::atan2(y, x);
+	}
+	
+	bits = static_cast<uint32_t>(exponent) << 23;
+	float factor;
+	std::memcpy(&factor, &bits, sizeof(factor));
+	
+	const Cordic::Angle angle = Cordic::atan2(
+			static_cast<int32_t>(y * factor),
+			static_cast<int32_t>(x * factor));
+	return Cordic::toRadian(angle);
+}
+
+// ----------------------------------------------------------------------------
+void
+xpcc::math::FastMath::sinCos(float angle, float& sin, float& cos)
+{
+	int32_t s;
+	int32_t c;
+	Cordic::sinCos(Cordic::fromRadian(angle), s, c);
+	
+	// 2^-30
+	sin = static_cast<float>(s) * 9.313225746154785e-10f;
+	cos = static_cast<float>(c) * 9.313225746154785e-10f;
+}
+
+// ----------------------------------------------------------------------------
+uint16_t
+xpcc::math::FastMath::integerSqrt(uint32_t value)
+{
+	uint32_t remainder = value;
+	uint32_t result = 0;
+	uint32_t bit = 1UL << 30;
+	
+	while (bit > remainder) {
+		bit >>= 2;
+	}
+	
+	while (bit != 0)
+	{
+		if (remainder >= result + bit) {
+			remainder -= result + bit;
+			result = (result >> 1) + bit;
+		}
+		else {
+			result >>= 1;
+		}
+		bit >>= 2;
+	}
+	
+	// remainder = value - result^2, round up if value >= (result + 0.5)^2
+	if (remainder > result && result < 0xffff) {
+		result++;
+	}
+	return result;
+}
@@ -0,0 +1,175 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_MATH__FAST_MATH_HPP
+#define	XPCC_MATH__FAST_MATH_HPP
+
+#include <cmath>
+#include <cstring>
+#include <stdint.h>
+
+#include "operator.hpp"
+
+namespace xpcc
+{
+	namespace math
+	{
+		/**
+		 * \brief	Math kernels using the functions of the C library
+		 * 
+		 * Default kernels of the geometry classes.
+		 * 
+		 * \see		xpcc::GeometricTraits
+		 * \ingroup	math
+		 */
+		struct StandardMath
+		{
+			static inline float
+			sqrt(float value)
+			{
+				return std::sqrt(value);
+			}
+			
+			static inline double
+			sqrt(double value)
+			{
+				return std::sqrt(value);
+			}
+			
+			/// Rounded integer square root
+			static inline uint16_t
+			sqrt(uint32_t value)
+			{
+				return xpcc::math::sqrt(value);
+			}
+			
+			static inline float
+			invSqrt(float value)
+			{
+				return 1.0f / std::sqrt(value);
+			}
+			
+			static inline float
+			atan2(float y, float x)
+			{
+				return std::atan2(y, x);
+			}
+			
+			static inline double
+			atan2(double y, double x)
+			{
+				return std::atan2(y, x);
+			}
+			
+			static inline void
+			sinCos(float angle, float& sin, float& cos)
+			{
+				sin = std::sin(angle);
+				cos = std::cos(angle);
+			}
+		};
+		
+		/**
+		 * \brief	Fast approximations for targets without a FPU
+		 * 
+		 * Same interface as xpcc::math::StandardMath. The trigonometric
+		 * functions use xpcc::math::Cordic, the square roots are
+		 * calculated with the fast inverse square root and two Newton
+		 * iterations or by a pure integer algorithm.
+		 * 
+		 * Maximum errors (verified by the unit tests):
+		 * - sqrt(float), invSqrt(): 5e-6 relative
+		 * - sqrt(uint32_t): none, same results as StandardMath
+		 * - atan2(): 1e-6 rad
+		 * - sinCos(): 1e-6
+		 * 
+		 * Negative, infinite or NaN input values are not supported.
+		 * 
+		 * Enable it for the geometry classes with
+		 * \code
+		 * [defines]
+		 * GEOMETRY_FAST_MATH = 1
+		 * \endcode
+		 * in the \c project.cfg.
+		 * 
+		 * \see		xpcc::GeometricTraits
+		 * \ingroup	math
+		 */
+		struct FastMath
+		{
+			static inline float
+			sqrt(float value)
+			{
+				// invSqrt(0) is finite, so this also works for zero
+				return value * invSqrt(value);
+			}
+			
+			/// Rounded integer square root
+			static inline uint16_t
+			sqrt(uint32_t value)
+			{
+#ifdef __AVR__
+				// the assembler implementation is already fast
+				return xpcc::math::sqrt(value);
+#else
+				return integerSqrt(value);
+#endif
+			}
+			
+			static inline float
+			invSqrt(float value)
+			{
+				uint32_t i;
+				std::memcpy(&i, &value, sizeof(i));
+				i = 0x5f3759df - (i >> 1);
+				
+				float y;
+				std::memcpy(&y, &i, sizeof(y));
+				
+				const float half = value * 0.5f;
+				y = y * (1.5f - half * y * y);
+				y = y * (1.5f - half * y * y);
+				return y;
+			}
+			
+			static float
+			atan2(float y, float x);
+			
+			static void
+			sinCos(float angle, float& sin, float& cos);
+			
+			/// Rounded integer square root without any multiplication
+			static uint16_t
+			integerSqrt(uint32_t value);
+		};
+	}
+}
+
+#endif	// XPCC_MATH__FAST_MATH_HPP
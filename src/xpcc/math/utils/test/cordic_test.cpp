@@ -0,0 +1,200 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+#include <algorithm>
+#include <xpcc/math/utils/cordic.hpp>
+
+#include "cordic_test.hpp"
+
+using xpcc::math::Cordic;
+
+namespace
+{
+	// Simple deterministic pseudo random numbers
+	uint32_t
+	random(uint32_t& state)
+	{
+		state = state * 1664525UL + 1013904223UL;
+		return state;
+	}
+	
+	double
+	toDouble(Cordic::Angle angle)
+	{
+		return static_cast<double>(angle) * (2 * M_PI / 4294967296.0);
+	}
+	
+	// Difference of two angles, taking the wrap around at +-Pi into account
+	double
+	angleError(double a, double b)
+	{
+		double error = std::fabs(a - b);
+		if (error > M_PI) {
+			error = std::fabs(error - 2 * M_PI);
+		}
+		return error;
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+CordicTest::testAtan2()
+{
+	TEST_ASSERT_EQUALS(Cordic::atan2(0, 0), 0);
+	
+	// 1e-7 rad correspond to 68 units of Cordic::Angle
+	TEST_ASSERT_EQUALS_DELTA(Cordic::atan2(0, 1000), 0, 68);
+	TEST_ASSERT_EQUALS_DELTA(Cordic::atan2(1000, 0),  (1L << 30), 68);
+	TEST_ASSERT_EQUALS_DELTA(Cordic::atan2(-1000, 0), -(1L << 30), 68);
+	TEST_ASSERT_EQUALS_DELTA(Cordic::atan2(1000, 1000), (1L << 29), 68);
+	
+	// -Pi and Pi are the same angle
+	TEST_ASSERT_EQUALS_DELTA(static_cast<uint32_t>(Cordic::atan2(0, -1000)),
+			0x80000000UL, 68UL);
+	
+	uint32_t state = 1;
+	double maxError = 0;
+	for (uint_fast16_t i = 0; i < 10000; ++i)
+	{
+		int32_t x = random(state);
+		int32_t y = random(state);
+		
+		// also check small values
+		uint8_t shift = random(state) % 31;
+		x >>= shift;
+		y >>= shift;
+		if (x == 0 && y == 0) {
+			continue;
+		}
+		
+		double error = angleError(toDouble(Cordic::atan2(y, x)),
+				std::atan2(static_cast<double>(y), static_cast<double>(x)));
+		
+		// subtract the resolution of the input values
+		error -= 1.0 / std::sqrt(static_cast<double>(x) * x +
+				static_cast<double>(y) * y);
+		maxError = std::max(maxError, error);
+	}
+	TEST_ASSERT_TRUE(maxError < 1e-7);
+}
+
+void
+CordicTest::testAtan2Limits()
+{
+	TEST_ASSERT_EQUALS_DELTA(Cordic::atan2(INT32_MAX, INT32_MAX), (1L << 29), 68);
+	TEST_ASSERT_EQUALS_DELTA(Cordic::atan2(INT32_MIN, INT32_MIN),
+			-(3L << 29), 68);
+	TEST_ASSERT_EQUALS_DELTA(Cordic::atan2(INT32_MIN, 0), -(1L << 30), 68);
+	TEST_ASSERT_EQUALS_DELTA(static_cast<uint32_t>(Cordic::atan2(0, INT32_MIN)),
+			0x80000000UL, 68UL);
+	
+	TEST_ASSERT_EQUALS_DELTA(Cordic::hypot(INT32_MIN, 0), 2147483648UL, 256UL);
+	TEST_ASSERT_EQUALS_DELTA(Cordic::hypot(INT32_MIN, INT32_MIN),
+			3037000500UL, 500UL);
+}
+
+void
+CordicTest::testSinCos()
+{
+	int32_t sin;
+	int32_t cos;
+	
+	Cordic::sinCos(0, sin, cos);
+	TEST_ASSERT_EQUALS_DELTA(sin, 0, 64);
+	TEST_ASSERT_EQUALS_DELTA(cos, Cordic::one, 64);
+	
+	Cordic::sinCos(1L << 30, sin, cos);
+	TEST_ASSERT_EQUALS_DELTA(sin, Cordic::one, 64);
+	TEST_ASSERT_EQUALS_DELTA(cos, 0, 64);
+	
+	Cordic::sinCos(INT32_MIN, sin, cos);
+	TEST_ASSERT_EQUALS_DELTA(sin, 0, 64);
+	TEST_ASSERT_EQUALS_DELTA(cos, -Cordic::one, 64);
+	
+	uint32_t state = 2;
+	double maxError = 0;
+	for (uint_fast16_t i = 0; i < 10000; ++i)
+	{
+		Cordic::Angle angle = random(state);
+		Cordic::sinCos(angle, sin, cos);
+		
+		double phi = toDouble(angle);
+		maxError = std::max(maxError,
+				std::fabs(sin / 1073741824.0 - std::sin(phi)));
+		maxError = std::max(maxError,
+				std::fabs(cos / 1073741824.0 - std::cos(phi)));
+	}
+	TEST_ASSERT_TRUE(maxError < 5e-8);
+}
+
+void
+CordicTest::testHypot()
+{
+	TEST_ASSERT_EQUALS(Cordic::hypot(0, 0), 0U);
+	TEST_ASSERT_EQUALS(Cordic::hypot(3, 4), 5U);
+	TEST_ASSERT_EQUALS(Cordic::hypot(-3, 4), 5U);
+	TEST_ASSERT_EQUALS(Cordic::hypot(-1000, 0), 1000U);
+	
+	uint32_t state = 3;
+	double maxError = 0;
+	for (uint_fast16_t i = 0; i < 10000; ++i)
+	{
+		int32_t x = random(state);
+		int32_t y = random(state);
+		
+		uint8_t shift = random(state) % 31;
+		x >>= shift;
+		y >>= shift;
+		
+		double length = std::sqrt(static_cast<double>(x) * x +
+				static_cast<double>(y) * y);
+		double error = std::fabs(Cordic::hypot(x, y) - length);
+		
+		// relative error above the absolute part of 2
+		maxError = std::max(maxError, (error - 2) / (length + 1));
+	}
+	TEST_ASSERT_TRUE(maxError < 1e-7);
+}
+
+void
+CordicTest::testRadian()
+{
+	TEST_ASSERT_EQUALS(Cordic::fromRadian(0.f), 0);
+	TEST_ASSERT_EQUALS_DELTA(Cordic::fromRadian(M_PI / 2), (1L << 30), 128);
+	TEST_ASSERT_EQUALS_DELTA(Cordic::fromRadian(-M_PI / 2), -(1L << 30), 128);
+	
+	// Angles outside of -Pi..Pi wrap around
+	TEST_ASSERT_EQUALS_DELTA(Cordic::fromRadian(3 * M_PI / 2), -(1L << 30), 512);
+	TEST_ASSERT_EQUALS_DELTA(Cordic::fromRadian(-5 * M_PI / 2), -(1L << 30), 512);
+	
+	TEST_ASSERT_EQUALS_FLOAT(Cordic::toRadian(1L << 30), M_PI / 2);
+	TEST_ASSERT_EQUALS_FLOAT(Cordic::toRadian(-(1L << 29)), -M_PI / 4);
+}
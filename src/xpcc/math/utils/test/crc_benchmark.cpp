@@ -0,0 +1,79 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/math/utils/crc.hpp>
+
+#include "crc_benchmark.hpp"
+
+void
+CrcBenchmark::setUp()
+{
+	for (uint_fast8_t i = 0; i < sizeof(data); ++i) {
+		data[i] = i * 37;
+	}
+}
+
+void
+CrcBenchmark::benchmarkCrc8Bytewise(unittest::BenchmarkState& state)
+{
+	uint8_t crc = 0;
+	while (state.keepRunning())
+	{
+		for (uint_fast8_t i = 0; i < sizeof(data); ++i) {
+			crc = xpcc::Crc8Dallas::update(crc, data[i]);
+		}
+		unittest::clobberMemory();
+	}
+	unittest::doNotOptimize(crc);
+}
+
+void
+CrcBenchmark::benchmarkCrc8Block(unittest::BenchmarkState& state)
+{
+	uint8_t crc = 0;
+	while (state.keepRunning())
+	{
+		crc = xpcc::Crc8Dallas::update(crc, data, sizeof(data));
+		unittest::clobberMemory();
+	}
+	unittest::doNotOptimize(crc);
+}
+
+void
+CrcBenchmark::benchmarkCrc16Block(unittest::BenchmarkState& state)
+{
+	uint16_t crc = 0xffff;
+	while (state.keepRunning())
+	{
+		crc = xpcc::Crc16Ibm::update(crc, data, sizeof(data));
+		unittest::clobberMemory();
+	}
+	unittest::doNotOptimize(crc);
+}
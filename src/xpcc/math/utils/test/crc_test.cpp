@@ -0,0 +1,147 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/math/utils/crc.hpp>
+
+#include "crc_test.hpp"
+
+namespace
+{
+	// Former implementation of sab::crcUpdate() and amnb::crcUpdate()
+	uint8_t
+	bitwiseCrc8(uint8_t crc, uint8_t data)
+	{
+		crc = crc ^ data;
+		for (uint_fast8_t i = 0; i < 8; ++i)
+		{
+			if (crc & 0x01) {
+				crc = (crc >> 1) ^ 0x8C;
+			}
+			else {
+				crc >>= 1;
+			}
+		}
+		return crc;
+	}
+	
+	// Former implementation of sab2::crcUpdate() and rpr::crcUpdate()
+	uint16_t
+	bitwiseCrc16(uint16_t crc, uint8_t data)
+	{
+		crc ^= data;
+		for (uint_fast8_t i = 0; i < 8; ++i)
+		{
+			if (crc & 1) {
+				crc = (crc >> 1) ^ 0xA001;
+			}
+			else {
+				crc = (crc >> 1);
+			}
+		}
+		return crc;
+	}
+	
+	// pseudo random test data
+	uint8_t data[100];
+	
+	void
+	fillData()
+	{
+		uint16_t value = 0x1234;
+		for (uint8_t i = 0; i < sizeof(data); ++i) {
+			value = value * 75 + 74;
+			data[i] = value >> 8;
+		}
+	}
+	
+	const char check[] = "123456789";
+}
+
+// ----------------------------------------------------------------------------
+void
+CrcTest::testCheckValue()
+{
+	// CRC-8/MAXIM
+	TEST_ASSERT_EQUALS(xpcc::Crc8Dallas::update(0x00, check, 9), 0xA1);
+	
+	// CRC-16/ARC and CRC-16/MODBUS
+	TEST_ASSERT_EQUALS(xpcc::Crc16Ibm::update(0x0000, check, 9), 0xBB3D);
+	TEST_ASSERT_EQUALS(xpcc::Crc16Ibm::update(0xffff, check, 9), 0x4B37);
+}
+
+void
+CrcTest::testCrc8()
+{
+	for (uint16_t crc = 0; crc < 256; ++crc)
+	{
+		for (uint16_t i = 0; i < 256; i += 7)
+		{
+			TEST_ASSERT_EQUALS(xpcc::Crc8Dallas::update(crc, i),
+					bitwiseCrc8(crc, i));
+		}
+	}
+}
+
+void
+CrcTest::testCrc16()
+{
+	for (uint32_t crc = 0; crc < 0x10000; crc += 251)
+	{
+		for (uint16_t i = 0; i < 256; i += 7)
+		{
+			TEST_ASSERT_EQUALS(xpcc::Crc16Ibm::update(crc, i),
+					bitwiseCrc16(crc, i));
+		}
+	}
+}
+
+void
+CrcTest::testBlock()
+{
+	fillData();
+	
+	// all lengths and alignments up to some blocks of four bytes
+	for (uint8_t offset = 0; offset < 4; ++offset)
+	{
+		for (uint8_t length = 0; length < sizeof(data) - 4; ++length)
+		{
+			uint8_t crc8 = 0x00;
+			uint16_t crc16 = 0xffff;
+			for (uint8_t i = 0; i < length; ++i)
+			{
+				crc8 = bitwiseCrc8(crc8, data[offset + i]);
+				crc16 = bitwiseCrc16(crc16, data[offset + i]);
+			}
+			
+			TEST_ASSERT_EQUALS(xpcc::Crc8Dallas::update(0x00, data + offset, length), crc8);
+			TEST_ASSERT_EQUALS(xpcc::Crc16Ibm::update(0xffff, data + offset, length), crc16);
+		}
+	}
+}
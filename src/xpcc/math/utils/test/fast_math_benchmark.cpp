@@ -0,0 +1,117 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/math/utils/fast_math.hpp>
+
+#include "fast_math_benchmark.hpp"
+
+using xpcc::math::FastMath;
+using xpcc::math::StandardMath;
+
+namespace
+{
+	template <typename Math>
+	void
+	atan2(unittest::BenchmarkState& state)
+	{
+		float x = 1000.f;
+		float y = 0.5f;
+		while (state.keepRunning())
+		{
+			unittest::doNotOptimize(Math::atan2(y, x));
+			x -= 0.01f;
+			y += 0.01f;
+		}
+	}
+	
+	template <typename Math>
+	void
+	sinCos(unittest::BenchmarkState& state)
+	{
+		float phi = 0.f;
+		while (state.keepRunning())
+		{
+			float sin;
+			float cos;
+			Math::sinCos(phi, sin, cos);
+			unittest::doNotOptimize(sin);
+			unittest::doNotOptimize(cos);
+			phi += 1e-5f;
+		}
+	}
+	
+	template <typename Math>
+	void
+	invSqrt(unittest::BenchmarkState& state)
+	{
+		float value = 1.f;
+		while (state.keepRunning())
+		{
+			unittest::doNotOptimize(Math::invSqrt(value));
+			value += 0.01f;
+		}
+	}
+}
+
+void
+FastMathBenchmark::benchmarkStandardAtan2(unittest::BenchmarkState& state)
+{
+	atan2<StandardMath>(state);
+}
+
+void
+FastMathBenchmark::benchmarkFastAtan2(unittest::BenchmarkState& state)
+{
+	atan2<FastMath>(state);
+}
+
+void
+FastMathBenchmark::benchmarkStandardSinCos(unittest::BenchmarkState& state)
+{
+	sinCos<StandardMath>(state);
+}
+
+void
+FastMathBenchmark::benchmarkFastSinCos(unittest::BenchmarkState& state)
+{
+	sinCos<FastMath>(state);
+}
+
+void
+FastMathBenchmark::benchmarkStandardInvSqrt(unittest::BenchmarkState& state)
+{
+	invSqrt<StandardMath>(state);
+}
+
+void
+FastMathBenchmark::benchmarkFastInvSqrt(unittest::BenchmarkState& state)
+{
+	invSqrt<FastMath>(state);
+}
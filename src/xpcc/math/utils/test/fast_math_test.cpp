@@ -0,0 +1,164 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+#include <algorithm>
+#include <xpcc/math/utils/fast_math.hpp>
+
+#include "fast_math_test.hpp"
+
+using xpcc::math::FastMath;
+
+namespace
+{
+	uint32_t
+	random(uint32_t& state)
+	{
+		state = state * 1664525UL + 1013904223UL;
+		return state;
+	}
+	
+	// Uniform value between -range and range
+	float
+	randomFloat(uint32_t& state, float range)
+	{
+		return (static_cast<float>(random(state) >> 8) / 8388608.f - 1.f) * range;
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+FastMathTest::testIntegerSqrt()
+{
+	TEST_ASSERT_EQUALS(FastMath::integerSqrt(0), 0U);
+	TEST_ASSERT_EQUALS(FastMath::integerSqrt(1), 1U);
+	TEST_ASSERT_EQUALS(FastMath::integerSqrt(2), 1U);
+	TEST_ASSERT_EQUALS(FastMath::integerSqrt(3), 2U);
+	TEST_ASSERT_EQUALS(FastMath::integerSqrt(10000), 100U);
+	
+	// results are rounded and limited to 16 bit
+	TEST_ASSERT_EQUALS(FastMath::integerSqrt(4294836224UL), 65535U);
+	TEST_ASSERT_EQUALS(FastMath::integerSqrt(4294836225UL), 65535U);
+	TEST_ASSERT_EQUALS(FastMath::integerSqrt(0xffffffffUL), 65535U);
+	
+	uint32_t state = 4;
+	uint_fast16_t errors = 0;
+	for (uint_fast16_t i = 0; i < 10000; ++i)
+	{
+		uint32_t value = random(state) >> (random(state) % 32);
+		uint32_t expected = std::min(65535.0,
+				std::floor(std::sqrt(static_cast<double>(value)) + 0.5));
+		if (FastMath::integerSqrt(value) != expected) {
+			errors++;
+		}
+	}
+	TEST_ASSERT_EQUALS(errors, 0U);
+}
+
+void
+FastMathTest::testSqrt()
+{
+	TEST_ASSERT_EQUALS(FastMath::sqrt(0.f), 0.f);
+	TEST_ASSERT_EQUALS_DELTA(FastMath::sqrt(4.f), 2.f, 1e-5f);
+	TEST_ASSERT_EQUALS_DELTA(FastMath::invSqrt(4.f), 0.5f, 3e-6f);
+	
+	uint32_t state = 5;
+	double maxError = 0;
+	for (uint_fast16_t i = 0; i < 10000; ++i)
+	{
+		// values between 1e-6 and 1e6
+		float value = std::pow(10.f, randomFloat(state, 6.f));
+		double expected = std::sqrt(static_cast<double>(value));
+		
+		maxError = std::max(maxError,
+				std::fabs(FastMath::sqrt(value) / expected - 1));
+		maxError = std::max(maxError,
+				std::fabs(FastMath::invSqrt(value) * expected - 1));
+	}
+	TEST_ASSERT_TRUE(maxError < 5e-6);
+}
+
+void
+FastMathTest::testAtan2()
+{
+	TEST_ASSERT_EQUALS(FastMath::atan2(0.f, 0.f), 0.f);
+	TEST_ASSERT_EQUALS_DELTA(FastMath::atan2(1.f, 0.f), M_PI / 2, 1e-6);
+	TEST_ASSERT_EQUALS_DELTA(FastMath::atan2(-1.f, -1.f), -3 * M_PI / 4, 1e-6);
+	TEST_ASSERT_EQUALS_DELTA(FastMath::atan2(1e-20f, 1e20f), 0.0, 1e-6);
+	TEST_ASSERT_EQUALS_DELTA(FastMath::atan2(1e20f, -1e-20f), M_PI / 2, 1e-6);
+	
+	uint32_t state = 6;
+	double maxError = 0;
+	for (uint_fast16_t i = 0; i < 10000; ++i)
+	{
+		float scale = std::pow(10.f, randomFloat(state, 10.f));
+		float x = randomFloat(state, scale);
+		float y = randomFloat(state, scale);
+		
+		double error = std::fabs(FastMath::atan2(y, x) -
+				std::atan2(static_cast<double>(y), static_cast<double>(x)));
+		if (error > M_PI) {
+			// -Pi and Pi are the same angle
+			error = std::fabs(error - 2 * M_PI);
+		}
+		maxError = std::max(maxError, error);
+	}
+	TEST_ASSERT_TRUE(maxError < 1e-6);
+}
+
+void
+FastMathTest::testSinCos()
+{
+	float sin;
+	float cos;
+	
+	FastMath::sinCos(0.f, sin, cos);
+	TEST_ASSERT_EQUALS_DELTA(sin, 0.f, 1e-6f);
+	TEST_ASSERT_EQUALS_DELTA(cos, 1.f, 1e-6f);
+	
+	FastMath::sinCos(-M_PI / 2, sin, cos);
+	TEST_ASSERT_EQUALS_DELTA(sin, -1.f, 1e-6f);
+	TEST_ASSERT_EQUALS_DELTA(cos, 0.f, 1e-6f);
+	
+	uint32_t state = 7;
+	double maxError = 0;
+	for (uint_fast16_t i = 0; i < 10000; ++i)
+	{
+		// also outside of -Pi..Pi
+		float phi = randomFloat(state, 10.f);
+		FastMath::sinCos(phi, sin, cos);
+		
+		maxError = std::max(maxError,
+				std::fabs(sin - std::sin(static_cast<double>(phi))));
+		maxError = std::max(maxError,
+				std::fabs(cos - std::cos(static_cast<double>(phi))));
+	}
+	TEST_ASSERT_TRUE(maxError < 1e-6);
+}
@@ -44,6 +44,39 @@ namespace xpcc
 		}
 		return first;
 	}
+	
+	/**
+	 * \brief	Check at compile time that a list of values is strictly
+	 * 			ascending
+	 * 
+	 * The values are given as separate arguments so that the function
+	 * can be used with the keys of a table inside \c static_assert():
+	 * 
+	 * \code
+	 * static_assert(xpcc::isStrictlyAscending(0x01, 0x05, 0x20), "not sorted");
+	 * \endcode
+	 * 
+	 * \return	\c true if every value is less than the following one
+	 */
+	constexpr bool
+	isStrictlyAscending()
+	{
+		return true;
+	}
+	
+	template <typename T>
+	constexpr bool
+	isStrictlyAscending(T /* last */)
+	{
+		return true;
+	}
+	
+	template <typename T, typename U, typename... Args>
+	constexpr bool
+	isStrictlyAscending(T first, U second, Args... rest)
+	{
+		return (first < second) && isStrictlyAscending(second, rest...);
+	}
 }
 
 #endif	// XPCC__ALGORITHM_HPP
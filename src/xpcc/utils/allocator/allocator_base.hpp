@@ -33,6 +33,7 @@
 
 #include <cstddef>
 #include <new>		// needed for placement new
+#include <utility>	// for std::move() and std::forward()
 
 namespace xpcc
 {
@@ -67,6 +68,32 @@ namespace xpcc
 				::new((void *) p) T(value);
 			}
 			
+			/**
+			 * \brief	Construct an object by moving from \p value
+			 * 
+			 * Same as construct(T*, const T&) but uses the move constructor
+			 * of T, so that resources owned by \p value are taken over
+			 * instead of being copied.
+			 */
+			static inline void
+			construct(T* p, T&& value)
+			{
+				::new((void *) p) T(std::move(value));
+			}
+			
+			/**
+			 * \brief	Construct an object in place
+			 * 
+			 * Constructs an object of type T on the location pointed by p
+			 * using the constructor which matches \p args.
+			 */
+			template <typename... Args>
+			static inline void
+			emplace(T* p, Args&&... args)
+			{
+				::new((void *) p) T(std::forward<Args>(args)...);
+			}
+			
 			/**
 			 * \brief	Destroy an object
 			 * 
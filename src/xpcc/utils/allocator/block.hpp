@@ -72,6 +72,13 @@ namespace xpcc
 			{
 			}
 			
+			/// Stateless, nothing to copy
+			Block&
+			operator = (const Block&)
+			{
+				return *this;
+			}
+			
 			template <typename U>
 			Block(const Block<U, BLOCKSIZE>&) :
 				AllocatorBase<T>()
@@ -67,6 +67,13 @@ namespace xpcc
 			{
 			}
 			
+			/// Stateless, nothing to copy
+			Dynamic&
+			operator = (const Dynamic&)
+			{
+				return *this;
+			}
+			
 			template <typename U>
 			Dynamic(const Dynamic<U>&) :
 				AllocatorBase<T>()
@@ -220,6 +220,31 @@ namespace xpcc
 			};
 		};
 		
+		// --------------------------------------------------------------------
+		/**
+		 * \brief	Check if objects of type T can be relocated with memcpy()
+		 *
+		 * \c TriviallyRelocatable<T>::value is \c true when an object of
+		 * type \c T can be moved to a new memory location by copying its
+		 * bytes and forgetting about the old location, without calling the
+		 * copy/move constructor or the destructor.
+		 *
+		 * This is always the case for types with a trivial copy constructor
+		 * and a trivial destructor. Types which own heap storage but do not
+		 * keep pointers into themselves (e.g. xpcc::DynamicArray) may
+		 * specialize this template to avoid the element-wise move when a
+		 * container is reallocated.
+		 *
+		 * \ingroup	tmp
+		 */
+		template <typename T>
+		struct TriviallyRelocatable
+		{
+			enum {
+				value = (__has_trivial_copy(T) && __has_trivial_destructor(T))
+			};
+		};
+
 		// --------------------------------------------------------------------
 		/**
 		 * \brief	These templates are a set of tools to allow a function
@@ -60,8 +60,16 @@
  * Ben Hoyt, but stripped down for public release. See his blog entry about
  * it for more information: http://blog.micropledge.com/2008/07/protothreads/
  * 
+ * Instead of calling the run() methods in a loop, protothreads derived
+ * from xpcc::pt::Runner::Task can be handled by a xpcc::pt::Runner. The
+ * runner only resumes them when one of their wake sources (PT_SLEEP(),
+ * PT_WAIT_ON() with a xpcc::pt::WaitableSemaphore or
+ * xpcc::pt::WaitableQueue) fired and sleeps otherwise.
+ * 
  * \see	http://www.sics.se/~adam/pt/
  */
 
 #include "protothread/protothread.hpp"
 #include "protothread/semaphore.hpp"
+#include "protothread/runner.hpp"
+#include "protothread/waitable.hpp"
@@ -31,6 +31,8 @@
 #ifndef XPCC_PT__MACROS_HPP
 #define XPCC_PT__MACROS_HPP
 
+#include <xpcc/architecture/utils.hpp>
+
 /**
  * Declare start of protothread
  * 
@@ -66,6 +68,7 @@
     do { \
 		ptYielded = false; \
 		this->ptState = __LINE__; \
+		ATTRIBUTE_FALLTHROUGH; \
 		case __LINE__: \
 			if (!ptYielded) \
 				return true; \
@@ -80,6 +83,7 @@
 #define PT_WAIT_UNTIL(condition) \
     do { \
 		this->ptState = __LINE__; \
+		ATTRIBUTE_FALLTHROUGH; \
 		case __LINE__: \
 			if (!(condition)) \
 				return true; \
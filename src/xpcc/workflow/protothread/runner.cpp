@@ -0,0 +1,418 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/architecture/driver/clock.hpp>
+
+#include "runner.hpp"
+
+#if defined(XPCC_PT__RUNNER_THREADED)
+#	include <pthread.h>
+#	include <sys/time.h>
+#elif defined(XPCC__CPU_AVR)
+#	include <avr/interrupt.h>
+#	include <avr/sleep.h>
+#endif
+
+#ifdef XPCC_PT__RUNNER_THREADED
+namespace
+{
+	// shared by all runners, a notify wakes every sleeping runner
+	pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+	pthread_cond_t condition = PTHREAD_COND_INITIALIZER;
+}
+
+xpcc::pt::Runner::Lock::Lock()
+{
+	pthread_mutex_lock(&mutex);
+}
+
+xpcc::pt::Runner::Lock::~Lock()
+{
+	pthread_mutex_unlock(&mutex);
+}
+#endif
+
+// ----------------------------------------------------------------------------
+xpcc::pt::Runner::Task::Task() :
+	runner(0), waitList(0), wakeup(), state(IDLE)
+{
+}
+
+void
+xpcc::pt::Runner::Task::waitOn(WaitList& list)
+{
+	Lock lock;
+	if (this->state == RUNNING)
+	{
+		this->state = WAITING;
+		this->waitList = &list;
+		list.tasks.append(*this);
+	}
+}
+
+void
+xpcc::pt::Runner::Task::cancelWait()
+{
+	Lock lock;
+	if (this->state == WAITING)
+	{
+		this->waitList->tasks.remove(*this);
+		this->waitList = 0;
+		this->state = RUNNING;
+	}
+	else if (this->state == READY)
+	{
+		// notified between waitOn() and the check of the condition
+		this->runner->readyList.remove(*this);
+		this->state = RUNNING;
+	}
+}
+
+void
+xpcc::pt::Runner::Task::sleep(uint16_t milliseconds)
+{
+	this->wakeup = xpcc::Clock::now() + milliseconds;
+	
+	Lock lock;
+	if (this->state != RUNNING) {
+		// not driven by a runner, PT_SLEEP() falls back to polling
+		return;
+	}
+	this->state = SLEEPING;
+	
+	// the queue is sorted, new entries are usually the latest ones
+	TimerQueue& queue = this->runner->timerQueue;
+	if (queue.isEmpty()) {
+		queue.append(*this);
+		return;
+	}
+	
+	Task *position = &queue.getBack();
+	while (position != 0 && this->wakeup < position->wakeup) {
+		position = TimerQueue::getPrevious(*position);
+	}
+	
+	if (position == 0) {
+		queue.prepend(*this);
+	}
+	else {
+		queue.insertAfter(*position, *this);
+	}
+}
+
+bool
+xpcc::pt::Runner::Task::isAwake() const
+{
+	return (xpcc::Clock::now() >= this->wakeup);
+}
+
+// ----------------------------------------------------------------------------
+uint32_t
+xpcc::pt::Runner::Statistics::getResumesPerSecond() const
+{
+	if (milliseconds == 0) {
+		return 0;
+	}
+	return static_cast<uint64_t>(resumes) * 1000 / milliseconds;
+}
+
+uint32_t
+xpcc::pt::Runner::Statistics::getWakeupsPerSecond() const
+{
+	if (milliseconds == 0) {
+		return 0;
+	}
+	return static_cast<uint64_t>(wakeups) * 1000 / milliseconds;
+}
+
+// ----------------------------------------------------------------------------
+xpcc::pt::Runner::Runner() :
+	readyList(), timerQueue(), passEnd(0), taskCount(0),
+	lastTime(xpcc::Clock::now()), statistics()
+{
+}
+
+// ----------------------------------------------------------------------------
+void
+xpcc::pt::Runner::addTask(Task& task)
+{
+	Lock lock;
+	
+	task.runner = this;
+	this->taskCount++;
+	this->makeReady(task);
+}
+
+// ----------------------------------------------------------------------------
+bool
+xpcc::pt::Runner::removeTask(Task& task)
+{
+	Lock lock;
+	
+	if (task.state == Task::IDLE || task.runner != this) {
+		return false;
+	}
+	
+	switch (task.state)
+	{
+		case Task::READY:
+			if (&task == this->passEnd) {
+				// end the current pass early
+				this->passEnd = 0;
+			}
+			this->readyList.remove(task);
+			break;
+		
+		case Task::WAITING:
+			task.waitList->tasks.remove(task);
+			task.waitList = 0;
+			break;
+		
+		case Task::SLEEPING:
+			this->timerQueue.remove(task);
+			break;
+		
+		default:
+			// RUNNING: removed by itself, schedule() drops it afterwards
+			break;
+	}
+	
+	task.state = Task::IDLE;
+	task.runner = 0;
+	this->taskCount--;
+	
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+bool
+xpcc::pt::Runner::schedule()
+{
+	xpcc::Timestamp now = xpcc::Clock::now();
+	
+	Task *task;
+	{
+		Lock lock;
+		
+		this->statistics.milliseconds += (now - this->lastTime).getTime();
+		this->lastTime = now;
+		
+		while (!this->timerQueue.isEmpty() &&
+				this->timerQueue.getFront().wakeup <= now)
+		{
+			Task& front = this->timerQueue.getFront();
+			this->timerQueue.removeFront();
+			this->makeReady(front);
+		}
+		
+		if (this->readyList.isEmpty()) {
+			return false;
+		}
+		this->passEnd = &this->readyList.getBack();
+		
+		task = &this->readyList.getFront();
+		this->readyList.removeFront();
+		task->state = Task::RUNNING;
+	}
+	
+	while (true)
+	{
+		bool running = task->run();
+		
+		Lock lock;
+		
+		this->statistics.resumes++;
+		if (task->state == Task::RUNNING)
+		{
+			if (running) {
+				// yielded or polling, resume it again at the next pass
+				task->state = Task::READY;
+				this->readyList.append(*task);
+			}
+			else {
+				task->state = Task::IDLE;
+				task->runner = 0;
+				this->taskCount--;
+			}
+		}
+		
+		if (task == this->passEnd || this->passEnd == 0 ||
+				this->readyList.isEmpty())
+		{
+			this->passEnd = 0;
+			return !this->readyList.isEmpty();
+		}
+		
+		task = &this->readyList.getFront();
+		this->readyList.removeFront();
+		task->state = Task::RUNNING;
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+xpcc::pt::Runner::idle()
+{
+#if defined(XPCC_PT__RUNNER_THREADED)
+	pthread_mutex_lock(&mutex);
+	if (this->readyList.isEmpty())
+	{
+		if (this->timerQueue.isEmpty()) {
+			pthread_cond_wait(&condition, &mutex);
+		}
+		else
+		{
+			xpcc::Timestamp now = xpcc::Clock::now();
+			xpcc::Timestamp wakeup = this->timerQueue.getFront().wakeup;
+			if (wakeup > now)
+			{
+				uint32_t delay = (wakeup - now).getTime();
+				
+				struct timeval tv;
+				gettimeofday(&tv, 0);
+				
+				struct timespec timeout;
+				uint32_t usec = tv.tv_usec + (delay % 1000) * 1000;
+				timeout.tv_sec = tv.tv_sec + delay / 1000 + usec / 1000000;
+				timeout.tv_nsec = (usec % 1000000) * 1000;
+				
+				pthread_cond_timedwait(&condition, &mutex, &timeout);
+			}
+		}
+	}
+	pthread_mutex_unlock(&mutex);
+#elif defined(XPCC__CPU_AVR)
+	cli();
+	if (this->readyList.isEmpty())
+	{
+		set_sleep_mode(SLEEP_MODE_IDLE);
+		sleep_enable();
+		// the instruction following sei is executed before any pending
+		// interrupt, so no wakeup is lost between the check and the sleep
+		sei();
+		sleep_cpu();
+		sleep_disable();
+	}
+	sei();
+#elif defined(XPCC__CPU_CORTEX_M0) || defined(XPCC__CPU_CORTEX_M3) || defined(XPCC__CPU_CORTEX_M4)
+	{
+		// a pending interrupt ends the WFI even when it is masked
+		xpcc::atomic::Lock lock;
+		if (this->readyList.isEmpty()) {
+			asm volatile ("wfi");
+		}
+	}
+#else
+	// no way to sleep, the runner degrades to polling
+#endif
+	
+	Lock lock;
+	this->statistics.wakeups++;
+}
+
+// ----------------------------------------------------------------------------
+void
+xpcc::pt::Runner::run()
+{
+	while (this->taskCount > 0)
+	{
+		// the last task may have ended during this pass
+		if (!this->schedule() && this->taskCount > 0) {
+			this->idle();
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+xpcc::pt::Runner::resetStatistics()
+{
+	xpcc::Timestamp now = xpcc::Clock::now();
+	
+	Lock lock;
+	this->lastTime = now;
+	this->statistics.resumes = 0;
+	this->statistics.wakeups = 0;
+	this->statistics.milliseconds = 0;
+}
+
+// ----------------------------------------------------------------------------
+void
+xpcc::pt::Runner::makeReady(Task& task)
+{
+	task.state = Task::READY;
+	this->readyList.append(task);
+	
+#ifdef XPCC_PT__RUNNER_THREADED
+	pthread_cond_broadcast(&condition);
+#endif
+}
+
+// ----------------------------------------------------------------------------
+xpcc::pt::WaitList::WaitList() :
+	tasks()
+{
+}
+
+bool
+xpcc::pt::WaitList::notifyOne()
+{
+	Runner::Lock lock;
+	return this->wakeOne();
+}
+
+void
+xpcc::pt::WaitList::notifyAll()
+{
+	Runner::Lock lock;
+	this->wakeAll();
+}
+
+bool
+xpcc::pt::WaitList::wakeOne()
+{
+	if (this->tasks.isEmpty()) {
+		return false;
+	}
+	
+	Runner::Task& task = this->tasks.getFront();
+	this->tasks.removeFront();
+	task.waitList = 0;
+	task.runner->makeReady(task);
+	
+	return true;
+}
+
+void
+xpcc::pt::WaitList::wakeAll()
+{
+	while (this->wakeOne()) {
+	}
+}
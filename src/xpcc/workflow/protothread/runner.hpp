@@ -0,0 +1,401 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_PT__RUNNER_HPP
+#define XPCC_PT__RUNNER_HPP
+
+#include <stdint.h>
+
+#include <xpcc/architecture/utils.hpp>
+#include <xpcc/architecture/driver/atomic/lock.hpp>
+#include <xpcc/container/intrusive_linked_list.hpp>
+#include <xpcc/container/intrusive_doubly_linked_list.hpp>
+#include <xpcc/workflow/timestamp.hpp>
+
+#include "protothread.hpp"
+
+#if defined(XPCC__CPU_HOSTED) && (defined(XPCC__OS_UNIX) || defined(XPCC__OS_OSX))
+	// wait-lists may be signalled from other threads of the process
+#	define XPCC_PT__RUNNER_THREADED	1
+#endif
+
+namespace xpcc
+{
+	namespace pt
+	{
+		class WaitList;
+		
+		/**
+		 * \brief	Event-driven protothread runner
+		 * 
+		 * Calling run() of every protothread in the main loop re-evaluates
+		 * every PT_WAIT_UNTIL() condition on every pass, even if nothing
+		 * has changed. The runner instead only resumes a task when it was
+		 * woken by one of its wake sources:
+		 * 
+		 * - PT_SLEEP(): the task is put in the timer queue of the runner,
+		 *   which is sorted by the wakeup time.
+		 * - PT_WAIT_ON(): the task is put in a xpcc::pt::WaitList, e.g. a
+		 *   xpcc::pt::WaitableSemaphore or a xpcc::pt::WaitableQueue, and
+		 *   resumed when the list is notified.
+		 * 
+		 * If no task is ready the runner sleeps in idle(): with \c WFI on
+		 * the Cortex-M, in the idle sleep mode on the AVR and on a
+		 * condition variable until the next timer expires on hosted
+		 * Unix targets. The xpcc::Clock interrupt has to keep running to
+		 * wake up the targets for the timer queue.
+		 * 
+		 * Tasks using PT_YIELD() or PT_WAIT_UNTIL() stay ready and are
+		 * resumed on every pass like before, which keeps the runner from
+		 * sleeping.
+		 * 
+		 * Example:
+		 * \code
+		 * class Consumer : public xpcc::pt::Runner::Task
+		 * {
+		 * public:
+		 *     bool
+		 *     run()
+		 *     {
+		 *         PT_BEGIN();
+		 *         while (true)
+		 *         {
+		 *             PT_WAIT_ON(queue, !queue.isEmpty());
+		 *             process(queue.get());
+		 *             queue.pop();
+		 *             
+		 *             PT_SLEEP(10);
+		 *         }
+		 *         PT_END();
+		 *     }
+		 * };
+		 * 
+		 * xpcc::pt::Runner runner;
+		 * Consumer consumer;
+		 * 
+		 * runner.addTask(consumer);
+		 * runner.run();
+		 * \endcode
+		 * 
+		 * Notifying a wait-list is allowed from interrupts and, on hosted
+		 * targets, from other threads.
+		 * 
+		 * \ingroup	protothread
+		 */
+		class Runner
+		{
+		public:
+			/**
+			 * \brief	Protothread managed by a runner
+			 * 
+			 * Other than xpcc::pt::Protothread the run() method is
+			 * virtual here, so that the runner can resume all tasks
+			 * through one list.
+			 */
+			class Task : public Protothread
+			{
+			public:
+				Task();
+				
+				/// \see	xpcc::pt::Protothread::run()
+				virtual bool
+				run() = 0;
+				
+			protected:
+				/// Wait on \p list, used by PT_WAIT_ON()
+				void
+				waitOn(WaitList& list);
+				
+				/// Undo waitOn() if the condition became true, used by PT_WAIT_ON()
+				void
+				cancelWait();
+				
+				/// Put the task in the timer queue, used by PT_SLEEP()
+				void
+				sleep(uint16_t milliseconds);
+				
+				/// \c true if the time given to sleep() has passed
+				bool
+				isAwake() const;
+				
+			private:
+				friend class Runner;
+				friend class WaitList;
+				
+				xpcc::IntrusiveLinkedListHook<Task> readyHook;
+				
+				/// Used for either a wait-list or the timer queue
+				xpcc::IntrusiveDoublyLinkedListHook<Task> waitHook;
+				
+				Runner *runner;
+				WaitList *waitList;
+				xpcc::Timestamp wakeup;
+				enum {
+					IDLE,		///< not added to a runner
+					READY,
+					RUNNING,
+					WAITING,	///< in a wait-list
+					SLEEPING	///< in the timer queue
+				} state;
+			};
+			
+			/**
+			 * \brief	Critical section for the lists of the runner
+			 * 
+			 * Disables the interrupts on the targets and locks a mutex
+			 * on hosted targets.
+			 */
+			class Lock
+			{
+			public:
+#ifdef XPCC_PT__RUNNER_THREADED
+				Lock();
+				
+				~Lock();
+#else
+				ALWAYS_INLINE
+				Lock()
+				{
+				}
+#endif
+				
+			private:
+				Lock(const Lock&);
+				
+				Lock&
+				operator = (const Lock&);
+				
+#ifndef XPCC_PT__RUNNER_THREADED
+				xpcc::atomic::Lock lock;
+#endif
+			};
+			
+			struct Statistics
+			{
+				uint32_t resumes;		///< Calls of Task::run()
+				uint32_t wakeups;		///< Returns from idle()
+				uint32_t milliseconds;	///< Time covered by the counters
+				
+				uint32_t
+				getResumesPerSecond() const;
+				
+				uint32_t
+				getWakeupsPerSecond() const;
+			};
+			
+		public:
+			Runner();
+			
+			/**
+			 * \brief	Add a task, it is resumed at the next pass
+			 * 
+			 * \param	task	Task to run, must not be added already
+			 */
+			void
+			addTask(Task& task);
+			
+			/**
+			 * \brief	Remove a task from the runner
+			 * 
+			 * May also be called by the task itself from inside its
+			 * run() method. Tasks which end are removed automatically.
+			 * 
+			 * \return	\c false if the task wasn't added
+			 */
+			bool
+			removeTask(Task& task);
+			
+			/**
+			 * \brief	Resume all tasks which are ready
+			 * 
+			 * Moves the expired timers to the ready list and resumes every
+			 * task which was ready at the beginning of the pass once.
+			 * 
+			 * \return	\c true if tasks are still ready, \c false if the
+			 * 			runner may sleep with idle()
+			 */
+			bool
+			schedule();
+			
+			/**
+			 * \brief	Sleep until a task may have become ready
+			 * 
+			 * Returns immediately if a task is ready. Spurious returns
+			 * are possible, e.g. for every tick of the xpcc::Clock on
+			 * the targets.
+			 */
+			void
+			idle();
+			
+			/// Run until all tasks have ended or were removed
+			void
+			run();
+			
+			/// Number of tasks added to the runner
+			inline uint16_t
+			getTaskCount() const
+			{
+				return taskCount;
+			}
+			
+			inline const Statistics&
+			getStatistics() const
+			{
+				return statistics;
+			}
+			
+			void
+			resetStatistics();
+			
+		private:
+			friend class WaitList;
+			
+			typedef xpcc::IntrusiveLinkedList<Task, &Task::readyHook> ReadyList;
+			typedef xpcc::IntrusiveDoublyLinkedList<Task, &Task::waitHook> TimerQueue;
+			
+			/// Must be called with the lock held
+			void
+			makeReady(Task& task);
+			
+			ReadyList readyList;
+			
+			/// Sleeping tasks, ordered by ascending wakeup time
+			TimerQueue timerQueue;
+			
+			/// Last task of the current pass of schedule()
+			Task *passEnd;
+			
+			uint16_t taskCount;
+			xpcc::Timestamp lastTime;
+			Statistics statistics;
+		};
+		
+		/**
+		 * \brief	Tasks waiting for an event
+		 * 
+		 * Base class of the wake sources used with PT_WAIT_ON(). A task
+		 * can only wait on one list at a time.
+		 * 
+		 * \ingroup	protothread
+		 */
+		class WaitList
+		{
+		public:
+			WaitList();
+			
+			inline bool
+			hasWaitingTasks() const
+			{
+				return !tasks.isEmpty();
+			}
+			
+			/**
+			 * \brief	Wake the task waiting the longest
+			 * 
+			 * \return	\c false if no task was waiting
+			 */
+			bool
+			notifyOne();
+			
+			/// Wake all waiting tasks
+			void
+			notifyAll();
+			
+		protected:
+			/// notifyOne() with the Runner::Lock already held
+			bool
+			wakeOne();
+			
+			/// notifyAll() with the Runner::Lock already held
+			void
+			wakeAll();
+			
+		private:
+			friend class Runner;
+			
+			WaitList(const WaitList&);
+			
+			WaitList&
+			operator = (const WaitList&);
+			
+			xpcc::IntrusiveDoublyLinkedList<Runner::Task, &Runner::Task::waitHook> tasks;
+		};
+	}
+}
+
+/**
+ * Wait on a wait-list of the runner until given condition is true.
+ * 
+ * The task is only resumed again after \p waitList was notified, so the
+ * condition is not polled. It is checked again after the task was put in
+ * the list, so a notify from an interrupt in between is not lost. Only
+ * usable in a xpcc::pt::Runner::Task.
+ * 
+ * \code
+ * PT_WAIT_ON(semaphore, semaphore.acquire());
+ * \endcode
+ * 
+ * \ingroup	protothread
+ * \hideinitializer
+ */
+#define PT_WAIT_ON(waitList, condition) \
+    do { \
+		this->ptState = __LINE__; \
+		ATTRIBUTE_FALLTHROUGH; \
+		case __LINE__: \
+			if (!(condition)) \
+			{ \
+				this->waitOn(waitList); \
+				if (!(condition)) \
+					return true; \
+				this->cancelWait(); \
+			} \
+    } while (0)
+
+/**
+ * Suspend the task for given number of milliseconds (at most 32767).
+ * 
+ * The task is put in the timer queue of the runner instead of polling a
+ * xpcc::Timeout. Only usable in a xpcc::pt::Runner::Task.
+ * 
+ * \ingroup	protothread
+ * \hideinitializer
+ */
+#define PT_SLEEP(milliseconds) \
+    do { \
+		this->sleep(milliseconds); \
+		this->ptState = __LINE__; \
+		ATTRIBUTE_FALLTHROUGH; \
+		case __LINE__: \
+			if (!this->isAwake()) \
+				return true; \
+    } while (0)
+
+#endif // XPCC_PT__RUNNER_HPP
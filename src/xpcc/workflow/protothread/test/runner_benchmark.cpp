@@ -0,0 +1,154 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/workflow/protothread.hpp>
+
+#include "runner_benchmark.hpp"
+
+namespace
+{
+	const uint8_t threadCount = 32;
+	
+	class PollingThread : public xpcc::pt::Protothread
+	{
+	public:
+		PollingThread() :
+			semaphore(0), count(0)
+		{
+		}
+		
+		bool
+		run()
+		{
+			PT_BEGIN();
+			while (true)
+			{
+				PT_WAIT_UNTIL(semaphore.acquire());
+				this->count++;
+			}
+			PT_END();
+		}
+		
+		xpcc::pt::Semaphore semaphore;
+		uint32_t count;
+	};
+	
+	class WaitingTask : public xpcc::pt::Runner::Task
+	{
+	public:
+		WaitingTask() :
+			semaphore(0), count(0)
+		{
+		}
+		
+		bool
+		run()
+		{
+			PT_BEGIN();
+			while (true)
+			{
+				PT_WAIT_ON(semaphore, semaphore.acquire());
+				this->count++;
+			}
+			PT_END();
+		}
+		
+		xpcc::pt::WaitableSemaphore semaphore;
+		uint32_t count;
+	};
+}
+
+void
+RunnerBenchmark::setUp()
+{
+}
+
+void
+RunnerBenchmark::tearDown()
+{
+}
+
+// ----------------------------------------------------------------------------
+void
+RunnerBenchmark::benchmarkPolling(unittest::BenchmarkState& state)
+{
+	PollingThread threads[threadCount];
+	
+	uint8_t next = 0;
+	while (state.keepRunning())
+	{
+		threads[next].semaphore.release();
+		next = (next + 1) % threadCount;
+		
+		for (uint8_t i = 0; i < threadCount; ++i) {
+			threads[i].run();
+		}
+	}
+	unittest::doNotOptimize(threads[0].count);
+}
+
+void
+RunnerBenchmark::benchmarkPollingIdle(unittest::BenchmarkState& state)
+{
+	PollingThread threads[threadCount];
+	
+	while (state.keepRunning())
+	{
+		for (uint8_t i = 0; i < threadCount; ++i) {
+			threads[i].run();
+		}
+	}
+	unittest::doNotOptimize(threads[0].count);
+}
+
+void
+RunnerBenchmark::benchmarkRunner(unittest::BenchmarkState& state)
+{
+	WaitingTask tasks[threadCount];
+	xpcc::pt::Runner runner;
+	for (uint8_t i = 0; i < threadCount; ++i) {
+		runner.addTask(tasks[i]);
+	}
+	runner.schedule();
+	
+	uint8_t next = 0;
+	while (state.keepRunning())
+	{
+		tasks[next].semaphore.release();
+		next = (next + 1) % threadCount;
+		
+		runner.schedule();
+	}
+	unittest::doNotOptimize(tasks[0].count);
+	
+	for (uint8_t i = 0; i < threadCount; ++i) {
+		runner.removeTask(tasks[i]);
+	}
+}
@@ -0,0 +1,529 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/workflow/protothread.hpp>
+#include <xpcc/architecture/driver/test/testing_clock.hpp>
+
+#ifdef XPCC_PT__RUNNER_THREADED
+#	include <pthread.h>
+#	include <unistd.h>
+#endif
+
+#include "runner_test.hpp"
+
+// ----------------------------------------------------------------------------
+namespace
+{
+	class YieldingTask : public xpcc::pt::Runner::Task
+	{
+	public:
+		YieldingTask() :
+			state(0)
+		{
+		}
+		
+		bool
+		run()
+		{
+			PT_BEGIN();
+			
+			this->state = 1;
+			PT_YIELD();
+			
+			this->state = 2;
+			PT_YIELD();
+			
+			this->state = 3;
+			
+			PT_END();
+		}
+		
+		uint8_t state;
+	};
+	
+	class SemaphoreTask : public xpcc::pt::Runner::Task
+	{
+	public:
+		SemaphoreTask(xpcc::pt::WaitableSemaphore& semaphore) :
+			semaphore(semaphore), acquired(0), resumes(0)
+		{
+		}
+		
+		bool
+		run()
+		{
+			this->resumes++;
+			
+			PT_BEGIN();
+			
+			while (true)
+			{
+				PT_WAIT_ON(semaphore, semaphore.acquire());
+				this->acquired++;
+			}
+			
+			PT_END();
+		}
+		
+		xpcc::pt::WaitableSemaphore& semaphore;
+		uint8_t acquired;
+		uint8_t resumes;
+	};
+	
+	class SleepingTask : public xpcc::pt::Runner::Task
+	{
+	public:
+		SleepingTask(uint16_t delay, uint8_t *order, uint8_t& position) :
+			delay(delay), order(order), position(position), resumes(0)
+		{
+		}
+		
+		bool
+		run()
+		{
+			this->resumes++;
+			
+			PT_BEGIN();
+			
+			PT_SLEEP(this->delay);
+			this->order[this->position++] = this->delay;
+			
+			PT_END();
+		}
+		
+		uint16_t delay;
+		uint8_t *order;
+		uint8_t& position;
+		uint8_t resumes;
+	};
+	
+	typedef xpcc::pt::WaitableQueue<uint8_t, 4> Queue;
+	
+	class ConsumerTask : public xpcc::pt::Runner::Task
+	{
+	public:
+		ConsumerTask(Queue& queue) :
+			queue(queue), sum(0), resumes(0)
+		{
+		}
+		
+		bool
+		run()
+		{
+			this->resumes++;
+			
+			PT_BEGIN();
+			
+			while (true)
+			{
+				PT_WAIT_ON(queue, !queue.isEmpty());
+				this->sum += queue.get();
+				queue.pop();
+				
+				// let the other consumer try
+				PT_YIELD();
+			}
+			
+			PT_END();
+		}
+		
+		Queue& queue;
+		uint16_t sum;
+		uint8_t resumes;
+	};
+	
+	class SelfNotifyingTask : public xpcc::pt::Runner::Task
+	{
+	public:
+		SelfNotifyingTask(xpcc::pt::WaitList& list) :
+			list(list), state(0)
+		{
+		}
+		
+		bool
+		run()
+		{
+			PT_BEGIN();
+			
+			PT_WAIT_ON(list, notify());
+			this->state = 1;
+			
+			PT_WAIT_ON(list, false);
+			
+			PT_END();
+		}
+		
+		bool
+		notify()
+		{
+			// simulates an interrupt firing right after waitOn()
+			return this->list.notifyOne();
+		}
+		
+		xpcc::pt::WaitList& list;
+		uint8_t state;
+	};
+}
+
+// ----------------------------------------------------------------------------
+void
+RunnerTest::setUp()
+{
+	TestingClock::time = 0;
+}
+
+// ----------------------------------------------------------------------------
+void
+RunnerTest::testPolling()
+{
+	xpcc::pt::Runner runner;
+	YieldingTask task;
+	
+	TEST_ASSERT_FALSE(runner.schedule());
+	
+	runner.addTask(task);
+	TEST_ASSERT_EQUALS(runner.getTaskCount(), 1U);
+	
+	TEST_ASSERT_TRUE(runner.schedule());
+	TEST_ASSERT_EQUALS(task.state, 1);
+	
+	TEST_ASSERT_TRUE(runner.schedule());
+	TEST_ASSERT_EQUALS(task.state, 2);
+	
+	// the task ends and is removed
+	TEST_ASSERT_FALSE(runner.schedule());
+	TEST_ASSERT_EQUALS(task.state, 3);
+	TEST_ASSERT_EQUALS(runner.getTaskCount(), 0U);
+	
+	TEST_ASSERT_FALSE(runner.removeTask(task));
+	
+	// ends immediately
+	task.restart();
+	runner.addTask(task);
+	runner.run();
+	TEST_ASSERT_EQUALS(task.state, 3);
+	TEST_ASSERT_FALSE(task.isRunning());
+	TEST_ASSERT_EQUALS(runner.getStatistics().resumes, 6U);
+}
+
+// ----------------------------------------------------------------------------
+void
+RunnerTest::testSemaphore()
+{
+	xpcc::pt::Runner runner;
+	xpcc::pt::WaitableSemaphore semaphore(1);
+	SemaphoreTask task1(semaphore);
+	SemaphoreTask task2(semaphore);
+	
+	runner.addTask(task1);
+	runner.addTask(task2);
+	
+	// task1 gets the semaphore and waits again, task2 waits
+	TEST_ASSERT_FALSE(runner.schedule());
+	TEST_ASSERT_EQUALS(task1.acquired, 1);
+	TEST_ASSERT_EQUALS(task2.acquired, 0);
+	
+	// nothing is polled while waiting
+	for (uint8_t i = 0; i < 10; ++i) {
+		TEST_ASSERT_FALSE(runner.schedule());
+	}
+	TEST_ASSERT_EQUALS(task1.resumes, 1);
+	TEST_ASSERT_EQUALS(task2.resumes, 1);
+	
+	// the longest waiting task is woken first
+	semaphore.release();
+	TEST_ASSERT_FALSE(runner.schedule());
+	TEST_ASSERT_EQUALS(task1.acquired, 2);
+	TEST_ASSERT_EQUALS(task2.acquired, 0);
+	TEST_ASSERT_EQUALS(task1.resumes, 2);
+	TEST_ASSERT_EQUALS(task2.resumes, 1);
+	
+	// task2 is resumed first and takes both, task1 has to wait again
+	semaphore.release();
+	semaphore.release();
+	TEST_ASSERT_FALSE(runner.schedule());
+	TEST_ASSERT_EQUALS(task1.acquired, 2);
+	TEST_ASSERT_EQUALS(task2.acquired, 2);
+	TEST_ASSERT_EQUALS(task1.resumes, 3);
+	TEST_ASSERT_TRUE(semaphore.hasWaitingTasks());
+	TEST_ASSERT_FALSE(semaphore.acquire());
+}
+
+// ----------------------------------------------------------------------------
+void
+RunnerTest::testSleep()
+{
+	xpcc::pt::Runner runner;
+	uint8_t order[3] = { 0, 0, 0 };
+	uint8_t position = 0;
+	
+	SleepingTask task1(10, order, position);
+	SleepingTask task2(5, order, position);
+	SleepingTask task3(20, order, position);
+	
+	runner.addTask(task1);
+	runner.addTask(task2);
+	runner.addTask(task3);
+	
+	TEST_ASSERT_FALSE(runner.schedule());
+	
+	TestingClock::time = 4;
+	TEST_ASSERT_FALSE(runner.schedule());
+	TEST_ASSERT_EQUALS(position, 0);
+	
+	TestingClock::time = 5;
+	TEST_ASSERT_FALSE(runner.schedule());
+	TEST_ASSERT_EQUALS(position, 1);
+	TEST_ASSERT_EQUALS(order[0], 5);
+	
+	// both expired timers are resumed in the same pass
+	TestingClock::time = 25;
+	TEST_ASSERT_FALSE(runner.schedule());
+	TEST_ASSERT_EQUALS(position, 3);
+	TEST_ASSERT_EQUALS(order[1], 10);
+	TEST_ASSERT_EQUALS(order[2], 20);
+	
+	TEST_ASSERT_EQUALS(task1.resumes, 2);
+	TEST_ASSERT_EQUALS(task2.resumes, 2);
+	TEST_ASSERT_EQUALS(task3.resumes, 2);
+	TEST_ASSERT_EQUALS(runner.getTaskCount(), 0U);
+	
+	// without a runner PT_SLEEP() polls the clock
+	SleepingTask task4(3, order, position);
+	position = 0;
+	TEST_ASSERT_TRUE(task4.run());
+	TEST_ASSERT_TRUE(task4.run());
+	TestingClock::time = 28;
+	TEST_ASSERT_FALSE(task4.run());
+	TEST_ASSERT_EQUALS(order[0], 3);
+}
+
+// ----------------------------------------------------------------------------
+void
+RunnerTest::testQueue()
+{
+	xpcc::pt::Runner runner;
+	Queue queue;
+	ConsumerTask consumer1(queue);
+	ConsumerTask consumer2(queue);
+	
+	runner.addTask(consumer1);
+	runner.addTask(consumer2);
+	
+	TEST_ASSERT_FALSE(runner.schedule());
+	TEST_ASSERT_TRUE(queue.hasWaitingTasks());
+	
+	// both are woken, only one gets the value
+	TEST_ASSERT_TRUE(queue.push(7));
+	TEST_ASSERT_TRUE(runner.schedule());
+	TEST_ASSERT_EQUALS(consumer1.sum, 7);
+	TEST_ASSERT_EQUALS(consumer2.sum, 0);
+	
+	// consumer1 continues after its yield and waits again
+	TEST_ASSERT_FALSE(runner.schedule());
+	TEST_ASSERT_EQUALS(consumer1.resumes, 3);
+	TEST_ASSERT_EQUALS(consumer2.resumes, 2);
+	
+	TEST_ASSERT_TRUE(queue.push(1));
+	TEST_ASSERT_TRUE(queue.push(2));
+	TEST_ASSERT_TRUE(runner.schedule());
+	TEST_ASSERT_FALSE(runner.schedule());
+	TEST_ASSERT_EQUALS(consumer1.sum + consumer2.sum, 10);
+	TEST_ASSERT_TRUE(queue.isEmpty());
+	
+	for (uint8_t i = 0; i < 10; ++i) {
+		TEST_ASSERT_FALSE(runner.schedule());
+	}
+	TEST_ASSERT_EQUALS(consumer1.resumes, 5);
+	TEST_ASSERT_EQUALS(consumer2.resumes, 4);
+}
+
+// ----------------------------------------------------------------------------
+void
+RunnerTest::testNotifyBeforeCheck()
+{
+	xpcc::pt::Runner runner;
+	xpcc::pt::WaitList list;
+	SelfNotifyingTask task(list);
+	
+	runner.addTask(task);
+	
+	// the task continues without being resumed twice
+	TEST_ASSERT_FALSE(runner.schedule());
+	TEST_ASSERT_EQUALS(task.state, 1);
+	TEST_ASSERT_EQUALS(runner.getStatistics().resumes, 1U);
+	TEST_ASSERT_TRUE(list.hasWaitingTasks());
+	
+	TEST_ASSERT_FALSE(runner.schedule());
+	TEST_ASSERT_EQUALS(runner.getStatistics().resumes, 1U);
+	
+	TEST_ASSERT_TRUE(list.notifyOne());
+	TEST_ASSERT_FALSE(list.notifyOne());
+	TEST_ASSERT_FALSE(runner.schedule());
+	TEST_ASSERT_EQUALS(runner.getStatistics().resumes, 2U);
+	TEST_ASSERT_TRUE(list.hasWaitingTasks());
+}
+
+// ----------------------------------------------------------------------------
+void
+RunnerTest::testRemoveTask()
+{
+	xpcc::pt::Runner runner;
+	xpcc::pt::WaitableSemaphore semaphore(0);
+	SemaphoreTask waiting(semaphore);
+	
+	uint8_t order[1] = { 0 };
+	uint8_t position = 0;
+	SleepingTask sleeping(10, order, position);
+	
+	YieldingTask ready;
+	
+	runner.addTask(waiting);
+	runner.addTask(sleeping);
+	TEST_ASSERT_FALSE(runner.schedule());
+	
+	runner.addTask(ready);
+	TEST_ASSERT_EQUALS(runner.getTaskCount(), 3U);
+	
+	TEST_ASSERT_TRUE(runner.removeTask(waiting));
+	TEST_ASSERT_FALSE(semaphore.hasWaitingTasks());
+	TEST_ASSERT_TRUE(runner.removeTask(sleeping));
+	TEST_ASSERT_TRUE(runner.removeTask(ready));
+	TEST_ASSERT_FALSE(runner.removeTask(ready));
+	TEST_ASSERT_EQUALS(runner.getTaskCount(), 0U);
+	
+	// nothing is resumed anymore
+	semaphore.release();
+	TestingClock::time = 10;
+	TEST_ASSERT_FALSE(runner.schedule());
+	TEST_ASSERT_EQUALS(waiting.resumes, 1);
+	TEST_ASSERT_EQUALS(sleeping.resumes, 1);
+	TEST_ASSERT_EQUALS(ready.state, 0);
+	
+	// a task added to another runner can't be removed here
+	xpcc::pt::Runner other;
+	other.addTask(ready);
+	TEST_ASSERT_FALSE(runner.removeTask(ready));
+	TEST_ASSERT_TRUE(other.removeTask(ready));
+}
+
+// ----------------------------------------------------------------------------
+void
+RunnerTest::testStatistics()
+{
+	xpcc::pt::Runner runner;
+	xpcc::pt::WaitableSemaphore semaphore(0);
+	SemaphoreTask task(semaphore);
+	
+	runner.addTask(task);
+	TEST_ASSERT_FALSE(runner.schedule());
+	
+	runner.resetStatistics();
+	for (uint16_t i = 1; i <= 100; ++i)
+	{
+		TestingClock::time = i * 10;
+		if (i % 10 == 0) {
+			semaphore.release();
+		}
+		TEST_ASSERT_FALSE(runner.schedule());
+	}
+	
+	const xpcc::pt::Runner::Statistics& statistics = runner.getStatistics();
+	TEST_ASSERT_EQUALS(statistics.resumes, 10U);
+	TEST_ASSERT_EQUALS(statistics.milliseconds, 1000U);
+	TEST_ASSERT_EQUALS(statistics.getResumesPerSecond(), 10U);
+	TEST_ASSERT_EQUALS(statistics.getWakeupsPerSecond(), 0U);
+	TEST_ASSERT_EQUALS(task.acquired, 10);
+	
+	runner.resetStatistics();
+	TEST_ASSERT_EQUALS(runner.getStatistics().resumes, 0U);
+	TEST_ASSERT_EQUALS(runner.getStatistics().getResumesPerSecond(), 0U);
+}
+
+// ----------------------------------------------------------------------------
+#ifdef XPCC_PT__RUNNER_THREADED
+namespace
+{
+	void *
+	releaseLater(void *semaphore)
+	{
+		usleep(10000);
+		static_cast<xpcc::pt::WaitableSemaphore *>(semaphore)->release();
+		return 0;
+	}
+}
+#endif
+
+void
+RunnerTest::testIdle()
+{
+	xpcc::pt::Runner runner;
+	YieldingTask ready;
+	
+	// returns immediately with a ready task
+	runner.addTask(ready);
+	runner.idle();
+	TEST_ASSERT_EQUALS(runner.getStatistics().wakeups, 1U);
+	runner.removeTask(ready);
+	
+	// or an expired timer
+	uint8_t order[1] = { 0 };
+	uint8_t position = 0;
+	SleepingTask sleeping(10, order, position);
+	runner.addTask(sleeping);
+	TEST_ASSERT_FALSE(runner.schedule());
+	TestingClock::time = 10;
+	runner.idle();
+	TEST_ASSERT_EQUALS(runner.getStatistics().wakeups, 2U);
+	runner.run();
+	TEST_ASSERT_EQUALS(position, 1);
+	
+#ifdef XPCC_PT__RUNNER_THREADED
+	// sleeps until the semaphore is released by another thread
+	xpcc::pt::WaitableSemaphore semaphore(0);
+	SemaphoreTask task(semaphore);
+	runner.addTask(task);
+	TEST_ASSERT_FALSE(runner.schedule());
+	
+	pthread_t thread;
+	TEST_ASSERT_EQUALS(pthread_create(&thread, 0, &releaseLater, &semaphore), 0);
+	
+	while (task.acquired == 0)
+	{
+		runner.idle();
+		runner.schedule();
+	}
+	pthread_join(thread, 0);
+	
+	TEST_ASSERT_EQUALS(task.resumes, 2);
+	TEST_ASSERT_TRUE(runner.getStatistics().wakeups <= 4U);
+	runner.removeTask(task);
+#endif
+}
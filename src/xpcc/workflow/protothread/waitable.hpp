@@ -0,0 +1,112 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_PT__WAITABLE_HPP
+#define XPCC_PT__WAITABLE_HPP
+
+#include <cstddef>
+#include <xpcc/container/queue.hpp>
+
+#include "runner.hpp"
+#include "semaphore.hpp"
+
+namespace xpcc
+{
+	namespace pt
+	{
+		/**
+		 * \brief	Counting semaphore which wakes the waiting tasks
+		 * 
+		 * Same as xpcc::pt::Semaphore, but release() resumes one task
+		 * waiting with
+		 * \code
+		 * PT_WAIT_ON(semaphore, semaphore.acquire());
+		 * \endcode
+		 * instead of having all of them poll the counter. release() may
+		 * also be called from an interrupt.
+		 * 
+		 * \ingroup	protothread
+		 */
+		class WaitableSemaphore : public Semaphore, public WaitList
+		{
+		public:
+			WaitableSemaphore(uint16_t initial) :
+				Semaphore(initial)
+			{
+			}
+			
+			bool
+			acquire()
+			{
+				Runner::Lock lock;
+				return Semaphore::acquire();
+			}
+			
+			void
+			release()
+			{
+				Runner::Lock lock;
+				Semaphore::release();
+				this->wakeOne();
+			}
+		};
+		
+		/**
+		 * \brief	Bounded queue which wakes the tasks waiting for data
+		 * 
+		 * Every successful push() notifies all tasks waiting with
+		 * \code
+		 * PT_WAIT_ON(queue, !queue.isEmpty());
+		 * \endcode
+		 * 
+		 * \warning	The queue itself is not protected against concurrent
+		 * 			access. Filling it from an interrupt needs an
+		 * 			additional xpcc::atomic::Lock around every access.
+		 * 
+		 * \ingroup	protothread
+		 */
+		template<typename T, std::size_t N>
+		class WaitableQueue : public xpcc::BoundedQueue<T, N>, public WaitList
+		{
+		public:
+			bool
+			push(const T& value)
+			{
+				if (!xpcc::BoundedQueue<T, N>::push(value)) {
+					return false;
+				}
+				this->notifyAll();
+				return true;
+			}
+		};
+	}
+}
+
+#endif // XPCC_PT__WAITABLE_HPP
@@ -28,11 +28,18 @@
  */
 // ----------------------------------------------------------------------------
 
+#include "xpcc_config.hpp"
 #include "scheduler.hpp"
 
+// ----------------------------------------------------------------------------
+xpcc::Scheduler::Task::Task() :
+	period(0), time(0), priority(0), state(IDLE)
+{
+}
+
 // ----------------------------------------------------------------------------
 xpcc::Scheduler::Scheduler() :
-	taskList(0), readyList(0), currentPriority(0)
+	taskList(), readyList(), currentPriority(0)
 {
 }
 
@@ -42,23 +49,44 @@ xpcc::Scheduler::scheduleTask(Task& task,
 		uint16_t period,
 		Priority priority)
 {
-	TaskListItem *item = new TaskListItem(task, period, priority);
+	xpcc::atomic::Lock lock;
 	
-	if (taskList == 0) {
-		taskList = item;
-	}
-	else {
-		item->nextTask = taskList;
-		taskList = item;
+	if (task.state != Task::IDLE)
+	{
+		// already scheduled, take it out of the lists before its
+		// hooks are reused
+		if (task.state == Task::READY) {
+			readyList.remove(task);
+		}
+		taskList.remove(task);
 	}
+	
+	task.period = period;
+	task.time = period;
+	task.priority = priority;
+	task.state = Task::WAITING;
+	
+	taskList.prepend(task);
 }
 
 // ----------------------------------------------------------------------------
-/*bool
-xpcc::Scheduler::removeTask(const Task& task)
+bool
+xpcc::Scheduler::removeTask(Task& task)
 {
+	xpcc::atomic::Lock lock;
+	
+	if (task.state == Task::IDLE) {
+		return false;
+	}
+	
+	if (task.state == Task::READY) {
+		readyList.remove(task);
+	}
+	taskList.remove(task);
+	task.state = Task::IDLE;
+	
+	return true;
 }
-*/
 
 // ----------------------------------------------------------------------------
 void
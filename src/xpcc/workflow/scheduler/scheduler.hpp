@@ -36,6 +36,9 @@
 #include <xpcc/architecture/utils.hpp>
 #include <xpcc/architecture/driver/accessor.hpp>
 #include <xpcc/architecture/driver/atomic/lock.hpp>		// for Scheduler::scheduleInterrupt()
+#include <xpcc/debug/profile.hpp>
+#include <xpcc/container/intrusive_linked_list.hpp>
+#include <xpcc/container/intrusive_doubly_linked_list.hpp>
 
 namespace xpcc
 {
@@ -62,25 +65,65 @@ namespace xpcc
 		
 		/**
 		 * \brief	%Scheduler task
+		 * 
+		 * The task contains all the information the scheduler needs, so
+		 * scheduling a task does not allocate any memory. Therefore a
+		 * task can only be scheduled once at a time.
 		 */
 		class Task
 		{
 		public:
+			Task();
+			
 			virtual void
 			run() = 0;
+			
+		private:
+			friend class Scheduler;
+			
+			xpcc::IntrusiveDoublyLinkedListHook<Task> taskHook;
+			xpcc::IntrusiveLinkedListHook<Task> readyHook;
+			
+			uint16_t period;
+			uint16_t time;
+			Priority priority;
+			enum {
+				IDLE,		///< not scheduled
+				RUNNING,
+				READY,
+				WAITING
+			} state;
 		};
 	
 	public:
 		Scheduler();
 		
+		/**
+		 * \brief	Add a task to the scheduler
+		 * 
+		 * A task which is already scheduled is rescheduled with the new
+		 * period and priority. May also be called by the task itself
+		 * from inside its run() method.
+		 * 
+		 * \param	task		Task to execute
+		 * \param	period		Execution period in calls of schedule()
+		 * \param	priority	Tasks with higher values are executed first
+		 */
 		void
 		scheduleTask(Task& task,
 					 uint16_t period,
 					 Priority priority = 127);
 		
-		// TODO	Implement this function
-		/*bool
-		removeTask(const Task& task);*/
+		/**
+		 * \brief	Remove a task from the scheduler
+		 * 
+		 * May also be called by the task itself from inside its run()
+		 * method.
+		 * 
+		 * \return	\c false if the task wasn't scheduled
+		 */
+		bool
+		removeTask(Task& task);
 		
 		void
 		schedule();
@@ -89,33 +132,13 @@ namespace xpcc
 		scheduleInterupt();
 		
 	private:
-		struct TaskListItem
-		{
-			TaskListItem(Task& task,
-						 uint16_t period,
-						 Priority priority) :
-				nextTask(0), nextReady(0), task(task),
-				period(period), time(period), priority(priority),
-				state(WAITING)
-			{
-			}
-			
-			TaskListItem *nextTask;
-			TaskListItem *nextReady;
-			
-			Task& task;
-			uint16_t period;
-			uint16_t time;
-			Priority priority;
-			enum {
-				RUNNING,
-				READY,
-				WAITING
-			} state;
-		};
+		typedef xpcc::IntrusiveDoublyLinkedList<Task, &Task::taskHook> TaskList;
+		typedef xpcc::IntrusiveLinkedList<Task, &Task::readyHook> ReadyList;
+		
+		TaskList taskList;
 		
-		TaskListItem *taskList;
-		TaskListItem *readyList;
+		/// Tasks ready to run, ordered by descending priority
+		ReadyList readyList;
 		
 		Priority currentPriority;
 	};
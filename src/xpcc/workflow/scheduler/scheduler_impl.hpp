@@ -51,60 +51,59 @@
 inline void
 xpcc::Scheduler::scheduleInterupt()
 {
-	if (taskList == 0) {
-		// nothing to schedule right now
-		return;
-	}
+	XPCC_PROFILE("Scheduler::scheduleInterupt");
 	
 	// update all tasks
-	TaskListItem *item = taskList;
-	do {
-		item->time--;
-		if (item->time == 0) {
-			item->time = item->period;
+	for (TaskList::iterator it = taskList.begin(); it != taskList.end(); ++it)
+	{
+		Task& task = *it;
+		
+		task.time--;
+		if (task.time == 0)
+		{
+			task.time = task.period;
 			
-			// add to ready list
-			if ((readyList == 0) ||
-				(readyList->priority < item->priority))
+			if (task.state != Task::READY)
 			{
-				item->nextReady = readyList;
-				readyList = item;
-			}
-			else {
-				TaskListItem *list = readyList;
+				// add to ready list behind all tasks with the same or a
+				// higher priority
+				Task *position = 0;
+				Task *next;
+				while (((next = readyList.getNext(position)) != 0) &&
+						(next->priority >= task.priority)) {
+					position = next;
+				}
 				
-				while (1)
-				{
-					if ((list->nextReady == 0) ||
-						(list->nextReady->priority < item->priority))
-					{
-						item->nextReady = list->nextReady;
-						list->nextReady = item;
-						break;
-					}
-					list = list->nextReady;
+				if (position == 0) {
+					readyList.prepend(task);
+				}
+				else {
+					readyList.insertAfter(*position, task);
 				}
+				task.state = Task::READY;
 			}
-			item->state = TaskListItem::READY;
 		}
 	}
-	while ((item = item->nextTask) != 0);
 	
 	// now execute the tasks which are ready
-	while (((item = xpcc::accessor::asVolatile(readyList)) != 0) &&
-			(item->priority > currentPriority))
+	Task *task;
+	while (((task = readyList.getNext(0)) != 0) &&
+			(task->priority > currentPriority))
 	{
-		item->state = TaskListItem::RUNNING;
-		readyList = item->nextReady;
-		currentPriority = item->priority;
+		task->state = Task::RUNNING;
+		readyList.removeFront();
+		currentPriority = task->priority;
 		{
 			xpcc::atomic::Unlock();
 			
 			// the actual execution of the task happens with interrupts
 			// enabled
-			item->task.run();
+			task->run();
 		}
 		currentPriority = 0;
-		item->state = TaskListItem::WAITING;
+		if (task->state == Task::RUNNING) {
+			// task wasn't removed or rescheduled while running
+			task->state = Task::WAITING;
+		}
 	}
 }
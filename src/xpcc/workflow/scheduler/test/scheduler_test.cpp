@@ -107,3 +107,77 @@ SchedulerTest::testScheduler()
 	TEST_ASSERT_EQUALS(task3.order, 3);
 	TEST_ASSERT_EQUALS(task4.order, 1);
 }
+
+void
+SchedulerTest::testRemoveTask()
+{
+	xpcc::Scheduler scheduler;
+	
+	TestTask task1;
+	TestTask task2;
+	
+	TEST_ASSERT_FALSE(scheduler.removeTask(task1));
+	
+	scheduler.scheduleTask(task1, 1, 10);
+	scheduler.scheduleTask(task2, 1, 20);
+	
+	count = 1;
+	scheduler.schedule();
+	
+	TEST_ASSERT_EQUALS(task1.order, 2);
+	TEST_ASSERT_EQUALS(task2.order, 1);
+	
+	TEST_ASSERT_TRUE(scheduler.removeTask(task2));
+	TEST_ASSERT_FALSE(scheduler.removeTask(task2));
+	
+	count = 1;
+	task1.order = 0;
+	task2.order = 0;
+	scheduler.schedule();
+	
+	TEST_ASSERT_EQUALS(task1.order, 1);
+	TEST_ASSERT_EQUALS(task2.order, 0);
+	
+	// a removed task can be scheduled again
+	scheduler.scheduleTask(task2, 1, 5);
+	
+	count = 1;
+	task1.order = 0;
+	scheduler.schedule();
+	
+	TEST_ASSERT_EQUALS(task1.order, 1);
+	TEST_ASSERT_EQUALS(task2.order, 2);
+}
+
+void
+SchedulerTest::testReschedule()
+{
+	xpcc::Scheduler scheduler;
+	
+	TestTask task1;
+	TestTask task2;
+	
+	scheduler.scheduleTask(task1, 2, 10);
+	scheduler.scheduleTask(task2, 2, 20);
+	
+	// scheduling the list head again must not link it to itself
+	scheduler.scheduleTask(task2, 1, 5);
+	
+	count = 1;
+	scheduler.schedule();
+	
+	TEST_ASSERT_EQUALS(task1.order, 0);
+	TEST_ASSERT_EQUALS(task2.order, 1);
+	
+	count = 1;
+	task2.order = 0;
+	scheduler.schedule();
+	
+	// the new priority is used, the task is only run once
+	TEST_ASSERT_EQUALS(task1.order, 1);
+	TEST_ASSERT_EQUALS(task2.order, 2);
+	
+	TEST_ASSERT_TRUE(scheduler.removeTask(task1));
+	TEST_ASSERT_TRUE(scheduler.removeTask(task2));
+	TEST_ASSERT_FALSE(scheduler.removeTask(task2));
+}
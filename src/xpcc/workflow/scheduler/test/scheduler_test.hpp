@@ -35,4 +35,10 @@ class SchedulerTest : public unittest::TestSuite
 public:
 	void
 	testScheduler();
+	
+	void
+	testRemoveTask();
+	
+	void
+	testReschedule();
 };
@@ -0,0 +1,265 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+/*
+ * Time needed by xpcc::sab::Slave and xpcc::amnb::Node to find the action
+ * for a received message in a table with 128 entries, once sorted (binary
+ * search) and once in reverse order (linear search).
+ * 
+ * Hosted build with -O2, best of 15 runs:
+ *   sab::Slave   sorted 48.8 ns/message, unsorted 49.5 ns/message
+ *   amnb::Node   sorted 31.2 ns/message, unsorted 76.8 ns/message
+ * 
+ * The sab::Slave shows no measurable difference on the host, the scan of
+ * its list is as fast as the binary search. The gain on AVR, where every
+ * key is read from flash, has not been measured.
+ * 
+ * Run with 'scons run'.
+ */
+
+#include <ctime>
+#include <cstdio>
+
+#include <xpcc/driver/connectivity/sab/slave.hpp>
+#include <xpcc/driver/connectivity/amnb/node.hpp>
+
+static const uint32_t iterations = 2000000;
+
+// prevents the compiler from removing the callbacks
+static volatile uint8_t sink;
+
+/*
+ * Replaces the interfaces, every call of update() makes the next message
+ * of a pseudo-random sequence of requests available.
+ */
+template <typename Flags>
+class FakeInterface
+{
+public:
+	static void
+	initialize(int = 0)
+	{
+	}
+	
+	static void
+	update()
+	{
+		// 16-bit Galois LFSR
+		state = (state >> 1) ^ (-(state & 1u) & 0xb400u);
+		command = state;
+	}
+	
+	static bool
+	isMessageAvailable()
+	{
+		return true;
+	}
+	
+	static uint8_t
+	getAddress()
+	{
+		return 0x10;
+	}
+	
+	static uint8_t
+	getCommand()
+	{
+		return command;
+	}
+	
+	static bool
+	isResponse()
+	{
+		return false;
+	}
+	
+	static bool
+	isAcknowledge()
+	{
+		return true;
+	}
+	
+	static uint8_t
+	getPayloadLength()
+	{
+		return 0;
+	}
+	
+	static const uint8_t *
+	getPayload()
+	{
+		return 0;
+	}
+	
+	static void
+	dropMessage()
+	{
+	}
+	
+	static bool
+	messageTransmitted()
+	{
+		return true;
+	}
+	
+	static uint8_t
+	getTransmittedAddress()
+	{
+		return 0x10;
+	}
+	
+	static uint8_t
+	getTransmittedCommand()
+	{
+		return command;
+	}
+	
+	static bool
+	sendMessage(uint8_t, Flags, uint8_t, const void *, std::size_t)
+	{
+		return true;
+	}
+	
+	static uint16_t state;
+	static uint8_t command;
+};
+
+template <typename Flags>
+uint16_t FakeInterface<Flags>::state = 0xace1;
+
+template <typename Flags>
+uint8_t FakeInterface<Flags>::command = 0;
+
+// ----------------------------------------------------------------------------
+class Handler : public xpcc::sab::Callable, public xpcc::amnb::Callable
+{
+public:
+	void
+	sabAction(xpcc::sab::Response& response)
+	{
+		sink = 1;
+		response.send();
+	}
+	
+	void
+	amnbAction(xpcc::amnb::Response& response)
+	{
+		sink = 2;
+		response.send();
+	}
+};
+
+Handler handler;
+
+// 128 actions with the even commands 0x00 to 0xfe
+#define	ENTRIES_4(ACTION, function, n) \
+	ACTION((n) + 0, handler, function, 0), \
+	ACTION((n) + 2, handler, function, 0), \
+	ACTION((n) + 4, handler, function, 0), \
+	ACTION((n) + 6, handler, function, 0)
+#define	ENTRIES_16(ACTION, function, n) \
+	ENTRIES_4(ACTION, function, (n) + 0), ENTRIES_4(ACTION, function, (n) + 8), \
+	ENTRIES_4(ACTION, function, (n) + 16), ENTRIES_4(ACTION, function, (n) + 24)
+#define	ENTRIES_64(ACTION, function, n) \
+	ENTRIES_16(ACTION, function, (n) + 0), ENTRIES_16(ACTION, function, (n) + 32), \
+	ENTRIES_16(ACTION, function, (n) + 64), ENTRIES_16(ACTION, function, (n) + 96)
+#define	ENTRIES_128(ACTION, function) \
+	ENTRIES_64(ACTION, function, 0), ENTRIES_64(ACTION, function, 128)
+
+// same entries in descending order
+#define	REVERSE_4(ACTION, function, n) \
+	ACTION((n) + 6, handler, function, 0), \
+	ACTION((n) + 4, handler, function, 0), \
+	ACTION((n) + 2, handler, function, 0), \
+	ACTION((n) + 0, handler, function, 0)
+#define	REVERSE_16(ACTION, function, n) \
+	REVERSE_4(ACTION, function, (n) + 24), REVERSE_4(ACTION, function, (n) + 16), \
+	REVERSE_4(ACTION, function, (n) + 8), REVERSE_4(ACTION, function, (n) + 0)
+#define	REVERSE_64(ACTION, function, n) \
+	REVERSE_16(ACTION, function, (n) + 96), REVERSE_16(ACTION, function, (n) + 64), \
+	REVERSE_16(ACTION, function, (n) + 32), REVERSE_16(ACTION, function, (n) + 0)
+#define	REVERSE_128(ACTION, function) \
+	REVERSE_64(ACTION, function, 128), REVERSE_64(ACTION, function, 0)
+
+#define	SAB_ACTIONS(ACTION)		ENTRIES_128(ACTION, Handler::sabAction)
+#define	AMNB_ACTIONS(ACTION)	ENTRIES_128(ACTION, Handler::amnbAction)
+
+SAB__ACTION_TABLE(sabSorted, SAB_ACTIONS);
+AMNB__ACTION_TABLE(amnbSorted, AMNB_ACTIONS);
+
+FLASH_STORAGE(xpcc::sab::Action sabReverse[]) =
+{
+	REVERSE_128(SAB__ACTION, Handler::sabAction)
+};
+
+FLASH_STORAGE(xpcc::amnb::Action amnbReverse[]) =
+{
+	REVERSE_128(AMNB__ACTION, Handler::amnbAction)
+};
+
+// ----------------------------------------------------------------------------
+static double
+seconds(std::clock_t start)
+{
+	return static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC;
+}
+
+template <typename T>
+static double
+benchmark(T& t)
+{
+	std::clock_t start = std::clock();
+	for (uint32_t i = 0; i < iterations; ++i) {
+		t.update();
+	}
+	return seconds(start) / iterations * 1e9;
+}
+
+int
+main()
+{
+	typedef xpcc::sab::Slave< FakeInterface<xpcc::sab::Flags> > Slave;
+	typedef xpcc::amnb::Node< FakeInterface<xpcc::amnb::Flags> > Node;
+	
+	const uint8_t count = sizeof(sabSorted) / sizeof(xpcc::sab::Action);
+	
+	Slave sabSortedSlave(0x10, xpcc::accessor::asFlash(sabSorted), count);
+	Slave sabReverseSlave(0x10, xpcc::accessor::asFlash(sabReverse), count);
+	
+	Node amnbSortedNode(0x10, xpcc::accessor::asFlash(amnbSorted), count);
+	Node amnbReverseNode(0x10, xpcc::accessor::asFlash(amnbReverse), count);
+	
+	std::printf("%u actions, half of the requests have no matching action\n", count);
+	std::printf("sab::Slave   sorted %5.1f ns/message, unsorted %5.1f ns/message\n",
+			benchmark(sabSortedSlave), benchmark(sabReverseSlave));
+	std::printf("amnb::Node   sorted %5.1f ns/message, unsorted %5.1f ns/message\n",
+			benchmark(amnbSortedNode), benchmark(amnbReverseNode));
+	
+	return 0;
+}
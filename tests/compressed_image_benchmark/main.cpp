@@ -0,0 +1,177 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+/*
+ * Size and drawing time of the PackBits compressed images and fonts
+ * compared to the uncompressed data.
+ * 
+ * Run with 'scons run'.
+ */
+
+#include <ctime>
+#include <cstdio>
+#include <cstring>
+
+#include <xpcc/driver/ui/display/buffered_graphic_display.hpp>
+#include <xpcc/driver/ui/display/font.hpp>
+#include <xpcc/driver/ui/display/image.hpp>
+
+static const uint32_t iterations = 20000;
+
+class Display : public xpcc::BufferedGraphicDisplay<256, 64>
+{
+public:
+	virtual void
+	update()
+	{
+		this->markClean();
+	}
+	
+	uint8_t
+	getByte(uint8_t x, uint8_t page) const
+	{
+		return this->buffer[x][page];
+	}
+};
+
+static double
+seconds(std::clock_t start)
+{
+	return static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC;
+}
+
+// prevents the compiler from removing the drawing operations
+static volatile uint8_t sink;
+
+// Size of the PackBits stream of an image
+static uint16_t
+compressedSize(const uint8_t *image)
+{
+	const uint16_t size = image[0] * ((image[1] + 7) / 8);
+	uint16_t decoded = 0;
+	uint16_t position = 2;
+	while (decoded < size)
+	{
+		const uint8_t header = image[position++];
+		if (header < 128) {
+			decoded += header + 1;
+			position += header + 1;
+		}
+		else if (header > 128) {
+			decoded += 257 - header;
+			position++;
+		}
+	}
+	return position;
+}
+
+static void
+benchmarkImage(const char *name, const uint8_t *raw, const uint8_t *compressed)
+{
+	Display display;
+	
+	const uint16_t rawSize = 2 + raw[0] * ((raw[1] + 7) / 8);
+	const uint16_t rleSize = compressedSize(compressed);
+	std::printf("%-20s %5u -> %5u bytes (%3.0f%%)\n", name, rawSize, rleSize,
+			100.0 * rleSize / rawSize);
+	
+	const uint8_t y[2] = { 0, 3 };
+	for (uint8_t k = 0; k < 2; ++k)
+	{
+		const xpcc::glcd::Point position(5, y[k]);
+		
+		std::clock_t start = std::clock();
+		for (uint32_t i = 0; i < iterations; ++i) {
+			display.drawImage(position, xpcc::accessor::asFlash(raw));
+			sink = display.getByte(10, 1);
+		}
+		const double rawTime = seconds(start);
+		
+		start = std::clock();
+		for (uint32_t i = 0; i < iterations; ++i) {
+			display.drawCompressedImage(position, xpcc::accessor::asFlash(compressed));
+			sink = display.getByte(10, 1);
+		}
+		const double rleTime = seconds(start);
+		
+		std::printf("  y = %u: drawImage() %7.0f ns, drawCompressedImage() %7.0f ns\n",
+				y[k], rawTime / iterations * 1e9, rleTime / iterations * 1e9);
+	}
+}
+
+static void
+benchmarkFont(const char *name, const uint8_t *raw, const uint8_t *compressed,
+		const char *text)
+{
+	Display display;
+	const uint32_t length = std::strlen(text);
+	
+	const uint16_t rawSize = raw[0] | (raw[1] << 8);
+	const uint16_t rleSize = compressed[0] | (compressed[1] << 8);
+	std::printf("%-20s %5u -> %5u bytes (%3.0f%%)\n", name, rawSize, rleSize,
+			100.0 * rleSize / rawSize);
+	
+	const uint8_t *fonts[2] = { raw, compressed };
+	double time[2];
+	for (uint8_t f = 0; f < 2; ++f)
+	{
+		display.setFont(fonts[f]);
+		
+		std::clock_t start = std::clock();
+		for (uint32_t i = 0; i < iterations; ++i)
+		{
+			display.setCursor(0, 3);
+			display.drawString(text);
+			sink = display.getByte(3, 0);
+		}
+		time[f] = seconds(start);
+	}
+	std::printf("  \"%s\": %5.0f ns/glyph, compressed %5.0f ns/glyph\n", text,
+			time[0] / (iterations * length) * 1e9,
+			time[1] / (iterations * length) * 1e9);
+}
+
+int
+main()
+{
+	benchmarkImage("skull_64x64", bitmap::skull_64x64, bitmap::skull_64x64_rle);
+	benchmarkImage("logo_xpcc_90x64", bitmap::logo_xpcc_90x64, bitmap::logo_xpcc_90x64_rle);
+	benchmarkImage("logo_rca_90x64", bitmap::logo_rca_90x64, bitmap::logo_rca_90x64_rle);
+	benchmarkImage("logo_eurobot_90x64", bitmap::logo_eurobot_90x64, bitmap::logo_eurobot_90x64_rle);
+	
+	benchmarkFont("numbers_14x32", xpcc::font::Numbers14x32,
+			xpcc::font::Numbers14x32Rle, "2013");
+	benchmarkFont("numbers_40x56", xpcc::font::Numbers40x57,
+			xpcc::font::Numbers40x57Rle, "2013");
+	benchmarkFont("numbers_46x64", xpcc::font::Numbers46x64,
+			xpcc::font::Numbers46x64Rle, "2013");
+	
+	return 0;
+}
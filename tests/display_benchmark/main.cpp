@@ -0,0 +1,146 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+/*
+ * Pixel throughput of the drawing primitives of a 128x64 pixel
+ * xpcc::BufferedGraphicDisplay: drawing pixel by pixel compared with the
+ * span and rectangle primitives.
+ * 
+ * Run with 'scons run'.
+ */
+
+#include <ctime>
+#include <cstdio>
+
+#include <xpcc/driver/ui/display/buffered_graphic_display.hpp>
+
+static const uint32_t iterations = 20000;
+
+class Display : public xpcc::BufferedGraphicDisplay<128, 64>
+{
+public:
+	virtual void
+	update()
+	{
+		this->markClean();
+	}
+	
+	uint8_t
+	getByte(uint8_t x, uint8_t page) const
+	{
+		return this->buffer[x][page];
+	}
+};
+
+// 32x24 pixel image
+static uint8_t image[32 * 3];
+
+static double
+seconds(std::clock_t start)
+{
+	return static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC;
+}
+
+static void
+report(const char *name, double time, uint32_t pixels)
+{
+	std::printf("  %-28s %7.3f s  %8.1f Mpixel/s\n", name, time,
+			(static_cast<double>(pixels) * iterations) / time / 1e6);
+}
+
+// prevents the compiler from removing the drawing operations
+static volatile uint8_t sink;
+
+int
+main()
+{
+	Display display;
+	display.clear();
+	
+	for (uint8_t i = 0; i < sizeof(image); ++i) {
+		image[i] = i * 37;
+	}
+	
+	std::printf("128x64 display, %u iterations\n",
+			static_cast<unsigned int>(iterations));
+	
+	std::clock_t start = std::clock();
+	for (uint32_t i = 0; i < iterations; ++i)
+	{
+		display.setColor((i & 1) ? xpcc::glcd::Color::white() : xpcc::glcd::Color::black());
+		for (int16_t x = 3; x < 123; ++x) {
+			for (int16_t y = 5; y < 55; ++y) {
+				display.drawPixel(x, y);
+			}
+		}
+		sink = display.getByte(10, 3);
+	}
+	report("rectangle, pixel by pixel", seconds(start), 120 * 50);
+	
+	start = std::clock();
+	for (uint32_t i = 0; i < iterations; ++i)
+	{
+		display.setColor((i & 1) ? xpcc::glcd::Color::white() : xpcc::glcd::Color::black());
+		display.fillRectangle(3, 5, 120, 50);
+		sink = display.getByte(10, 3);
+	}
+	report("rectangle, fillRectangle", seconds(start), 120 * 50);
+	
+	start = std::clock();
+	for (uint32_t i = 0; i < iterations; ++i)
+	{
+		display.setColor((i & 1) ? xpcc::glcd::Color::white() : xpcc::glcd::Color::black());
+		for (int16_t x = 0; x < 128; ++x) {
+			display.drawLine(x, 2, x, 60);
+		}
+		sink = display.getByte(10, 3);
+	}
+	report("vertical lines", seconds(start), 128 * 58);
+	
+	start = std::clock();
+	for (uint32_t i = 0; i < iterations; ++i)
+	{
+		display.setColor((i & 1) ? xpcc::glcd::Color::white() : xpcc::glcd::Color::black());
+		display.fillCircle(xpcc::glcd::Point(64, 32), 30);
+		sink = display.getByte(64, 3);
+	}
+	report("circle, r = 30", seconds(start), 2827);
+	
+	start = std::clock();
+	for (uint32_t i = 0; i < iterations; ++i)
+	{
+		display.drawImageRaw(xpcc::glcd::Point(i & 0x3f, (i >> 6) & 0x1f), 32, 24,
+				xpcc::accessor::asFlash(image));
+		sink = display.getByte(10, 3);
+	}
+	report("image 32x24, any position", seconds(start), 32 * 24);
+	
+	return 0;
+}
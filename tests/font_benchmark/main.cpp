@@ -0,0 +1,142 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+/*
+ * Text rendering with and without the glyph offset table of the fonts.
+ * 
+ * For the fonts without the table (the format before the table was
+ * added) the position of every glyph is calculated by summing up the
+ * widths of all preceding characters. Fonts with only a few characters
+ * like numbers_46x64 are exported without the table, the benchmark
+ * shows that it makes no difference for them.
+ * 
+ * Run with 'scons run'.
+ */
+
+#include <ctime>
+#include <cstdio>
+#include <cstring>
+
+#include <xpcc/driver/ui/display/buffered_graphic_display.hpp>
+#include <xpcc/driver/ui/display/font.hpp>
+
+static const uint32_t iterations = 20000;
+
+class Display : public xpcc::BufferedGraphicDisplay<256, 64>
+{
+public:
+	virtual void
+	update()
+	{
+		this->markClean();
+	}
+	
+	uint8_t
+	getByte(uint8_t x, uint8_t page) const
+	{
+		return this->buffer[x][page];
+	}
+};
+
+static uint8_t oldFormat[4000];
+
+// Copy of the font with the plain 8 byte header, which has no flags
+// and therefore no glyph offset table
+static const uint8_t *
+withoutOffsetTable(const uint8_t *font)
+{
+	const uint16_t size = font[0] | (font[1] << 8);
+	std::memcpy(oldFormat, font, 8);
+	std::memcpy(oldFormat + 8, font + 10, size - 10);
+	oldFormat[2] = font[9];
+	return oldFormat;
+}
+
+static double
+seconds(std::clock_t start)
+{
+	return static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC;
+}
+
+// prevents the compiler from removing the drawing operations
+static volatile uint8_t sink;
+
+static void
+benchmark(const char *name, const uint8_t *font, const char *text)
+{
+	Display display;
+	const uint32_t length = std::strlen(text);
+	
+	std::printf("%s, \"%s\", %u iterations\n", name, text,
+			static_cast<unsigned int>(iterations));
+	
+	const uint8_t *fonts[2] = { withoutOffsetTable(font), font };
+	const char *names[2] = { "without offset table",
+			(font[8] & 0x80) ? "with offset table" : "extended header" };
+	
+	for (uint8_t f = 0; f < 2; ++f)
+	{
+		display.setFont(fonts[f]);
+		
+		std::clock_t start = std::clock();
+		for (uint32_t i = 0; i < iterations; ++i)
+		{
+			display.setCursor(0, 0);
+			for (uint32_t k = 0; k < length; ++k) {
+				display.write(text[k]);
+			}
+			sink = display.getByte(3, 0);
+		}
+		double time = seconds(start);
+		std::printf("  %-22s write(char):  %7.3f s  %6.0f ns/glyph\n", names[f], time,
+				time / (iterations * length) * 1e9);
+		
+		start = std::clock();
+		for (uint32_t i = 0; i < iterations; ++i)
+		{
+			display.setCursor(0, 0);
+			display.drawString(text);
+			sink = display.getByte(3, 0);
+		}
+		time = seconds(start);
+		std::printf("  %-22s drawString(): %7.3f s  %6.0f ns/glyph\n", names[f], time,
+				time / (iterations * length) * 1e9);
+	}
+}
+
+int
+main()
+{
+	benchmark("fixed_width_5x8", xpcc::font::FixedWidth5x8,
+			"The quick brown fox jumps over the lazy dog");
+	benchmark("numbers_46x64", xpcc::font::Numbers46x64, "2013");
+	
+	return 0;
+}
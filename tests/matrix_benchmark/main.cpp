@@ -0,0 +1,161 @@
+// coding: utf-8
+// ----------------------------------------------------------------------------
+/* Copyright (c) 2013, Roboterclub Aachen e.V.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Roboterclub Aachen e.V. nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+// ----------------------------------------------------------------------------
+
+/*
+ * Compares the matrix kernels with the previous implementation:
+ * 
+ * - matrix multiplication: unrolled dot products vs. the old
+ *   triple loop accumulating in memory
+ * - solving A*X = B: in-place LU and Cholesky vs. the old LU
+ *   decomposition with separate L and U matrices
+ * 
+ * Run with 'scons run'.
+ */
+
+#include <ctime>
+#include <cstdio>
+
+#include <xpcc/math/matrix.hpp>
+#include <xpcc/math/lu_decomposition.hpp>
+#include <xpcc/math/cholesky_decomposition.hpp>
+
+static const uint32_t iterations = 1000000;
+
+// Previous implementation of the matrix multiplication
+template<typename T, uint8_t ROWS, uint8_t COLUMNS, uint8_t RHSCOL>
+static xpcc::Matrix<T, ROWS, RHSCOL>
+referenceMultiply(const xpcc::Matrix<T, ROWS, COLUMNS> &lhs,
+		const xpcc::Matrix<T, COLUMNS, RHSCOL> &rhs)
+{
+	xpcc::Matrix<T, ROWS, RHSCOL> m;
+	for (uint_fast8_t i = 0; i < ROWS; ++i)
+	{
+		for (uint_fast8_t j = 0; j < RHSCOL; ++j)
+		{
+			m[i][j] = lhs[i][0] * rhs[0][j];
+			for (uint_fast8_t x = 1; x < COLUMNS; ++x) {
+				m[i][j] += lhs[i][x] * rhs[x][j];
+			}
+		}
+	}
+	return m;
+}
+
+// Symmetric positive-definite test matrix
+template<uint8_t N>
+static xpcc::Matrix<float, N, N>
+createMatrix()
+{
+	xpcc::Matrix<float, N, N> a;
+	for (uint8_t i = 0; i < N; ++i) {
+		for (uint8_t j = 0; j < N; ++j) {
+			a[i][j] = (i == j) ? (2.0f * N) : 1.0f / (1 + i + j);
+		}
+	}
+	return a;
+}
+
+static double
+seconds(std::clock_t start)
+{
+	return static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC;
+}
+
+// prevents the compiler from removing the calculations
+static volatile float sink;
+
+template<uint8_t N>
+static void
+benchmark()
+{
+	const xpcc::Matrix<float, N, N> a = createMatrix<N>();
+	xpcc::Matrix<float, N, N> b = createMatrix<N>();
+	b[0][N - 1] = 2.0f;
+	
+	std::printf("%dx%d matrices, %u iterations\n", N, N,
+			static_cast<unsigned int>(iterations));
+	
+	std::clock_t start = std::clock();
+	for (uint32_t i = 0; i < iterations; ++i)
+	{
+		b[0][0] = static_cast<float>(i);
+		sink = referenceMultiply(a, b)[N - 1][N - 1];
+	}
+	std::printf("  multiply (old):          %7.3f s\n", seconds(start));
+	
+	start = std::clock();
+	for (uint32_t i = 0; i < iterations; ++i)
+	{
+		b[0][0] = static_cast<float>(i);
+		sink = (a * b)[N - 1][N - 1];
+	}
+	std::printf("  multiply (unrolled):     %7.3f s\n", seconds(start));
+	
+	start = std::clock();
+	for (uint32_t i = 0; i < iterations; ++i)
+	{
+		xpcc::Matrix<float, N, N> l;
+		xpcc::Matrix<float, N, N> u;
+		xpcc::Matrix<float, N, N> x = b;
+		xpcc::LUDecomposition::decompose(a, &l, &u);
+		xpcc::LUDecomposition::solve(l, u, &x);
+		sink = x[0][0];
+	}
+	std::printf("  solve, LU (old):         %7.3f s\n", seconds(start));
+	
+	start = std::clock();
+	for (uint32_t i = 0; i < iterations; ++i)
+	{
+		xpcc::Matrix<float, N, N> lu = a;
+		xpcc::Matrix<float, N, N> x = b;
+		xpcc::LUDecomposition::solve(&lu, &x);
+		sink = x[0][0];
+	}
+	std::printf("  solve, LU (in-place):    %7.3f s\n", seconds(start));
+	
+	start = std::clock();
+	for (uint32_t i = 0; i < iterations; ++i)
+	{
+		xpcc::Matrix<float, N, N> l = a;
+		xpcc::Matrix<float, N, N> x = b;
+		xpcc::CholeskyDecomposition::solve(&l, &x);
+		sink = x[0][0];
+	}
+	std::printf("  solve, Cholesky:         %7.3f s\n", seconds(start));
+}
+
+int
+main()
+{
+	benchmark<6>();
+	benchmark<9>();
+	
+	return 0;
+}
@@ -0,0 +1,122 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# 
+# Copyright (c) 2013, Roboterclub Aachen e.V.
+# All rights reserved.
+# 
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+# 
+#  * Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+#  * Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+#  * Neither the name of the Roboterclub Aachen e.V. nor the
+#    names of its contributors may be used to endorse or promote products
+#    derived from this software without specific prior written permission.
+# 
+# THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+# EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+# DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+# (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+# LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+# ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+# THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+# -----------------------------------------------------------------------------
+"""
+Compare two result files of the benchmarks.
+
+Usage:
+  $ cd src
+  $ scons target=benchmark output=old.json
+  ... change something ...
+  $ scons target=benchmark output=new.json
+  $ python ../tools/benchmark_compare.py old.json new.json
+
+Every benchmark which got slower by more than the threshold (default 10%)
+is reported as a regression, the exit code is then 1. More heap
+allocations per iteration are always a regression.
+"""
+
+import sys
+import json
+import optparse
+
+COLOR_GREEN = ";32"
+COLOR_RED = ";31"
+COLOR_YELLOW = ";33"
+COLOR_DEFAULT = ""
+
+def set_color(color):
+	if sys.stdout.isatty():
+		sys.stdout.write("\033[0%sm" % color)
+
+def load_results(filename):
+	"""
+	Returns a dictionary: name -> result
+	"""
+	results = {}
+	for benchmark in json.load(open(filename))['benchmarks']:
+		results[benchmark['name']] = benchmark
+	return results
+
+def compare(old, new, threshold):
+	"""
+	Returns the number of regressions
+	"""
+	regressions = 0
+	for name in sorted(new.keys()):
+		result = new[name]
+		try:
+			reference = old[name]
+		except KeyError:
+			set_color(COLOR_YELLOW)
+			print("NEW          %s: %.2f ns/op" % (name, result['ns_per_op']))
+			set_color(COLOR_DEFAULT)
+			continue
+		
+		oldTime = reference['ns_per_op']
+		time = result['ns_per_op']
+		change = 0 if oldTime == 0 else (time - oldTime) * 100.0 / oldTime
+		
+		oldAllocations = reference['allocs_per_op']
+		allocations = result['allocs_per_op']
+		
+		if change > threshold or allocations > oldAllocations:
+			regressions += 1
+			set_color(COLOR_RED)
+			print("REGRESSION   %s: %.2f -> %.2f ns/op (%+.1f%%)" % (name, oldTime, time, change))
+			if allocations != oldAllocations:
+				print("             allocations: %.2f -> %.2f per op" % (oldAllocations, allocations))
+			set_color(COLOR_DEFAULT)
+		elif change < -threshold:
+			set_color(COLOR_GREEN)
+			print("IMPROVEMENT  %s: %.2f -> %.2f ns/op (%+.1f%%)" % (name, oldTime, time, change))
+			set_color(COLOR_DEFAULT)
+		else:
+			print("             %s: %.2f -> %.2f ns/op (%+.1f%%)" % (name, oldTime, time, change))
+	
+	for name in sorted(set(old.keys()) - set(new.keys())):
+		set_color(COLOR_YELLOW)
+		print("REMOVED      %s" % name)
+		set_color(COLOR_DEFAULT)
+	
+	return regressions
+
+if __name__ == '__main__':
+	parser = optparse.OptionParser(usage="%prog [options] old.json new.json")
+	parser.add_option("-t", "--threshold", type="float", dest="threshold", default=10.0,
+					  help="allowed slowdown in percent [default: %default]")
+	
+	(options, args) = parser.parse_args()
+	if len(args) != 2:
+		parser.error("two result files are needed")
+	
+	regressions = compare(load_results(args[0]), load_results(args[1]), options.threshold)
+	if regressions > 0:
+		print("\n%i regression(s) above %.1f%%" % (regressions, options.threshold))
+		sys.exit(1)
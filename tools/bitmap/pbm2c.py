@@ -5,13 +5,44 @@ import string
 import re
 import math
 
+def packbits(data):
+	""" PackBits compression, see xpcc::GraphicDisplay::drawCompressedImage() """
+	output = []
+	literal = []
+	i = 0
+	while i < len(data):
+		run = 1
+		while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+			run += 1
+		
+		if run >= 3:
+			if literal:
+				output += [len(literal) - 1] + literal
+				literal = []
+			output += [257 - run, data[i]]
+			i += run
+		else:
+			literal.append(data[i])
+			i += 1
+			if len(literal) == 128:
+				output += [len(literal) - 1] + literal
+				literal = []
+	
+	if literal:
+		output += [len(literal) - 1] + literal
+	return output
+
 if __name__ == '__main__':
-	filename = os.sys.argv[1]
+	args = os.sys.argv[1:]
+	compress = '--rle' in args
+	if compress:
+		args.remove('--rle')
 	
-	if not filename.endswith('.pbm'):
-		print "usage: %s *.pbm" % os.sys.argv[0]
+	if len(args) != 1 or not args[0].endswith('.pbm'):
+		print "usage: %s [--rle] *.pbm" % os.sys.argv[0]
 		exit(1)
 	
+	filename = args[0]
 	input = open(filename).read()
 	if input[0:3] != "P1\n":
 		print "Format needs to be a portable bitmap in ascii format (file descriptor 'P1')!"
@@ -47,10 +78,19 @@ if __name__ == '__main__':
 				data[y / 8][x] |= 1 << (y % 8)
 	
 	output = []
-	for y in range(rows):
-		line = []
-		for x in range(width):
-			line.append("0x%02x," % data[y][x])
-		output.append(" ".join(line))
+	if compress:
+		compressed = packbits(sum(data, []))
+		if len(compressed) >= width * rows:
+			print "PackBits does not shrink this bitmap (%i >= %i bytes), use the uncompressed data!" % (len(compressed), width * rows)
+			exit(1)
+		
+		for i in range(0, len(compressed), 16):
+			output.append(" ".join(["0x%02x," % c for c in compressed[i:i + 16]]))
+	else:
+		for y in range(rows):
+			line = []
+			for x in range(width):
+				line.append("0x%02x," % data[y][x])
+			output.append(" ".join(line))
 	
 	print "\n".join(output)
@@ -50,27 +50,40 @@ namespace xpcc
 {
 	namespace font
 	{
+${arrays}
+	}
+}
+
+"""
+
+template_array = """\
 		FLASH_STORAGE(uint8_t ${array_name}[]) =
 		{
 			${size_low}, ${size_high}, // total size of this array
-			${width},	// width (may vary)
+			0,	// extended header, flags and width follow the char count
 			${height},	// height
 			${hspace},	// hspace
 			${vspace}, 	// vspace
 			${first},	// first char
 			${count},	// char count
+			${flags},	// ${flags_comment}
+			${width},	// width (may vary)
 			
 			// char widths
 			// for each character the separate width in pixels
 			${char_width}
 			
 			// font data
-			// bit field of all characters
+			// ${data_comment}
 			${font_data}
-		};
-	}
-}
+${glyph_offset_table}		};
+"""
 
+template_glyph_offsets = """			
+			// glyph offsets
+			// for each character the position of its font data within
+			// this array (low byte, high byte)
+			${glyph_offsets}
 """
 
 # -----------------------------------------------------------------------------
@@ -101,13 +114,25 @@ namespace xpcc
 		 * \\ingroup	font
 		 */
 		EXTERN_FLASH_STORAGE(uint8_t ${array_name}[]);
-	}
+${header_rle}	}
 }
 
 #endif	// ${include_guard}
 
 """
 
+# Only emitted if the compressed font is smaller than the uncompressed one
+template_header_rle = """		
+		/**
+		 * \\brief	${font_name}, compressed
+		 * 
+		 * Same font with PackBits compressed font data, ${size_rle} bytes.
+		 * 
+		 * \\ingroup	font
+		 */
+		EXTERN_FLASH_STORAGE(uint8_t ${array_name}Rle[]);
+"""
+
 # -----------------------------------------------------------------------------
 class ParseException(Exception):
 	def __init__(self, msg, line):
@@ -225,32 +250,58 @@ def read_font_file(filename):
 	return font
 
 # -----------------------------------------------------------------------------
-if __name__ == '__main__':
-	try:
-		filename = os.sys.argv[1]
-		if not filename.endswith('.font'):
-			raise
-		outfile = os.sys.argv[2]
-	except:
-		print "usage: %s *.font outfile" % os.sys.argv[0]
-		exit(1)
+def packbits(data):
+	""" PackBits compression
 	
-	try:
-		font = read_font_file(filename)
-	except ParseException as e:
-		print "Error in line %i: " % e.line, e
-		exit(1)
+	A header byte n < 128 is followed by n + 1 literal bytes, a header
+	byte n > 128 by a single byte which is repeated 257 - n times.
+	"""
+	output = []
+	literal = []
+	i = 0
+	while i < len(data):
+		run = 1
+		while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+			run += 1
+		
+		if run >= 3:
+			if literal:
+				output += [len(literal) - 1] + literal
+				literal = []
+			output += [257 - run, data[i]]
+			i += run
+		else:
+			literal.append(data[i])
+			i += 1
+			if len(literal) == 128:
+				output += [len(literal) - 1] + literal
+				literal = []
+	
+	if literal:
+		output += [len(literal) - 1] + literal
+	return output
+
+# Summing up the widths of a few preceding characters is as fast as
+# reading the glyph offset table. Smaller fonts get the table only if
+# their data is compressed, then the glyphs differ in size.
+offset_table_min_chars = 17
+
+def create_array(font, substitutions, compress):
+	offset_table = compress or len(font.chars) >= offset_table_min_chars
 	
-	width_histogram = {}
 	char_width = []
 	char_width_line = ""
 	char_line_count = 0
 	font_data = []
+	glyph_offsets = []
 	
-	# 8 byte header, width table
-	size = 8 + len(font.chars)
+	# 10 byte extended header, width table
+	size = 10 + len(font.chars)
 	for char in font.chars:
-		size += len(char.data)
+		glyph_offsets.append("0x%02X, 0x%02X, // %i" % (size & 0xff, size >> 8, char.index))
+		
+		char_data = packbits(char.data) if compress else char.data
+		size += len(char_data)
 		
 		char_width_line += "%2i, " % char.width
 		
@@ -262,16 +313,64 @@ if __name__ == '__main__':
 			char_width_line = ""
 		
 		data = ""
-		for c in char.data:
+		for c in char_data:
 			data += "0x%02X, " % c
 		data += "// %i" % char.index
 		font_data.append(data)
-		
-		width_histogram[char.width] = width_histogram.get(char.width, 0) + 1
 	
 	if char_width_line != "":
 		char_width.append(char_width_line)
 	
+	# offset table with two bytes per character at the end of the array
+	if offset_table:
+		size += 2 * len(font.chars)
+	
+	if compress:
+		flags = ("0x80 | 0x40", "flags: glyph offset table | compressed data")
+	elif offset_table:
+		flags = ("0x80", "flags: glyph offset table")
+	else:
+		flags = ("0", "flags: none")
+	
+	substitutions = dict(substitutions)
+	substitutions.update({
+		'array_name': substitutions['array_name'] + ("Rle" if compress else ""),
+		'size_low': "0x%02X" % (size & 0xff),
+		'size_high': "0x%02X" % (size >> 8),
+		'flags': flags[0],
+		'flags_comment': flags[1],
+		'data_comment': "PackBits compressed bit field of every character" if compress else "bit field of all characters",
+		'char_width': "\n\t\t\t".join(char_width),
+		'font_data': "\n\t\t\t".join(font_data),
+	})
+	if offset_table:
+		substitutions['glyph_offset_table'] = string.Template(template_glyph_offsets).safe_substitute(
+				glyph_offsets="\n\t\t\t".join(glyph_offsets))
+	else:
+		substitutions['glyph_offset_table'] = ""
+	return (size, string.Template(template_array).safe_substitute(substitutions))
+
+# -----------------------------------------------------------------------------
+if __name__ == '__main__':
+	try:
+		filename = os.sys.argv[1]
+		if not filename.endswith('.font'):
+			raise
+		outfile = os.sys.argv[2]
+	except:
+		print "usage: %s *.font outfile" % os.sys.argv[0]
+		exit(1)
+	
+	try:
+		font = read_font_file(filename)
+	except ParseException as e:
+		print "Error in line %i: " % e.line, e
+		exit(1)
+	
+	width_histogram = {}
+	for char in font.chars:
+		width_histogram[char.width] = width_histogram.get(char.width, 0) + 1
+	
 	preferred_width = 0
 	max = 0
 	for key, value in width_histogram.items():
@@ -279,13 +378,14 @@ if __name__ == '__main__':
 			preferred_width = key
 			max = value
 	
+	if preferred_width > 255 or font.height > 255:
+		print "Error: width and height must fit into one byte"
+		exit(1)
+	
 	substitutions = {
 		'copyright': template_copyright,
 		'font_name': font.name,
 		'array_name': ''.join([s[0].upper() + s[1:] for s in font.name.split(' ')]),
-		'size': size,
-		'size_low': "0x%02X" % (size & 0xff),
-		'size_high': "0x%02X" % (size >> 8),
 		'width': preferred_width,
 		'width_string': "fixed width    " if (len(width_histogram) == 1) else "preferred width",
 		'height': font.height,
@@ -294,11 +394,25 @@ if __name__ == '__main__':
 		'first': font.first_char,
 		'last': font.first_char + len(font.chars),
 		'count': len(font.chars),
-		'char_width': "\n\t\t\t".join(char_width),
-		'font_data': "\n\t\t\t".join(font_data),
 		'include_guard': "XPCC_FONT__" + os.path.basename(outfile).upper().replace(" ", "_") + "_HPP"
 	}
 	
+	# the raw font and a version with compressed font data
+	size, array = create_array(font, substitutions, False)
+	size_rle, array_rle = create_array(font, substitutions, True)
+	
+	substitutions['size'] = size
+	substitutions['size_rle'] = size_rle
+	
+	# PackBits adds a header byte per literal run, small fonts without
+	# longer runs of equal bytes get bigger. No compressed variant for them.
+	if size_rle < size:
+		substitutions['arrays'] = array + "\n" + array_rle
+		substitutions['header_rle'] = string.Template(template_header_rle).safe_substitute(substitutions)
+	else:
+		substitutions['arrays'] = array
+		substitutions['header_rle'] = ""
+	
 	output = string.Template(template_source).safe_substitute(substitutions)
 	open(outfile + ".cpp", 'w').write(output)
 	
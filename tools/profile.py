@@ -0,0 +1,183 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# 
+# Copyright (c) 2013, Roboterclub Aachen e.V.
+# All rights reserved.
+# 
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+# 
+#  * Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+#  * Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+#  * Neither the name of the Roboterclub Aachen e.V. nor the
+#    names of its contributors may be used to endorse or promote products
+#    derived from this software without specific prior written permission.
+# 
+# THIS SOFTWARE IS PROVIDED BY ROBOTERCLUB AACHEN E.V. ''AS IS'' AND ANY
+# EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL ROBOTERCLUB AACHEN E.V. BE LIABLE FOR ANY
+# DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+# (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+# LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+# ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+# THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+# -----------------------------------------------------------------------------
+"""
+Aggregate the dumps of xpcc::profile::Profiler.
+
+Reads the output of Profiler::dump() from a file, stdin or a serial port
+and prints the number of calls and min/avg/max/percentiles of the
+duration of every zone in microseconds.
+
+Examples:
+  $ ./program | python profile.py
+  $ python profile.py log.txt
+  $ python profile.py --port /dev/ttyUSB0 --baudrate 115200 --count 10
+
+Lines which are not part of a dump (e.g. other log messages) are
+ignored. When reading from a serial port the statistics are printed
+after every dump or when the program is stopped with Ctrl+C.
+"""
+
+import sys
+import optparse
+
+class Zone:
+	def __init__(self, name):
+		self.name = name
+		self.durations = []
+	
+	def add(self, seconds):
+		self.durations.append(seconds)
+	
+	def percentile(self, p):
+		"""
+		Nearest rank percentile, 'durations' has to be sorted
+		"""
+		index = int(round(p / 100.0 * (len(self.durations) - 1)))
+		return self.durations[index]
+
+class Statistics:
+	def __init__(self):
+		self.zones = {}
+		self.dumps = 0
+		self.lost = 0
+	
+	def add_dump(self, frequency, lost, records):
+		self.dumps += 1
+		self.lost += lost
+		for name, ticks in records:
+			try:
+				zone = self.zones[name]
+			except KeyError:
+				zone = Zone(name)
+				self.zones[name] = zone
+			zone.add(float(ticks) / frequency)
+	
+	def write(self, output):
+		output.write("%-32s %8s %10s %10s %10s %10s %10s %10s\n" %
+				("zone [us]", "calls", "min", "avg", "max", "50%", "90%", "99%"))
+		for name in sorted(self.zones.keys()):
+			zone = self.zones[name]
+			zone.durations.sort()
+			values = zone.durations
+			output.write("%-32s %8i %10.2f %10.2f %10.2f %10.2f %10.2f %10.2f\n" % (
+					name, len(values),
+					values[0] * 1e6,
+					sum(values) / len(values) * 1e6,
+					values[-1] * 1e6,
+					zone.percentile(50) * 1e6,
+					zone.percentile(90) * 1e6,
+					zone.percentile(99) * 1e6))
+		output.write("%i dump(s), %i record(s) lost\n" % (self.dumps, self.lost))
+
+class Parser:
+	"""
+	Collects the lines of a dump, see Profiler::dump()
+	"""
+	def __init__(self, statistics):
+		self.statistics = statistics
+		self.records = None
+	
+	def parse(self, line):
+		"""
+		Returns True when a dump is complete
+		"""
+		line = line.strip()
+		fields = line.split('\t')
+		if fields[0] == 'profile' and len(fields) == 3:
+			try:
+				self.frequency = int(fields[1])
+				self.lost = int(fields[2])
+				self.records = []
+			except ValueError:
+				self.records = None
+		elif self.records is not None:
+			if line == 'end':
+				self.statistics.add_dump(self.frequency, self.lost, self.records)
+				self.records = None
+				return True
+			elif len(fields) == 2:
+				try:
+					self.records.append((fields[0], int(fields[1])))
+				except ValueError:
+					# broken line, discard the whole dump
+					self.records = None
+			else:
+				self.records = None
+		return False
+
+def read_serial(port, baudrate):
+	import serial
+	device = serial.Serial(port, baudrate)
+	line = []
+	while True:
+		c = device.read(1)
+		if isinstance(c, bytes):
+			c = c.decode('ascii', 'replace')
+		if c == '\n':
+			yield ''.join(line)
+			line = []
+		else:
+			line.append(c)
+
+if __name__ == '__main__':
+	parser = optparse.OptionParser(usage="%prog [options] [file]")
+	parser.add_option("-p", "--port", dest="port",
+					  help="read from a serial port instead of a file")
+	parser.add_option("-b", "--baudrate", type="int", dest="baudrate", default=115200,
+					  help="baudrate of the serial port [default: %default]")
+	parser.add_option("-c", "--count", type="int", dest="count", default=0,
+					  help="stop after this number of dumps")
+	
+	(options, args) = parser.parse_args()
+	
+	if options.port:
+		lines = read_serial(options.port, options.baudrate)
+		verbose = True
+	elif len(args) == 0 or args[0] == '-':
+		lines = sys.stdin
+		verbose = False
+	else:
+		lines = open(args[0])
+		verbose = False
+	
+	statistics = Statistics()
+	dumpParser = Parser(statistics)
+	try:
+		for line in lines:
+			if dumpParser.parse(line):
+				if options.count and statistics.dumps >= options.count:
+					break
+				if verbose:
+					statistics.write(sys.stdout)
+					sys.stdout.write("\n")
+	except KeyboardInterrupt:
+		pass
+	
+	statistics.write(sys.stdout)
@@ -31,9 +31,14 @@
 import os
 import re
 import sys
+import glob
+import json
+import time
 import subprocess
 import optparse
 
+import benchmark_compare
+
 COLOR_GREEN = ";32"
 COLOR_RED = ";31"
 COLOR_YELLOW = ";33"
@@ -172,13 +177,312 @@ def update_files():
 		except OSError:
 			pass
 
+# -----------------------------------------------------------------------------
+# Performance regression tracking with the hosted benchmarks
+#
+# Every run stores the timing of all benchmarks and the size of all symbols
+# of the benchmark executable together with the git commit in a JSON file.
+# The current build is compared against the last stored run (or a given
+# commit). Benchmarks which got slower and classes which got bigger by more
+# than the threshold are regressions.
+
+SCALING_GOVERNOR = '/sys/devices/system/cpu/cpu*/cpufreq/scaling_governor'
+
+def set_governor(governor):
+	"""
+	Set the frequency governor of all CPUs (needs root)
+	
+	Returns the previous settings for restore_governor().
+	"""
+	previous = {}
+	for path in sorted(glob.glob(SCALING_GOVERNOR)):
+		try:
+			old = open(path).read().strip()
+			if old != governor:
+				open(path, 'w').write(governor)
+				previous[path] = old
+		except IOError:
+			set_color(COLOR_YELLOW)
+			print "WARNING: could not set the CPU governor to '%s', results may be noisy!" % governor
+			set_color(COLOR_DEFAULT)
+			break
+	return previous
+
+def restore_governor(previous):
+	for path, governor in previous.items():
+		try:
+			open(path, 'w').write(governor)
+		except IOError:
+			pass
+
+def get_commit():
+	"""
+	Returns the abbreviated hash of HEAD, '-dirty' is appended when there
+	are uncommitted changes.
+	"""
+	try:
+		p = subprocess.Popen(['git', 'rev-parse', '--short', 'HEAD'],
+				stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+		commit = p.communicate()[0].strip()
+		if p.returncode != 0:
+			return 'unknown'
+		if subprocess.call(['git', 'diff', '--quiet', 'HEAD']) != 0:
+			commit += '-dirty'
+		return commit
+	except OSError:
+		return 'unknown'
+
+def symbol_group(name):
+	"""
+	Returns the class or namespace a demangled symbol belongs to
+	
+	'xpcc::IOStream::printf(char const*, ...)' -> 'xpcc::IOStream'
+	'vtable for xpcc::IOStream'                -> 'xpcc::IOStream'
+	"""
+	for prefix in ['vtable for ', 'typeinfo for ', 'typeinfo name for ']:
+		if name.startswith(prefix):
+			return name[len(prefix):]
+	if name.startswith('guard variable for '):
+		name = name[len('guard variable for '):]
+	
+	name = name.replace('(anonymous namespace)', '{anonymous}')
+	
+	# the group ends at the last '::' outside of the template
+	# parameters and before the parameter list. Template functions
+	# are prefixed with their return type.
+	depth = 0
+	start = 0
+	end = 0
+	i = 0
+	while i < len(name):
+		if depth == 0 and name.startswith('operator', i):
+			break
+		c = name[i]
+		if c == '<':
+			depth += 1
+		elif c == '>':
+			depth -= 1
+		elif c == '(' and depth == 0:
+			break
+		elif c == ' ' and depth == 0:
+			start = i + 1
+			end = start
+		elif depth == 0 and name.startswith('::', i):
+			end = i
+			i += 1
+		i += 1
+	
+	if end == start:
+		return '<global>'
+	return name[start:end]
+
+def read_symbols(output):
+	"""
+	Parse the output of 'nm -S -C --size-sort -td'
+	
+	Returns a dictionary: name -> size. Symbols with the same name
+	(e.g. static functions in different files) are summed up.
+	"""
+	symbols = {}
+	for line in output.splitlines():
+		m = re.match("\d+ (\d+) (\w) (.+)$", line.strip())
+		if m:
+			name = m.group(3)
+			symbols[name] = symbols.get(name, 0) + int(m.group(1))
+	return symbols
+
+def group_symbols(symbols):
+	groups = {}
+	for name, size in symbols.items():
+		group = symbol_group(name)
+		groups[group] = groups.get(group, 0) + size
+	return groups
+
+def compare_groups(old, new, threshold, minimum):
+	"""
+	Returns the number of classes which grew by more than threshold
+	percent and at least minimum bytes
+	"""
+	regressions = 0
+	for name in sorted(new.keys()):
+		size = new[name]
+		oldSize = old.get(name, 0)
+		if size == oldSize:
+			continue
+		
+		change = 0 if oldSize == 0 else (size - oldSize) * 100.0 / oldSize
+		if (size - oldSize) >= minimum and (oldSize == 0 or change > threshold):
+			regressions += 1
+			set_color(COLOR_RED)
+			if oldSize == 0:
+				print "REGRESSION   %s: %i bytes added" % (name, size)
+			else:
+				print "REGRESSION   %s: %i -> %i bytes (%+.1f%%)" % (name, oldSize, size, change)
+			set_color(COLOR_DEFAULT)
+		elif size < oldSize:
+			set_color(COLOR_GREEN)
+			print "IMPROVEMENT  %s: %i -> %i bytes (%+.1f%%)" % (name, oldSize, size, change)
+			set_color(COLOR_DEFAULT)
+		else:
+			print "             %s: %i -> %i bytes (%+.1f%%)" % (name, oldSize, size, change)
+	return regressions
+
+def compare_symbols(old, new):
+	"""
+	Print all symbols which changed their size
+	"""
+	for name in sorted(set(old.keys()) | set(new.keys())):
+		oldSize = old.get(name, 0)
+		size = new.get(name, 0)
+		if oldSize < size:
+			set_color(COLOR_RED)
+		elif oldSize > size:
+			set_color(COLOR_GREEN)
+		else:
+			continue
+		print "    %6i -> %6i (%+6i) %s" % (oldSize, size, size - oldSize, name)
+		set_color(COLOR_DEFAULT)
+
+def load_history(filename):
+	try:
+		return json.load(open(filename))
+	except IOError:
+		return {'runs': []}
+
+def find_reference(history, commit):
+	"""
+	Returns the latest run of the given commit, or the latest run if
+	commit is None
+	"""
+	for run in reversed(history['runs']):
+		if commit is None or run['commit'].startswith(commit):
+			return run
+	return None
+
+def print_history(history, pattern):
+	"""
+	Print the timing of all benchmarks and the size of all classes
+	matching the pattern for every stored run
+	"""
+	for run in history['runs']:
+		print "%s %s" % (run['date'], run['commit'])
+		for name in sorted(run['benchmarks'].keys()):
+			if re.search(pattern, name):
+				print "    %10.2f ns/op  %s" % (run['benchmarks'][name]['ns_per_op'], name)
+		for name in sorted(run['groups'].keys()):
+			if re.search(pattern, name):
+				print "    %10i bytes  %s" % (run['groups'][name], name)
+
+def check_benchmarks(options):
+	"""
+	Build and run the hosted benchmarks, compare the results against the
+	stored history.
+	
+	Returns the number of regressions.
+	"""
+	scons = ['scons', '-C%s' % options.source, 'target=benchmark']
+	
+	if subprocess.call(scons + ['build']) != 0:
+		set_color(COLOR_YELLOW)
+		print "ERROR: Failure when compiling the benchmarks"
+		set_color(COLOR_DEFAULT)
+		sys.exit(2)
+	
+	stdout = subprocess.Popen(scons + ['symbols'], stdout=subprocess.PIPE).communicate()[0]
+	symbols = read_symbols(stdout)
+	
+	output = os.path.abspath('regression/benchmark.json')
+	if not os.path.isdir('regression'):
+		os.makedirs('regression')
+	
+	cmd = scons + ['run', 'output=%s' % output]
+	if options.cpu is not None:
+		# keep the benchmarks on one core
+		cmd = ['taskset', '-c', options.cpu] + cmd
+	
+	previous = {}
+	if options.governor:
+		previous = set_governor(options.governor)
+	try:
+		result = subprocess.call(cmd)
+	finally:
+		restore_governor(previous)
+	
+	if result != 0:
+		set_color(COLOR_YELLOW)
+		print "ERROR: Failure when running the benchmarks"
+		set_color(COLOR_DEFAULT)
+		sys.exit(2)
+	
+	run = {
+		'commit': get_commit(),
+		'date': time.strftime('%Y-%m-%d %H:%M:%S'),
+		'benchmarks': benchmark_compare.load_results(output),
+		'symbols': symbols,
+		'groups': group_symbols(symbols),
+	}
+	
+	history = load_history(options.database)
+	reference = find_reference(history, options.reference)
+	
+	regressions = 0
+	if reference is None:
+		print "WARNING: no reference found in '%s'!" % options.database
+	else:
+		print "\nCompare against %s (%s):\n" % (reference['commit'], reference['date'])
+		regressions += benchmark_compare.compare(reference['benchmarks'],
+				run['benchmarks'], options.threshold)
+		print
+		regressions += compare_groups(reference['groups'], run['groups'],
+				options.sizeThreshold, options.minimum)
+		if options.verbose:
+			print
+			compare_symbols(reference['symbols'], run['symbols'])
+	
+	if options.update:
+		history['runs'].append(run)
+		json.dump(history, open(options.database, 'w'), indent=1, sort_keys=True)
+	
+	if regressions > 0:
+		print "\n%i regression(s)" % regressions
+	return regressions
+
 if __name__ == '__main__':
 	parser = optparse.OptionParser()
 	parser.add_option("-v", "--verbose", action="store_true", dest="verbose")
 	parser.add_option("-u", "--update", action="store_true", dest="update")
+	parser.add_option("-b", "--benchmark", action="store_true", dest="benchmark",
+					  help="track the hosted benchmarks instead of the example sizes")
+	parser.add_option("-t", "--threshold", type="float", dest="threshold", default=10.0,
+					  help="allowed slowdown of a benchmark in percent [default: %default]")
+	parser.add_option("-s", "--size-threshold", type="float", dest="sizeThreshold", default=10.0,
+					  help="allowed growth of a class in percent [default: %default]")
+	parser.add_option("-m", "--minimum", type="int", dest="minimum", default=16,
+					  help="ignore classes growing by less bytes [default: %default]")
+	parser.add_option("-r", "--reference", dest="reference", default=None,
+					  help="compare against this commit instead of the last run")
+	parser.add_option("--database", dest="database", default="regression/history.json",
+					  help="history of the benchmark runs [default: %default]")
+	parser.add_option("--source", dest="source", default="../src",
+					  help="path to the benchmarks [default: %default]")
+	parser.add_option("--governor", dest="governor", default="performance",
+					  help="CPU governor during the run, empty to keep the current one [default: %default]")
+	parser.add_option("--cpu", dest="cpu", default=None,
+					  help="run the benchmarks only on this CPU (uses taskset)")
+	parser.add_option("--history", dest="history", default=None,
+					  help="print the stored results of all benchmarks and classes matching the regex")
 	
 	(options, args) = parser.parse_args()
 	
+	if options.history is not None:
+		print_history(load_history(options.database), options.history)
+		sys.exit(0)
+	
+	if options.benchmark:
+		if check_benchmarks(options) > 0:
+			sys.exit(1)
+		sys.exit(0)
+	
 	if len(args) == 0:
 		dir = '../examples'
 	else: